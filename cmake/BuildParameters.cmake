@@ -33,6 +33,14 @@ endif()
 
 option(USE_VTUNE "Plug VTUNE to profile GS JIT.")
 
+# Release builds still carry the pxAssertRel report branches; this compiles them out
+# entirely for end-user/benchmark binaries. Has no effect on Debug/Devel builds.
+option(DIST_BUILD "Compile out release-mode assertion branches (distribution option)")
+if(DIST_BUILD)
+	message(STATUS "Compiling out release-mode assertion branches (distribution build).")
+	list(APPEND PCSX2_DEFS PCSX2_DISTBUILD)
+endif()
+
 #-------------------------------------------------------------------------------
 # Graphical option
 #-------------------------------------------------------------------------------
@@ -0,0 +1,214 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/Threading.h"
+#include "common/Console.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include "common/RedtapeWindows.h"
+#include <vector>
+#endif
+
+// --------------------------------------------------------------------------------------
+//  Thread placement policy  (implementation)
+// --------------------------------------------------------------------------------------
+// Topology detection runs once, on first use.  Sources, in order of priority:
+//
+//  1. PCSX2_PCORE_MASK / PCSX2_ECORE_MASK environment variables (hex masks), for
+//     deployments that know better than the heuristics below.
+//  2. Linux: the sysfs cpu lists the kernel publishes for hybrid parts
+//     (/sys/devices/cpu_core and /sys/devices/cpu_atom).
+//  3. Windows: GetLogicalProcessorInformationEx, splitting cores by EfficiencyClass.
+//
+// When every core looks the same (or nothing can be detected) both masks stay 0 and
+// the whole policy collapses to "leave it to the OS scheduler", which is exactly the
+// pre-policy behavior.
+
+namespace
+{
+	struct AffinityPolicy
+	{
+		u64 pcore_mask;
+		u64 ecore_mask;
+
+		AffinityPolicy()
+		{
+			pcore_mask = 0;
+			ecore_mask = 0;
+		}
+	};
+} // namespace
+
+static u64 ParseMaskEnv(const char* name)
+{
+	const char* value = getenv(name);
+	if (!value || !*value)
+		return 0;
+	return strtoull(value, NULL, 16);
+}
+
+#ifdef __linux__
+// Parses the kernel's cpu list format ("0-7,16-23") into a bitmask; processors
+// past the first 64 are ignored.
+static u64 ReadCpuListMask(const char* path)
+{
+	FILE* file = fopen(path, "r");
+	if (!file)
+		return 0;
+
+	char buf[256];
+	const bool ok = (fgets(buf, sizeof(buf), file) != NULL);
+	fclose(file);
+	if (!ok)
+		return 0;
+
+	u64 mask = 0;
+	const char* p = buf;
+	while (*p)
+	{
+		char* end;
+		long first = strtol(p, &end, 10);
+		if (end == p)
+			break;
+
+		long last = first;
+		p = end;
+		if (*p == '-')
+		{
+			last = strtol(p + 1, &end, 10);
+			p = end;
+		}
+
+		for (long i = first; (i <= last) && (i < 64); ++i)
+		{
+			if (i >= 0)
+				mask |= (u64)1 << i;
+		}
+
+		if (*p == ',')
+			++p;
+	}
+	return mask;
+}
+#endif
+
+#ifdef _WIN32
+static void DetectHybridMasks(u64& pcores, u64& ecores)
+{
+	DWORD len = 0;
+	GetLogicalProcessorInformationEx(RelationProcessorCore, NULL, &len);
+	if ((GetLastError() != ERROR_INSUFFICIENT_BUFFER) || !len)
+		return;
+
+	std::vector<u8> buffer(len);
+	SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* info =
+		(SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)buffer.data();
+	if (!GetLogicalProcessorInformationEx(RelationProcessorCore, info, &len))
+		return;
+
+	// First pass figures out whether there's more than one efficiency class at
+	// all; homogeneous parts report 0 for everything.
+	BYTE max_class = 0;
+	bool hybrid = false;
+	for (DWORD offset = 0; offset < len;)
+	{
+		const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* cur =
+			(const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(buffer.data() + offset);
+		if (cur->Processor.EfficiencyClass != max_class)
+		{
+			hybrid = (offset != 0);
+			if (cur->Processor.EfficiencyClass > max_class)
+				max_class = cur->Processor.EfficiencyClass;
+		}
+		offset += cur->Size;
+	}
+	if (!hybrid)
+		return;
+
+	// Higher EfficiencyClass means higher performance.  Only the first processor
+	// group is considered; 64+ thread machines don't need our help.
+	for (DWORD offset = 0; offset < len;)
+	{
+		const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* cur =
+			(const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(buffer.data() + offset);
+		if (cur->Processor.GroupCount > 0 && cur->Processor.GroupMask[0].Group == 0)
+		{
+			if (cur->Processor.EfficiencyClass == max_class)
+				pcores |= (u64)cur->Processor.GroupMask[0].Mask;
+			else
+				ecores |= (u64)cur->Processor.GroupMask[0].Mask;
+		}
+		offset += cur->Size;
+	}
+}
+#endif
+
+static const AffinityPolicy& GetPolicy()
+{
+	static AffinityPolicy policy;
+	static bool initialized = false;
+
+	// First use is during thread startup before much concurrency exists; a
+	// benign double-init would compute identical masks anyway.
+	if (!initialized)
+	{
+		initialized = true;
+
+		policy.pcore_mask = ParseMaskEnv("PCSX2_PCORE_MASK");
+		policy.ecore_mask = ParseMaskEnv("PCSX2_ECORE_MASK");
+
+		if (policy.pcore_mask || policy.ecore_mask)
+		{
+			Console.WriteLn("(AffinityPolicy) Using deployment override: P=0x%llx E=0x%llx",
+				(unsigned long long)policy.pcore_mask, (unsigned long long)policy.ecore_mask);
+			return policy;
+		}
+
+#ifdef __linux__
+		policy.pcore_mask = ReadCpuListMask("/sys/devices/cpu_core/cpus");
+		policy.ecore_mask = ReadCpuListMask("/sys/devices/cpu_atom/cpus");
+#elif defined(_WIN32)
+		DetectHybridMasks(policy.pcore_mask, policy.ecore_mask);
+#endif
+
+		if (policy.pcore_mask && policy.ecore_mask)
+		{
+			Console.WriteLn("(AffinityPolicy) Hybrid topology detected: performance=0x%llx efficiency=0x%llx",
+				(unsigned long long)policy.pcore_mask, (unsigned long long)policy.ecore_mask);
+		}
+		else
+		{
+			// Need both halves to make meaningful placement decisions.
+			policy.pcore_mask = 0;
+			policy.ecore_mask = 0;
+		}
+	}
+
+	return policy;
+}
+
+u64 Threading::GetRoleAffinityMask(ThreadRole role)
+{
+	const AffinityPolicy& policy = GetPolicy();
+	return (role == ThreadRole_Background) ? policy.ecore_mask : policy.pcore_mask;
+}
+
+void Threading::SetRoleAffinity(ThreadRole role)
+{
+	SetProcessorAffinity(GetRoleAffinityMask(role));
+}
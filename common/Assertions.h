@@ -108,10 +108,25 @@ extern pxDoAssertFnType* pxDoAssert;
 // (especially with LTCG) are highly suspect.  But when troubleshooting crashes that only
 // rear ugly heads in optimized builds, this is one of the few tools we have.
 
+#if defined(PCSX2_DISTBUILD) && !defined(PCSX2_DEVBUILD) && !defined(PCSX2_DEBUG)
+
+// Distribution builds (-DDIST_BUILD=ON) strip even the release-mode assertions down to
+// plain optimization hints, so no cold report branches are emitted into hot loops at all.
+// Only use this for end-user/benchmark binaries -- crashes in these builds give you
+// nothing to work with.
+
+#define pxAssertRel(cond, msg) (likely(cond))
+#define pxAssumeRel(cond, msg) (__assume(cond))
+#define pxFailRel(msg) ((void)0)
+
+#else
+
 #define pxAssertRel(cond, msg) ((likely(cond)) || (pxOnAssert(pxAssertSpot(cond), msg), false))
 #define pxAssumeRel(cond, msg) ((void)((!likely(cond)) && (pxOnAssert(pxAssertSpot(cond), msg), false)))
 #define pxFailRel(msg) pxAssertRel(false, msg)
 
+#endif
+
 #if defined(PCSX2_DEBUG)
 
 #define pxAssertMsg(cond, msg) pxAssertRel(cond, msg)
@@ -0,0 +1,107 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/BumpArena.h"
+#include "common/ScopedAlloc.h"
+
+#include <algorithm>
+
+BumpArena::BumpArena(size_t chunk_size)
+	: m_chunk_size(chunk_size)
+	, m_current(0)
+	, m_pos(0)
+	, m_used(0)
+{
+}
+
+BumpArena::~BumpArena()
+{
+	for (Chunk& chunk : m_chunks)
+		_aligned_free(chunk.mem);
+}
+
+void* BumpArena::Alloc(size_t bytes, size_t align)
+{
+	pxAssume((align & (align - 1)) == 0);
+
+	if (!m_chunks.empty())
+	{
+		Chunk& chunk = m_chunks[m_current];
+		size_t pos = (m_pos + align - 1) & ~(align - 1);
+		if (pos + bytes <= chunk.size)
+		{
+			m_pos = pos + bytes;
+			m_used += bytes;
+			return chunk.mem + pos;
+		}
+	}
+
+	return AllocSlow(bytes, align);
+}
+
+void* BumpArena::AllocSlow(size_t bytes, size_t align)
+{
+	// Move to the next retained chunk, or grow.  Chunks are aligned to at least
+	// 64 bytes, so any in-chunk alignment up to that holds from a fresh cursor.
+	while (m_current + 1 < m_chunks.size())
+	{
+		++m_current;
+		m_pos = 0;
+		if (bytes <= m_chunks[m_current].size)
+			return Alloc(bytes, align);
+	}
+
+	// Oversized requests get a chunk of their own so they don't poison the
+	// steady-state chunk size.
+	Chunk chunk;
+	chunk.size = std::max(bytes, m_chunk_size);
+	chunk.mem = (u8*)_aligned_malloc(chunk.size, std::max<size_t>(align, 64));
+	if (!chunk.mem)
+		throw std::bad_alloc();
+
+	m_chunks.push_back(chunk);
+	m_current = m_chunks.size() - 1;
+	m_pos = bytes;
+	m_used += bytes;
+	return chunk.mem;
+}
+
+void BumpArena::Reset()
+{
+	// Keep enough capacity for a frame like this one (with some slack), and give
+	// anything beyond that back -- a single pathological frame shouldn't pin its
+	// high-water mark forever.
+	size_t keep = std::max(m_used * 2, m_chunk_size);
+	size_t total = 0;
+	size_t i = 0;
+	for (; i < m_chunks.size() && total < keep; ++i)
+		total += m_chunks[i].size;
+
+	for (size_t j = i; j < m_chunks.size(); ++j)
+		_aligned_free(m_chunks[j].mem);
+	m_chunks.resize(i);
+
+	m_current = 0;
+	m_pos = 0;
+	m_used = 0;
+}
+
+size_t BumpArena::GetCapacity() const
+{
+	size_t total = 0;
+	for (const Chunk& chunk : m_chunks)
+		total += chunk.size;
+	return total;
+}
@@ -0,0 +1,73 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Dependencies.h"
+
+#include <new>
+#include <utility>
+#include <vector>
+
+// --------------------------------------------------------------------------------------
+//  BumpArena
+// --------------------------------------------------------------------------------------
+// Chunked bump allocator for transient allocations with a common lifetime, such as
+// per-frame draw data.  Alloc is a pointer increment; nothing is freed individually.
+// Reset() rewinds the arena for the next frame, keeping (most of) the chunks so a
+// steady-state frame performs no heap calls at all.
+//
+// Not thread-safe: allocation and Reset must stay on the owning thread.  Objects
+// created with New() get their destructor run by the owner, not the arena -- the
+// arena only reclaims the memory.
+class BumpArena
+{
+	DeclareNoncopyableObject(BumpArena);
+
+protected:
+	struct Chunk
+	{
+		u8* mem;
+		size_t size;
+	};
+
+	std::vector<Chunk> m_chunks;
+	size_t m_chunk_size;
+	size_t m_current; // chunk the cursor lives in
+	size_t m_pos;     // cursor offset within the current chunk
+	size_t m_used;    // bytes handed out since the last Reset (for trimming)
+
+	void* AllocSlow(size_t bytes, size_t align);
+
+public:
+	BumpArena(size_t chunk_size = _1mb);
+	~BumpArena();
+
+	void* Alloc(size_t bytes, size_t align = 16);
+
+	// Typed helper; the caller owns the object's lifetime and must run the
+	// destructor itself (or via a no-op-free smart pointer deleter) before Reset.
+	template <typename T, typename... Args>
+	T* New(Args&&... args)
+	{
+		return new (Alloc(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+	}
+
+	// Rewinds the arena.  All memory handed out since the previous Reset becomes
+	// invalid; chunks well beyond this frame's usage are returned to the heap.
+	void Reset();
+
+	size_t GetCapacity() const;
+};
@@ -16,44 +16,53 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <type_traits>
 #include "common/Threading.h"
 
 // --------------------------------------------------------------------------------------
 //  EventSource< template EvtType >
 // --------------------------------------------------------------------------------------
-
-template <typename ListenerType>
+// Listener registration (Add/Remove) is mutex-protected and rebuilds an immutable
+// snapshot of the listener list, which is what Dispatch() walks.  Dispatching thus
+// never takes the lock, which matters on the paths that fire during emulation
+// (page faults, CoreThread status).  It also means listeners may safely add or
+// remove listeners -- including themselves -- from within a dispatch; the walk in
+// progress simply finishes against the old snapshot.
+//
+// Sources that need custom fan-out semantics pass themselves as DerivedSource and
+// shadow _DispatchRaw() (see SrcType_PageFault); the call binds at compile time, so
+// there's no vtable hop per event.
+//
+template <typename ListenerType, typename DerivedSource = void>
 class EventSource
 {
 public:
 	typedef typename ListenerType::EvtParams EvtParams;
 	typedef typename std::list<ListenerType*> ListenerList;
 	typedef typename ListenerList::iterator ListenerIterator;
+	typedef typename ListenerList::const_iterator ConstIterator;
 
 protected:
-	typedef typename ListenerList::const_iterator ConstIterator;
+	// Resolves to the derived source when one is given, or to ourselves when the
+	// default dispatch behavior suffices.
+	typedef typename std::conditional<std::is_void<DerivedSource>::value, EventSource, DerivedSource>::type DispatchType;
 
 	ListenerList m_listeners;
 
-	// This is a cached copy of the listener list used to handle standard dispatching, which
-	// allows for self-modification of the EventSource's listener list by the listeners.
-	// Translation: The dispatcher uses this copy instead, to avoid iterator invalidation.
-	ListenerList m_cache_copy;
-	bool m_cache_valid;
+	// Snapshot of m_listeners taken whenever the list is modified, and published
+	// atomically.  NULL when there are no listeners at all.
+	std::shared_ptr<const ListenerList> m_snapshot;
 
 	Threading::Mutex m_listeners_lock;
 
 public:
-	EventSource()
-	{
-		m_cache_valid = false;
-	}
-
+	EventSource() = default;
 	virtual ~EventSource() = default;
 
-	virtual ListenerIterator Add(ListenerType& listener);
-	virtual void Remove(ListenerType& listener);
-	virtual void Remove(const ListenerIterator& listenerHandle);
+	ListenerIterator Add(ListenerType& listener);
+	void Remove(ListenerType& listener);
+	void Remove(const ListenerIterator& listenerHandle);
 
 	void Add(ListenerType* listener)
 	{
@@ -72,8 +81,9 @@ public:
 	void Dispatch(const EvtParams& params);
 
 protected:
-	virtual ListenerIterator _AddFast_without_lock(ListenerType& listener);
-	virtual void _DispatchRaw(ListenerIterator iter, const ListenerIterator& iend, const EvtParams& params);
+	ListenerIterator _AddFast_without_lock(ListenerType& listener);
+	void _DispatchRaw(ConstIterator iter, const ConstIterator& iend, const EvtParams& params);
+	void _PublishSnapshot_without_lock();
 };
 
 // --------------------------------------------------------------------------------------
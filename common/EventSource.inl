@@ -19,8 +19,8 @@
 
 using Threading::ScopedLock;
 
-template <typename ListenerType>
-typename EventSource<ListenerType>::ListenerIterator EventSource<ListenerType>::Add(ListenerType& listener)
+template <typename ListenerType, typename DerivedSource>
+typename EventSource<ListenerType, DerivedSource>::ListenerIterator EventSource<ListenerType, DerivedSource>::Add(ListenerType& listener)
 {
 	ScopedLock locker(m_listeners_lock);
 
@@ -38,33 +38,44 @@ typename EventSource<ListenerType>::ListenerIterator EventSource<ListenerType>::
 	return _AddFast_without_lock(listener);
 }
 
-template <typename ListenerType>
-void EventSource<ListenerType>::Remove(ListenerType& listener)
+template <typename ListenerType, typename DerivedSource>
+void EventSource<ListenerType, DerivedSource>::Remove(ListenerType& listener)
 {
 	ScopedLock locker(m_listeners_lock);
-	m_cache_valid = false;
 	m_listeners.remove(&listener);
+	_PublishSnapshot_without_lock();
 }
 
-template <typename ListenerType>
-void EventSource<ListenerType>::Remove(const ListenerIterator& listenerHandle)
+template <typename ListenerType, typename DerivedSource>
+void EventSource<ListenerType, DerivedSource>::Remove(const ListenerIterator& listenerHandle)
 {
 	ScopedLock locker(m_listeners_lock);
-	m_cache_valid = false;
 	m_listeners.erase(listenerHandle);
+	_PublishSnapshot_without_lock();
 }
 
-template <typename ListenerType>
-typename EventSource<ListenerType>::ListenerIterator EventSource<ListenerType>::_AddFast_without_lock(ListenerType& listener)
+template <typename ListenerType, typename DerivedSource>
+typename EventSource<ListenerType, DerivedSource>::ListenerIterator EventSource<ListenerType, DerivedSource>::_AddFast_without_lock(ListenerType& listener)
 {
-	m_cache_valid = false;
 	m_listeners.push_front(&listener);
+	_PublishSnapshot_without_lock();
 	return m_listeners.begin();
 }
 
+// Rebuilds the immutable dispatch snapshot from the live listener list.  The atomic
+// store pairs with the atomic load in Dispatch(), which is the one accessor that
+// doesn't hold m_listeners_lock.
+template <typename ListenerType, typename DerivedSource>
+void EventSource<ListenerType, DerivedSource>::_PublishSnapshot_without_lock()
+{
+	std::shared_ptr<const ListenerList> snapshot;
+	if (!m_listeners.empty())
+		snapshot = std::make_shared<ListenerList>(m_listeners);
+	std::atomic_store(&m_snapshot, snapshot);
+}
 
-template <typename ListenerType>
-__fi void EventSource<ListenerType>::_DispatchRaw(ListenerIterator iter, const ListenerIterator& iend, const EvtParams& evtparams)
+template <typename ListenerType, typename DerivedSource>
+__fi void EventSource<ListenerType, DerivedSource>::_DispatchRaw(ConstIterator iter, const ConstIterator& iend, const EvtParams& evtparams)
 {
 	while (iter != iend)
 	{
@@ -96,16 +107,11 @@ __fi void EventSource<ListenerType>::_DispatchRaw(ListenerIterator iter, const L
 	}
 }
 
-template <typename ListenerType>
-void EventSource<ListenerType>::Dispatch(const EvtParams& evtparams)
+template <typename ListenerType, typename DerivedSource>
+void EventSource<ListenerType, DerivedSource>::Dispatch(const EvtParams& evtparams)
 {
-	if (!m_cache_valid)
-	{
-		m_cache_copy = m_listeners;
-		m_cache_valid = true;
-	}
-
-	if (m_cache_copy.empty())
+	const std::shared_ptr<const ListenerList> snapshot(std::atomic_load(&m_snapshot));
+	if (!snapshot)
 		return;
-	_DispatchRaw(m_cache_copy.begin(), m_cache_copy.end(), evtparams);
+	static_cast<DispatchType*>(this)->_DispatchRaw(snapshot->begin(), snapshot->end(), evtparams);
 }
@@ -16,6 +16,7 @@
 #include "common/Pcsx2Defs.h"
 #include "common/SafeArray.inl"
 #include "common/StringHelpers.h"
+#include "common/Threading.h"
 
 // Implement some very commonly used SafeArray types here
 // (done here for lack of a better place)
@@ -33,6 +34,75 @@ template class SafeAlignedArray<u8, 16>;
 // system deadlock.
 static const int MaxFormattedStringLength = 0x80000;
 
+// --------------------------------------------------------------------------------------
+//  FormatBufferCache
+// --------------------------------------------------------------------------------------
+// Formatters are created and discarded for nearly every log call, so allocating their
+// 2k scratch buffer from the heap each time adds up on chatty titles (IOP printf spam
+// being the classic offender).  Each thread retains a few buffers and hands them out to
+// live formatters; a thread somehow running more formatters than that at once just
+// falls back to a plain heap allocation for the extras.
+
+namespace
+{
+	class FormatBufferCache
+	{
+		static const uint MaxCached = 4;
+
+		CharBufferType* m_buffers[MaxCached];
+		bool m_inuse[MaxCached];
+
+	public:
+		FormatBufferCache()
+		{
+			for (uint i = 0; i < MaxCached; ++i)
+			{
+				m_buffers[i] = NULL;
+				m_inuse[i] = false;
+			}
+		}
+
+		~FormatBufferCache()
+		{
+			for (uint i = 0; i < MaxCached; ++i)
+				delete m_buffers[i];
+		}
+
+		CharBufferType* Acquire()
+		{
+			for (uint i = 0; i < MaxCached; ++i)
+			{
+				if (m_inuse[i])
+					continue;
+				if (!m_buffers[i])
+					m_buffers[i] = new CharBufferType(2048);
+				m_inuse[i] = true;
+				return m_buffers[i];
+			}
+			return new CharBufferType(2048);
+		}
+
+		void Release(CharBufferType* buffer)
+		{
+			for (uint i = 0; i < MaxCached; ++i)
+			{
+				if (buffer != m_buffers[i])
+					continue;
+
+				// Don't let one monster message pin a huge buffer to the thread forever.
+				if (buffer->GetLength() > (size_t)_64kb)
+					buffer->Resize(2048);
+
+				m_inuse[i] = false;
+				return;
+			}
+			delete buffer;
+		}
+	};
+} // namespace
+
+static DeclareTls(FormatBufferCache) s_format_buffers;
+
 #ifndef __linux__
 static __ri void format_that_ascii_mess(CharBufferType& buffer, uint writepos, const char* fmt, va_list argptr)
 #else
@@ -127,15 +197,20 @@ static uint format_that_unicode_mess(CharBufferType& buffer, uint writepos, cons
 // this class nicely in its current state. --air
 
 FastFormatUnicode::FastFormatUnicode()
-	: m_dest(2048)
+	: m_dest(s_format_buffers.Acquire())
 {
 	Clear();
 }
 
+FastFormatUnicode::~FastFormatUnicode()
+{
+	s_format_buffers.Release(m_dest);
+}
+
 void FastFormatUnicode::Clear()
 {
 	m_Length = 0;
-	((wxChar*)m_dest.GetPtr())[0] = 0;
+	((wxChar*)m_dest->GetPtr())[0] = 0;
 }
 
 FastFormatUnicode& FastFormatUnicode::WriteV(const char* fmt, va_list argptr)
@@ -144,8 +219,8 @@ FastFormatUnicode& FastFormatUnicode::WriteV(const char* fmt, va_list argptr)
 
 	const uint inspos = m_Length;
 	const uint convLen = converted.Length();
-	m_dest.MakeRoomFor((inspos + convLen + 64) * sizeof(wxChar));
-	memcpy(&((wxChar*)m_dest.GetPtr())[inspos], converted.wc_str(), (convLen + 1) * sizeof(wxChar));
+	m_dest->MakeRoomFor((inspos + convLen + 64) * sizeof(wxChar));
+	memcpy(&((wxChar*)m_dest->GetPtr())[inspos], converted.wc_str(), (convLen + 1) * sizeof(wxChar));
 	m_Length += convLen;
 
 	return *this;
@@ -153,7 +228,7 @@ FastFormatUnicode& FastFormatUnicode::WriteV(const char* fmt, va_list argptr)
 
 FastFormatUnicode& FastFormatUnicode::WriteV(const wxChar* fmt, va_list argptr)
 {
-	m_Length = format_that_unicode_mess(m_dest, m_Length, fmt, argptr);
+	m_Length = format_that_unicode_mess(*m_dest, m_Length, fmt, argptr);
 	return *this;
 }
 
@@ -186,12 +261,12 @@ FastFormatUnicode& FastFormatUnicode::Write(const wxString fmt, ...)
 
 bool FastFormatUnicode::IsEmpty() const
 {
-	return ((wxChar&)m_dest[0]) == 0;
+	return ((wxChar&)(*m_dest)[0]) == 0;
 }
 
 FastFormatUnicode& FastFormatUnicode::ToUpper()
 {
-	wxChar* ch = (wxChar*)m_dest.GetPtr();
+	wxChar* ch = (wxChar*)m_dest->GetPtr();
 	for (uint i = 0; i < m_Length; ++i, ++ch)
 		*ch = (wxChar)wxToupper(*ch);
 
@@ -200,7 +275,7 @@ FastFormatUnicode& FastFormatUnicode::ToUpper()
 
 FastFormatUnicode& FastFormatUnicode::ToLower()
 {
-	wxChar* ch = (wxChar*)m_dest.GetPtr();
+	wxChar* ch = (wxChar*)m_dest->GetPtr();
 	for (uint i = 0; i < m_Length; ++i, ++ch)
 		*ch = (wxChar)wxTolower(*ch);
 
@@ -252,24 +327,29 @@ wxString operator+(const FastFormatUnicode& str1, const wxChar* str2)
 //  FastFormatAscii  (implementations)
 // --------------------------------------------------------------------------------------
 FastFormatAscii::FastFormatAscii()
-	: m_dest(2048)
+	: m_dest(s_format_buffers.Acquire())
 {
 	Clear();
 }
 
+FastFormatAscii::~FastFormatAscii()
+{
+	s_format_buffers.Release(m_dest);
+}
+
 void FastFormatAscii::Clear()
 {
-	m_dest.GetPtr()[0] = 0;
+	m_dest->GetPtr()[0] = 0;
 }
 
 const wxString FastFormatAscii::GetString() const
 {
-	return fromAscii(m_dest.GetPtr());
+	return fromAscii(m_dest->GetPtr());
 }
 
 FastFormatAscii& FastFormatAscii::WriteV(const char* fmt, va_list argptr)
 {
-	format_that_ascii_mess(m_dest, strlen(m_dest.GetPtr()), fmt, argptr);
+	format_that_ascii_mess(*m_dest, strlen(m_dest->GetPtr()), fmt, argptr);
 	return *this;
 }
 
@@ -285,5 +365,5 @@ FastFormatAscii& FastFormatAscii::Write(const char* fmt, ...)
 
 bool FastFormatAscii::IsEmpty() const
 {
-	return m_dest[0] == 0;
+	return (*m_dest)[0] == 0;
 }
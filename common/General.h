@@ -248,6 +248,26 @@ namespace HostSys
 
 	extern void MemProtect(void* baseaddr, size_t size, const PageProtectionMode& mode);
 
+	// Advises the OS that the given range would benefit from being backed by large
+	// (2MB) pages where available.  Purely a hint; platforms or kernels without
+	// support leave the regular 4k backing in place.
+	extern void AdviseHugePages(void* base, size_t size);
+
+	// Maps the first 'size' bytes (page aligned) of the given file copy-on-write over
+	// an already-mapped address range.  Pages stay backed by the OS page cache until
+	// written to, so processes mapping the same file share a single physical copy.
+	// Returns false if the platform can't replace part of an existing mapping this
+	// way (Windows), or if the mapping fails; in either case the original mapping at
+	// base is left intact and the caller should fall back to a plain read.
+	extern bool MmapFilePtr(void* base, size_t size, const wxString& filename);
+
+	// Maps an entire file read-only at an OS-chosen address, returning the base (or
+	// NULL on failure) and storing the file's size in 'size'.  The mapping is backed
+	// by the page cache, so every process mapping the same file shares one physical
+	// copy of it.  Release with MunmapFile.
+	extern void* MmapFile(const wxString& filename, size_t& size);
+	extern void MunmapFile(void* base, size_t size);
+
 	extern void Munmap(void* base, size_t size);
 
 	template <uint size>
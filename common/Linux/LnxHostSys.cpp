@@ -18,6 +18,8 @@
 #include <sys/mman.h>
 #include <signal.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include "common/PageFaultSource.h"
@@ -218,6 +220,62 @@ void HostSys::Munmap(uptr base, size_t size)
 	munmap((void*)base, size);
 }
 
+bool HostSys::MmapFilePtr(void* base, size_t size, const wxString& filename)
+{
+	PageSizeAssertionTest(size);
+
+	const int fd = open(filename.fn_str(), O_RDONLY);
+	if (fd == -1)
+		return false;
+
+	// MAP_FIXED replaces the existing pages of the target range, but only on success;
+	// a failed mapping leaves the original range untouched.  The fd can be closed
+	// right away, the mapping keeps its own reference to the file.
+	void* result = mmap(base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+	close(fd);
+	return result != MAP_FAILED;
+}
+
+void* HostSys::MmapFile(const wxString& filename, size_t& size)
+{
+	size = 0;
+
+	const int fd = open(filename.fn_str(), O_RDONLY);
+	if (fd == -1)
+		return NULL;
+
+	struct stat info;
+	if ((fstat(fd, &info) == -1) || (info.st_size <= 0))
+	{
+		close(fd);
+		return NULL;
+	}
+
+	void* result = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (result == MAP_FAILED)
+		return NULL;
+
+	size = info.st_size;
+	return result;
+}
+
+void HostSys::MunmapFile(void* base, size_t size)
+{
+	if (!base)
+		return;
+	munmap(base, size);
+}
+
+void HostSys::AdviseHugePages(void* base, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+	// Advisory only: failure just means the kernel was built without transparent
+	// hugepage support, in which case the mapping stays 4k-backed as before.
+	madvise(base, size, MADV_HUGEPAGE);
+#endif
+}
+
 void HostSys::MemProtect(void* baseaddr, size_t size, const PageProtectionMode& mode)
 {
 	if (!_memprotect(baseaddr, size, mode))
@@ -60,6 +60,25 @@ __forceinline void Threading::DisableHiresScheduler()
 {
 }
 
+void Threading::SetProcessorAffinity(u64 mask)
+{
+	if (!mask)
+		return;
+
+#if defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+
+	for (uint i = 0; i < 64; ++i)
+	{
+		if (mask & ((u64)1 << i))
+			CPU_SET(i, &set);
+	}
+
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
 // Unit of time of GetThreadCpuTime/GetCpuTime
 u64 Threading::GetThreadTicksPerSecond()
 {
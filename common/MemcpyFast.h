@@ -27,6 +27,21 @@ extern u8 memcmp_mmx(const void* src1, const void* src2, int cmpsize);
 #define memcmp_mmx memcmp
 #endif
 
+// Runtime-dispatched bulk copy.  On CPUs with Enhanced REP MOVSB a bare
+// rep movsb beats SSE copy loops for large blocks and handles any alignment;
+// everywhere else this is just memcpy.  Use it for copies that are usually
+// several KB or more -- for small fixed sizes plain memcpy inlines better.
+extern void memcpy_fast(void* dest, const void* src, size_t size);
+
+// Bulk copy using non-temporal stores: the destination bypasses the cache
+// hierarchy, so multi-hundred-KB transfers (GS image uploads, DMA bursts the
+// EE won't read back) don't evict hot data such as recompiled code.  Any
+// alignment and size are accepted; ends with an sfence, so the data is
+// globally visible before any subsequent store that publishes it.  Only use
+// this when the destination won't be read again soon -- a consumer chasing
+// non-temporal data pays a trip to DRAM instead of hitting the shared LLC.
+extern void memcpy_nt(void* dest, const void* src, size_t size);
+
 // This method can clear any object-like entity -- which is anything that is not a pointer.
 // Structures, static arrays, etc.  No need to include sizeof() crap, this does it automatically
 // for you!
@@ -0,0 +1,61 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/MemoryAccount.h"
+#include "common/Console.h"
+
+#include <atomic>
+
+namespace MemAccount
+{
+	static const char* AccountNames[Id_Count] = {
+		"VM commit",
+		"rec cache",
+		"GS surface pool",
+		"GS texture cache",
+	};
+
+	static std::atomic<s64> s_bytes[Id_Count];
+
+	void Add(Id id, sptr bytes)
+	{
+		s_bytes[id].fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	void Set(Id id, u64 bytes)
+	{
+		s_bytes[id].store((s64)bytes, std::memory_order_relaxed);
+	}
+
+	u64 Get(Id id)
+	{
+		const s64 bytes = s_bytes[id].load(std::memory_order_relaxed);
+		return bytes > 0 ? (u64)bytes : 0;
+	}
+
+	void Report()
+	{
+		u64 total = 0;
+
+		Console.WriteLn("Memory usage by subsystem:");
+		for (int id = 0; id < Id_Count; id++)
+		{
+			const u64 bytes = Get((Id)id);
+			total += bytes;
+			Console.WriteLn("  %-18s %6llu KB", AccountNames[id], (unsigned long long)(bytes / 1024));
+		}
+		Console.WriteLn("  %-18s %6llu KB", "total tracked", (unsigned long long)(total / 1024));
+	}
+} // namespace MemAccount
@@ -0,0 +1,48 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Pcsx2Types.h"
+
+// Per-subsystem accounting of the large runtime memory consumers.  The owners
+// of the tracked allocations update their account as memory is committed and
+// released (or mirror an absolute figure once per frame, for the GS caches),
+// so a report of where the process memory went is available at any time.
+// Budget enforcement stays with the owning subsystem -- see GSDevice::Recycle
+// and GSTextureCache::IncAge -- since only the owner knows how to evict.
+namespace MemAccount
+{
+	enum Id
+	{
+		Id_VmCommit, // pages committed into the main VM reserve (see VirtualMemoryReserve)
+		Id_RecCache, // recompiled code buffers (RecompiledCodeReserve)
+		Id_GSPool,   // GSDevice surface pool
+		Id_GSTextureCache, // hardware renderer texture cache surfaces
+		Id_Count
+	};
+
+	// Adjusts an account by the given (signed) number of bytes.
+	void Add(Id id, sptr bytes);
+
+	// Replaces an account with an absolute figure; used by owners that already
+	// track their total and just mirror it here periodically.
+	void Set(Id id, u64 bytes);
+
+	u64 Get(Id id);
+
+	// Writes a per-subsystem usage summary to the console.
+	void Report();
+} // namespace MemAccount
@@ -26,6 +26,7 @@
 
 #include "EventSource.h"
 #include "General.h"
+#include "MemoryAccount.h"
 #include <atomic>
 
 struct PageFaultInfo
@@ -101,10 +102,11 @@ protected:
 // --------------------------------------------------------------------------------------
 //  SrcType_PageFault
 // --------------------------------------------------------------------------------------
-class SrcType_PageFault : public EventSource<IEventListener_PageFault>
+class SrcType_PageFault : public EventSource<IEventListener_PageFault, SrcType_PageFault>
 {
 protected:
-	typedef EventSource<IEventListener_PageFault> _parent;
+	typedef EventSource<IEventListener_PageFault, SrcType_PageFault> _parent;
+	friend _parent;
 
 protected:
 	bool m_handled;
@@ -117,10 +119,12 @@ public:
 	virtual ~SrcType_PageFault() = default;
 
 	bool WasHandled() const { return m_handled; }
-	virtual void Dispatch(const PageFaultInfo& params);
+	void Dispatch(const PageFaultInfo& params);
 
 protected:
-	virtual void _DispatchRaw(ListenerIterator iter, const ListenerIterator& iend, const PageFaultInfo& evt);
+	// Shadows the default fan-out (statically bound, see EventSource): page fault
+	// dispatch stops at the first listener that handles the fault.
+	void _DispatchRaw(ConstIterator iter, const ConstIterator& iend, const PageFaultInfo& evt);
 };
 
 
@@ -214,6 +218,10 @@ protected:
 	// Protection mode to be applied to committed blocks.
 	PageProtectionMode m_prot_mode;
 
+	// Which memory account committed pages are charged to; subclasses that
+	// represent a specific consumer (rec caches) override this in their ctor.
+	MemAccount::Id m_account = MemAccount::Id_VmCommit;
+
 	// Controls write access to the entire reserve.  When true (the default), the reserve
 	// operates normally.  When set to false, all committed blocks are re-protected with
 	// write disabled, and accesses to uncommitted blocks (read or write) will cause a GPF
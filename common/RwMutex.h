@@ -17,6 +17,10 @@
 
 #include "common/Threading.h"
 
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
 namespace Threading
 {
 	// --------------------------------------------------------------------------------------
@@ -87,4 +91,74 @@ namespace Threading
 	protected:
 		ScopedWriteLock(RwMutex& locker, bool isTryLock);
 	};
+
+	// --------------------------------------------------------------------------------------
+	//  SeqLockedObject
+	// --------------------------------------------------------------------------------------
+	// Sequence-locked snapshot of a (trivially copyable) object, for read-mostly data
+	// that gets polled from realtime threads.  Readers copy the object out and never
+	// block or touch a kernel lock -- they just retry the copy in the unlikely event a
+	// writer was mid-update -- so a per-frame Read() from the GS or EE thread costs a
+	// memcpy and two fence-free atomic loads.  Writers are serialized against each
+	// other by an internal mutex and should be rare (settings changes and the like).
+	//
+	template <typename T>
+	class SeqLockedObject
+	{
+		DeclareNoncopyableObject(SeqLockedObject);
+
+		static_assert(std::is_trivially_copyable<T>::value,
+			"SeqLockedObject requires a trivially copyable type (readers copy it while writers may be mutating).");
+
+	protected:
+		std::atomic<u32> m_seq{0};
+		Mutex m_write_lock;
+		T m_data;
+
+	public:
+		SeqLockedObject()
+			: m_data()
+		{
+		}
+
+		explicit SeqLockedObject(const T& initial)
+			: m_data(initial)
+		{
+		}
+
+		// Copies the current value into dest.  Safe from any thread; lock-free.
+		void Read(T& dest) const
+		{
+			uint start;
+			do
+			{
+				// An odd sequence means a writer is mid-update; spin until it lands.
+				while ((start = m_seq.load(std::memory_order_acquire)) & 1)
+					SpinWait();
+
+				memcpy(&dest, &m_data, sizeof(T));
+
+				// Pairs with the writer's release bump: if the sequence still matches,
+				// no writer touched m_data during the copy above.
+				std::atomic_thread_fence(std::memory_order_acquire);
+			} while (m_seq.load(std::memory_order_relaxed) != start);
+		}
+
+		T Read() const
+		{
+			T result;
+			Read(result);
+			return result;
+		}
+
+		void Write(const T& src)
+		{
+			ScopedLock lock(m_write_lock);
+
+			m_seq.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			memcpy(&m_data, &src, sizeof(T));
+			m_seq.fetch_add(1, std::memory_order_release);
+		}
+	};
 } // namespace Threading
@@ -34,6 +34,10 @@
 // Handy little class for allocating a resizable memory block, complete with exception
 // error handling and automatic cleanup.  A lightweight alternative to std::vector.
 //
+// Growth is realloc-based and does *not* initialize the newly exposed bytes (devel
+// builds fill them with 0xbaadf00d); callers that need zeroed memory must clear it
+// themselves.  Arrays are movable but not copyable -- use Clone() for a deep copy.
+//
 template <typename T>
 class SafeArray
 {
@@ -64,6 +68,9 @@ public:
 	explicit SafeArray(const wxChar* name = L"Unnamed");
 	explicit SafeArray(int initialSize, const wxChar* name = L"Unnamed");
 
+	SafeArray(SafeArray&& other);
+	SafeArray& operator=(SafeArray&& other);
+
 	void Dispose();
 	void ExactAlloc(int newsize);
 	void MakeRoomFor(int newsize)
@@ -212,6 +219,9 @@ public:
 	{
 	}
 
+	SafeAlignedArray(SafeAlignedArray&& other) = default;
+	SafeAlignedArray& operator=(SafeAlignedArray&& other) = default;
+
 	explicit SafeAlignedArray(int initialSize, const wxChar* name = L"Unnamed");
 	virtual SafeAlignedArray<T, Alignment>* Clone() const;
 };
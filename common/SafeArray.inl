@@ -84,6 +84,30 @@ SafeArray<T>::SafeArray(int initialSize, const wxChar* name)
 			.SetDiagMsg(wxsFormat(L"Called from 'SafeArray::ctor' [size=%d]", initialSize));
 }
 
+template <typename T>
+SafeArray<T>::SafeArray(SafeArray&& other)
+	: Name(std::move(other.Name))
+{
+	ChunkSize = other.ChunkSize;
+	m_ptr = other.m_ptr;
+	m_size = other.m_size;
+
+	other.m_ptr = NULL;
+	other.m_size = 0;
+}
+
+// Implemented as a swap so that the displaced allocation is released by the right
+// destructor -- important for SafeAlignedArray, whose memory must not meet free().
+template <typename T>
+SafeArray<T>& SafeArray<T>::operator=(SafeArray&& other)
+{
+	std::swap(Name, other.Name);
+	std::swap(ChunkSize, other.ChunkSize);
+	std::swap(m_ptr, other.m_ptr);
+	std::swap(m_size, other.m_size);
+	return *this;
+}
+
 // Clears the contents of the array to zero, and frees all memory allocations.
 template <typename T>
 void SafeArray<T>::Dispose()
@@ -138,20 +138,23 @@ typedef ScopedAlignedAlloc<char, 16> CharBufferType;
 
 class FastFormatAscii
 {
+	DeclareNoncopyableObject(FastFormatAscii);
+
 protected:
-	CharBufferType m_dest;
+	// Borrowed from the calling thread's format buffer cache; returned on destruction.
+	CharBufferType* m_dest;
 
 public:
 	FastFormatAscii();
-	~FastFormatAscii() = default;
+	~FastFormatAscii();
 	FastFormatAscii& Write(const char* fmt, ...);
 	FastFormatAscii& WriteV(const char* fmt, va_list argptr);
 
 	void Clear();
 	bool IsEmpty() const;
 
-	const char* c_str() const { return m_dest.GetPtr(); }
-	operator const char*() const { return m_dest.GetPtr(); }
+	const char* c_str() const { return m_dest->GetPtr(); }
+	operator const char*() const { return m_dest->GetPtr(); }
 
 	const wxString GetString() const;
 	//operator wxString() const;
@@ -180,13 +183,16 @@ public:
 // --------------------------------------------------------------------------------------
 class FastFormatUnicode
 {
+	DeclareNoncopyableObject(FastFormatUnicode);
+
 protected:
-	CharBufferType m_dest;
+	// Borrowed from the calling thread's format buffer cache; returned on destruction.
+	CharBufferType* m_dest;
 	uint m_Length;
 
 public:
 	FastFormatUnicode();
-	~FastFormatUnicode() = default;
+	~FastFormatUnicode();
 
 	FastFormatUnicode& Write(const char* fmt, ...);
 	FastFormatUnicode& Write(const wxChar* fmt, ...);
@@ -201,9 +207,9 @@ public:
 	FastFormatUnicode& ToUpper();
 	FastFormatUnicode& ToLower();
 
-	const wxChar* c_str() const { return (const wxChar*)m_dest.GetPtr(); }
-	operator const wxChar*() const { return (const wxChar*)m_dest.GetPtr(); }
-	operator wxString() const { return (const wxChar*)m_dest.GetPtr(); }
+	const wxChar* c_str() const { return (const wxChar*)m_dest->GetPtr(); }
+	operator const wxChar*() const { return (const wxChar*)m_dest->GetPtr(); }
+	operator wxString() const { return (const wxChar*)m_dest->GetPtr(); }
 
 	FastFormatUnicode& operator+=(const wxString& s)
 	{
@@ -0,0 +1,155 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/ThreadPool.h"
+#include "common/Console.h"
+#include "common/StringHelpers.h"
+#include "common/emitter/tools.h"
+
+#include <algorithm>
+
+using namespace Threading;
+
+// --------------------------------------------------------------------------------------
+//  TaskPool::Worker Implementations
+// --------------------------------------------------------------------------------------
+
+TaskPool::Worker::Worker(TaskPool& pool, uint index)
+	: pxThread(pxsFmt(L"TaskPool::%u", index))
+	, m_pool(pool)
+{
+	Start();
+}
+
+TaskPool::Worker::~Worker()
+{
+	try
+	{
+		_parent::Cancel();
+	}
+	DESTRUCTOR_CATCHALL
+}
+
+void TaskPool::Worker::ExecuteTaskInThread()
+{
+	// Pool tasks are background work (I/O, decompression); prefer efficiency
+	// cores so they don't contend with the emulation threads.
+	SetRoleAffinity(ThreadRole_Background);
+
+	while (true)
+	{
+		m_pool.m_sema.WaitWithoutYield();
+
+		Task task;
+		{
+			ScopedLock lock(m_pool.m_lock);
+			if (m_pool.m_shutdown)
+				break;
+
+			pxAssume(!m_pool.m_tasks.empty());
+			task = std::move(m_pool.m_tasks.front());
+			m_pool.m_tasks.pop_front();
+		}
+
+		try
+		{
+			task();
+		}
+		catch (Exception::BaseException& ex)
+		{
+			Console.Error(L"(TaskPool) Task aborted with an exception:\n%ls",
+				WX_STR(ex.FormatDiagnosticMessage()));
+		}
+		catch (std::exception& ex)
+		{
+			Console.Error("(TaskPool) Task aborted with a runtime error: %s", ex.what());
+		}
+	}
+}
+
+// --------------------------------------------------------------------------------------
+//  TaskPool Implementations
+// --------------------------------------------------------------------------------------
+
+TaskPool& TaskPool::Get()
+{
+	static TaskPool s_pool;
+	return s_pool;
+}
+
+TaskPool::TaskPool()
+	: m_shutdown(false)
+{
+	// Leave headroom for the emulation pipeline threads; the pool is meant to soak
+	// up whatever the host has spare, not to compete with the EE/GS for cores.
+	uint threads = x86caps.LogicalCores;
+	if (threads == 0)
+		threads = 2;
+	threads = std::min<uint>(threads > 2 ? threads - 2 : 1, 8);
+
+	m_workers.reserve(threads);
+	for (uint i = 0; i < threads; ++i)
+		m_workers.push_back(std::unique_ptr<Worker>(new Worker(*this, i)));
+}
+
+TaskPool::~TaskPool()
+{
+	{
+		ScopedLock lock(m_lock);
+		m_shutdown = true;
+	}
+	// One post per worker; each wakes once, sees the shutdown flag and exits.
+	m_sema.Post(m_workers.size());
+	m_workers.clear();
+}
+
+void TaskPool::Enqueue(Task task, bool urgent)
+{
+	{
+		ScopedLock lock(m_lock);
+		if (urgent)
+			m_tasks.push_front(std::move(task));
+		else
+			m_tasks.push_back(std::move(task));
+	}
+	m_sema.Post();
+}
+
+// --------------------------------------------------------------------------------------
+//  TaskGroup Implementations
+// --------------------------------------------------------------------------------------
+
+TaskGroup::TaskGroup()
+	: m_pending(0)
+{
+}
+
+void TaskGroup::Run(TaskPool::Task task, bool urgent)
+{
+	m_pending.fetch_add(1);
+	TaskPool::Get().Enqueue([this, task]() {
+		task();
+		if (m_pending.fetch_sub(1) == 1)
+			m_done.Post();
+	},
+		urgent);
+}
+
+void TaskGroup::Wait()
+{
+	if (m_pending.load() == 0)
+		return;
+	m_done.WaitWithoutYield();
+}
@@ -0,0 +1,103 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/PersistentThread.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Threading
+{
+	// --------------------------------------------------------------------------------------
+	//  TaskPool
+	// --------------------------------------------------------------------------------------
+	// Process-wide pool of worker threads for bursty background work (savestate
+	// compression, file conversions, cache rebuilds).  Subsystems with such work should
+	// queue it here instead of spinning up short-lived threads of their own.  The
+	// latency-bound pipeline threads (EE core, MTGS, MTVU, the software rasterizer
+	// workers) are not candidates -- they need dedicated threads and keep them.
+	//
+	// Tasks start in queue order across a fixed set of workers sized to the host cpu,
+	// so a long-running task delays later ones but never blocks the caller.  Urgent
+	// tasks jump to the front of the queue.  Exceptions escaping a task are logged by
+	// the worker and swallowed; tasks that need richer error reporting must handle it
+	// themselves.
+	class TaskPool
+	{
+		DeclareNoncopyableObject(TaskPool);
+
+	public:
+		typedef std::function<void()> Task;
+
+		// Returns the process-wide pool, creating it (and its workers) on first use.
+		// Do not call before cpu detection has run; worker count derives from it.
+		static TaskPool& Get();
+
+		void Enqueue(Task task, bool urgent = false);
+
+		uint GetNumWorkers() const { return m_workers.size(); }
+
+	protected:
+		class Worker : public pxThread
+		{
+			typedef pxThread _parent;
+
+			TaskPool& m_pool;
+
+		public:
+			Worker(TaskPool& pool, uint index);
+			virtual ~Worker();
+
+		protected:
+			void ExecuteTaskInThread();
+		};
+
+		Mutex m_lock;
+		Semaphore m_sema;
+		std::deque<Task> m_tasks;
+		bool m_shutdown;
+
+		std::vector<std::unique_ptr<Worker>> m_workers;
+
+		TaskPool();
+		~TaskPool();
+	};
+
+	// --------------------------------------------------------------------------------------
+	//  TaskGroup
+	// --------------------------------------------------------------------------------------
+	// Fork/join helper for a burst of parallel tasks: Run() each piece, then Wait()
+	// once for all of them to finish.  A group may not be reused after Wait() returns,
+	// and must outlive its tasks (Wait guarantees that when it is called).
+	class TaskGroup
+	{
+		DeclareNoncopyableObject(TaskGroup);
+
+	protected:
+		std::atomic<int> m_pending;
+		Semaphore m_done;
+
+	public:
+		TaskGroup();
+
+		void Run(TaskPool::Task task, bool urgent = false);
+		void Wait();
+	};
+} // namespace Threading
@@ -180,6 +180,39 @@ namespace Threading
 	// sleeps the current thread for the given number of milliseconds.
 	extern void Sleep(int ms);
 
+	// Pins the calling thread to the given set of logical processors.  Mask 0 is
+	// ignored (no preference).  Processors past the first 64 are out of scope.
+	extern void SetProcessorAffinity(u64 mask);
+
+	// --------------------------------------------------------------------------------------
+	//  Thread placement policy  (hybrid P/E-core hosts)
+	// --------------------------------------------------------------------------------------
+	// On CPUs that mix performance and efficiency cores the OS scheduler likes to park
+	// our latency-critical threads on E-cores, which shows up directly in frame times.
+	// Threads declare a role and the policy below maps it to a processor mask; on
+	// homogeneous hosts the policy is a no-op and placement stays with the OS.
+
+	enum ThreadRole
+	{
+		// Latency-critical emulation threads (EE, GS, VU, rasterizer workers);
+		// placed on performance cores when the host distinguishes them.
+		ThreadRole_Compute,
+
+		// Audio mixing, disc I/O, compression and other helper threads; efficiency
+		// cores are plenty, and using them keeps the P-cores free.
+		ThreadRole_Background,
+	};
+
+	// Returns the logical-processor bitmask the placement policy assigns to the given
+	// role, or 0 for "no preference" (homogeneous host or detection unavailable).
+	// Deployments can override detection with the PCSX2_PCORE_MASK / PCSX2_ECORE_MASK
+	// environment variables (hex processor masks).
+	extern u64 GetRoleAffinityMask(ThreadRole role);
+
+	// Applies the policy mask for the role to the calling thread; no-op when the
+	// mask is 0.
+	extern void SetRoleAffinity(ThreadRole role);
+
 // pthread Cond is an evil api that is not suited for Pcsx2 needs.
 // Let's not use it. Use mutexes and semaphores instead to create waits. (Air)
 #if 0
@@ -18,9 +18,12 @@
 #endif
 #include "common/PageFaultSource.h"
 #include "common/EventSource.inl"
+#include "common/MemoryAccount.h"
 #include "common/MemsetFast.inl"
 
-template class EventSource<IEventListener_PageFault>;
+#include <cstdlib>
+
+template class EventSource<IEventListener_PageFault, SrcType_PageFault>;
 
 SrcType_PageFault* Source_PageFault = NULL;
 Threading::Mutex PageFault_Mutex;
@@ -58,7 +61,7 @@ void SrcType_PageFault::Dispatch(const PageFaultInfo& params)
 	_parent::Dispatch(params);
 }
 
-void SrcType_PageFault::_DispatchRaw(ListenerIterator iter, const ListenerIterator& iend, const PageFaultInfo& evt)
+void SrcType_PageFault::_DispatchRaw(ConstIterator iter, const ConstIterator& iend, const PageFaultInfo& evt)
 {
 	do
 	{
@@ -117,6 +120,13 @@ VirtualMemoryManager::VirtualMemoryManager(const wxString& name, uptr base, size
 	if (!m_baseptr)
 		return;
 
+	// Opt-in (PCSX2_HUGEPAGES=1): ask the OS to back the arena with 2MB pages.
+	// Everything TLB-hot lives in this reserve -- main memory and all of the
+	// recompiler code caches -- so one hint on the whole range covers them all.
+	const char* hugepages = getenv("PCSX2_HUGEPAGES");
+	if (hugepages && hugepages[0] == '1')
+		HostSys::AdviseHugePages((void*)m_baseptr, reserved_bytes);
+
 	m_pageuse = new std::atomic<bool>[m_pages_reserved]();
 
 	FastFormatUnicode mbkb;
@@ -313,6 +323,7 @@ void VirtualMemoryReserve::Reset()
 
 	ReprotectCommittedBlocks(PageAccess_None());
 	HostSys::MmapResetPtr(m_baseptr, m_pages_commited * __pagesize);
+	MemAccount::Add(m_account, -(sptr)(m_pages_commited * __pagesize));
 	m_pages_commited = 0;
 }
 
@@ -333,6 +344,7 @@ bool VirtualMemoryReserve::Commit()
 		return true;
 
 	m_pages_commited = m_pages_reserved;
+	MemAccount::Add(m_account, m_pages_reserved * __pagesize);
 	return HostSys::MmapCommitPtr(m_baseptr, m_pages_reserved * __pagesize, m_prot_mode);
 }
 
@@ -141,6 +141,58 @@ void HostSys::Munmap(uptr base, size_t size)
 	VirtualFree((void*)base, 0, MEM_RELEASE);
 }
 
+void HostSys::AdviseHugePages(void* base, size_t size)
+{
+	// No transparent equivalent on Windows: large pages must be requested with
+	// MEM_LARGE_PAGES at allocation time, require SeLockMemoryPrivilege, and are
+	// non-pageable -- none of which fits a hint applied to an existing reserve.
+}
+
+bool HostSys::MmapFilePtr(void* base, size_t size, const wxString& filename)
+{
+	// Not supported: MapViewOfFileEx can't replace part of a VirtualAlloc'd region,
+	// the target range would have to be released first (racy and reserve-breaking).
+	return false;
+}
+
+void* HostSys::MmapFile(const wxString& filename, size_t& size)
+{
+	size = 0;
+
+	HANDLE file = CreateFile(filename.wc_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	LARGE_INTEGER filesize;
+	if (!GetFileSizeEx(file, &filesize) || (filesize.QuadPart <= 0))
+	{
+		CloseHandle(file);
+		return NULL;
+	}
+
+	HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping)
+		return NULL;
+
+	// the view holds its own reference, so the mapping handle can go right away
+	void* result = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!result)
+		return NULL;
+
+	size = (size_t)filesize.QuadPart;
+	return result;
+}
+
+void HostSys::MunmapFile(void* base, size_t size)
+{
+	if (!base)
+		return;
+	UnmapViewOfFile(base);
+}
+
 void HostSys::MemProtect(void* baseaddr, size_t size, const PageProtectionMode& mode)
 {
 	pxAssertDev(((size & (__pagesize - 1)) == 0), pxsFmt(
@@ -47,6 +47,16 @@ __fi void Threading::DisableHiresScheduler()
 	timeEndPeriod(1);
 }
 
+void Threading::SetProcessorAffinity(u64 mask)
+{
+	if (!mask)
+		return;
+
+	// DWORD_PTR truncates to the first 32 processors on 32-bit builds, which is
+	// fine: the policy masks never extend past what the process can address.
+	::SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)mask);
+}
+
 // This hacky union would probably fail on some cpu platforms if the contents of FILETIME aren't
 // packed (but for any x86 CPU and microsoft compiler, they will be).
 union FileTimeSucks
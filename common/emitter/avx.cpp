@@ -0,0 +1,68 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2015  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/emitter/internal.h"
+#include "common/emitter/tools.h"
+
+namespace x86Emitter
+{
+
+	const xImplAVX_ArithFloat xVADD = {{0x00, 0x58}, {0xF3, 0x58}};
+	const xImplAVX_ArithFloat xVSUB = {{0x00, 0x5C}, {0xF3, 0x5C}};
+	const xImplAVX_ArithFloat xVMUL = {{0x00, 0x59}, {0xF3, 0x59}};
+
+	const xImplAVX_3Arg xVPOR     = {0x66, 0xEB};
+	const xImplAVX_3Arg xVPXOR    = {0x66, 0xEF};
+	const xImplAVX_3Arg xVPCMPEQD = {0x66, 0x76};
+
+	// Emits the VEX prefix, opcode and modrm bytes for a 128-bit, 0F-map,
+	// three-operand instruction.  The compact two-byte prefix is used unless the
+	// rm operand needs the B/X extension bits (only possible on x86-64).
+	template <typename T2>
+	static void EmitAVXOp(u8 prefix, u8 opcode, const xRegisterSSE& to, const xRegisterSSE& from1, const T2& from2, bool extB, bool extX)
+	{
+		const u8 p =
+			prefix == 0xF2 ? 3 :
+			prefix == 0xF3 ? 2 :
+			prefix == 0x66 ? 1 :
+                             0;
+		const u8 nv = (~from1.GetId() & 0xF) << 3;
+
+		if (extB || extX)
+		{
+			xWrite8(0xC4);
+			xWrite8((to.IsExtended() ? 0x00 : 0x80) | (extX ? 0x00 : 0x40) | (extB ? 0x00 : 0x20) | 1); // 0F map
+			xWrite8(nv | p); // W=0, L=0 (128-bit)
+			xWrite8(opcode);
+		}
+		else
+		{
+			xWrite8(0xC5);
+			xWrite8((to.IsExtended() ? 0x00 : 0x80) | nv | p); // L=0 (128-bit)
+			xWrite8(opcode);
+		}
+		EmitSibMagic(to, from2);
+	}
+
+	void xImplAVX_3Arg::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2) const
+	{
+		EmitAVXOp(Prefix, Opcode, to, from1, from2, from2.IsExtended(), false);
+	}
+
+	void xImplAVX_3Arg::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2) const
+	{
+		EmitAVXOp(Prefix, Opcode, to, from1, from2, from2.Base.IsExtended(), from2.Index.IsExtended());
+	}
+} // namespace x86Emitter
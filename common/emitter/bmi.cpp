@@ -24,6 +24,12 @@ namespace x86Emitter
 	const xImplBMI_RVM xPEXT = {0xF3, 0x38, 0xF5};
 	const xImplBMI_RVM xANDN_S = {0x00, 0x38, 0xF2};
 
+	const xImplBMI_RMV xSHLX = {0x66, 0x38, 0xF7};
+	const xImplBMI_RMV xSHRX = {0xF2, 0x38, 0xF7};
+	const xImplBMI_RMV xSARX = {0xF3, 0x38, 0xF7};
+
+	const xImplBMI_RMI xRORX = {0xF2, 0x3A, 0xF0};
+
 	void xImplBMI_RVM::operator()(const xRegisterInt& to, const xRegisterInt& from1, const xRegisterInt& from2) const
 	{
 		xOpWriteC4(Prefix, MbPrefix, Opcode, to, from1, from2);
@@ -32,4 +38,26 @@ namespace x86Emitter
 	{
 		xOpWriteC4(Prefix, MbPrefix, Opcode, to, from1, from2);
 	}
+
+	void xImplBMI_RMV::operator()(const xRegisterInt& to, const xRegisterInt& from, const xRegisterInt& count) const
+	{
+		xOpWriteC4(Prefix, MbPrefix, Opcode, to, count, from);
+	}
+	void xImplBMI_RMV::operator()(const xRegisterInt& to, const xIndirectVoid& from, const xRegisterInt& count) const
+	{
+		xOpWriteC4(Prefix, MbPrefix, Opcode, to, count, from);
+	}
+
+	// RORX has no vvvv operand; encoding register 0 yields the required 1111b
+	// ("unused") field through the complement in xOpWriteC4.
+	void xImplBMI_RMI::operator()(const xRegisterInt& to, const xRegisterInt& from, u8 imm) const
+	{
+		xOpWriteC4(Prefix, MbPrefix, Opcode, to, xRegister32(0), from);
+		xWrite8(imm);
+	}
+	void xImplBMI_RMI::operator()(const xRegisterInt& to, const xIndirectVoid& from, u8 imm) const
+	{
+		xOpWriteC4(Prefix, MbPrefix, Opcode, to, xRegister32(0), from);
+		xWrite8(imm);
+	}
 } // namespace x86Emitter
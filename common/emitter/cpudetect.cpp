@@ -312,6 +312,7 @@ void x86capabilities::Identify()
 
 	hasBMI1 = (SEFlag >> 3) & 1;
 	hasBMI2 = (SEFlag >> 8) & 1;
+	hasEnhancedRepMovsb = (SEFlag >> 9) & 1; //erms
 
 	// Ones only for AMDs:
 	hasAMD64BitArchitecture = (EFlags >> 29) & 1; //64bit cpu
@@ -0,0 +1,40 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2015  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Implement a small set of 128-bit AVX instructions (VEX encoded, 0F escape map).
+// Only the non-destructive three-operand forms are provided; callers are expected
+// to check x86caps.hasAVX before using any of these.
+
+namespace x86Emitter
+{
+
+	struct xImplAVX_3Arg
+	{
+		u8 Prefix;
+		u8 Opcode;
+
+		// to = from1 <op> from2, leaving from1 untouched
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2) const;
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2) const;
+	};
+
+	struct xImplAVX_ArithFloat
+	{
+		xImplAVX_3Arg PS;
+		xImplAVX_3Arg SS;
+	};
+} // namespace x86Emitter
@@ -33,29 +33,33 @@ namespace x86Emitter
 		// ANDN 	Logical and not 	~x & y
 		void operator()(const xRegisterInt& to, const xRegisterInt& from1, const xRegisterInt& from2) const;
 		void operator()(const xRegisterInt& to, const xRegisterInt& from1, const xIndirectVoid& from2) const;
+	};
 
-#if 0
-		// RMV
-		// BEXTR 	Bit field extract (with register) 	(src >> start) & ((1 << len)-1)[9]
-		// BZHI 	Zero high bits starting with specified bit position
-		// SARX 	Shift arithmetic right without affecting flags
-		// SHRX 	Shift logical right without affecting flags
+	struct xImplBMI_RMV
+	{
+		u8 Prefix;
+		u8 MbPrefix;
+		u8 Opcode;
+
+		// RMV (note: V and M are swapped relative to the RVM group above)
 		// SHLX 	Shift logical left without affecting flags
-		// FIXME: WARNING same as above but V and M are inverted
-		//void operator()( const xRegisterInt& to, const xRegisterInt& from1, const xRegisterInt& from2) const;
-		//void operator()( const xRegisterInt& to, const xIndirectVoid& from1, const xRegisterInt& from2) const;
+		// SHRX 	Shift logical right without affecting flags
+		// SARX 	Shift arithmetic right without affecting flags
+		// The count may live in any register and is masked to the operand size
+		// (31 or 63), exactly like the CL forms of the group 2 shifts.
+		void operator()(const xRegisterInt& to, const xRegisterInt& from, const xRegisterInt& count) const;
+		void operator()(const xRegisterInt& to, const xIndirectVoid& from, const xRegisterInt& count) const;
+	};
 
-		// VM
-		// BLSI 	Extract lowest set isolated bit 	x & -x
-		// BLSMSK 	Get mask up to lowest set bit 	x ^ (x - 1)
-		// BLSR 	Reset lowest set bit 	x & (x - 1)
-		void operator()( const xRegisterInt& to, const xRegisterInt& from) const;
-		void operator()( const xRegisterInt& to, const xIndirectVoid& from) const;
+	struct xImplBMI_RMI
+	{
+		u8 Prefix;
+		u8 MbPrefix;
+		u8 Opcode;
 
 		// RMI
-		//RORX 	Rotate right logical without affecting flags
-		void operator()( const xRegisterInt& to, const xRegisterInt& from, u8 imm) const;
-		void operator()( const xRegisterInt& to, const xIndirectVoid& from, u8 imm) const;
-#endif
+		// RORX 	Rotate right logical without affecting flags
+		void operator()(const xRegisterInt& to, const xRegisterInt& from, u8 imm) const;
+		void operator()(const xRegisterInt& to, const xIndirectVoid& from, u8 imm) const;
 	};
 } // namespace x86Emitter
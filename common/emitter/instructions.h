@@ -124,6 +124,15 @@ namespace x86Emitter
 	// BMI extra instruction requires BMI1/BMI2
 	extern const xImplBMI_RVM xMULX, xPDEP, xPEXT, xANDN_S; // Warning xANDN is already used by SSE
 
+	// Flags-free shifts/rotate; callers must check x86caps.hasBMI2
+	extern const xImplBMI_RMV xSHLX, xSHRX, xSARX;
+	extern const xImplBMI_RMI xRORX;
+
+	// ------------------------------------------------------------------------
+	// Three-operand AVX instructions; callers must check x86caps.hasAVX
+	extern const xImplAVX_ArithFloat xVADD, xVSUB, xVMUL;
+	extern const xImplAVX_3Arg xVPOR, xVPXOR, xVPCMPEQD;
+
 	//////////////////////////////////////////////////////////////////////////////////////////
 	// Miscellaneous Instructions
 	// These are all defined inline or in ix86.cpp.
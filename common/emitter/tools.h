@@ -96,6 +96,7 @@ public:
 			u32 hasBMI1 : 1;
 			u32 hasBMI2 : 1;
 			u32 hasFMA : 1;
+			u32 hasEnhancedRepMovsb : 1;
 
 			// AMD-specific CPU Features
 			u32 hasAMD64BitArchitecture : 1;
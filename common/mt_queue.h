@@ -1,75 +1,140 @@
-/*  OnePAD - PCSX2 dev
- *  Copyright (C) 2017-2017
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
  *
- *  This program is free software; you can redistribute it and/or modify
- *  it under the terms of the GNU General Public License as published by
- *  the Free Software Foundation; either version 2 of the License, or
- *  (at your option) any later version.
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
  *
- *  This program is distributed in the hope that it will be useful,
- *  but WITHOUT ANY WARRANTY; without even the implied warranty of
- *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- *  GNU General Public License for more details.
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
  *
- *  You should have received a copy of the GNU General Public License
- *  along with this program; if not, write to the Free Software
- *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
  */
 
 #pragma once
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 
-template <typename T>
-class MtQueue
+// --------------------------------------------------------------------------------------
+//  MtMpmcQueue
+// --------------------------------------------------------------------------------------
+// Bounded lock-free multi-producer/multi-consumer queue (Dmitry Vyukov's array based
+// design: every cell carries a sequence counter, so producers and consumers only
+// contend on their own CAS'd cursor and never take a lock).  CAPACITY must be a power
+// of two.  push/pop fail instead of blocking when the queue is full/empty; callers
+// decide how to wait.  Elements are copied in and out, so keep T small -- pointers.
+template <typename T, size_t CAPACITY>
+class MtMpmcQueue
 {
-    std::queue<T> m_queue;
-    std::mutex m_mtx;
+	static_assert((CAPACITY & (CAPACITY - 1)) == 0, "MtMpmcQueue capacity must be a power of two");
+
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T data;
+	};
+
+	static const size_t MASK = CAPACITY - 1;
+
+	Cell m_cells[CAPACITY];
+	alignas(64) std::atomic<size_t> m_enqueue_pos;
+	alignas(64) std::atomic<size_t> m_dequeue_pos;
 
 public:
-    MtQueue()
-    {
-    }
+	MtMpmcQueue()
+		: m_enqueue_pos(0)
+		, m_dequeue_pos(0)
+	{
+		for (size_t i = 0; i < CAPACITY; i++)
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	MtMpmcQueue(const MtMpmcQueue&) = delete;
+	MtMpmcQueue& operator=(const MtMpmcQueue&) = delete;
 
-    ~MtQueue()
-    {
-    }
+	// Returns false when the queue is full.
+	bool push(const T& data)
+	{
+		Cell* cell;
+		size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			cell = &m_cells[pos & MASK];
+			size_t seq = cell->sequence.load(std::memory_order_acquire);
+			intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+			if (dif == 0)
+			{
+				if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (dif < 0)
+				return false;
+			else
+				pos = m_enqueue_pos.load(std::memory_order_relaxed);
+		}
+		cell->data = data;
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
 
-    void push(const T &e)
-    {
-        std::lock_guard<std::mutex> guard(m_mtx);
-        m_queue.push(e);
-    }
+	// Returns false when the queue is empty.
+	bool pop(T& data)
+	{
+		Cell* cell;
+		size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			cell = &m_cells[pos & MASK];
+			size_t seq = cell->sequence.load(std::memory_order_acquire);
+			intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+			if (dif == 0)
+			{
+				if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (dif < 0)
+				return false;
+			else
+				pos = m_dequeue_pos.load(std::memory_order_relaxed);
+		}
+		data = cell->data;
+		cell->sequence.store(pos + MASK + 1, std::memory_order_release);
+		return true;
+	}
 
-    size_t size()
-    {
-        std::lock_guard<std::mutex> guard(m_mtx);
-        return m_queue.size();
-    }
+	// Batch helpers.  Per-thread ordering is preserved; items from concurrent
+	// producers/consumers interleave as usual for an MPMC queue.
+	size_t push_n(const T* items, size_t count)
+	{
+		size_t n = 0;
+		while (n < count && push(items[n]))
+			++n;
+		return n;
+	}
 
-    T dequeue()
-    {
-        std::lock_guard<std::mutex> guard(m_mtx);
-        T item = m_queue.front();
-        m_queue.pop();
-        return item;
-    }
+	size_t pop_n(T* items, size_t max)
+	{
+		size_t n = 0;
+		while (n < max && pop(items[n]))
+			++n;
+		return n;
+	}
 
-    template <typename F>
-    void consume_all(F f)
-    {
-        std::lock_guard<std::mutex> guard(m_mtx);
-        while (!m_queue.empty()) {
-            f(m_queue.front());
-            m_queue.pop();
-        }
-    }
+	// Approximate under concurrency; exact only when producers and consumers
+	// are quiescent.  Good enough for logging and heuristics.
+	size_t size_approx() const
+	{
+		size_t enq = m_enqueue_pos.load(std::memory_order_relaxed);
+		size_t deq = m_dequeue_pos.load(std::memory_order_relaxed);
+		return enq > deq ? enq - deq : 0;
+	}
 
-    void reset()
-    {
-        std::lock_guard<std::mutex> guard(m_mtx);
-        while (!m_queue.empty())
-            m_queue.pop();
-    }
+	bool empty_approx() const
+	{
+		return size_approx() == 0;
+	}
 };
@@ -0,0 +1,72 @@
+/*  OnePAD - PCSX2 dev
+ *  Copyright (C) 2017-2017
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Fixed capacity single-producer/single-consumer ring. Both sides are
+// wait-free, so neither the thread generating input events nor the thread
+// draining them can ever block behind the other (unlike MtQueue, where both
+// sides contend on one mutex).
+template <typename T, size_t N>
+class MtRing
+{
+    T m_buffer[N];
+    std::atomic<size_t> m_head{0}; // next slot to write, owned by the producer
+    std::atomic<size_t> m_tail{0}; // next slot to read, owned by the consumer
+
+public:
+    // Producer side. Returns false (dropping the element) when the ring is full.
+    bool push(const T &e)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        const size_t next = (head + 1) % N;
+        if (next == m_tail.load(std::memory_order_acquire))
+            return false;
+        m_buffer[head] = e;
+        m_head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when the ring is empty.
+    bool dequeue(T *e)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire))
+            return false;
+        *e = m_buffer[tail];
+        m_tail.store((tail + 1) % N, std::memory_order_release);
+        return true;
+    }
+
+    template <typename F>
+    void consume_all(F f)
+    {
+        T e;
+        while (dequeue(&e))
+            f(e);
+    }
+
+    // Consumer side; discards everything queued so far.
+    void reset()
+    {
+        m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+};
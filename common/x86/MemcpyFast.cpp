@@ -1,9 +1,82 @@
 // GH: AMD memcpy was removed. The remaining part (memcmp_mmx) is likely from Zerofrog.
 // Hopefully memcmp_mmx will be dropped in the future.
 
-#if defined(_WIN32) && !defined(_M_AMD64)
 #include "common/MemcpyFast.h"
 #include "common/Assertions.h"
+#include "common/emitter/tools.h"
+
+#include <emmintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// See MemcpyFast.h for usage notes on both of these.
+
+void memcpy_fast(void* dest, const void* src, size_t size)
+{
+	if (size >= 1024 && x86caps.hasEnhancedRepMovsb)
+	{
+#ifdef _MSC_VER
+		__movsb((unsigned char*)dest, (const unsigned char*)src, size);
+#else
+		__asm__ __volatile__("rep movsb"
+							 : "+D"(dest), "+S"(src), "+c"(size)
+							 :
+							 : "memory");
+#endif
+		return;
+	}
+
+	memcpy(dest, src, size);
+}
+
+void memcpy_nt(void* dest, const void* src, size_t size)
+{
+	u8* d = (u8*)dest;
+	const u8* s = (const u8*)src;
+
+	// Copy the unaligned head normally so the streaming loop can use aligned
+	// stores; movntdq to an unaligned address faults.
+	uint head = (uint)(-(sptr)d & 15);
+	if (head != 0)
+	{
+		if (head > size)
+			head = (uint)size;
+		memcpy(d, s, head);
+		d += head;
+		s += head;
+		size -= head;
+	}
+
+	while (size >= 64)
+	{
+		_mm_stream_si128((__m128i*)(d + 0), _mm_loadu_si128((const __m128i*)(s + 0)));
+		_mm_stream_si128((__m128i*)(d + 16), _mm_loadu_si128((const __m128i*)(s + 16)));
+		_mm_stream_si128((__m128i*)(d + 32), _mm_loadu_si128((const __m128i*)(s + 32)));
+		_mm_stream_si128((__m128i*)(d + 48), _mm_loadu_si128((const __m128i*)(s + 48)));
+		d += 64;
+		s += 64;
+		size -= 64;
+	}
+
+	while (size >= 16)
+	{
+		_mm_stream_si128((__m128i*)d, _mm_loadu_si128((const __m128i*)s));
+		d += 16;
+		s += 16;
+		size -= 16;
+	}
+
+	// Order the weakly-ordered stores above ahead of whatever store the
+	// caller uses to publish the buffer (ringbuffer write positions etc).
+	_mm_sfence();
+
+	if (size != 0)
+		memcpy(d, s, size);
+}
+
+#if defined(_WIN32) && !defined(_M_AMD64)
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4414)
@@ -76,6 +76,7 @@ class FlatFileReader : public AsyncFileReader
 #elif defined(__linux__)
 	int m_fd; // FIXME don't know if overlap as an equivalent on linux
 	io_context_t m_aio_context;
+	bool m_async_inflight;
 #elif defined(__POSIX__)
 	int m_fd; // TODO OSX don't know if overlap as an equivalent on OSX
 	struct aiocb m_aiocb;
@@ -142,6 +143,39 @@ public:
 	static AsyncFileReader* DetectMultipart(AsyncFileReader* reader);
 };
 
+// Serves reads out of a copy of the whole image pinned in host memory, which rules
+// out disc access latency entirely at the cost of the image's (uncompressed) size
+// in RAM.  Created through Precache when the CdvdPrecache option is enabled.
+class PrecachedFileReader : public AsyncFileReader
+{
+	DeclareNoncopyableObject( PrecachedFileReader );
+
+	u8* m_data;
+	uint m_blocks;
+	int m_lresult;
+
+	PrecachedFileReader(AsyncFileReader* source, u8* data);
+
+public:
+	virtual ~PrecachedFileReader(void);
+
+	virtual bool Open(const wxString& fileName);
+
+	virtual int ReadSync(void* pBuffer, uint sector, uint count);
+
+	virtual void BeginRead(void* pBuffer, uint sector, uint count);
+	virtual int FinishRead(void);
+	virtual void CancelRead(void);
+
+	virtual void Close(void);
+
+	virtual uint GetBlockCount(void) const;
+
+	// Returns a reader serving source's contents from memory (source is consumed),
+	// or source itself if the image could not be fully loaded.
+	static AsyncFileReader* Precache(AsyncFileReader* source);
+};
+
 class BlockdumpFileReader : public AsyncFileReader
 {
 	DeclareNoncopyableObject( BlockdumpFileReader );
@@ -154,6 +188,9 @@ class BlockdumpFileReader : public AsyncFileReader
 
 	// index table
 	std::unique_ptr<u32[]> m_dtable;
+	// m_dtable indices sorted by LSN, so ReadSync can binary search
+	// instead of scanning the whole table for every sector
+	std::unique_ptr<u32[]> m_dsorted;
 	int m_dtablesize;
 
 	int m_lresult;
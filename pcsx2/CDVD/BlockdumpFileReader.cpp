@@ -112,6 +112,18 @@ bool BlockdumpFileReader::Open(const wxString& fileName)
 
 	} while (has == bs);
 
+	// Blocks are stored in record order, which for multi-gigabyte dumps made
+	// the old linear lookup in ReadSync painfully slow.  Keep a second table
+	// of record indices sorted by LSN so lookups can binary search instead.
+	// The sort is stable so duplicate LSNs resolve to the earliest record,
+	// matching what the linear scan used to return.
+	m_dsorted = std::unique_ptr<u32[]>(new u32[m_dtablesize]);
+	for (int j = 0; j < m_dtablesize; ++j)
+		m_dsorted[j] = j;
+
+	std::stable_sort(m_dsorted.get(), m_dsorted.get() + m_dtablesize,
+		[this](u32 a, u32 b) { return m_dtable[a] < m_dtable[b]; });
+
 	return true;
 }
 
@@ -122,35 +134,32 @@ int BlockdumpFileReader::ReadSync(void* pBuffer, uint lsn, uint count)
 
 	while (count > 0)
 	{
-		bool ok = false;
-		for (int i = 0; i < m_dtablesize; ++i)
+		const u32* begin = m_dsorted.get();
+		const u32* end = begin + m_dtablesize;
+		const u32* it = std::lower_bound(begin, end, lsn,
+			[this](u32 record, uint lsn_) { return m_dtable[record] < lsn_; });
+
+		if (it == end || m_dtable[*it] != lsn)
 		{
-			if (m_dtable[i] != lsn)
-				continue;
+			Console.WriteLn("Block %u not found in dump", lsn);
+			return -1;
+		}
+
+		const int i = *it;
 
-				// We store the LSN (u32) along with each block inside of blockdumps, so the
-				// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
+		// We store the LSN (u32) along with each block inside of blockdumps, so the
+		// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
 
 #ifdef PCSX2_DEBUG
-			u32 check_lsn;
-			m_file->SeekI(BlockDumpHeaderSize + (i * (m_blocksize + 4)));
-			m_file->Read(&check_lsn, sizeof(check_lsn));
-			pxAssert(check_lsn == lsn);
+		u32 check_lsn;
+		m_file->SeekI(BlockDumpHeaderSize + (i * (m_blocksize + 4)));
+		m_file->Read(&check_lsn, sizeof(check_lsn));
+		pxAssert(check_lsn == lsn);
 #else
-			m_file->SeekI(BlockDumpHeaderSize + (i * (m_blocksize + 4)) + 4);
+		m_file->SeekI(BlockDumpHeaderSize + (i * (m_blocksize + 4)) + 4);
 #endif
 
-			m_file->Read(dst, m_blocksize);
-
-			ok = true;
-			break;
-		}
-
-		if (!ok)
-		{
-			Console.WriteLn("Block %u not found in dump", lsn);
-			return -1;
-		}
+		m_file->Read(dst, m_blocksize);
 
 		count--;
 		lsn++;
@@ -18,9 +18,12 @@
 #include "gui/AppConfig.h"
 
 #include <memory>
+#include <map>
 #include <ctype.h>
 #include <wx/datetime.h>
 
+#include "PathDefs.h"
+
 #include "CdRom.h"
 #include "CDVD.h"
 #include "CDVD_internal.h"
@@ -394,6 +397,107 @@ static __fi ElfObject* loadElf(const wxString filename)
 	return new ElfObject(fixedname, file);
 }
 
+// Cached result of a previous ELF identification, validated against the size and
+// mtime of the disc image it was read out of.
+struct CachedElfInfo
+{
+	u32 crc;
+	u32 entry;
+	u32 textStart;
+	u32 textSize;
+	wxLongLong_t imageSize;
+	wxLongLong_t imageMtime;
+};
+
+static std::map<wxString, CachedElfInfo> s_elfInfoCache;
+static bool s_elfInfoCacheLoaded = false;
+
+static wxString elfCacheFilename()
+{
+	return Path::Combine(PathDefs::GetCache().ToString(), L"elfinfo.cache");
+}
+
+// Returns the size/mtime of the disc image backing the current cdvd source, used to
+// invalidate cache entries when the image file changes.  Returns false if the source
+// isn't a plain host file (plugin-based disc drives and the like).
+static bool elfCacheImageStats(wxLongLong_t& size, wxLongLong_t& mtime)
+{
+	const wxString& image(CDVDsys_GetFile(CDVDsys_GetSourceType()));
+	if (image.IsEmpty() || !wxFileExists(image))
+		return false;
+
+	const wxDateTime stamp(wxFileName(image).GetModificationTime());
+	if (!stamp.IsValid())
+		return false;
+
+	size = Path::GetFileSize(image);
+	mtime = (wxLongLong_t)stamp.GetTicks();
+	return true;
+}
+
+// The cache file holds one line per identified executable:
+//   crc entry textstart textsize imagesize imagemtime elfpath
+static void elfCacheLoad()
+{
+	wxFFile fp(elfCacheFilename(), L"rb");
+	if (!fp.IsOpened())
+		return;
+
+	wxString contents;
+	if (!fp.ReadAll(&contents))
+		return;
+
+	wxStringTokenizer lines(contents, L"\n");
+	while (lines.HasMoreTokens())
+	{
+		wxStringTokenizer fields(lines.GetNextToken(), L" ");
+		if (fields.CountTokens() < 7)
+			continue;
+
+		unsigned long crc, entry, textStart, textSize;
+		wxLongLong_t imageSize, imageMtime;
+		bool valid = fields.GetNextToken().ToULong(&crc, 16);
+		valid = valid && fields.GetNextToken().ToULong(&entry, 16);
+		valid = valid && fields.GetNextToken().ToULong(&textStart, 16);
+		valid = valid && fields.GetNextToken().ToULong(&textSize, 16);
+		valid = valid && fields.GetNextToken().ToLongLong(&imageSize);
+		valid = valid && fields.GetNextToken().ToLongLong(&imageMtime);
+		if (!valid)
+			continue;
+
+		// the elf path is the remainder of the line, it may contain spaces
+		wxString elfpath(fields.GetString());
+		elfpath.Trim();
+		if (elfpath.IsEmpty())
+			continue;
+
+		CachedElfInfo& info(s_elfInfoCache[elfpath]);
+		info.crc = crc;
+		info.entry = entry;
+		info.textStart = textStart;
+		info.textSize = textSize;
+		info.imageSize = imageSize;
+		info.imageMtime = imageMtime;
+	}
+}
+
+static void elfCacheStore(const wxString& elfpath, const CachedElfInfo& info)
+{
+	s_elfInfoCache[elfpath] = info;
+
+	PathDefs::GetCache().Mkdir();
+	wxFFile fp(elfCacheFilename(), L"wb");
+	if (!fp.IsOpened())
+		return;
+
+	for (const auto& entry : s_elfInfoCache)
+	{
+		fp.Write(pxsFmt(L"%08x %08x %08x %08x %lld %lld %s\n",
+			entry.second.crc, entry.second.entry, entry.second.textStart, entry.second.textSize,
+			entry.second.imageSize, entry.second.imageMtime, WX_STR(entry.first)));
+	}
+}
+
 static __fi void _reloadElfInfo(wxString elfpath)
 {
 	// Now's a good time to reload the ELF info...
@@ -411,6 +515,30 @@ static __fi void _reloadElfInfo(wxString elfpath)
 	if (fname.Matches(L"????_???.??*"))
 		DiscSerial = fname(0, 4) + L"-" + fname(5, 3) + fname(9, 2);
 
+	// Known discs can be identified straight from the cache, which skips reading and
+	// checksumming the entire executable out of the image on every boot.  host: elfs
+	// are excluded, those are typically dev builds whose symbols should get loaded.
+	wxLongLong_t imageSize = 0, imageMtime = 0;
+	const bool cacheUsable = !elfpath.StartsWith(L"host") && elfCacheImageStats(imageSize, imageMtime);
+	if (cacheUsable)
+	{
+		if (!s_elfInfoCacheLoaded)
+		{
+			elfCacheLoad();
+			s_elfInfoCacheLoaded = true;
+		}
+
+		auto it = s_elfInfoCache.find(elfpath);
+		if (it != s_elfInfoCache.end() && it->second.imageSize == imageSize && it->second.imageMtime == imageMtime)
+		{
+			ElfCRC = it->second.crc;
+			ElfEntry = it->second.entry;
+			ElfTextRange = std::make_pair(it->second.textStart, it->second.textSize);
+			Console.WriteLn(Color_StrongBlue, L"ELF (%s) Game CRC = 0x%08X, EntryPoint = 0x%08X (cached)", WX_STR(elfpath), ElfCRC, ElfEntry);
+			return;
+		}
+	}
+
 	std::unique_ptr<ElfObject> elfptr(loadElf(elfpath));
 
 	elfptr->loadHeaders();
@@ -419,6 +547,18 @@ static __fi void _reloadElfInfo(wxString elfpath)
 	ElfTextRange = elfptr->getTextRange();
 	Console.WriteLn(Color_StrongBlue, L"ELF (%s) Game CRC = 0x%08X, EntryPoint = 0x%08X", WX_STR(elfpath), ElfCRC, ElfEntry);
 
+	if (cacheUsable)
+	{
+		CachedElfInfo info;
+		info.crc = ElfCRC;
+		info.entry = ElfEntry;
+		info.textStart = ElfTextRange.first;
+		info.textSize = ElfTextRange.second;
+		info.imageSize = imageSize;
+		info.imageMtime = imageMtime;
+		elfCacheStore(elfpath, info);
+	}
+
 	// Note: Do not load game database info here.  This code is generic and called from
 	// BIOS key encryption as well as eeloadReplaceOSDSYS.  The first is actually still executing
 	// BIOS code, and patches and cheats should not be applied yet.  (they are applied when
@@ -678,6 +818,21 @@ void cdvdReset()
 	cdvd.Action = cdvdAction_None;
 	cdvd.ReadTime = cdvdBlockReadTime(MODE_DVDROM);
 
+	// Deterministic runs can't take the RTC seed from the wall clock -- it leaks
+	// into the guest through sceCdReadClock and makes otherwise identical runs
+	// diverge.  Pin it to a fixed date instead; it still ticks forward normally
+	// (in emulated time) from there.
+	if (EmuConfig.DeterministicClock)
+	{
+		cdvd.RTC.second = 0;
+		cdvd.RTC.minute = 0;
+		cdvd.RTC.hour = 0;
+		cdvd.RTC.day = 1;
+		cdvd.RTC.month = 1;
+		cdvd.RTC.year = 0; // 2000-01-01, the RTC epoch
+		return;
+	}
+
 	// CDVD internally uses GMT+9.  If you think the time's wrong, you're wrong.
 	// Set up your time zone and winter/summer in the BIOS.  No PS2 BIOS I know of features automatic DST.
 	wxDateTime curtime(wxDateTime::GetTimeNow());
@@ -918,11 +1073,18 @@ __fi void cdvdReadInterrupt()
 	{
 		if (cdvd.RErr == 0)
 		{
-			while ((cdvd.RErr = DoCDVDgetBuffer(cdr.Transfer)), cdvd.RErr == -2)
+			cdvd.RErr = DoCDVDgetBuffer(cdr.Transfer);
+
+			if (cdvd.RErr == -2)
 			{
-				// not finished yet ... block on the read until it finishes.
-				Threading::Sleep(0);
-				Threading::SpinWait();
+				// The host read hasn't caught up with the emulated drive yet
+				// (slow media or network storage).  The data only has to be
+				// there when the IRQ fires, so instead of stalling the whole
+				// emu thread on a spinwait, push the read completion back a
+				// bit and let the machine keep running.
+				cdvd.RErr = 0;
+				CDVDREAD_INT(cdvd.ReadTime / 4);
+				return;
 			}
 		}
 
@@ -984,7 +1146,35 @@ __fi void cdvdReadInterrupt()
 	cdvd.RetryCntP = 0;
 	cdvd.Reading = 1;
 	cdvd.RErr = DoCDVDreadTrack(cdvd.Sector, cdvd.ReadMode);
-	CDVDREAD_INT(cdvd.ReadTime);
+
+	// Deliver a few more sectors in this same event if the host side already
+	// has them.  The DMA makes its progress slightly early that way, but the
+	// end-of-read IRQ still fires after the same aggregate time (one ReadTime
+	// per sector), and a long read stops costing one IOP event per sector --
+	// FMVs stream thousands of sectors a second, so the event count matters.
+	// The last sector is always left to the regular path above so the final
+	// IRQ timing is untouched.
+	uint sectors = 1;
+
+	while (sectors < 4 && cdvd.nSectors > 1 && cdvd.RErr == 0)
+	{
+		if (DoCDVDgetBuffer(cdr.Transfer) != 0)
+			break; // not ready yet (or errored); the next event resolves it as usual
+
+		cdvd.Reading = false;
+
+		if (cdvdReadSector() == -1)
+			break; // out of BCR room; the next event retries the delivery
+
+		cdvd.Sector++;
+		cdvd.nSectors--;
+
+		cdvd.Reading = 1;
+		cdvd.RErr = DoCDVDreadTrack(cdvd.Sector, cdvd.ReadMode);
+		sectors++;
+	}
+
+	CDVDREAD_INT(cdvd.ReadTime * sectors);
 
 	return;
 }
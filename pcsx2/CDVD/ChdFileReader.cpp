@@ -141,6 +141,26 @@ int ChdFileReader::ReadChunk(void *dst, s64 chunkID)
 	if (chunkID < 0)
 		return -1;
 
+	// Decompressed-hunk LRU cache.  One game sector read can cost a whole
+	// hunk decode, and the block trimming plus readahead make it common to
+	// revisit a hunk shortly after ThreadedFileReader's two buffers dropped
+	// it.  Calls here are already serialized by ThreadedFileReader - the same
+	// discipline that keeps chd_read safe on the single chd_file - so the
+	// cache needs no locking of its own.
+	CachedHunk* victim = &m_hunk_cache[0];
+	for (uint i = 0; i < HUNK_CACHE_SIZE; i++)
+	{
+		CachedHunk& entry = m_hunk_cache[i];
+		if (entry.id == chunkID)
+		{
+			entry.lru = ++m_hunk_cache_clock;
+			memcpy(dst, entry.data, hunk_size);
+			return hunk_size;
+		}
+		if (entry.lru < victim->lru)
+			victim = &entry;
+	}
+
 	chd_error error = chd_read(ChdFile, chunkID, dst);
 	if (error != CHDERR_NONE)
 	{
@@ -148,6 +168,17 @@ int ChdFileReader::ReadChunk(void *dst, s64 chunkID)
 		return 0;
 	}
 
+	// Park a copy in the least recently used slot for the next visit; the
+	// memcpy is noise next to the decode it saves.
+	if (!victim->data)
+		victim->data = (u8*)malloc(hunk_size);
+	if (victim->data)
+	{
+		memcpy(victim->data, dst, hunk_size);
+		victim->id = chunkID;
+		victim->lru = ++m_hunk_cache_clock;
+	}
+
 	return hunk_size;
 }
 
@@ -158,6 +189,19 @@ void ChdFileReader::Close2()
 		chd_close(ChdFile);
 		ChdFile = NULL;
 	}
+
+	// The next file may use a different hunk size, so drop the cache buffers
+	for (CachedHunk& entry : m_hunk_cache)
+	{
+		if (entry.data)
+		{
+			free(entry.data);
+			entry.data = nullptr;
+		}
+		entry.id = -1;
+		entry.lru = 0;
+	}
+	m_hunk_cache_clock = 0;
 }
 
 u32 ChdFileReader::GetBlockCount() const
@@ -38,4 +38,16 @@ private:
 	chd_file* ChdFile;
 	u64 file_size;
 	u32 hunk_size;
+
+	/// Decompressed-hunk LRU cache, see ReadChunk.  Entry buffers are
+	/// allocated lazily at the file's hunk size and freed in Close2.
+	struct CachedHunk
+	{
+		s64 id = -1;
+		u64 lru = 0;
+		u8* data = nullptr;
+	};
+	static const uint HUNK_CACHE_SIZE = 8;
+	CachedHunk m_hunk_cache[HUNK_CACHE_SIZE];
+	u64 m_hunk_cache_clock = 0;
 };
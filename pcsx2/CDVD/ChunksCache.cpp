@@ -51,8 +51,10 @@ int ChunksCache::Read(void* pDest, PX_off_t offset, int length)
 		{
 			if (it != m_entries.begin())
 				m_entries.splice(m_entries.begin(), m_entries, it); // Move to top (MRU)
+			m_hits++;
 			return CopyAvailable(e->data, e->offset, e->size, pDest, offset, length);
 		}
 	}
+	m_misses++;
 	return -1;
 }
@@ -25,10 +25,21 @@ public:
 	ChunksCache(uint initialLimitMb)
 		: m_entries(0)
 		, m_size(0)
-		, m_limit(initialLimitMb * 1024 * 1024){};
+		, m_limit(initialLimitMb * 1024 * 1024)
+		, m_hits(0)
+		, m_misses(0){};
 	~ChunksCache() { Clear(); };
 	void SetLimit(uint megabytes);
-	void Clear() { MatchLimit(true); };
+	void Clear()
+	{
+		MatchLimit(true);
+		m_hits = 0;
+		m_misses = 0;
+	};
+
+	// Cumulative Read() hit/miss counts, reset by Clear()
+	uint GetHits() const { return m_hits; };
+	uint GetMisses() const { return m_misses; };
 
 	void Take(void* pMallocedSrc, PX_off_t offset, int length, int coverage);
 	int Read(void* pDest, PX_off_t offset, int length);
@@ -67,6 +78,8 @@ private:
 	void MatchLimit(bool removeAll = false);
 	PX_off_t m_size;
 	PX_off_t m_limit;
+	uint m_hits;
+	uint m_misses;
 };
 
 #undef CLAMP
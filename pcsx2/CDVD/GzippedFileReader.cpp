@@ -14,6 +14,7 @@
 */
 
 #include "PrecompiledHeader.h"
+#include <chrono>
 #include <fstream>
 #include <wx/stdpaths.h>
 #include "gui/AppConfig.h"
@@ -44,6 +45,9 @@ static s64 fsize(const wxString& filename)
 // - [GZIP_ID_LEN] GZIP_ID (no \0)
 // - [sizeof(Access)] index (should be allocated, contains various sizes)
 // - [rest] the indexed data points (should be allocated, index->list should then point to it)
+// An index with uncompressed_size == 0 on disk is a partial snapshot from an
+// interrupted background build; it's valid as far as it goes and construction
+// resumes from its last access point on the next open.
 static Access* ReadIndexFromFile(const wxString& filename)
 {
 	s64 size = fsize(filename);
@@ -82,34 +86,31 @@ static Access* ReadIndexFromFile(const wxString& filename)
 	return index;
 }
 
-static void WriteIndexToFile(Access* index, const wxString filename)
+// Overwrites any previous file: during background construction the same
+// filename is rewritten repeatedly as the snapshots grow (foreign files which
+// don't carry our GZIP_ID never reach this - see OkIndex).  The in-memory
+// uncompressed_size meanwhile holds the trailer-based estimate, so the header
+// that goes to disk is patched up separately: complete indexes store the real
+// size, snapshots store the 0 partial marker.
+static bool WriteIndexToFile(Access* index, const wxString filename, bool complete, PX_off_t uncompressed_size)
 {
 	if (wxFileName::FileExists(filename))
-	{
-		Console.Warning(L"WARNING: Won't write index - file name exists (please delete it manually): '%s'", WX_STR(filename));
-		return;
-	}
+		wxRemoveFile(filename);
 
 	std::ofstream outfile(PX_wfilename(filename), std::ofstream::binary);
 	outfile.write(GZIP_ID, GZIP_ID_LEN);
 
-	Point* tmp = index->list;
-	index->list = 0; // current pointer is useless on disk, normalize it as 0.
-	outfile.write((char*)index, sizeof(Access));
-	index->list = tmp;
+	Access header = *index;
+	header.list = 0; // current pointer is useless on disk, normalize it as 0.
+	header.size = header.have;
+	header.uncompressed_size = complete ? uncompressed_size : 0;
+	outfile.write((char*)&header, sizeof(Access));
 
 	outfile.write((char*)index->list, sizeof(Point) * index->have);
 	outfile.close();
 
 	// Verify
-	if (fsize(filename) != (s64)GZIP_ID_LEN + sizeof(Access) + sizeof(Point) * index->have)
-	{
-		Console.Warning(L"Warning: Can't write index file to disk: '%s'", WX_STR(filename));
-	}
-	else
-	{
-		Console.WriteLn(Color_Green, L"OK: Gzip quick access index file saved to disk: '%s'", WX_STR(filename));
-	}
+	return fsize(filename) == (s64)GZIP_ID_LEN + sizeof(Access) + sizeof(Point) * index->have;
 }
 
 static wxString INDEX_TEMPLATE_KEY(L"$(f)");
@@ -188,10 +189,37 @@ static wxString iso2indexname(const wxString& isoname)
 	return ApplyTemplate(L"gzip index", appRoot, g_Conf->GzipIsoIndexTemplate, isoname, false);
 }
 
+// A gzip stream ends with the uncompressed size mod 2^32 (ISIZE).  Unwrap it
+// against the compressed file size so GetBlockCount can report a plausible
+// image size while the index is still being built in the background.  Deflate
+// never expands its input by more than a fraction of a percent, so the
+// smallest candidate at least (nearly) as large as the compressed file is the
+// right one for anything short of a >4GB perfectly-compressible pathology;
+// the background scan reports if the guess turns out wrong.
+static PX_off_t EstimateUncompressedSize(const wxString& filename)
+{
+	s64 csize = fsize(filename);
+	if (csize <= 4)
+		return 0;
+
+	unsigned char tail[4] = {0};
+	std::ifstream infile(PX_wfilename(filename), std::ifstream::binary);
+	infile.seekg(csize - 4);
+	infile.read((char*)tail, 4);
+	infile.close();
+
+	PX_off_t est = (PX_off_t)tail[0] | ((PX_off_t)tail[1] << 8) | ((PX_off_t)tail[2] << 16) | ((PX_off_t)tail[3] << 24);
+	s64 slack = csize / 1000 + 0x10000; // worst case stored-block expansion + headers
+	while (est + slack < csize)
+		est += (PX_off_t)1 << 32;
+	return est;
+}
+
 GzippedFileReader::GzippedFileReader(void)
 	: mBytesRead(0)
 	, m_pIndex(0)
 	, m_zstates(0)
+	, m_zstatesCount(0)
 	, m_src(0)
 	, m_cache(GZFILE_CACHE_SIZE_MB)
 {
@@ -206,12 +234,15 @@ void GzippedFileReader::InitZstates()
 		delete[] m_zstates;
 		m_zstates = 0;
 	}
+	m_zstatesCount = 0;
 	if (!m_pIndex)
 		return;
 
 	// having another extra element helps avoiding logic for last (so 2+ instead of 1+)
-	int size = 2 + m_pIndex->uncompressed_size / m_pIndex->span;
-	m_zstates = new Czstate[size]();
+	// (uncompressed_size can be an estimate at this point, hence the clamping
+	// wherever a span index is computed)
+	m_zstatesCount = 2 + m_pIndex->uncompressed_size / m_pIndex->span;
+	m_zstates = new Czstate[m_zstatesCount]();
 }
 
 #ifndef _WIN32
@@ -311,44 +342,155 @@ bool GzippedFileReader::OkIndex()
 	if (indexfile.length() == 0)
 		return false; // iso2indexname(...) will print errors if it can't apply the template
 
-	if (wxFileName::FileExists(indexfile) && (m_pIndex = ReadIndexFromFile(indexfile)))
+	bool canSave = true;
+	if (wxFileName::FileExists(indexfile))
 	{
-		Console.WriteLn(Color_Green, L"OK: Gzip quick access index read from disk: '%s'", WX_STR(indexfile));
-		if (m_pIndex->span != GZFILE_SPAN_DEFAULT)
+		if ((m_pIndex = ReadIndexFromFile(indexfile)))
 		{
-			Console.Warning(L"Note: This index has %1.1f MB intervals, while the current default for new indexes is %1.1f MB.",
-							(float)m_pIndex->span / 1024 / 1024, (float)GZFILE_SPAN_DEFAULT / 1024 / 1024);
-			Console.Warning(L"It will work fine, but if you want to generate a new index with default intervals, delete this index file.");
-			Console.Warning(L"(smaller intervals mean bigger index file and quicker but more frequent decompressions)");
+			if (m_pIndex->uncompressed_size != 0)
+			{
+				Console.WriteLn(Color_Green, L"OK: Gzip quick access index read from disk: '%s'", WX_STR(indexfile));
+				if (m_pIndex->span != GZFILE_SPAN_DEFAULT)
+				{
+					Console.Warning(L"Note: This index has %1.1f MB intervals, while the current default for new indexes is %1.1f MB.",
+									(float)m_pIndex->span / 1024 / 1024, (float)GZFILE_SPAN_DEFAULT / 1024 / 1024);
+					Console.Warning(L"It will work fine, but if you want to generate a new index with default intervals, delete this index file.");
+					Console.Warning(L"(smaller intervals mean bigger index file and quicker but more frequent decompressions)");
+				}
+				m_indexDone = true;
+				InitZstates();
+				return true;
+			}
+			// Partial snapshot from an interrupted session: use it as-is and
+			// let the background scan pick up where it left off.
+			Console.WriteLn(Color_Green, L"OK: Resuming gzip index construction from a partial index (%d points): '%s'",
+							m_pIndex->have, WX_STR(indexfile));
+			m_pIndex->size = m_pIndex->have; // the file holds exactly 'have' points
 		}
-		InitZstates();
-		return true;
+		else
+		{
+			// ReadIndexFromFile printed why; don't clobber a file we don't understand
+			canSave = false;
+		}
+	}
+
+	// No complete index. Build one on a background thread, so the first open
+	// doesn't stall for minutes on big images: reads work as soon as the first
+	// access point exists (reads far beyond the scan frontier wait for it to
+	// catch up), and GetBlockCount meanwhile reports a size estimated from the
+	// gzip trailer.
+	if (!m_pIndex)
+	{
+		Console.Warning(L"Generating a quick access index in the background (only once); reads far into the image may stall until it catches up...");
+		m_pIndex = (Access*)malloc(sizeof(Access));
+		m_pIndex->list = (Point*)malloc(sizeof(Point) << 3); // addpoint grows by doubling
+		m_pIndex->size = 8;
+		m_pIndex->have = 0;
+		m_pIndex->span = GZFILE_SPAN_DEFAULT;
 	}
+	m_pIndex->uncompressed_size = EstimateUncompressedSize(m_filename); // refined when the scan completes
+
+	m_indexfile = canSave ? indexfile : wxString();
+	InitZstates();
 
-	// No valid index file. Generate an index
-	Console.Warning(L"This may take a while (but only once). Scanning compressed file to generate a quick access index...");
+	m_indexCancel = false;
+	m_indexDone = false;
+	if (m_indexThread.joinable())
+		m_indexThread.join();
+	m_indexThread = std::thread([](GzippedFileReader* r) { r->IndexThreadProc(); }, this);
+	return true;
+}
 
-	Access* index;
-	FILE* infile = PX_fopen_rb(m_filename);
-	int len = build_index(infile, GZFILE_SPAN_DEFAULT, &index);
-	printf("\n"); // build_index prints progress without \n's
-	fclose(infile);
+int GzippedFileReader::IndexEmitPoint(void* user, int bits, PX_off_t in, PX_off_t out,
+									  unsigned left, unsigned char* window)
+{
+	GzippedFileReader* self = (GzippedFileReader*)user;
+	if (self->m_indexCancel.load())
+		return 1;
 
-	if (len >= 0)
+	bool snapshot;
 	{
-		m_pIndex = index;
-		WriteIndexToFile((Access*)m_pIndex, indexfile);
+		std::lock_guard<std::mutex> lock(self->m_indexMutex);
+		Access* grown = addpoint(self->m_pIndex, bits, in, out, left, window);
+		if (!grown)
+		{
+			// addpoint freed the whole index on OOM
+			self->m_pIndex = 0;
+			Console.Error(L"ERROR: Out of memory while building gzip index for '%s'", WX_STR(self->m_filename));
+			return 1;
+		}
+		self->m_pIndex = grown;
+		// Periodic snapshot (~every 256MB with the default span) so the next
+		// session resumes roughly where this one ends if the user quits early.
+		snapshot = (self->m_pIndex->have & 63) == 0;
 	}
-	else
+
+	// The write can go without the lock: this thread is the only one that ever
+	// moves or appends to the list, so 'have' points are stable here.
+	if (snapshot && self->m_indexfile.length())
+		WriteIndexToFile(self->m_pIndex, self->m_indexfile, false, 0);
+
+	return 0;
+}
+
+// Runs on m_indexThread: walks the compressed stream from the last known
+// access point (or the gzip header), publishing points through IndexEmitPoint
+// and saving the completed index - or a resumable snapshot - to disk.
+void GzippedFileReader::IndexThreadProc()
+{
+	FILE* in = PX_fopen_rb(m_filename); // private handle; the EE thread seeks m_src
+	if (!in)
 	{
-		Console.Error(L"ERROR (%d): index could not be generated for file '%s'", len, WX_STR(m_filename));
-		free_index(index);
-		InitZstates();
-		return false;
+		Console.Error(L"ERROR: Could not open '%s' for index construction", WX_STR(m_filename));
+		m_indexDone = true;
+		return;
 	}
 
-	InitZstates();
-	return true;
+	Point* resume = 0;
+	{
+		std::lock_guard<std::mutex> lock(m_indexMutex);
+		if (m_pIndex->have > 0)
+		{
+			resume = (Point*)malloc(sizeof(Point));
+			*resume = m_pIndex->list[m_pIndex->have - 1];
+		}
+	}
+
+	PX_off_t total = 0;
+	int ret = scan_index_points(in, m_pIndex->span, resume, IndexEmitPoint, this, &total);
+	free(resume);
+	fclose(in);
+
+	if (ret == 0)
+	{
+		PX_off_t estimate;
+		{
+			std::lock_guard<std::mutex> lock(m_indexMutex);
+			estimate = m_pIndex->uncompressed_size;
+			m_pIndex->uncompressed_size = total;
+		}
+		if (estimate != total)
+			Console.Warning(L"Note: gzip trailer size estimate was off (%lld vs actual %lld); the reported block count corrects on the next open.",
+							(long long)estimate, (long long)total);
+		if (m_indexfile.length())
+		{
+			if (WriteIndexToFile(m_pIndex, m_indexfile, true, total))
+				Console.WriteLn(Color_Green, L"OK: Gzip quick access index file saved to disk: '%s'", WX_STR(m_indexfile));
+			else
+				Console.Warning(L"Warning: Can't write index file to disk: '%s'", WX_STR(m_indexfile));
+		}
+		Console.WriteLn(Color_Green, L"OK: Gzip quick access index built in the background (%d points).", m_pIndex->have);
+	}
+	else if (ret == Z_INDEX_SCAN_STOPPED)
+	{
+		// Canceled (emu closing) - leave a snapshot so the next session resumes here.
+		if (m_pIndex && m_indexfile.length() && m_pIndex->have > 0)
+			WriteIndexToFile(m_pIndex, m_indexfile, false, 0);
+	}
+	else
+		Console.Error(L"ERROR (%d): index could not be generated for file '%s'", ret, WX_STR(m_filename));
+
+	m_indexDone = true;
 }
 
 bool GzippedFileReader::Open(const wxString& fileName)
@@ -396,7 +538,7 @@ int GzippedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 PX_off_t GzippedFileReader::GetOptimalExtractionStart(PX_off_t offset)
 {
 	int span = m_pIndex->span;
-	Czstate& cstate = m_zstates[offset / span];
+	Czstate& cstate = m_zstates[std::min((PX_off_t)(m_zstatesCount - 1), offset / span)];
 	PX_off_t stateOffset = cstate.state.isValid ? cstate.state.out_offset : 0;
 	if (stateOffset && stateOffset <= offset)
 		return stateOffset; // state is faster than indexed
@@ -438,6 +580,25 @@ int GzippedFileReader::_ReadSync(void* pBuffer, PX_off_t offset, uint bytesToRea
 	if (res >= 0)
 		return res;
 
+	// While the index is still being built, extracting far past the scan
+	// frontier would redo the very inflation the background thread is busy
+	// with.  Wait until it has an access point close enough to serve this
+	// offset cheaply (the common case - sequential reads from the start of
+	// the image - sails through without ever sleeping here).
+	while (!m_indexDone.load())
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_indexMutex);
+			if (!m_pIndex)
+				return -1; // index build hit OOM and freed it
+			if (m_pIndex->have > 0 && m_pIndex->list[m_pIndex->have - 1].out + m_pIndex->span > offset)
+				break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	if (!m_pIndex || m_pIndex->have == 0)
+		return -1; // scan failed before producing a single access point
+
 	// Not available from cache. Decompress from optimal starting
 	// point in GZFILE_READ_CHUNK_SIZE chunks and cache each chunk.
 	PTT s = NOW();
@@ -446,9 +607,14 @@ int GzippedFileReader::_ReadSync(void* pBuffer, PX_off_t offset, uint bytesToRea
 	unsigned char* extracted = (unsigned char*)malloc(size);
 
 	int span = m_pIndex->span;
-	int spanix = extractOffset / span;
+	int spanix = std::min(m_zstatesCount - 1, (int)(extractOffset / span));
 	AsyncPrefetchCancel();
-	res = extract(m_src, m_pIndex, extractOffset, extracted, size, &(m_zstates[spanix].state));
+	{
+		// extract searches the access point list, which the index thread may
+		// be growing (and realloc moving) concurrently
+		std::lock_guard<std::mutex> lock(m_indexMutex);
+		res = extract(m_src, m_pIndex, extractOffset, extracted, size, &(m_zstates[spanix].state));
+	}
 	if (res < 0)
 	{
 		free(extracted);
@@ -458,11 +624,11 @@ int GzippedFileReader::_ReadSync(void* pBuffer, PX_off_t offset, uint bytesToRea
 
 	int copied = ChunksCache::CopyAvailable(extracted, extractOffset, res, pBuffer, offset, bytesToRead);
 
-	if (m_zstates[spanix].state.isValid && (extractOffset + res) / span != offset / span)
+	int targetix = std::min(m_zstatesCount - 1, (int)((extractOffset + res) / span));
+	if (m_zstates[spanix].state.isValid && (extractOffset + res) / span != offset / span && targetix != spanix)
 	{
 		// The state no longer matches this span.
 		// move the state to the appropriate span because it will be faster than using the index
-		int targetix = (extractOffset + res) / span;
 		m_zstates[targetix].Kill();
 		// We have elements for the entire file, and another one.
 		m_zstates[targetix].state.in_offset = m_zstates[spanix].state.in_offset;
@@ -501,6 +667,15 @@ int GzippedFileReader::_ReadSync(void* pBuffer, PX_off_t offset, uint bytesToRea
 
 void GzippedFileReader::Close()
 {
+	// Stop background indexing first; the thread appends into m_pIndex (and
+	// writes a resume snapshot on its way out).
+	m_indexCancel = true;
+	if (m_indexThread.joinable())
+		m_indexThread.join();
+	m_indexCancel = false;
+	m_indexDone = false;
+	m_indexfile.Empty();
+
 	m_filename.Empty();
 	if (m_pIndex)
 	{
@@ -509,6 +684,11 @@ void GzippedFileReader::Close()
 	}
 
 	InitZstates(); // results in delete because no index
+
+	// Cache effectiveness for this session, useful when tuning the cache size
+	if (m_cache.GetHits() + m_cache.GetMisses() > 0)
+		DevCon.WriteLn(Color_Gray, L"gunzip: cache %u hits / %u misses",
+					   m_cache.GetHits(), m_cache.GetMisses());
 	m_cache.Clear();
 
 	if (m_src)
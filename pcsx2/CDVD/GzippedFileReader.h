@@ -21,6 +21,10 @@ typedef struct zstate Zstate;
 #include "ChunksCache.h"
 #include "zlib_indexed.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #define GZFILE_SPAN_DEFAULT (1048576L * 4)  /* distance between direct access points when creating a new index */
 #define GZFILE_READ_CHUNK_SIZE (256 * 1024) /* zlib extraction chunks size (at 0-based boundaries) */
 #define GZFILE_CACHE_SIZE_MB 200            /* cache size for extracted data. must be at least GZFILE_READ_CHUNK_SIZE (in MB)*/
@@ -49,6 +53,8 @@ public:
 	{
 		// type and formula copied from FlatFileReader
 		// FIXME? : Shouldn't it be uint and (size - m_dataoffset) / m_blocksize ?
+		// Note: while the index is still being built in the background,
+		// uncompressed_size holds an estimate unwrapped from the gzip trailer.
 		return (int)((m_pIndex ? m_pIndex->uncompressed_size : 0) / m_blocksize);
 	};
 
@@ -70,16 +76,31 @@ private:
 		Zstate state;
 	};
 
-	bool OkIndex(); // Verifies that we have an index, or try to create one
+	bool OkIndex(); // Verifies that we have an index, or kick off creating one
 	PX_off_t GetOptimalExtractionStart(PX_off_t offset);
 	int _ReadSync(void* pBuffer, PX_off_t offset, uint bytesToRead);
 	void InitZstates();
 
+	// Background index construction (runs on m_indexThread)
+	void IndexThreadProc();
+	static int IndexEmitPoint(void* user, int bits, PX_off_t in, PX_off_t out,
+							  unsigned left, unsigned char* window);
+
 	int mBytesRead;   // Temp sync read result when simulating async read
 	Access* m_pIndex; // Quick access index
 	Czstate* m_zstates;
+	int m_zstatesCount; // Allocated entries; span indexes are clamped to this
 	FILE* m_src;
 
+	// The EE thread owns m_src, m_zstates and the cache; the index thread only
+	// appends access points, with m_indexMutex held around anything that can
+	// grow (and therefore move) m_pIndex->list.
+	std::thread m_indexThread;
+	std::mutex m_indexMutex;
+	std::atomic<bool> m_indexCancel{false};
+	std::atomic<bool> m_indexDone{false};
+	wxString m_indexfile; // Target for incremental index snapshots ("" = don't save)
+
 	ChunksCache m_cache;
 
 #ifdef _WIN32
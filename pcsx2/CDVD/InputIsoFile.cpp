@@ -108,6 +108,12 @@ int InputIsoFile::FinishRead3(u8* dst, uint mode)
 			return ret;
 	}
 
+	// cdvdReadInterrupt calls back in here for every DMA retry of the same
+	// sector, so don't redo the framing when the previous delivery already
+	// put this exact sector into this exact buffer.
+	if (m_current_lsn == m_delivered_lsn && mode == m_delivered_mode && dst == m_delivered_dst)
+		return 0;
+
 	switch (mode)
 	{
 		case CDVD_MODE_2352:
@@ -156,6 +162,10 @@ int InputIsoFile::FinishRead3(u8* dst, uint mode)
 		dst[diff - 9] = 2;
 	}
 
+	m_delivered_lsn = m_current_lsn;
+	m_delivered_mode = mode;
+	m_delivered_dst = dst;
+
 	return 0;
 }
 
@@ -185,6 +195,10 @@ void InputIsoFile::_init()
 	m_current_lsn = -1;
 	m_read_lsn = -1;
 	m_reader = NULL;
+
+	m_delivered_lsn = -1;
+	m_delivered_mode = -1;
+	m_delivered_dst = NULL;
 }
 
 // Tests the specified filename to see if it is a supported ISO type.  This function typically
@@ -268,6 +282,12 @@ bool InputIsoFile::Open(const wxString& srcfile, bool testOnly)
 			delete m_reader_old;
 	}
 
+	// Optionally pin the whole image in memory.  Mostly useful for timing-
+	// sensitive setups where disc access latency has to be ruled out; blockdumps
+	// are sparse by nature so they keep using their own reader.
+	if (EmuConfig.CdvdPrecache && !isBlockdump)
+		m_reader = PrecachedFileReader::Precache(m_reader);
+
 	m_blocks = m_reader->GetBlockCount();
 
 	Console.WriteLn(Color_StrongBlue, L"isoFile open ok: %s", WX_STR(m_filename));
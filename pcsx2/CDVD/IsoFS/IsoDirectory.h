@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 enum IsoFS_Type
 {
 	FStype_ISO9660 = 1,
@@ -28,6 +30,12 @@ public:
 	std::vector<IsoFileDescriptor> files;
 	IsoFS_Type m_fstype;
 
+protected:
+	// Name -> files[] index, built by Init.  Root directories on asset-heavy
+	// discs can hold thousands of entries, so lookups shouldn't rescan the
+	// record list for every file.
+	std::unordered_map<std::wstring, int> m_nameMap;
+
 public:
 	IsoDirectory(SectorSource& r);
 	IsoDirectory(SectorSource& r, IsoFileDescriptor directoryEntry);
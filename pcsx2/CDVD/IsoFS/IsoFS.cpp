@@ -142,6 +142,12 @@ void IsoDirectory::Init(const IsoFileDescriptor& directoryEntry)
 	}
 
 	b[0] = 0;
+
+	// emplace keeps the first occurrence of a duplicated name, which matches
+	// what the old linear scan in GetIndexOf used to find.
+	m_nameMap.clear();
+	for (unsigned int i = 0; i < files.size(); ++i)
+		m_nameMap.emplace(files[i].name.ToStdWstring(), (int)i);
 }
 
 const IsoFileDescriptor& IsoDirectory::GetEntry(int index) const
@@ -151,11 +157,9 @@ const IsoFileDescriptor& IsoDirectory::GetEntry(int index) const
 
 int IsoDirectory::GetIndexOf(const wxString& fileName) const
 {
-	for (unsigned int i = 0; i < files.size(); i++)
-	{
-		if (files[i].name == fileName)
-			return i;
-	}
+	auto it = m_nameMap.find(fileName.ToStdWstring());
+	if (it != m_nameMap.end())
+		return it->second;
 
 	throw Exception::FileNotFound(fileName);
 }
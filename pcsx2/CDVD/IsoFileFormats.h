@@ -20,6 +20,7 @@
 #include "AsyncFileReader.h"
 #include "CompressedFileReader.h"
 #include <memory>
+#include <unordered_set>
 
 enum isoType
 {
@@ -65,6 +66,12 @@ protected:
 	uint m_read_count;
 	u8 m_readbuffer[MaxReadUnit * CD_FRAMESIZE_RAW];
 
+	// Last sector/mode/destination delivered by FinishRead3, used to skip
+	// re-framing the same sector when the DMA retry path asks again.
+	uint m_delivered_lsn;
+	uint m_delivered_mode;
+	u8* m_delivered_dst;
+
 public:
 	InputIsoFile();
 	virtual ~InputIsoFile();
@@ -113,8 +120,12 @@ protected:
 	// total number of blocks in the ISO image (including all parts)
 	u32 m_blocks;
 
-	// dtable is used when reading blockdumps
-	std::vector<u32> m_dtable;
+	// LSNs already written to the dump, so re-reads of a sector aren't recorded twice
+	std::unordered_set<u32> m_dtable;
+
+	// Coalesces v2 sector records into multi-MB sequential writes, so dumping
+	// while playing doesn't issue two small write syscalls per sector read.
+	std::vector<u8> m_wbuffer;
 
 	std::unique_ptr<wxFileOutputStream> m_outstream;
 
@@ -141,6 +152,7 @@ protected:
 	void _init();
 
 	void WriteBuffer(const void* src, size_t size);
+	void FlushBuffer();
 
 	template <typename T>
 	void WriteValue(const T& data)
@@ -20,6 +20,12 @@
 
 #include <errno.h>
 
+// Sector records are coalesced into writes of this size, so that dumping while
+// playing costs the IOP path one large sequential write every several hundred
+// sectors instead of two small syscalls per sector.  The OS flushes the page
+// cache in the background from there.
+static const size_t DumpWriteBufferSize = _1mb * 2;
+
 void pxStream_OpenCheck(const wxStreamBase& stream, const wxString& fname, const wxString& mode)
 {
 	if (stream.IsOk())
@@ -91,30 +97,62 @@ void OutputIsoFile::WriteSector(const u8* src, uint lsn)
 	if (m_version == 2)
 	{
 		// Find and ignore blocks that have already been dumped:
-		if (std::any_of(std::begin(m_dtable), std::end(m_dtable), [=](const u32 entry) { return entry == lsn; }))
+		if (!m_dtable.insert(lsn).second)
 			return;
 
-		m_dtable.push_back(lsn);
+		// The v2 format is append-only, so records can pile up in the write
+		// buffer until there's enough for a decent sequential write.
+		const u8* lsnbytes = (const u8*)&lsn;
+		m_wbuffer.insert(m_wbuffer.end(), lsnbytes, lsnbytes + sizeof(u32));
+		m_wbuffer.insert(m_wbuffer.end(), src + m_blockofs, src + m_blockofs + m_blocksize);
 
-		WriteValue<u32>(lsn);
-	}
-	else
-	{
-		wxFileOffset ofs = (wxFileOffset)lsn * m_blocksize + m_offset;
+		if (m_wbuffer.size() >= DumpWriteBufferSize)
+			FlushBuffer();
 
-		m_outstream->SeekO(ofs);
+		return;
 	}
 
+	wxFileOffset ofs = (wxFileOffset)lsn * m_blocksize + m_offset;
+
+	m_outstream->SeekO(ofs);
+
 	WriteBuffer(src + m_blockofs, m_blocksize);
 }
 
 void OutputIsoFile::Close()
 {
+	if (IsOpened())
+	{
+		try
+		{
+			FlushBuffer();
+		}
+		catch (Exception::BaseException& ex)
+		{
+			// Close runs from the destructor too, so the error can only be reported.
+			Console.Error(L"Failed to flush block dump: " + ex.DiagMsg());
+		}
+	}
+
+	// Also release the stream; writes are buffered now, so leaving it open
+	// behind the caller's back would keep the file tail unflushed.
+	m_outstream = nullptr;
+
 	m_dtable.clear();
+	m_wbuffer.clear();
 
 	_init();
 }
 
+void OutputIsoFile::FlushBuffer()
+{
+	if (m_wbuffer.empty())
+		return;
+
+	WriteBuffer(m_wbuffer.data(), m_wbuffer.size());
+	m_wbuffer.clear();
+}
+
 void OutputIsoFile::WriteBuffer(const void* src, size_t size)
 {
 	m_outstream->Write(src, size);
@@ -20,6 +20,10 @@
 // If buffers are smaller than that, we can't keep up with linear reads
 static constexpr u32 MINIMUM_SIZE = 128 * 1024;
 
+// Number of consecutive requests that must repeat the same seek delta before
+// the readahead trusts it (see UpdateStride / Loop)
+static constexpr u32 STRIDE_CONFIRMATIONS = 2;
+
 ThreadedFileReader::ThreadedFileReader()
 {
 	m_readThread = std::thread([](ThreadedFileReader* r){ r->Loop(); }, this);
@@ -74,6 +78,20 @@ void ThreadedFileReader::Loop()
 		u32 requestSize = m_requestSize;
 		void* ptr = m_requestPtr.load(std::memory_order_relaxed);
 
+		// Readahead target: normally the data immediately following the
+		// request, but once the request stream settles into a fixed seek
+		// stride (interleaved audio/video streams on DVD do this constantly)
+		// aim at where the next request will land instead - the contiguous
+		// guess would miss every time.  For purely linear reads the stride
+		// equals the request size, so this degenerates to the old behavior.
+		u64 readaheadOffset = requestOffset + requestSize;
+		if (m_strideMatches >= STRIDE_CONFIRMATIONS)
+		{
+			const s64 predicted = static_cast<s64>(m_lastRequestOffset) + m_strideDelta;
+			if (predicted > 0)
+				readaheadOffset = static_cast<u64>(predicted);
+		}
+
 		m_running = true;
 		lock.unlock();
 
@@ -90,7 +108,7 @@ void ThreadedFileReader::Loop()
 		if (ok)
 		{
 			// Readahead
-			Chunk chunk = ChunkForOffset(requestOffset + requestSize);
+			Chunk chunk = ChunkForOffset(readaheadOffset);
 			if (chunk.chunkID >= 0)
 			{
 				int buffersFilled = 0;
@@ -239,6 +257,20 @@ bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, co
 	return allDone;
 }
 
+void ThreadedFileReader::UpdateStride(u64 offset)
+{
+	const s64 delta = static_cast<s64>(offset - m_lastRequestOffset);
+	// Repeat reads of the same spot carry no pattern information, skip them
+	if (delta == 0)
+		return;
+	if (delta == m_strideDelta)
+		m_strideMatches = std::min(m_strideMatches + 1, 16u);
+	else
+		m_strideMatches = 0;
+	m_strideDelta = delta;
+	m_lastRequestOffset = offset;
+}
+
 bool ThreadedFileReader::Open(const wxString& fileName)
 {
 	CancelAndWaitUntilStopped();
@@ -252,6 +284,7 @@ int ThreadedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 	u32 size = count * blocksize;
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
+		UpdateStride(offset);
 		if (TryCachedRead(pBuffer, offset, size, l))
 			return m_amtRead;
 
@@ -301,6 +334,7 @@ void ThreadedFileReader::BeginRead(void* pBuffer, uint sector, uint count)
 	u32 size = count * blocksize;
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
+		UpdateStride(offset);
 		if (TryCachedRead(pBuffer, offset, size, l))
 			return;
 		if (size == 0)
@@ -346,6 +380,9 @@ void ThreadedFileReader::Close(void)
 	CancelAndWaitUntilStopped();
 	for (auto& buf : m_buffer)
 		buf.size.store(0, std::memory_order_relaxed);
+	m_lastRequestOffset = 0;
+	m_strideDelta = 0;
+	m_strideMatches = 0;
 	Close2();
 }
 
@@ -78,6 +78,13 @@ private:
 	Buffer m_buffer[2];
 	u32 m_nextBuffer = 0;
 
+	/// Seek-stride detector state, updated per request while holding `m_mtx`:
+	/// offset of the last request, the delta between the last two requests,
+	/// and how many consecutive requests repeated that delta
+	u64 m_lastRequestOffset = 0;
+	s64 m_strideDelta = 0;
+	u32 m_strideMatches = 0;
+
 	std::thread m_readThread;
 	std::mutex m_mtx;
 	std::condition_variable m_condition;
@@ -107,6 +114,8 @@ private:
 	/// Adjusts pointer, offset, and size if successful
 	/// Returns true if no additional reads are necessary
 	bool TryCachedRead(void*& buffer, u64& offset, u32& size, const std::lock_guard<std::mutex>&);
+	/// Feed a request offset to the seek-stride detector (hold `m_mtx` while calling)
+	void UpdateStride(u64 offset);
 
 public:
 	bool Open(const wxString& fileName) final override;
@@ -216,20 +216,34 @@ local struct access* addpoint(struct access* index, int bits,
 	return index;
 }
 
-/* Make one entire pass through the compressed stream and build an index, with
-   access points about every span bytes of uncompressed output -- span is
-   chosen to balance the speed of random access against the memory requirements
-   of the list, about 32K bytes per access point.  Note that data after the end
-   of the first zlib or gzip stream in the file is ignored.  build_index()
-   returns the number of access points on success (>= 1), Z_MEM_ERROR for out
-   of memory, Z_DATA_ERROR for an error in the input file, or Z_ERRNO for a
-   file read error.  On success, *built points to the resulting index. */
-local int build_index(FILE* in, PX_off_t span, struct access** built)
+/* Callback invoked by scan_index_points() for each access point encountered:
+   the same (bits, in, out, left, window) tuple that addpoint() stores, plus
+   the caller's cookie.  Return 0 to keep scanning, nonzero to stop early (the
+   scan then returns Z_INDEX_SCAN_STOPPED). */
+typedef int (*index_point_fn)(void* user, int bits, PX_off_t in, PX_off_t out,
+							  unsigned left, unsigned char* window);
+
+#define Z_INDEX_SCAN_STOPPED 1
+
+/* Make one pass through the compressed stream, reporting an access point via
+   emit() about every span bytes of uncompressed output -- span is chosen to
+   balance the speed of random access against the memory requirements of the
+   list, about 32K bytes per access point.  The scan does not own the list:
+   build_index() keeps the classic "return a malloc'd Access" API on top of
+   this, while callers that publish points elsewhere (incrementally, or from
+   another thread) supply their own emit callback.  When from is not NULL the
+   scan resumes mid-stream at that access point instead of at the gzip/zlib
+   header, which is what makes a partially built index resumable.  Note that
+   data after the end of the first zlib or gzip stream in the file is ignored.
+   Returns 0 when the end of the stream is reached (*total_out then holds the
+   total uncompressed size), Z_INDEX_SCAN_STOPPED if emit asked to stop, or
+   Z_MEM_ERROR / Z_DATA_ERROR / Z_ERRNO as build_index() always has. */
+local int scan_index_points(FILE* in, PX_off_t span, const struct point* from,
+							index_point_fn emit, void* user, PX_off_t* total_out)
 {
 	int ret;
-	PX_off_t totin, totout, totPrinted; /* our own total counters to avoid 4GB limit */
-	PX_off_t last;                      /* totout value of last access point */
-	struct access* index;               /* access points being generated */
+	PX_off_t totin, totout; /* our own total counters to avoid 4GB limit */
+	PX_off_t last;          /* totout value of last access point */
 	z_stream strm;
 	unsigned char input[CHUNK];
 	unsigned char window[WINSIZE];
@@ -240,15 +254,47 @@ local int build_index(FILE* in, PX_off_t span, struct access** built)
 	strm.opaque = Z_NULL;
 	strm.avail_in = 0;
 	strm.next_in = Z_NULL;
-	ret = inflateInit2(&strm, 47); /* automatic zlib or gzip decoding */
-	if (ret != Z_OK)
-		return ret;
+	if (from == NULL)
+	{
+		ret = inflateInit2(&strm, 47); /* automatic zlib or gzip decoding */
+		if (ret != Z_OK)
+			return ret;
+		totin = totout = last = 0;
+	}
+	else
+	{
+		/* resume: raw inflate from the stored block boundary, seeded with the
+           32K dictionary kept in the point -- the same recipe extract() uses */
+		ret = inflateInit2(&strm, -15);
+		if (ret != Z_OK)
+			return ret;
+		if (PX_fseeko(in, from->in - (from->bits ? 1 : 0), SEEK_SET) == -1)
+		{
+			(void)inflateEnd(&strm);
+			return Z_ERRNO;
+		}
+		if (from->bits)
+		{
+			ret = getc(in);
+			if (ret == -1)
+			{
+				(void)inflateEnd(&strm);
+				return ferror(in) ? Z_ERRNO : Z_DATA_ERROR;
+			}
+			inflatePrime(&strm, from->bits, ret >> (8 - from->bits));
+		}
+		inflateSetDictionary(&strm, from->window, WINSIZE);
+		/* seed the sliding window too; the slight rotation mismatch only
+           matters if a point is emitted within 32K of the resume position,
+           which cannot happen with any sane (span >> WINSIZE) setting */
+		memcpy(window, from->window, WINSIZE);
+		totin = from->in;
+		totout = last = from->out;
+	}
 
-	/* inflate the input, maintain a sliding window, and build an index -- this
+	/* inflate the input, maintain a sliding window, and report points -- this
        also validates the integrity of the compressed data using the check
        information at the end of the gzip or zlib stream */
-	totin = totout = last = totPrinted = 0;
-	index = NULL; /* will be allocated by first addpoint() */
 	strm.avail_out = 0;
 	do
 	{
@@ -257,12 +303,12 @@ local int build_index(FILE* in, PX_off_t span, struct access** built)
 		if (ferror(in))
 		{
 			ret = Z_ERRNO;
-			goto build_index_error;
+			goto scan_index_error;
 		}
 		if (strm.avail_in == 0)
 		{
 			ret = Z_DATA_ERROR;
-			goto build_index_error;
+			goto scan_index_error;
 		}
 		strm.next_in = input;
 
@@ -286,7 +332,7 @@ local int build_index(FILE* in, PX_off_t span, struct access** built)
 			if (ret == Z_NEED_DICT)
 				ret = Z_DATA_ERROR;
 			if (ret == Z_MEM_ERROR || ret == Z_DATA_ERROR)
-				goto build_index_error;
+				goto scan_index_error;
 			if (ret == Z_STREAM_END)
 				break;
 
@@ -302,44 +348,91 @@ local int build_index(FILE* in, PX_off_t span, struct access** built)
 			if ((strm.data_type & 128) && !(strm.data_type & 64) &&
 				(totout == 0 || totout - last > span))
 			{
-				index = addpoint(index, strm.data_type & 7, totin,
-								 totout, strm.avail_out, window);
-				if (index == NULL)
+				if (emit(user, strm.data_type & 7, totin,
+						 totout, strm.avail_out, window))
 				{
-					ret = Z_MEM_ERROR;
-					goto build_index_error;
+					ret = Z_INDEX_SCAN_STOPPED;
+					goto scan_index_error;
 				}
 				last = totout;
 			}
 		} while (strm.avail_in != 0);
-		if (totin / (50 * 1024 * 1024) != totPrinted / (50 * 1024 * 1024))
-		{
-			printf("%dMB ", (int)(totin / (1024 * 1024)));
-			totPrinted = totin;
-		}
 	} while (ret != Z_STREAM_END);
 
-	if (index == NULL)
+	(void)inflateEnd(&strm);
+	if (total_out != NULL)
+		*total_out = totout;
+	return 0;
+
+	/* return error (or requested stop) */
+scan_index_error:
+	(void)inflateEnd(&strm);
+	return ret;
+}
+
+/* addpoint()-into-a-list glue for build_index(), plus the classic progress
+   printfs (roughly every 50MB of compressed input) */
+struct build_index_ctx
+{
+	struct access* index;
+	PX_off_t totPrinted;
+	int err;
+};
+
+local int build_index_emit(void* user, int bits, PX_off_t in, PX_off_t out,
+						   unsigned left, unsigned char* window)
+{
+	struct build_index_ctx* ctx = (struct build_index_ctx*)user;
+	ctx->index = addpoint(ctx->index, bits, in, out, left, window);
+	if (ctx->index == NULL)
+	{
+		ctx->err = Z_MEM_ERROR;
+		return 1;
+	}
+	if (in / (50 * 1024 * 1024) != ctx->totPrinted / (50 * 1024 * 1024))
+	{
+		printf("%dMB ", (int)(in / (1024 * 1024)));
+		ctx->totPrinted = in;
+	}
+	return 0;
+}
+
+/* Make one entire pass through the compressed stream and build an index.
+   build_index() returns the number of access points on success (>= 1),
+   Z_MEM_ERROR for out of memory, Z_DATA_ERROR for an error in the input file,
+   or Z_ERRNO for a file read error.  On success, *built points to the
+   resulting index. */
+local int build_index(FILE* in, PX_off_t span, struct access** built)
+{
+	struct build_index_ctx ctx;
+	PX_off_t totout = 0;
+	int ret;
+
+	ctx.index = NULL; /* will be allocated by first addpoint() */
+	ctx.totPrinted = 0;
+	ctx.err = Z_OK;
+	ret = scan_index_points(in, span, NULL, build_index_emit, &ctx, &totout);
+	if (ret != 0)
+	{
+		/* addpoint() already freed the list if it hit Z_MEM_ERROR */
+		if (ret != Z_INDEX_SCAN_STOPPED && ctx.index != NULL)
+			free_index(ctx.index);
+		return ret == Z_INDEX_SCAN_STOPPED ? ctx.err : ret;
+	}
+
+	if (ctx.index == NULL)
 	{
 		// Could happen if the start of the stream in Z_STREAM_END
 		return 0;
 	}
 
-	/* clean up and return index (release unused entries in list) */
-	(void)inflateEnd(&strm);
-	index->list = (Point*)realloc(index->list, sizeof(struct point) * index->have);
-	index->size = index->have;
-	index->span = span;
-	index->uncompressed_size = totout;
-	*built = index;
-	return index->have;
-
-	/* return error */
-build_index_error:
-	(void)inflateEnd(&strm);
-	if (index != NULL)
-		free_index(index);
-	return ret;
+	/* return index (release unused entries in list) */
+	ctx.index->list = (Point*)realloc(ctx.index->list, sizeof(struct point) * ctx.index->have);
+	ctx.index->size = ctx.index->have;
+	ctx.index->span = span;
+	ctx.index->uncompressed_size = totout;
+	*built = ctx.index;
+	return ctx.index->have;
 }
 
 typedef struct zstate
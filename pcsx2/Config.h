@@ -380,7 +380,9 @@ struct Pcsx2Config
 				WaitLoop		:1,		// enables constant loop detection and fast-forwarding
 				vuFlagHack		:1,		// microVU specific flag hack
 				vuThread		:1,		// Enable Threaded VU1
-				vu1Instant		:1;		// Enable Instant VU1 (Without MTVU only)
+				vu1Instant		:1,		// Enable Instant VU1 (Without MTVU only)
+				eeCycleAuto		:1;		// closed-loop EECycleRate controller; owns the scalar
+										// within [-3..0] while active (see Counters.cpp)
 		BITFIELD_END
 
 		s8	EECycleRate;		// EE cycle rate selector (1.0, 1.5, 2.0)
@@ -438,6 +440,7 @@ struct Pcsx2Config
 			CdvdVerboseReads	:1,		// enables cdvd read activity verbosely dumped to the console
 			CdvdDumpBlocks		:1,		// enables cdvd block dumping
 			CdvdShareWrite		:1,		// allows the iso to be modified while it's loaded
+			CdvdPrecache		:1,		// loads the complete iso into memory at boot (rules out disc access latency)
 			EnablePatches		:1,		// enables patch detection and application
 			EnableCheats		:1,		// enables cheat detection and application
 			EnableIPC		    :1,		// enables inter-process communication 
@@ -448,6 +451,12 @@ struct Pcsx2Config
 		// when enabled uses BOOT2 injection, skipping sony bios splashes
 			UseBOOT2Injection	:1,
 			BackupSavestate		:1,
+		// saves serialize EE main memory from a persistent dirty-page-synced image,
+		// keeping the paused-core window small enough for frequent autosaving
+			IncrementalSavestates:1,
+		// keeps a delta-encoded in-memory history of recent machine states which the
+		// States_Rewind hotkey steps back through
+			EnableRewind		:1,
 		// enables simulated ejection of memory cards when loading savestates
 			McdEnableEjection	:1,
 			McdFolderAutoManage	:1,
@@ -457,7 +466,13 @@ struct Pcsx2Config
 
 			ConsoleToStdio		:1,
 			HostFs				:1,
-			FullBootConfig		:1;
+			FullBootConfig		:1,
+
+		// detaches emulation from the host clock: the CDVD RTC seeds from a fixed
+		// date instead of the wall clock and all frame pacing is driven purely by
+		// emulated cycle counts, so repeated headless runs are reproducible even
+		// on oversubscribed machines
+			DeterministicClock	:1;
 	BITFIELD_END
 
 	CpuOptions			Cpu;
@@ -29,6 +29,8 @@
 #include "VUmicro.h"
 
 #include "ps2/HwInternal.h"
+#include "FrameProfiler.h"
+#include "SPU2/spu2.h"
 #ifdef _WIN32
 #include "PAD/Windows/PAD.h"
 #else
@@ -407,9 +409,83 @@ u32 UpdateVSyncRate()
 	return static_cast<u32>(m_iTicks);
 }
 
+// --- Adaptive EE cyclerate ---------------------------------------------
+// Closed-loop controller for the EE cyclerate scalar (Speedhacks.eeCycleAuto):
+// watches how early each frame reaches the framelimiter and, one notch per
+// decision window, walks EECycleRate between -3 (max underclock) and 0
+// (stock).  It replaces hand-tuning the scalar per game and per hardware
+// tier: a machine that can't hold the target rate gets stepped down until it
+// can, and the hack is unwound again as soon as the headroom (and SPU2's
+// buffer depth) says it's safe.
+
+static const int EECYCLE_WINDOW = 120; // frames per decision (~2 seconds NTSC)
+static const int EECYCLE_COOLDOWN = 2; // decision windows to hold after a change
+
+static s64 s_eeAutoDeltaSum = 0;
+static int s_eeAutoLateFrames = 0;
+static int s_eeAutoFrames = 0;
+static int s_eeAutoHold = 0;
+
+static void eeCycleAutoReset()
+{
+	s_eeAutoDeltaSum = 0;
+	s_eeAutoLateFrames = 0;
+	s_eeAutoFrames = 0;
+}
+
+// sDeltaTime is the limiter's arrival delta: negative means the frame got
+// here early (headroom), positive means it overran its slot.
+static __fi void eeCycleAutoUpdate(s64 sDeltaTime, s64 iTicks)
+{
+	if (!EmuConfig.Speedhacks.eeCycleAuto)
+		return;
+
+	s_eeAutoDeltaSum += sDeltaTime;
+	if (sDeltaTime > 0)
+		s_eeAutoLateFrames++;
+
+	if (++s_eeAutoFrames < EECYCLE_WINDOW)
+		return;
+
+	const double headroom = -(double)s_eeAutoDeltaSum / ((double)iTicks * s_eeAutoFrames);
+	const bool late = s_eeAutoLateFrames > (s_eeAutoFrames / 8);
+	eeCycleAutoReset();
+
+	if (s_eeAutoHold > 0)
+	{
+		s_eeAutoHold--;
+		return;
+	}
+
+	// SPU2's buffer depth is the canary: it drains when emulation slips below
+	// realtime, and it thrashes when an underclock notch broke the game's
+	// timing, so any unhealthy reading vetoes unwinding the hack.
+	const float audio = SPU2getBufferStatus();
+	const s8 rate = EmuConfig.Speedhacks.EECycleRate;
+	s8 newrate = rate;
+
+	if ((late || audio < -0.5f) && rate > -3)
+		newrate = rate - 1; // not keeping up: underclock one notch
+	else if (!late && headroom > 0.35 && audio > -0.25f && rate < 0)
+		newrate = rate + 1; // sustained headroom, healthy audio: back toward stock
+
+	if (newrate == rate)
+		return;
+
+	Console.WriteLn(Color_StrongGray, "EE cyclerate auto: %d -> %d (headroom %.0f%%, audio %.2f)",
+		rate, newrate, headroom * 100, audio);
+
+	// The scalar is baked into recompiled blocks, so the rec has to flush;
+	// the reset is deferred until the current execution chain exits.
+	EmuConfig.Speedhacks.EECycleRate = newrate;
+	Cpu->Reset();
+	s_eeAutoHold = EECYCLE_COOLDOWN;
+}
+
 void frameLimitReset()
 {
 	m_iStart = GetCPUTicks();
+	eeCycleAutoReset();
 }
 
 // Convenience function to update UI thread and set patches. 
@@ -425,7 +501,8 @@ static __fi void frameLimitUpdateCore()
 static __fi void frameLimit()
 {
 	// Framelimiter off in settings? Framelimiter go brrr.
-	if (!EmuConfig.GS.FrameLimitEnable)
+	// A deterministic clock means no host-time pacing at all, same deal.
+	if (!EmuConfig.GS.FrameLimitEnable || EmuConfig.DeterministicClock)
 	{
 		frameLimitUpdateCore();
 		return;
@@ -435,6 +512,10 @@ static __fi void frameLimit()
 	const u64 iEnd = GetCPUTicks();                // The current tick we actually stopped on.
 	const s64 sDeltaTime = iEnd - uExpectedEnd;    // The diff between when we stopped and when we expected to.
 
+	// Feed the adaptive cyclerate controller before any pacing happens; it
+	// wants the raw arrival delta, not the post-sleep one.
+	eeCycleAutoUpdate(sDeltaTime, m_iTicks);
+
 	// If frame ran too long...
 	if (sDeltaTime >= m_iTicks)
 	{
@@ -462,6 +543,8 @@ static __fi void frameLimit()
 		// SKREEEEEEEE
 	}
 
+	FrameProfiler::AddPhase(FrameProfiler::Phase_FrameLimit, GetCPUTicks() - iEnd);
+
 	// Finally, set our next frame start to when this one ends
 	m_iStart = uExpectedEnd;
 	frameLimitUpdateCore();
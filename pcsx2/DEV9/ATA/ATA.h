@@ -134,6 +134,17 @@ private:
 	u8* readBuffer = nullptr;
 	//Read Buffer
 
+	//Readahead Buffer
+	//Filled by the io thread once the guest reads sequentially, so that the
+	//next demand read is served from memory instead of hitting the image file
+	static const int raMaxSectors = 256;
+	u64 raStartSector = 0;
+	int raSectorCount = 0;
+	u64 raNextSector = 0;
+	int raSequentialReads = 0;
+	u8* raBuffer = nullptr;
+	//Readahead Buffer
+
 	//PIO Buffer
 	int pioPtr;
 	int pioEnd;
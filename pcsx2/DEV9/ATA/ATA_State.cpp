@@ -31,6 +31,11 @@ int ATA::Open(ghc::filesystem::path hddPath)
 	readBufferLen = 256 * 512;
 	readBuffer = new u8[readBufferLen];
 
+	raBuffer = new u8[raMaxSectors * 512];
+	raSectorCount = 0;
+	raNextSector = 0;
+	raSequentialReads = 0;
+
 	CreateHDDinfo(config.HddSize);
 
 	//Open File
@@ -92,6 +97,10 @@ void ATA::Close()
 
 	delete[] readBuffer;
 	readBuffer = nullptr;
+
+	delete[] raBuffer;
+	raBuffer = nullptr;
+	raSectorCount = 0;
 }
 
 void ATA::ResetBegin()
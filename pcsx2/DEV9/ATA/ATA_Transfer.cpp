@@ -73,18 +73,56 @@ void ATA::IO_Read()
 	}
 
 	const u64 pos = lba * 512;
-	hddImage.seekg(pos, std::ios::beg);
-	if (hddImage.fail())
+	if (raSectorCount != 0 && (u64)lba >= raStartSector &&
+		(u64)lba + nsector <= raStartSector + raSectorCount)
 	{
-		Console.Error("DEV9: ATA: File read error");
-		pxAssert(false);
-		abort();
+		//Served entirely from the readahead buffer
+		memcpy(readBuffer, &raBuffer[((u64)lba - raStartSector) * 512], (u64)nsector * 512);
 	}
-	hddImage.read((char*)readBuffer, (u64)nsector * 512);
+	else
+	{
+		hddImage.seekg(pos, std::ios::beg);
+		if (hddImage.fail())
+		{
+			Console.Error("DEV9: ATA: File read error");
+			pxAssert(false);
+			abort();
+		}
+		hddImage.read((char*)readBuffer, (u64)nsector * 512);
+	}
+
+	//Track whether the guest is reading sequentially
+	if ((u64)lba == raNextSector)
+		raSequentialReads++;
+	else
+		raSequentialReads = 0;
+	raNextSector = lba + nsector;
+
 	{
 		std::lock_guard ioSignallock(ioMutex);
 		ioRead = false;
 	}
+
+	//With the demand read delivered, prefetch what a sequential reader will ask
+	//for next.  This runs after completion is signalled, so it overlaps with the
+	//guest consuming the data it just got.
+	raSectorCount = 0;
+	if (raSequentialReads >= 2)
+	{
+		const s64 raCount = std::min<s64>(raMaxSectors, (s64)(hddImageSize / 512) - (s64)raNextSector);
+		if (raCount > 0)
+		{
+			hddImage.seekg(raNextSector * 512, std::ios::beg);
+			hddImage.read((char*)raBuffer, raCount * 512);
+			if (!hddImage.fail())
+			{
+				raStartSector = raNextSector;
+				raSectorCount = (int)raCount;
+			}
+			else
+				hddImage.clear();
+		}
+	}
 }
 
 bool ATA::IO_Write()
@@ -97,6 +135,12 @@ bool ATA::IO_Write()
 		return false;
 	}
 
+	//Invalidate any readahead overlapping the written range
+	if (raSectorCount != 0 &&
+		entry.sector < raStartSector + raSectorCount &&
+		entry.sector + (entry.length / 512) > raStartSector)
+		raSectorCount = 0;
+
 	hddImage.seekp(entry.sector * 512, std::ios::beg);
 	hddImage.write((char*)entry.data, entry.length);
 	if (hddImage.fail())
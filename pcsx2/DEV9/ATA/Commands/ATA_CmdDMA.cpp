@@ -155,8 +155,9 @@ void ATA::HDD_ReadDMA(bool isLBA48)
 		return;
 	}
 
-	//Do Sync Read
-	HDD_ReadSync(&ATA::DRQCmdDMADataToHost);
+	//Do Async Read, the DRQ IRQ is raised from Async() once the io thread
+	//has the data ready, instead of stalling the IOP on the file read here
+	HDD_ReadAsync(&ATA::DRQCmdDMADataToHost);
 }
 
 void ATA::HDD_WriteDMA(bool isLBA48)
@@ -115,7 +115,8 @@ void ATA::HDD_ReadPIO(bool isLBA48)
 		return;
 	}
 
-	HDD_ReadSync(&ATA::HDD_ReadPIOS2);
+	//Do Async Read, as with DMA reads the command continues from Async()
+	HDD_ReadAsync(&ATA::HDD_ReadPIOS2);
 }
 
 void ATA::HDD_ReadPIOS2()
@@ -15,6 +15,8 @@
 
 #include "PrecompiledHeader.h"
 
+#include <emmintrin.h>
+
 #include "IP_Packet.h"
 #include "DEV9/PacketReader/NetLib.h"
 
@@ -278,6 +280,42 @@ namespace PacketReader::IP
 
 		int i = 0;
 		u32 sum = 0;
+
+		//Sum whole 16 byte blocks with SSE2 first; the ones-complement sum is
+		//commutative, so the bytes at even (network order high) and odd offsets
+		//can be accumulated separately and weighted at the end.  The 64bit
+		//accumulators can't overflow at frame sizes, so the end-around carry
+		//only has to be applied once below.
+		if (length >= 16)
+		{
+			const __m128i byteMask = _mm_set1_epi16(0x00FF);
+			const __m128i zero = _mm_setzero_si128();
+			__m128i sumHi = zero; //bytes at even offsets, weighted << 8
+			__m128i sumLo = zero; //bytes at odd offsets
+
+			while (length >= 16)
+			{
+				const __m128i data = _mm_loadu_si128((__m128i*)&buffer[i]);
+				sumHi = _mm_add_epi64(sumHi, _mm_sad_epu8(_mm_and_si128(data, byteMask), zero));
+				sumLo = _mm_add_epi64(sumLo, _mm_sad_epu8(_mm_srli_epi16(data, 8), zero));
+
+				i += 16;
+				length -= 16;
+			}
+
+			u64 wideSum;
+			alignas(16) u64 lanes[2];
+			_mm_store_si128((__m128i*)lanes, sumHi);
+			wideSum = (lanes[0] + lanes[1]) << 8;
+			_mm_store_si128((__m128i*)lanes, sumLo);
+			wideSum += lanes[0] + lanes[1];
+
+			//Fold to 16 bits with end-around carry
+			while (wideSum > 0xFFFF)
+				wideSum = (wideSum & 0xFFFF) + (wideSum >> 16);
+			sum = (u32)wideSum;
+		}
+
 		while (length > 1)
 		{
 			sum += ((u32)(buffer[i]) << 8) | ((u32)(buffer[i + 1]) & 0xFF);
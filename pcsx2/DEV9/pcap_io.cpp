@@ -46,6 +46,22 @@ char errbuf[PCAP_ERRBUF_SIZE];
 int pcap_io_running = 0;
 bool pcap_io_switched;
 
+// Preallocated ring the capture buffer is drained into.  A single pcap_dispatch()
+// call per poll hands us every frame pcap has buffered, instead of paying the
+// library/kernel round trip once per frame via pcap_next_ex().
+// Only ever touched from the rx thread, so no locking is needed.
+#define PCAP_IO_RX_RING_SIZE 64
+
+struct pcap_io_rx_frame
+{
+	struct pcap_pkthdr header;
+	u8 data[2048];
+};
+
+static pcap_io_rx_frame rx_ring[PCAP_IO_RX_RING_SIZE];
+static int rx_ring_rd = 0;
+static int rx_ring_count = 0;
+
 extern u8 eeprom[];
 
 char namebuff[256];
@@ -240,6 +256,9 @@ int pcap_io_init(char* adapter, bool switched, mac_address virtual_mac)
 	dump_pcap = pcap_dump_open(adhandle, plfile.c_str());
 #endif
 
+	rx_ring_rd = 0;
+	rx_ring_count = 0;
+
 	pcap_io_running = 1;
 	Console.WriteLn("DEV9: Adapter Ok.");
 	return 0;
@@ -288,20 +307,39 @@ int pcap_io_send(void* packet, int plen)
 	return pcap_sendpacket(adhandle, (u_char*)packet, plen);
 }
 
-int pcap_io_recv(void* packet, int max_len)
+static void pcap_io_recv_handler(u_char* user, const struct pcap_pkthdr* header, const u_char* pkt_data)
 {
-	static struct pcap_pkthdr* header;
-	static const u_char* pkt_data1;
+	if (header->len > sizeof(rx_ring[0].data))
+		return;
+
+	pcap_io_rx_frame* frame = &rx_ring[(rx_ring_rd + rx_ring_count) % PCAP_IO_RX_RING_SIZE];
+	frame->header = *header;
+	memcpy(frame->data, pkt_data, header->len);
+	rx_ring_count++;
+}
 
+int pcap_io_recv(void* packet, int max_len)
+{
 	if (pcap_io_running <= 0)
 		return -1;
 
-	if ((pcap_next_ex(adhandle, &header, &pkt_data1)) > 0)
+	if (rx_ring_count == 0)
+	{
+		//drain everything pcap has buffered in one call, limited to the ring's free space
+		if (pcap_dispatch(adhandle, PCAP_IO_RX_RING_SIZE, pcap_io_recv_handler, NULL) < 0)
+			return -1;
+	}
+
+	if (rx_ring_count > 0)
 	{
-		if ((int)header->len > max_len)
+		pcap_io_rx_frame* frame = &rx_ring[rx_ring_rd];
+		rx_ring_rd = (rx_ring_rd + 1) % PCAP_IO_RX_RING_SIZE;
+		rx_ring_count--;
+
+		if ((int)frame->header.len > max_len)
 			return -1;
 
-		memcpy(packet, pkt_data1, header->len);
+		memcpy(packet, frame->data, frame->header.len);
 
 		if (!pcap_io_switched)
 		{
@@ -327,9 +365,9 @@ int pcap_io_recv(void* packet, int max_len)
 		}
 
 		if (dump_pcap)
-			pcap_dump((u_char*)dump_pcap, header, (u_char*)packet);
+			pcap_dump((u_char*)dump_pcap, &frame->header, (u_char*)packet);
 
-		return header->len;
+		return frame->header.len;
 	}
 
 	return -1;
@@ -25,6 +25,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <stdarg.h>
+#include <algorithm>
 #include <mutex>
 
 #include "smap.h"
@@ -99,12 +100,12 @@ void rx_process(NetPacket* pk)
 	}
 
 	int pstart = (dev9.rxfifo_wr_ptr) & 16383;
-	int i = 0;
-	while (i < bytes)
-	{
-		dev9_rxfifo_write(pk->buffer[i++]);
-		dev9.rxfifo_wr_ptr &= 16383;
-	}
+	//copy the frame into the fifo in (at most) two spans instead of a byte at a time
+	int prewrap = std::min(bytes, (int)sizeof(dev9.rxfifo) - pstart);
+	memcpy(dev9.rxfifo + pstart, pk->buffer, prewrap);
+	if (bytes > prewrap)
+		memcpy(dev9.rxfifo, pk->buffer + prewrap, bytes - prewrap);
+	dev9.rxfifo_wr_ptr = (pstart + bytes) & 16383;
 
 	//increase RXBD
 	std::unique_lock<std::mutex> reset_lock(reset_mutex);
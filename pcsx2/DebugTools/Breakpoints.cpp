@@ -18,7 +18,9 @@
 #include "SymbolMap.h"
 #include "MIPSAnalyst.h"
 #include <cstdio>
+#include <cstring>
 #include "R5900.h"
+#include "R3000A.h"
 #include "System.h"
 
 std::vector<BreakPoint> CBreakPoints::breakPoints_;
@@ -29,6 +31,14 @@ u64 CBreakPoints::breakSkipFirstTicksIop_ = 0;
 std::vector<MemCheck> CBreakPoints::memChecks_;
 std::vector<MemCheck *> CBreakPoints::cleanupMemChecks_;
 bool CBreakPoints::breakpointTriggered_ = false;
+std::unordered_set<u64> CBreakPoints::addressIndex_;
+u32 CBreakPoints::memcheckPageMaskEE_[(1 << 20) / 32];
+u32 CBreakPoints::memcheckPageMaskIop_[(1 << 20) / 32];
+
+static __fi u64 BreakpointIndexKey(BreakPointCpu cpu, u32 addr)
+{
+	return ((u64)cpu << 32) | addr;
+}
 
 // called from the dynarec
 u32 __fastcall standardizeBreakpointAddress(BreakPointCpu cpu, u32 addr)
@@ -167,12 +177,10 @@ size_t CBreakPoints::FindMemCheck(BreakPointCpu cpu, u32 start, u32 end)
 
 bool CBreakPoints::IsAddressBreakPoint(BreakPointCpu cpu, u32 addr)
 {
-	size_t bp = FindBreakpoint(cpu, addr);
-	if (bp != INVALID_BREAKPOINT && breakPoints_[bp].enabled)
-		return true;
-	// Check again for overlapping temp breakpoint
-	bp = FindBreakpoint(cpu, addr, true, true);
-	return bp != INVALID_BREAKPOINT && breakPoints_[bp].enabled;
+	// Hot path: called per instruction by the interpreters and per compiled
+	// op by the recs, so probe the index instead of scanning breakPoints_.
+	// The index only holds enabled breakpoints (temporary or not).
+	return addressIndex_.find(BreakpointIndexKey(cpu, standardizeBreakpointAddress(cpu, addr))) != addressIndex_.end();
 }
 
 bool CBreakPoints::IsAddressBreakPoint(BreakPointCpu cpu, u32 addr, bool* enabled)
@@ -255,8 +263,11 @@ void CBreakPoints::ClearTemporaryBreakPoints()
 	{
 		if (breakPoints_[i].temporary)
 		{
-			Update(breakPoints_[i].cpu, breakPoints_[i].addr);
+			const BreakPointCpu cpu = breakPoints_[i].cpu;
+			const u32 addr = breakPoints_[i].addr;
 			breakPoints_.erase(breakPoints_.begin() + i);
+			// erase before Update so the rebuilt index no longer contains it
+			Update(cpu, addr);
 		}
 	}
 }
@@ -411,8 +422,54 @@ const std::vector<BreakPoint> CBreakPoints::GetBreakpoints()
 #include "gui/App.h"
 #include "gui/Debugger/DisassemblyDialog.h"
 
+void CBreakPoints::RebuildAddressIndex()
+{
+	addressIndex_.clear();
+
+	for (const BreakPoint& bp : breakPoints_)
+	{
+		if (bp.enabled)
+			addressIndex_.insert(BreakpointIndexKey(bp.cpu, standardizeBreakpointAddress(bp.cpu, bp.addr)));
+	}
+}
+
+const u32* CBreakPoints::GetMemCheckPageMask(BreakPointCpu cpu)
+{
+	return cpu == BREAKPOINT_IOP ? memcheckPageMaskIop_ : memcheckPageMaskEE_;
+}
+
+void CBreakPoints::RebuildMemCheckPageMask()
+{
+	memset(memcheckPageMaskEE_, 0, sizeof(memcheckPageMaskEE_));
+	memset(memcheckPageMaskIop_, 0, sizeof(memcheckPageMaskIop_));
+
+	for (size_t i = 0; i < memChecks_.size(); i++)
+	{
+		const MemCheck& check = memChecks_[i];
+		if (check.result == 0)
+			continue;
+
+		u32* mask = check.cpu == BREAKPOINT_IOP ? memcheckPageMaskIop_ : memcheckPageMaskEE_;
+		u32 start = standardizeBreakpointAddress(check.cpu, check.start);
+		u32 end = standardizeBreakpointAddress(check.cpu, check.end);
+		if (end <= start)
+			end = start + 1;
+
+		// The emitted probe only tests the page of an access' start address,
+		// but a 16 byte access beginning just below the range can still reach
+		// into it, so mark the preceding page as well.
+		u32 first = (start >> 12) == 0 ? 0 : (start >> 12) - 1;
+		u32 last = (end - 1) >> 12;
+		for (u32 page = first; page <= last; page++)
+			mask[page / 32] |= 1u << (page % 32);
+	}
+}
+
 void CBreakPoints::Update(BreakPointCpu cpu, u32 addr)
 {
+	RebuildAddressIndex();
+	RebuildMemCheckPageMask();
+
 	bool resume = false;
 	if (!r5900Debug.isCpuPaused())
 	{
@@ -420,10 +477,23 @@ void CBreakPoints::Update(BreakPointCpu cpu, u32 addr)
 		resume = true;
 	}
 
-//	if (addr != 0)
-//		Cpu->Clear(addr-4,8);
-//	else
+	if (addr != 0)
+	{
+		// An execution breakpoint only affects the blocks overlapping its
+		// address, so invalidate just those and let the rec re-inject (or
+		// drop) the check when it recompiles them.  Starting at addr-4 also
+		// catches a branch whose delay slot sits on the breakpoint.
+		if (cpu & BREAKPOINT_EE)
+			Cpu->Clear(addr - 4, 8);
+		if (cpu & BREAKPOINT_IOP)
+			psxCpu->Clear(addr - 4, 8);
+	}
+	else
+	{
+		// Memcheck and condition changes patch every affected memory access
+		// site, so those still flush everything.
 		SysClearExecutionCache();
+	}
 
 	if (resume)
 		r5900Debug.resumeCpu();
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <vector>
+#include <unordered_set>
 
 #include "DebugInterface.h"
 #include "common/Pcsx2Types.h"
@@ -147,6 +148,12 @@ public:
 
 	static void Update(BreakPointCpu cpu = BREAKPOINT_IOP_AND_EE, u32 addr = 0);
 
+	// Bitmap with one bit per 4KB guest page overlapping an active memcheck
+	// (standardized addresses).  The recs test the accessed page against this
+	// inline and only fall into the per-check compare chain on a hit, so
+	// watching a variable no longer slows every memory access in the program.
+	static const u32* GetMemCheckPageMask(BreakPointCpu cpu);
+
 	static void SetBreakpointTriggered(bool b) { breakpointTriggered_ = b; };
 	static bool GetBreakpointTriggered() { return breakpointTriggered_; };
 
@@ -155,6 +162,12 @@ private:
 	// Finds exactly, not using a range check.
 	static size_t FindMemCheck(BreakPointCpu cpu, u32 start, u32 end);
 
+	// Rebuilds addressIndex_ from breakPoints_; called by Update().
+	static void RebuildAddressIndex();
+
+	// Rebuilds the per-page memcheck bitmaps from memChecks_; called by Update().
+	static void RebuildMemCheckPageMask();
+
 	static std::vector<BreakPoint> breakPoints_;
 	static u32 breakSkipFirstAtEE_;
 	static u64 breakSkipFirstTicksEE_;
@@ -165,6 +178,16 @@ private:
 
 	static std::vector<MemCheck> memChecks_;
 	static std::vector<MemCheck *> cleanupMemChecks_;
+
+	// Standardized addresses of the enabled breakpoints, keyed with the cpu in
+	// the upper 32 bits.  IsAddressBreakPoint is called for every instruction
+	// by the interpreters and during block recompile, so it must not scan.
+	static std::unordered_set<u64> addressIndex_;
+
+	// One bit per 4KB page of the standardized address space.  Static so the
+	// emitted probes can address them directly.
+	static u32 memcheckPageMaskEE_[(1 << 20) / 32];
+	static u32 memcheckPageMaskIop_[(1 << 20) / 32];
 };
 
 
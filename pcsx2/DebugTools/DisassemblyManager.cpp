@@ -18,6 +18,8 @@
 #include <string>
 #include <algorithm>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "DisassemblyManager.h"
 #include "Memory.h"
@@ -26,6 +28,52 @@
 
 int DisassemblyManager::maxParamChars = 29;
 
+// Cache of formatted opcode lines.  cpu->disasm builds and parses the full
+// text for every call, which used to happen for every visible line on every
+// repaint; with the cache a redraw of unchanged code is a few hash probes.
+// Entries are validated against the current opcode word, so self-modifying
+// code and patched memory fall through to a fresh disassembly.
+struct CachedOpcodeLine
+{
+	u32 op;
+	u32 tick;
+	std::string name;
+	std::string params;
+};
+
+static std::unordered_map<u64, CachedOpcodeLine> s_lineCache;
+static u32 s_lineCacheTick;
+
+static const size_t LineCacheMaxEntries = 0x2000;
+
+static u64 lineCacheKey(DebugInterface* cpu, u32 address, bool insertSymbols)
+{
+	return (u64)address | ((u64)cpu->getCpuType() << 32) | ((u64)insertSymbols << 40);
+}
+
+// Evicts the least recently used half once the cache is full.
+static void trimLineCache()
+{
+	if (s_lineCache.size() < LineCacheMaxEntries)
+		return;
+
+	std::vector<u32> ticks;
+	ticks.reserve(s_lineCache.size());
+	for (const auto& entry : s_lineCache)
+		ticks.push_back(entry.second.tick);
+
+	std::nth_element(ticks.begin(), ticks.begin() + ticks.size() / 2, ticks.end());
+	const u32 cutoff = ticks[ticks.size() / 2];
+
+	for (auto it = s_lineCache.begin(); it != s_lineCache.end();)
+	{
+		if (it->second.tick < cutoff)
+			it = s_lineCache.erase(it);
+		else
+			++it;
+	}
+}
+
 bool isInInterval(u32 start, u32 size, u32 value)
 {
 	return start <= value && value <= (start+size-1);
@@ -343,6 +391,9 @@ void DisassemblyManager::clear()
 		delete it->second;
 	}
 	entries.clear();
+
+	// symbols may have changed, which invalidates the cached line text
+	s_lineCache.clear();
 }
 
 DisassemblyFunction::DisassemblyFunction(DebugInterface* _cpu, u32 _address, u32 _size): address(_address), size(_size)
@@ -691,14 +742,32 @@ void DisassemblyFunction::clear()
 
 bool DisassemblyOpcode::disassemble(u32 address, DisassemblyLineInfo& dest, bool insertSymbols)
 {
-	char opcode[64],arguments[256];
-	
-	std::string dis = cpu->disasm(address,insertSymbols);
-	parseDisasm(dis.c_str(),opcode,arguments,insertSymbols);
+	const u32 op = cpu->read32(address);
+	const u64 key = lineCacheKey(cpu,address,insertSymbols);
+
+	auto it = s_lineCache.find(key);
+	if (it != s_lineCache.end() && it->second.op == op)
+	{
+		it->second.tick = ++s_lineCacheTick;
+		dest.name = it->second.name;
+		dest.params = it->second.params;
+	}
+	else
+	{
+		char opcode[64],arguments[256];
+
+		std::string dis = cpu->disasm(address,insertSymbols);
+		parseDisasm(dis.c_str(),opcode,arguments,insertSymbols);
+		dest.name = opcode;
+		dest.params = arguments;
+
+		trimLineCache();
+		s_lineCache[key] = {op, ++s_lineCacheTick, dest.name, dest.params};
+	}
+
 	dest.type = DISTYPE_OPCODE;
-	dest.name = opcode;
-	dest.params = arguments;
 	dest.totalSize = 4;
+	// register dependent (branch condition evaluation), so never cached
 	dest.info = MIPSAnalyst::GetOpcodeInfo(cpu,address);
 	return true;
 }
@@ -0,0 +1,185 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "GuestProfiler.h"
+#include "SymbolMap.h"
+#include "R5900.h"
+#include "R3000A.h"
+#include "VU.h"
+#include "VUmicro.h"
+#include "PathDefs.h"
+
+#include <wx/ffile.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace GuestProfiler
+{
+	// Interval between samples.  1ms gives ~1000 samples/sec per cpu, which
+	// resolves anything worth optimizing within a few seconds of capture while
+	// keeping the sampler thread essentially free.
+	static const int SamplePeriodMs = 1;
+
+	static std::thread s_thread;
+	static std::atomic<bool> s_running(false);
+
+	// Hit counters, keyed by sampled pc.  Only the sampler thread touches these
+	// while it runs; Start() clears them before launching it and Stop() joins it
+	// before reading them, so no locking is needed.
+	static std::unordered_map<u32, u64> s_ee_hits;
+	static std::unordered_map<u32, u64> s_iop_hits;
+	static std::unordered_map<u32, u64> s_vu1_hits;
+	static u64 s_start_ticks = 0;
+
+	static void SamplerThread()
+	{
+		while (s_running.load(std::memory_order_acquire))
+		{
+			// The pc reads below race with the emulation threads; a torn or
+			// slightly stale value just lands one sample on a neighboring block,
+			// which is noise at profiling granularity.  Note that the recompilers
+			// only write cpuRegs.pc back at block boundaries, so EE/IOP
+			// attribution is block-granular rather than instruction-granular.
+			s_ee_hits[cpuRegs.pc]++;
+			s_iop_hits[psxRegs.pc]++;
+			if (VU0.VI[REG_VPU_STAT].UL & 0x100)
+				s_vu1_hits[VU1.VI[REG_TPC].UL & 0x3fff]++;
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(SamplePeriodMs));
+		}
+	}
+
+	// Folds raw pc hits into per-function totals.  EE and IOP pcs are resolved
+	// through the debugger's symbol map (IRX modules register their exports
+	// there, so IOP samples usually get real names); unresolved pcs keep the
+	// map's "(address)" placeholder.
+	static std::map<std::string, u64> FoldSymbols(const std::unordered_map<u32, u64>& hits)
+	{
+		std::map<std::string, u64> folded;
+		for (auto&& it : hits)
+		{
+			u32 start = symbolMap.GetFunctionStart(it.first);
+			folded[symbolMap.GetDescription(start != SymbolMap::INVALID_ADDRESS ? start : it.first)] += it.second;
+		}
+		return folded;
+	}
+
+	static void WriteConsoleSummary(const char* cpu, const std::map<std::string, u64>& folded)
+	{
+		u64 total = 0;
+		std::vector<std::pair<std::string, u64>> sorted(folded.begin(), folded.end());
+		for (auto&& it : sorted)
+			total += it.second;
+		if (total == 0)
+			return;
+
+		std::sort(sorted.begin(), sorted.end(),
+			[](const std::pair<std::string, u64>& a, const std::pair<std::string, u64>& b) { return a.second > b.second; });
+
+		Console.WriteLn("GuestProfiler: %s hot spots (%llu samples):", cpu, total);
+		for (uint i = 0; i < std::min<size_t>(10, sorted.size()); i++)
+			Console.WriteLn("  %5.1f%%  %s", sorted[i].second * 100.0 / total, sorted[i].first.c_str());
+	}
+
+	static void WriteReport()
+	{
+		const std::map<std::string, u64> ee = FoldSymbols(s_ee_hits);
+		const std::map<std::string, u64> iop = FoldSymbols(s_iop_hits);
+
+		// VU1 microprograms aren't in the symbol map; bucket them by TPC so the
+		// report at least separates the resident microprograms from each other.
+		std::map<std::string, u64> vu1;
+		for (auto&& it : s_vu1_hits)
+			vu1[pxsFmt("micro_0x%04x", it.first).ToStdString()] += it.second;
+
+		// Collapsed-stack format ("cpu;function count" per line), directly
+		// consumable by flamegraph.pl.  Guest call stacks aren't sampled (that
+		// would need frame unwinding against emulated memory), so each line is
+		// a single frame.
+		PathDefs::GetLogs().Mkdir();
+		const wxString filename(Path::Combine(PathDefs::GetLogs().ToString(), L"guestprofile.folded"));
+		wxFFile file(filename, L"wb");
+		if (!file.IsOpened())
+		{
+			Console.Warning("GuestProfiler: could not write '%ls'.", WX_STR(filename));
+			return;
+		}
+
+		const std::pair<const char*, const std::map<std::string, u64>*> cpus[] = {
+			{"EE", &ee}, {"IOP", &iop}, {"VU1", &vu1}};
+
+		for (auto&& cpu : cpus)
+		{
+			for (auto&& it : *cpu.second)
+			{
+				wxString line(pxsFmt("%s;%s %llu\n", cpu.first, it.first.c_str(), it.second));
+				file.Write(line.ToUTF8().data(), strlen(line.ToUTF8().data()));
+			}
+			WriteConsoleSummary(cpu.first, *cpu.second);
+		}
+
+		// The sampler only buckets VU1 micros by TPC; the recompiler's own
+		// per-program counters say which program the host time went to.
+		mVUdumpProgramTimings();
+
+		const double secs = (GetCPUTicks() - s_start_ticks) / (double)GetTickFrequency();
+		Console.WriteLn(Color_StrongGreen, "GuestProfiler: %.1fs capture written to '%ls'.", secs, WX_STR(filename));
+	}
+
+	bool IsRunning()
+	{
+		return s_running.load(std::memory_order_acquire);
+	}
+
+	void Start()
+	{
+		if (IsRunning())
+			return;
+
+		s_ee_hits.clear();
+		s_iop_hits.clear();
+		s_vu1_hits.clear();
+		s_start_ticks = GetCPUTicks();
+
+		s_running.store(true, std::memory_order_release);
+		s_thread = std::thread(SamplerThread);
+		Console.WriteLn(Color_StrongGreen, "GuestProfiler: sampling started.");
+	}
+
+	void Stop()
+	{
+		if (!IsRunning())
+			return;
+
+		s_running.store(false, std::memory_order_release);
+		s_thread.join();
+		WriteReport();
+	}
+
+	void Toggle()
+	{
+		if (IsRunning())
+			Stop();
+		else
+			Start();
+	}
+} // namespace GuestProfiler
@@ -0,0 +1,30 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Built-in sampling profiler for *guest* code.  Host-side profilers (perf,
+// VTune) can attribute time to recompiler blocks via Perf.cpp's jit maps, but
+// they cannot see which game function those blocks came from.  This sampler
+// periodically reads the EE/IOP program counters (and the VU1 TPC while a
+// microprogram is running) from a background thread and, on stop, folds the
+// hits against the debugger's SymbolMap into a report under the logs folder.
+namespace GuestProfiler
+{
+	extern bool IsRunning();
+	extern void Start();
+	extern void Stop();
+	extern void Toggle();
+} // namespace GuestProfiler
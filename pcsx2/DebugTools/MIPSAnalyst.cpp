@@ -21,6 +21,9 @@
 #include "DebugInterface.h"
 #include "R5900.h"
 #include "R5900OpcodeTables.h"
+#include "PathDefs.h"
+
+#include <wx/ffile.h>
 
 static std::vector<MIPSAnalyst::AnalyzedFunction> functions;
 
@@ -322,6 +325,65 @@ namespace MIPSAnalyst
 		}
 	}
 
+	static const u32 FUNCTION_CACHE_MAGIC   = 0x4e463250; // 'P2FN'
+	static const u32 FUNCTION_CACHE_VERSION = 1;
+
+	static wxString functionCacheFilename(u32 crc) {
+		return Path::Combine(PathDefs::GetCache().ToString(), pxsFmt(L"%08x.mipsfuncs", crc));
+	}
+
+	bool LoadFunctionsFromCache(u32 crc, bool insertSymbols) {
+		if (!crc)
+			return false;
+
+		wxFFile f(functionCacheFilename(crc), L"rb");
+		if (!f.IsOpened())
+			return false;
+
+		u32 header[3];
+		if (f.Read(header, sizeof(header)) != sizeof(header) ||
+			header[0] != FUNCTION_CACHE_MAGIC || header[1] != FUNCTION_CACHE_VERSION)
+			return false;
+
+		std::vector<u32> bounds(header[2] * 2);
+		const size_t expected = bounds.size() * sizeof(u32);
+		if (header[2] == 0 || f.Read(bounds.data(), expected) != expected)
+			return false;
+
+		functions.clear();
+		for (u32 i = 0; i < header[2]; i++) {
+			AnalyzedFunction func = {bounds[i * 2], bounds[i * 2 + 1]};
+			func.size = func.end - func.start + 4;
+			functions.push_back(func);
+
+			if (insertSymbols) {
+				char temp[256];
+				symbolMap.AddFunction(DefaultFunctionName(temp, func.start), func.start, func.size);
+			}
+		}
+
+		DevCon.WriteLn("MIPSAnalyst: loaded %u cached functions for %08x", header[2], crc);
+		return true;
+	}
+
+	void SaveFunctionsToCache(u32 crc) {
+		if (!crc || functions.empty())
+			return;
+
+		PathDefs::GetCache().Mkdir();
+
+		wxFFile f(functionCacheFilename(crc), L"wb");
+		if (!f.IsOpened())
+			return;
+
+		u32 header[3] = {FUNCTION_CACHE_MAGIC, FUNCTION_CACHE_VERSION, (u32)functions.size()};
+		f.Write(header, sizeof(header));
+		for (const AnalyzedFunction& func : functions) {
+			u32 bounds[2] = {func.start, func.end};
+			f.Write(bounds, sizeof(bounds));
+		}
+	}
+
 	MipsOpcodeInfo GetOpcodeInfo(DebugInterface* cpu, u32 address) {
 		MipsOpcodeInfo info;
 		memset(&info, 0, sizeof(info));
@@ -41,6 +41,12 @@ namespace MIPSAnalyst
 
 	void ScanForFunctions(u32 startAddr, u32 endAddr, bool insertSymbols);
 
+	// Persistent cache of the ScanForFunctions result, keyed by ELF CRC.
+	// Load returns false when no usable cache exists; the caller should then
+	// scan and save.
+	bool LoadFunctionsFromCache(u32 crc, bool insertSymbols);
+	void SaveFunctionsToCache(u32 crc);
+
 	enum LoadStoreLRType { LOADSTORE_NORMAL, LOADSTORE_LEFT, LOADSTORE_RIGHT };
 
 	typedef struct {
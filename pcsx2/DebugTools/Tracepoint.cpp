@@ -0,0 +1,130 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "Tracepoint.h"
+#include "PathDefs.h"
+
+#include <wx/ffile.h>
+
+#include <mutex>
+#include <vector>
+
+namespace Tracepoint
+{
+	struct TraceRecord
+	{
+		u64 tsc;
+		u32 id;
+		u32 a;
+		u32 b;
+		u32 unused;
+	};
+
+	// 64K records of 24 bytes is 1.5MB per instrumented thread, which holds a
+	// few seconds of history at typical event rates -- enough to cover the
+	// frame spike that prompted the dump.
+	static const u32 TraceRingRecords = 0x10000;
+
+	struct TraceRing
+	{
+		TraceRecord buf[TraceRingRecords];
+		u32 head; // total records written; wraps through the buffer via masking
+		char name[32];
+	};
+
+	static std::mutex s_registry_lock;
+	static std::vector<TraceRing*> s_rings;
+	static thread_local TraceRing* t_ring = nullptr;
+
+	static TraceRing* RegisterRing()
+	{
+		TraceRing* ring = new TraceRing(); // value-initialized: zeroed buffer and head
+
+		const wxString threadname(Threading::pxGetCurrentThreadName());
+		if (threadname.IsEmpty())
+			snprintf(ring->name, sizeof(ring->name), "thread_%u", (u32)s_rings.size());
+		else
+			strncpy(ring->name, threadname.ToUTF8().data(), sizeof(ring->name) - 1);
+
+		std::lock_guard<std::mutex> guard(s_registry_lock);
+		s_rings.push_back(ring);
+		return ring;
+	}
+
+	void Record(TraceEventId id, u32 a, u32 b)
+	{
+		// Each ring has exactly one writer (its owning thread), so the fast
+		// path is a plain store and increment -- no atomics, no locks.
+		TraceRing* ring = t_ring;
+		if (!ring)
+			ring = t_ring = RegisterRing();
+
+		TraceRecord& rec = ring->buf[ring->head & (TraceRingRecords - 1)];
+		rec.tsc = GetCPUTicks();
+		rec.id = id;
+		rec.a = a;
+		rec.b = b;
+		ring->head++;
+	}
+
+	// Dumps every ring to logs/tracepoints.bin: a file header carrying the
+	// tick frequency, then per ring a name, a record count and the records in
+	// oldest-to-newest order.  The emulation threads keep writing while we
+	// read; the head is snapshotted up front, so at worst the few records
+	// racing the snapshot at the wrap seam come out torn -- tolerable for a
+	// diagnostic dump, and vastly better than pausing the machine to trace it.
+	void Dump()
+	{
+		PathDefs::GetLogs().Mkdir();
+		const wxString filename(Path::Combine(PathDefs::GetLogs().ToString(), L"tracepoints.bin"));
+		wxFFile file(filename, L"wb");
+		if (!file.IsOpened())
+		{
+			Console.Warning("Tracepoint: could not write '%ls'.", WX_STR(filename));
+			return;
+		}
+
+		struct
+		{
+			char magic[8];
+			u64 tickfreq;
+			u32 recsize;
+			u32 ringcount;
+		} header = {{'P', '2', 'T', 'R', 'A', 'C', 'E', 0}, GetTickFrequency(), sizeof(TraceRecord), 0};
+
+		std::lock_guard<std::mutex> guard(s_registry_lock);
+		header.ringcount = (u32)s_rings.size();
+		file.Write(&header, sizeof(header));
+
+		u64 total = 0;
+		for (TraceRing* ring : s_rings)
+		{
+			const u32 head = ring->head;
+			const u32 count = std::min(head, TraceRingRecords);
+
+			file.Write(ring->name, sizeof(ring->name));
+			file.Write(&count, sizeof(count));
+			// Oldest record first: when the ring has wrapped that's the slot
+			// just past the head.
+			for (u32 i = 0; i < count; i++)
+				file.Write(&ring->buf[(head - count + i) & (TraceRingRecords - 1)], sizeof(TraceRecord));
+			total += count;
+		}
+
+		Console.WriteLn(Color_StrongGreen, "Tracepoint: dumped %llu records from %u threads to '%ls'.",
+			total, header.ringcount, WX_STR(filename));
+	}
+} // namespace Tracepoint
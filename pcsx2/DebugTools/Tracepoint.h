@@ -0,0 +1,46 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Pcsx2Types.h"
+
+// Lightweight always-on tracepoints.  Unlike the printf-based trace logs in
+// SourceLog.cpp these write fixed-size binary records into per-thread ring
+// buffers (no locks, no formatting), so they are cheap enough to leave enabled
+// while chasing frame spikes whose timing verbose logging would distort.  The
+// rings hold the most recent ~64K events per thread and can be dumped to
+// logs/tracepoints.bin on demand (Shift-F11).
+enum TraceEventId : u32
+{
+	TRACE_EE_DMA_START,  // a = channel, b = qwc
+	TRACE_EE_DMA_IRQ,    // a = DMAC_STAT irq bit
+	TRACE_VIF0_KICK,     // a = chcr, b = qwc
+	TRACE_VIF1_KICK,     // a = chcr, b = qwc
+	TRACE_GS_VSYNC,      // (none)
+	TRACE_GS_WAIT_BEGIN, // a = weakWait, b = isMTVU
+	TRACE_GS_WAIT_END,   // (none)
+	TRACE_EE_EVENT_TEST, // a = cpuRegs.cycle
+	TRACE_GIF_PACKET,    // a = path (0-2), b = size in bytes
+	TRACE_GIF_FRAME_STATS, // a = path << 28 | packet count, b = bytes (per frame, at vsync)
+	TRACE_GIF_SIZE_HIST, // a = path << 8 | log2 size bucket, b = packet count (per frame)
+	TRACE_VIF_TRANSFER,  // a = vif index, b = size in bytes
+};
+
+namespace Tracepoint
+{
+	extern void Record(TraceEventId id, u32 a = 0, u32 b = 0);
+	extern void Dump();
+} // namespace Tracepoint
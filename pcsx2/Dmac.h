@@ -555,7 +555,22 @@ static DMACh& sif2dma	= (DMACh&)eeHw[0xc800];
 extern void throwBusError(const char *s);
 extern void setDmacStat(u32 num);
 extern tDMA_TAG *SPRdmaGetAddr(u32 addr, bool write);
-extern tDMA_TAG *dmaGetAddr(u32 addr, bool write);
+extern tDMA_TAG *_dmaGetAddr(u32 addr, bool write);
+
+// Note: Dma addresses are guaranteed to be aligned to 16 bytes (128 bits)
+//
+// Chain mode re-resolves TADR and MADR through here for every tag it walks,
+// so the main memory case -- which covers practically every display list a
+// game builds -- is kept inline at the call site.  The uncommon targets
+// (scratchpad, the zero-page holes, bad addresses) drop to the out-of-line
+// fallback in LegacyDmac.cpp.
+__fi static tDMA_TAG *dmaGetAddr(u32 addr, bool write)
+{
+	if (!DMA_TAG(addr).SPR && ((addr & 0x1ffffff0) < Ps2MemSize::MainRam))
+		return (tDMA_TAG*)&eeMem->Main[addr & 0x1ffffff0];
+
+	return _dmaGetAddr(addr, write);
+}
 
 extern void hwIntcIrq(int n);
 extern void hwDmacIrq(int n);
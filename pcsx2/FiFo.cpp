@@ -39,6 +39,43 @@
 // 0x6000 - 0x7000 : GS    (all registers map to 0x6000)
 // 0x7000 - 0x8000 : IPU   (registers map to 0x7000 and 0x7010, respectively)
 
+// The FIFO window is read one qword at a time, but pulling each qword from
+// the GS used to cost two full MTGS synchronizations.  Games that consume a
+// download through the window instead of a reverse DMA therefore paid a
+// thread ping-pong per 128 bits.  The first read now materializes everything
+// the FIFO architecturally holds (FQC, up to 16 qwords) in a single round
+// trip and the following reads are served from this buffer; the status side
+// (FQC/OPH) still updates per read, exactly as before.
+static __aligned16 u128 vif1fifo_data[16];
+static u32 vif1fifo_count = 0;   // buffered qwords left
+static u32 vif1fifo_readpos = 0; // next buffered qword
+
+// Discards buffered qwords.  Needed on FDR direction switches (which clear
+// the hardware FIFO) and on loadstates, where the buffer contents no longer
+// match the architectural FIFO.
+void vif1FifoClearBuffered()
+{
+	vif1fifo_count = 0;
+	vif1fifo_readpos = 0;
+}
+
+// Hands buffered qwords over to the caller, up to qwc.  Mainly for the
+// reverse DMA path: games can read the start of a GS download through the
+// FIFO window and DMA the remainder (Alex Ferguson's Player Manager 2001),
+// so the DMA must consume what the window already pulled from the GS before
+// reading the GS itself.  Returns the number of qwords copied.
+u32 vif1FifoReadBuffered(u128* dst, u32 qwc)
+{
+	const u32 n = std::min(qwc, vif1fifo_count);
+	if (n > 0)
+	{
+		memcpy(dst, &vif1fifo_data[vif1fifo_readpos], n * 16);
+		vif1fifo_readpos += n;
+		vif1fifo_count -= n;
+	}
+	return n;
+}
+
 void __fastcall ReadFIFO_VIF1(mem128_t* out)
 {
 	if (vif1Regs.stat.test(VIF1_STAT_INT | VIF1_STAT_VSS | VIF1_STAT_VIS | VIF1_STAT_VFS))
@@ -54,10 +91,17 @@ void __fastcall ReadFIFO_VIF1(mem128_t* out)
 		}
 		if (vif1Regs.stat.FQC > 0)
 		{
-			GetMTGS().WaitGS();
-			GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO1, 0, out);
-			GetMTGS().WaitGS(false); // wait without reg sync
-			GSreadFIFO((u8*)out);
+			if (vif1fifo_count == 0)
+			{
+				const u32 drain = std::min((u32)16, vif1.GSLastDownloadSize);
+				GetMTGS().WaitGS();
+				GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO2, drain, vif1fifo_data);
+				GetMTGS().WaitGS(false); // wait without reg sync
+				GSreadFIFO2((u8*)vif1fifo_data, drain);
+				vif1fifo_count = drain;
+				vif1fifo_readpos = 0;
+			}
+			vif1FifoReadBuffered(out, 1);
 			vif1.GSLastDownloadSize--;
 			GUNIT_LOG("ReadFIFO_VIF1");
 			if (vif1.GSLastDownloadSize <= 16)
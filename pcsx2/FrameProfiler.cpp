@@ -0,0 +1,166 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace FrameProfiler
+{
+	// Relaxed atomics throughout: the accumulators are statistics, not
+	// synchronization, and the reader tolerates a phase slice landing one
+	// frame (or one Read window) late.
+	static std::atomic<u64> s_phase_ticks[Phase_Count];
+	static std::atomic<u64> s_frame_ticks(0);
+	static std::atomic<u64> s_queue_sum(0);
+	static std::atomic<u32> s_frames(0);
+
+	// EE thread only.
+	static u64 s_frame_start = 0;
+
+	bool g_accounting = false;
+
+	// EE thread only: the accounting slice in progress and the portion of it
+	// already attributed to a blocking phase by AddPhase.
+	static u64 s_slice_start = 0;
+	static u64 s_slice_waited = 0;
+
+	// Folded by the once-a-second reporter in OnVsync, hence atomic like the
+	// phase accumulators.
+	static std::atomic<u64> s_ctx_ticks[Ctx_Count];
+
+	// OnVsync only: summary window bookkeeping.
+	static u64 s_acct_window_start = 0;
+	static u32 s_acct_frames = 0;
+
+	void AddPhase(Phase phase, u64 ticks)
+	{
+		s_phase_ticks[phase].fetch_add(ticks, std::memory_order_relaxed);
+
+		// The EE-side blocking phases happen inside whatever accounting slice
+		// is open; remember them so the slice can be re-bucketed as waiting
+		// rather than inflating the context it lands in.
+		if (g_accounting && phase != Phase_Present)
+			s_slice_waited += ticks;
+	}
+
+	void DoAccountSlice(Context ctx)
+	{
+		const u64 now = GetCPUTicks();
+
+		if (s_slice_start != 0)
+		{
+			const u64 elapsed = now - s_slice_start;
+			const u64 waited = std::min(s_slice_waited, elapsed);
+
+			s_ctx_ticks[Ctx_Wait].fetch_add(waited, std::memory_order_relaxed);
+			s_ctx_ticks[ctx].fetch_add(elapsed - waited, std::memory_order_relaxed);
+		}
+
+		s_slice_start = now;
+		s_slice_waited = 0;
+	}
+
+	void ToggleAccounting()
+	{
+		// Clear before raising the flag so the EE thread never folds stale
+		// state from a previous run into the new window.
+		if (!g_accounting)
+		{
+			for (int i = 0; i < Ctx_Count; i++)
+				s_ctx_ticks[i].store(0, std::memory_order_relaxed);
+
+			s_slice_start = 0;
+			s_slice_waited = 0;
+			s_acct_window_start = 0;
+			s_acct_frames = 0;
+		}
+
+		g_accounting = !g_accounting;
+	}
+
+	bool IsAccounting()
+	{
+		return g_accounting;
+	}
+
+	void OnVsync(u32 gs_queue_depth)
+	{
+		const u64 now = GetCPUTicks();
+		if (s_frame_start != 0)
+			s_frame_ticks.fetch_add(now - s_frame_start, std::memory_order_relaxed);
+		s_frame_start = now;
+
+		s_queue_sum.fetch_add(gs_queue_depth, std::memory_order_relaxed);
+		s_frames.fetch_add(1, std::memory_order_relaxed);
+
+		if (g_accounting)
+		{
+			s_acct_frames++;
+
+			if (s_acct_window_start == 0)
+			{
+				s_acct_window_start = now;
+			}
+			else if (now - s_acct_window_start >= GetTickFrequency())
+			{
+				u64 ticks[Ctx_Count];
+				u64 total = 0;
+
+				for (int i = 0; i < Ctx_Count; i++)
+					total += ticks[i] = s_ctx_ticks[i].exchange(0, std::memory_order_relaxed);
+
+				if (total > 0 && s_acct_frames > 0)
+				{
+					const double to_pct = 100.0 / (double)total;
+					const double to_ms = 1000.0 / (GetTickFrequency() * (double)s_acct_frames);
+
+					Console.WriteLn(Color_StrongBlack,
+						"acct: %5.2fms/f | ee %4.1f%% bios %4.1f%% iop %4.1f%% evt %4.1f%% vu %4.1f%% wait %4.1f%%",
+						total * to_ms,
+						ticks[Ctx_EEUser] * to_pct, ticks[Ctx_EEKernel] * to_pct,
+						ticks[Ctx_IOP] * to_pct, ticks[Ctx_Events] * to_pct,
+						ticks[Ctx_VU] * to_pct, ticks[Ctx_Wait] * to_pct);
+				}
+
+				s_acct_window_start = now;
+				s_acct_frames = 0;
+			}
+		}
+	}
+
+	Stats Read()
+	{
+		Stats stats = {};
+		stats.frames = s_frames.exchange(0, std::memory_order_relaxed);
+		if (stats.frames == 0)
+			return stats;
+
+		const double to_ms = 1000.0 / (GetTickFrequency() * (double)stats.frames);
+		stats.frame_ms = s_frame_ticks.exchange(0, std::memory_order_relaxed) * to_ms;
+		stats.vu1_wait_ms = s_phase_ticks[Phase_VU1Wait].exchange(0, std::memory_order_relaxed) * to_ms;
+		stats.gs_wait_ms = s_phase_ticks[Phase_GSWait].exchange(0, std::memory_order_relaxed) * to_ms;
+		stats.limit_ms = s_phase_ticks[Phase_FrameLimit].exchange(0, std::memory_order_relaxed) * to_ms;
+		stats.present_ms = s_phase_ticks[Phase_Present].exchange(0, std::memory_order_relaxed) * to_ms;
+		stats.gs_queue = s_queue_sum.exchange(0, std::memory_order_relaxed) / (double)stats.frames;
+
+		stats.ee_run_ms = std::max(0.0,
+			stats.frame_ms - stats.vu1_wait_ms - stats.gs_wait_ms - stats.limit_ms);
+
+		return stats;
+	}
+} // namespace FrameProfiler
@@ -0,0 +1,94 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+// Per-frame phase timing, collected at the existing cross-thread sync points
+// (WaitVU, WaitGS, the framelimiter, the MTGS vsync handler) and read once a
+// second by the GS window title/OSD updater.  Where CpuUsageProvider answers
+// "how busy is each thread", this answers "what was each frame spent on" --
+// the first question in any bottleneck triage.
+namespace FrameProfiler
+{
+	enum Phase
+	{
+		Phase_VU1Wait = 0, // EE thread blocked in VU_Thread::WaitVU
+		Phase_GSWait,      // EE thread blocked in SysMtgsThread::WaitGS
+		Phase_FrameLimit,  // EE thread stalled in the framelimiter
+		Phase_Present,     // MTGS thread inside GSvsync (flip + host vsync)
+		Phase_Count
+	};
+
+	// Accumulates time spent in a phase during the current frame; callable
+	// from any thread.
+	extern void AddPhase(Phase phase, u64 ticks);
+
+	// Marks a frame boundary; called once per vsync from the EE thread with
+	// the number of whole frames currently queued ahead of the GS.
+	extern void OnVsync(u32 gs_queue_depth);
+
+	// Per-frame averages over the frames elapsed since the previous Read().
+	// ee_run_ms is the frame time minus the EE-side waits, i.e. the time the
+	// EE thread actually spent emulating.
+	struct Stats
+	{
+		u32 frames;
+		double frame_ms;
+		double ee_run_ms;
+		double vu1_wait_ms;
+		double gs_wait_ms;
+		double limit_ms;
+		double present_ms;
+		double gs_queue;
+	};
+	extern Stats Read();
+
+	// ---- Cycle accounting (opt-in, Ctrl-F10) ----
+	// Buckets host time by guest context between the scheduling boundaries in
+	// _cpuEventTest_Shared/iopEventTest, answering "what is the EE thread busy
+	// with" one level below ee_run_ms.  While active, a one-line per-frame
+	// summary goes to the console once a second.
+
+	enum Context
+	{
+		Ctx_EEUser = 0, // EE guest code with the PC in useg (game code)
+		Ctx_EEKernel,   // EE guest code with the PC in kseg (kernel/BIOS)
+		Ctx_IOP,        // IOP timeslices (psxCpu->ExecuteBlock + its event tests)
+		Ctx_Events,     // INTC/DMAC/counter handlers run from the event tests
+		Ctx_VU,         // VU0/VU1 micro execution on the EE thread
+		Ctx_Wait,       // the blocking phases above, re-bucketed out of their slice
+		Ctx_Count
+	};
+
+	// True while accounting; checked inline so the disabled path is a single
+	// predicted branch at every scheduling boundary.
+	extern bool g_accounting;
+
+	extern void DoAccountSlice(Context ctx);
+	extern void ToggleAccounting();
+	extern bool IsAccounting();
+
+	// Attributes the host time since the previous boundary to the given
+	// context and starts the next slice.  EE thread only; uses the same
+	// TSC-backed tick source as the phase timers, so a slice costs one
+	// counter read.
+	__fi void AccountSlice(Context ctx)
+	{
+		if (g_accounting)
+			DoAccountSlice(ctx);
+	}
+} // namespace FrameProfiler
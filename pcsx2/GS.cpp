@@ -417,7 +417,8 @@ __fi void gsFrameSkip()
 void gsPostVsyncStart()
 {
 	//gifUnit.FlushToMTGS();  // Needed for some (broken?) homebrew game loaders
-	
+
+	Gif_FlushFrameStats();
 	GetMTGS().PostVsyncStart();
 }
 
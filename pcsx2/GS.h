@@ -19,6 +19,7 @@
 #include "System/SysThreads.h"
 #include "Gif.h"
 #include "GS/GS.h"
+#include "common/MemcpyFast.h"
 
 extern double GetVerticalFrequency();
 extern __aligned16 u8 g_RealGSMem[Ps2MemSize::GSregs];
@@ -324,6 +325,13 @@ public:
 	std::atomic<int>	m_QueuedFrameCount;
 	std::atomic<bool>	m_VsyncSignalListener;
 
+	// Frame pacing: each vsync packet carries the EE-side tick count of its
+	// creation, and the GS thread measures EE->present latency from it once the
+	// frame has been presented.  The measurement drives an adaptive cap on how
+	// many vsyncs the EE may queue ahead (never above VsyncQueueSize); the cap
+	// is read by the EE in PostVsyncStart, the rest is GS thread state.
+	std::atomic<int>	m_VsyncQueueLimit;
+
 	Mutex			m_mtx_RingBufferBusy;  // Is obtained while processing ring-buffer data
 	Mutex			m_mtx_RingBufferBusy2; // This one gets released on semaXGkick waiting...
 	Mutex			m_mtx_WaitGS;
@@ -348,6 +356,11 @@ public:
 	uint			m_packet_size;		// size of the packet (data only, ie. not including the 16 byte command!)
 	uint			m_packet_writepos;	// index of the data location in the ringbuffer.
 
+	// GS thread side of the frame pacing measurement, in GetCPUTicks units.
+	u64				m_LastVsyncStamp;
+	s64				m_FrameLatencyEMA;
+	s64				m_FrameIntervalEMA;
+
 #ifdef RINGBUF_DEBUG_STACK
 	Threading::Mutex m_lock_Stack;
 #endif
@@ -490,27 +503,46 @@ extern __aligned(32) MTGS_BufferedData RingBuffer;
 inline void MemCopy_WrappedDest( const u128* src, u128* destBase, uint& destStart, uint destSize, uint len ) {
 	uint endpos = destStart + len;
 	if ( endpos < destSize ) {
-		memcpy(&destBase[destStart], src, len*16);
+		memcpy_fast(&destBase[destStart], src, len*16);
+		destStart += len;
+	}
+	else {
+		uint firstcopylen = destSize - destStart;
+		memcpy_fast(&destBase[destStart], src, firstcopylen*16);
+		destStart = endpos % destSize;
+		memcpy_fast(destBase, src+firstcopylen, destStart*16);
+	}
+}
+
+// Same as MemCopy_WrappedDest but with non-temporal stores; for image uploads
+// large enough that pulling them through the cache only evicts data we'd rather
+// keep (the MTGS thread has to read them from DRAM either way at that size).
+// The sfence inside memcpy_nt makes the copy visible before the caller stores
+// the updated ringbuffer write position.
+inline void MemCopy_WrappedDest_NT( const u128* src, u128* destBase, uint& destStart, uint destSize, uint len ) {
+	uint endpos = destStart + len;
+	if ( endpos < destSize ) {
+		memcpy_nt(&destBase[destStart], src, len*16);
 		destStart += len;
 	}
 	else {
 		uint firstcopylen = destSize - destStart;
-		memcpy(&destBase[destStart], src, firstcopylen*16);
+		memcpy_nt(&destBase[destStart], src, firstcopylen*16);
 		destStart = endpos % destSize;
-		memcpy(destBase, src+firstcopylen, destStart*16);
+		memcpy_nt(destBase, src+firstcopylen, destStart*16);
 	}
 }
 
 inline void MemCopy_WrappedSrc( const u128* srcBase, uint& srcStart, uint srcSize, u128* dest, uint len ) {
 	uint endpos = srcStart + len;
 	if ( endpos < srcSize ) {
-		memcpy(dest, &srcBase[srcStart], len*16);
+		memcpy_fast(dest, &srcBase[srcStart], len*16);
 		srcStart += len;
 	}
 	else {
 		uint firstcopylen = srcSize - srcStart;
-		memcpy(dest, &srcBase[srcStart], firstcopylen*16);
+		memcpy_fast(dest, &srcBase[srcStart], firstcopylen*16);
 		srcStart = endpos % srcSize;
-		memcpy(dest+firstcopylen, srcBase, srcStart*16);
+		memcpy_fast(dest+firstcopylen, srcBase, srcStart*16);
 	}
 }
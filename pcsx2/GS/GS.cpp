@@ -65,6 +65,13 @@ static bool s_exclusive = true;
 static std::string s_renderer_name;
 bool gsopen_done = false; // crash guard for GSgetTitleInfo2 and GSKeyEvent (replace with lock?)
 
+// Device and window parked across a warm renderer switch (the F9 toggle).
+// Both OGL renderers present through the same GSDeviceOGL, so the GL context
+// and its compiled shaders can outlive the swap of the renderer object.
+static bool s_warm_switch = false;
+static GSDevice* s_warm_dev = nullptr;
+static std::shared_ptr<GSWnd> s_warm_wnd;
+
 void GSsetBaseMem(uint8* mem)
 {
 	s_basemem = mem;
@@ -111,6 +118,16 @@ void GSshutdown()
 	delete s_gs;
 	s_gs = nullptr;
 
+	// drop anything still parked for a warm switch that never completed
+	delete s_warm_dev;
+	s_warm_dev = nullptr;
+	if (s_warm_wnd)
+	{
+		s_warm_wnd->Detach();
+		s_warm_wnd = nullptr;
+	}
+	s_warm_switch = false;
+
 	theApp.SetCurrentRendererType(GSRendererType::Undefined);
 
 #ifdef _WIN32
@@ -132,6 +149,20 @@ void GSclose()
 
 	s_gs->ResetDevice();
 
+	const GSRendererType current = theApp.GetCurrentRendererType();
+	if (s_warm_switch && s_gs->m_dev && s_gs->m_wnd &&
+		(current == GSRendererType::OGL_HW || current == GSRendererType::OGL_SW))
+	{
+		// Park the device and the still-attached window for the upcoming
+		// reopen; _GSopen checks that the new renderer can actually reuse
+		// them before unparking.
+		s_warm_dev = s_gs->m_dev;
+		s_warm_wnd = s_gs->m_wnd;
+		s_gs->m_dev = NULL;
+		return;
+	}
+	s_warm_switch = false;
+
 	// Opengl requirement: It must be done before the Detach() of
 	// the context
 	delete s_gs->m_dev;
@@ -144,6 +175,14 @@ void GSclose()
 	}
 }
 
+// Called ahead of a close/reopen pair that only toggles between the HW and SW
+// renderers, so GSclose keeps the window, GL context and device alive instead
+// of tearing them down with the renderer.
+void GSSetWarmSwitch(bool enabled)
+{
+	s_warm_switch = enabled;
+}
+
 int _GSopen(void** dsp, const char* title, GSRendererType renderer, int threads = -1)
 {
 	GSDevice* dev = NULL;
@@ -162,8 +201,19 @@ int _GSopen(void** dsp, const char* title, GSRendererType renderer, int threads
 	if (threads == -1)
 	{
 		threads = theApp.GetConfigI("extrathreads");
+
+		if (threads < 0)
+		{
+			// extrathreads = -1 sizes the pool from the machine instead of a
+			// flat number: one worker per logical core, minus the pair the gs
+			// and ee threads keep busy, capped to what the interleave handles
+
+			threads = std::min<int>(std::max<int>((int)std::thread::hardware_concurrency() - 2, 0), 32);
+		}
 	}
 
+	bool warm = false;
+
 	try
 	{
 		if (theApp.GetCurrentRendererType() != renderer)
@@ -179,7 +229,24 @@ int _GSopen(void** dsp, const char* title, GSRendererType renderer, int threads
 			theApp.SetCurrentRendererType(renderer);
 		}
 
+		// A parked device can only be reused by the other OGL renderer; a
+		// toggle that lands elsewhere (eg back to DX11) takes the full path.
+		if (s_warm_dev && renderer != GSRendererType::OGL_HW && renderer != GSRendererType::OGL_SW)
+		{
+			delete s_warm_dev;
+			s_warm_dev = nullptr;
+			s_warm_wnd->Detach();
+			s_warm_wnd = nullptr;
+			s_warm_switch = false;
+		}
+		warm = s_warm_dev != nullptr;
+
 		std::shared_ptr<GSWnd> window;
+		if (warm)
+		{
+			window = s_warm_wnd;
+		}
+		else
 		{
 			// Select the window first to detect the GL requirement
 			std::vector<std::shared_ptr<GSWnd>> wnds;
@@ -268,7 +335,22 @@ int _GSopen(void** dsp, const char* title, GSRendererType renderer, int threads
 
 		std::string renderer_name;
 
-		switch (renderer)
+		if (warm)
+		{
+			// warm switch reuses the parked device instead of creating one
+			dev = s_warm_dev;
+			if (renderer == GSRendererType::OGL_SW)
+			{
+				s_renderer_name = "SW";
+				renderer_name = "Software";
+			}
+			else
+			{
+				s_renderer_name = "OGL";
+				renderer_name = "OpenGL";
+			}
+		}
+		else switch (renderer)
 		{
 			default:
 #ifdef _WIN32
@@ -341,7 +423,18 @@ int _GSopen(void** dsp, const char* title, GSRendererType renderer, int threads
 	if (!old_api)
 		s_gs->SetMultithreaded(true);
 
-	if (!s_gs->CreateDevice(dev))
+	if (warm)
+	{
+		// The device outlived the old renderer object, so skip the device
+		// creation (context setup, shader compilation) and just hand it to
+		// the new renderer.
+		s_gs->m_dev = dev;
+		dev->SetVSync(s_vsync);
+		s_warm_dev = nullptr;
+		s_warm_wnd = nullptr;
+		s_warm_switch = false;
+	}
+	else if (!s_gs->CreateDevice(dev))
 	{
 		// This probably means the user has DX11 configured with a video card that is only DX9
 		// compliant.  Cound mean drivr issues of some sort also, but to be sure, that's the most
@@ -811,6 +904,19 @@ void GSendRecording()
 void GSsetGameCRC(uint32 crc, int options)
 {
 	s_gs->SetGameCRC(crc, options);
+
+	// The CRC is the first point where the game is known, use it to pre-warm
+	// the surface pool from the profile the previous session of this game
+	// left behind (see GSDevice::SetWarmFile).
+	const std::string warm_dir = theApp.GetConfigS("texture_warm_dir");
+
+	if (!warm_dir.empty() && crc != 0 && s_gs->m_dev != NULL)
+		s_gs->m_dev->SetWarmFile(format("%s/%08X.warm", warm_dir.c_str(), crc));
+}
+
+size_t GSfetchEncodedFrame(void* dst, size_t available)
+{
+	return GSFrameStream::Fetch(dst, available);
 }
 
 void GSgetLastTag(uint32* tag)
@@ -838,6 +944,21 @@ void GSgetTitleInfo2(char* dest, size_t length)
 	strcpy(dest, s.c_str());
 }
 
+void GSgetPerfStats(double* prims, double* draws, double* syncs)
+{
+	*prims = *draws = *syncs = 0.0;
+
+	if (!gsopen_done || s_gs == NULL)
+		return;
+
+	// Fold whatever accumulated since the last 32-frame window into the
+	// averaged stats, then report the per-frame figures.
+	s_gs->m_perfmon.Update();
+	*prims = s_gs->m_perfmon.Get(GSPerfMon::Prim);
+	*draws = s_gs->m_perfmon.Get(GSPerfMon::Draw);
+	*syncs = s_gs->m_perfmon.Get(GSPerfMon::SyncPoint);
+}
+
 void GSsetFrameSkip(int frameskip)
 {
 	s_gs->SetFrameSkip(frameskip);
@@ -876,6 +997,14 @@ void GSSetFMVSwitch(bool enabled)
 	}
 }
 
+void GSSetEELatency(double ms)
+{
+	if (s_gs)
+	{
+		s_gs->SetEELatency(ms);
+	}
+}
+
 #if defined(__unix__) || defined(__APPLE__)
 
 inline unsigned long timeGetTime()
@@ -910,6 +1039,7 @@ void GSReplay(char* lpszCmdLine, int renderer)
 	{
 		uint8 type, param;
 		uint32 size, addr;
+		const uint8* data; // points into buff, or into the mapped dump
 		std::vector<uint8> buff;
 	};
 
@@ -941,15 +1071,23 @@ void GSReplay(char* lpszCmdLine, int renderer)
 	if (s_gs->m_wnd == NULL)
 		return;
 
+	GSDumpFile* file = nullptr;
+
 	{ // Read .gs content
 		std::string f(lpszCmdLine);
 		bool is_xz = (f.size() >= 4) && (f.compare(f.size() - 3, 3, ".xz") == 0);
+		bool is_v2 = (f.size() >= 4) && (f.compare(f.size() - 4, 4, ".gs2") == 0);
 		if (is_xz)
 			f.replace(f.end() - 6, f.end(), "_repack.gs");
 		else
 			f.replace(f.end() - 3, f.end(), "_repack.gs");
 
-		GSDumpFile* file = is_xz ? (GSDumpFile*)new GSDumpLzma(lpszCmdLine, repack_dump ? f.c_str() : nullptr) : (GSDumpFile*)new GSDumpRaw(lpszCmdLine, repack_dump ? f.c_str() : nullptr);
+		if (is_v2)
+			file = new GSDumpMmap(lpszCmdLine, nullptr); // already raw, nothing to repack
+		else if (is_xz)
+			file = new GSDumpLzma(lpszCmdLine, repack_dump ? f.c_str() : nullptr);
+		else
+			file = new GSDumpRaw(lpszCmdLine, repack_dump ? f.c_str() : nullptr);
 
 		uint32 crc;
 		file->Read(&crc, 4);
@@ -981,15 +1119,25 @@ void GSReplay(char* lpszCmdLine, int renderer)
 					switch (p->param)
 					{
 						case 0:
-							p->buff.resize(0x4000);
 							p->addr = 0x4000 - p->size;
-							file->Read(&p->buff[p->addr], p->size);
+							p->data = file->Map(p->size);
+							if (!p->data)
+							{
+								p->buff.resize(0x4000);
+								file->Read(&p->buff[p->addr], p->size);
+								p->data = &p->buff[p->addr];
+							}
 							break;
 						case 1:
 						case 2:
 						case 3:
-							p->buff.resize(p->size);
-							file->Read(&p->buff[0], p->size);
+							p->data = file->Map(p->size);
+							if (!p->data)
+							{
+								p->buff.resize(p->size);
+								file->Read(&p->buff[0], p->size);
+								p->data = &p->buff[0];
+							}
 							break;
 					}
 
@@ -1007,9 +1155,13 @@ void GSReplay(char* lpszCmdLine, int renderer)
 					break;
 
 				case 3:
-					p->buff.resize(0x2000);
-
-					file->Read(&p->buff[0], 0x2000);
+					p->data = file->Map(0x2000);
+					if (!p->data)
+					{
+						p->buff.resize(0x2000);
+						file->Read(&p->buff[0], 0x2000);
+						p->data = &p->buff[0];
+					}
 
 					break;
 			}
@@ -1019,8 +1171,6 @@ void GSReplay(char* lpszCmdLine, int renderer)
 			if (repack_dump && frame_number > -finished)
 				break;
 		}
-
-		delete file;
 	}
 
 	sleep(2);
@@ -1044,16 +1194,18 @@ void GSReplay(char* lpszCmdLine, int renderer)
 					switch (p->param)
 					{
 						case 0:
-							GSgifTransfer1(&p->buff[0], p->addr);
+							// only [mem + addr, mem + 0x4000) is dereferenced, so the
+							// base may point before a mapped span
+							GSgifTransfer1(const_cast<uint8*>(p->data) - p->addr, p->addr);
 							break;
 						case 1:
-							GSgifTransfer2(&p->buff[0], p->size / 16);
+							GSgifTransfer2(const_cast<uint8*>(p->data), p->size / 16);
 							break;
 						case 2:
-							GSgifTransfer3(&p->buff[0], p->size / 16);
+							GSgifTransfer3(const_cast<uint8*>(p->data), p->size / 16);
 							break;
 						case 3:
-							GSgifTransfer(&p->buff[0], p->size / 16);
+							GSgifTransfer(p->data, p->size / 16);
 							break;
 					}
 
@@ -1077,7 +1229,7 @@ void GSReplay(char* lpszCmdLine, int renderer)
 
 				case 3:
 
-					memcpy(regs, &p->buff[0], 0x2000);
+					memcpy(regs, p->data, 0x2000);
 
 					break;
 			}
@@ -1114,6 +1266,9 @@ void GSReplay(char* lpszCmdLine, int renderer)
 
 	packets.clear();
 
+	// mapped packets point into the dump, it has to outlive them
+	delete file;
+
 	sleep(2);
 
 	GSclose();
@@ -1617,21 +1772,26 @@ void GSApp::Init()
 	m_default_configuration["AspectRatio"]                                = "1";
 	m_default_configuration["autoflush_sw"]                               = "1";
 	m_default_configuration["capture_enabled"]                            = "0";
+	m_default_configuration["capture_encoder_cmd"]                        = "";
 	m_default_configuration["capture_out_dir"]                            = "/tmp/GS_Capture";
 	m_default_configuration["capture_threads"]                            = "4";
 	m_default_configuration["CaptureHeight"]                              = "480";
 	m_default_configuration["CaptureWidth"]                               = "640";
 	m_default_configuration["crc_hack_level"]                             = std::to_string(static_cast<int8>(CRCHackLevel::Automatic));
+	m_default_configuration["crc_hack_rules"]                             = "";
 	m_default_configuration["CrcHacksExclusions"]                         = "";
 	m_default_configuration["debug_glsl_shader"]                          = "0";
 	m_default_configuration["debug_opengl"]                               = "0";
 	m_default_configuration["disable_hw_gl_draw"]                         = "0";
 	m_default_configuration["dithering_ps2"]                              = "2";
 	m_default_configuration["dump"]                                       = "0";
+	m_default_configuration["dump_v2"]                                    = "0";
 	m_default_configuration["extrathreads"]                               = "2";
+	m_default_configuration["extrathreads_affinity"]                      = "0";
 	m_default_configuration["extrathreads_height"]                        = "4";
 	m_default_configuration["filter"]                                     = std::to_string(static_cast<int8>(BiFiltering::PS2));
 	m_default_configuration["force_texture_clear"]                        = "0";
+	m_default_configuration["frame_stream"]                               = "0";
 	m_default_configuration["fxaa"]                                       = "0";
 	m_default_configuration["interlace"]                                  = "7";
 	m_default_configuration["conservative_framebuffer"]                   = "1";
@@ -1685,13 +1845,20 @@ void GSApp::Init()
 	m_default_configuration["saven"]                                      = "0";
 	m_default_configuration["savet"]                                      = "0";
 	m_default_configuration["savez"]                                      = "0";
+	m_default_configuration["scanline_cache_dir"]                         = "/tmp/GS_ScanlineCache";
 	m_default_configuration["ShadeBoost"]                                 = "0";
 	m_default_configuration["ShadeBoost_Brightness"]                      = "50";
 	m_default_configuration["ShadeBoost_Contrast"]                        = "50";
 	m_default_configuration["ShadeBoost_Saturation"]                      = "50";
+	m_default_configuration["shader_cache_dir"]                           = "/tmp/GS_ShaderCache";
 	m_default_configuration["shaderfx"]                                   = "0";
 	m_default_configuration["shaderfx_conf"]                              = "shaders/GS_FX_Settings.ini";
 	m_default_configuration["shaderfx_glsl"]                              = "shaders/GS.fx";
+	m_default_configuration["snapshot_frames"]                            = "1";
+	m_default_configuration["swizzle_threads"]                            = "0";
+	m_default_configuration["texture_cache_budget_mb"]                    = "0";
+	m_default_configuration["texture_pool_budget_mb"]                     = "0";
+	m_default_configuration["texture_warm_dir"]                           = "";
 	m_default_configuration["TVShader"]                                   = "0";
 	m_default_configuration["upscale_multiplier"]                         = "1";
 	m_default_configuration["UserHacks"]                                  = "0";
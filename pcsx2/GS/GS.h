@@ -32,7 +32,7 @@
 #include <shellapi.h>
 #include <d3dcompiler.h>
 #include <d3d11_1.h>
-#include <dxgi1_3.h>
+#include <dxgi1_5.h>
 
 #else
 
@@ -367,6 +367,8 @@ enum GIF_REG_COMPLEX
 {
 	GIF_REG_STQRGBAXYZF2 = 0x00,
 	GIF_REG_STQRGBAXYZ2 = 0x01,
+	GIF_REG_XYZF2RUN = 0x02,
+	GIF_REG_XYZ2RUN = 0x03,
 };
 
 enum GIF_A_D_REG
@@ -1409,7 +1411,9 @@ struct alignas(32) GIFPath
 		TYPE_UNKNOWN,
 		TYPE_ADONLY,
 		TYPE_STQRGBAXYZF2,
-		TYPE_STQRGBAXYZ2
+		TYPE_STQRGBAXYZ2,
+		TYPE_XYZF2,
+		TYPE_XYZ2
 	};
 
 	__forceinline void SetTag(const void* mem)
@@ -1448,8 +1452,25 @@ struct alignas(32) GIFPath
 				switch (nreg)
 				{
 					case 1:
+						// particle bursts: color/tex set up once, then a position-only run
+						if (regs.u32[0] == 0x00000004)
+							type = TYPE_XYZF2;
+						if (regs.u32[0] == 0x00000005)
+							type = TYPE_XYZ2;
 						break;
 					case 2:
+						if (regs.u32[0] == 0x00000404)
+						{
+							type = TYPE_XYZF2;
+							nreg = 1;
+							nloop *= 2;
+						}
+						if (regs.u32[0] == 0x00000505)
+						{
+							type = TYPE_XYZ2;
+							nreg = 1;
+							nloop *= 2;
+						}
 						break;
 					case 3:
 						// many games, TODO: formats mixed with NOPs (xeno2: 040f010f02, 04010f020f, mgs3: 04010f0f02, 0401020f0f, 04010f020f)
@@ -1505,6 +1526,27 @@ struct alignas(32) GIFPath
 				}
 			}
 		}
+		else if (tag.FLG == GIF_FLG_REGLIST)
+		{
+			switch (nreg)
+			{
+				case 1:
+					// VU1 renderers like to kick pre-swizzled vertices as plain position runs
+					if (regs.u32[0] == 0x00000004)
+						type = TYPE_XYZF2;
+					if (regs.u32[0] == 0x00000005)
+						type = TYPE_XYZ2;
+					break;
+				case 3:
+					if (regs.u32[0] == 0x00040102)
+						type = TYPE_STQRGBAXYZF2;
+					if (regs.u32[0] == 0x00050102)
+						type = TYPE_STQRGBAXYZ2;
+					break;
+				default:
+					break;
+			}
+		}
 	}
 
 	__forceinline uint8 GetReg() const
@@ -1812,11 +1854,19 @@ void GSendRecording();
 void GSsetGameCRC(uint32 crc, int options);
 void GSgetLastTag(uint32* tag);
 void GSgetTitleInfo2(char* dest, size_t length);
+// Per-frame averages of the internal perf-monitor counters since the last
+// readout; used by the GS dump benchmark (gui/GSDumpBench.cpp).
+void GSgetPerfStats(double* prims, double* draws, double* syncs);
 void GSsetFrameSkip(int frameskip);
 void GSsetVsync(int vsync);
 void GSsetExclusive(int enabled);
 bool GSGetFMVSwitch();
 void GSSetFMVSwitch(bool enabled);
+// Drains the packet queue of the SW renderer frame stream ("frame_stream"
+// config); see Renderers/SW/GSFrameStream.h for the packet layout.
+size_t GSfetchEncodedFrame(void* dst, size_t available);
+void GSSetWarmSwitch(bool enabled);
+void GSSetEELatency(double ms);
 
 class GSApp
 {
@@ -1665,6 +1665,31 @@ public:
 #endif
 	}
 
+#if _M_SSE >= 0x501
+
+	__forceinline static void ExpandRow8_32(const GSVector4i& v, const uint32* RESTRICT pal, uint8* RESTRICT dst)
+	{
+		GSVector8i* d = (GSVector8i*)dst;
+
+		d[0] = GSVector8i::cast(v).u8to32c().gather32_32(pal);
+		d[1] = GSVector8i::cast(v.zwzw()).u8to32c().gather32_32(pal);
+	}
+
+	__forceinline static void ExpandRow4_32(const GSVector4i& v, const uint64* RESTRICT pal, uint8* RESTRICT dst)
+	{
+		GSVector8i* d = (GSVector8i*)dst;
+
+		GSVector8i i0 = GSVector8i::cast(v).u8to32c();
+		GSVector8i i1 = GSVector8i::cast(v.zwzw()).u8to32c();
+
+		d[0] = i0.gather64_32(pal);
+		d[1] = GSVector8i::cast(i0.extract<1>()).gather64_32(pal);
+		d[2] = i1.gather64_32(pal);
+		d[3] = GSVector8i::cast(i1.extract<1>()).gather64_32(pal);
+	}
+
+#endif
+
 	__forceinline static void ReadAndExpandBlock8_32(const uint8* RESTRICT src, uint8* RESTRICT dst, int dstpitch, const uint32* RESTRICT pal)
 	{
 		//printf("ReadAndExpandBlock8_32\n");
@@ -1684,6 +1709,19 @@ public:
 			GSVector4i::sw16(v0, v1, v2, v3);
 			GSVector4i::sw32(v0, v1, v3, v2);
 
+#if _M_SSE >= 0x501
+
+			ExpandRow8_32(v0, pal, dst);
+			dst += dstpitch;
+			ExpandRow8_32(v3, pal, dst);
+			dst += dstpitch;
+			ExpandRow8_32(v1, pal, dst);
+			dst += dstpitch;
+			ExpandRow8_32(v2, pal, dst);
+			dst += dstpitch;
+
+#else
+
 			v0.gather32_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
 			v3.gather32_8<>(pal, (GSVector4i*)dst);
@@ -1693,6 +1731,8 @@ public:
 			v2.gather32_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
 
+#endif
+
 			v2 = s[i * 8 + 4].shuffle8(mask);
 			v3 = s[i * 8 + 5].shuffle8(mask);
 			v0 = s[i * 8 + 6].shuffle8(mask);
@@ -1701,6 +1741,19 @@ public:
 			GSVector4i::sw16(v0, v1, v2, v3);
 			GSVector4i::sw32(v0, v1, v3, v2);
 
+#if _M_SSE >= 0x501
+
+			ExpandRow8_32(v0, pal, dst);
+			dst += dstpitch;
+			ExpandRow8_32(v3, pal, dst);
+			dst += dstpitch;
+			ExpandRow8_32(v1, pal, dst);
+			dst += dstpitch;
+			ExpandRow8_32(v2, pal, dst);
+			dst += dstpitch;
+
+#else
+
 			v0.gather32_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
 			v3.gather32_8<>(pal, (GSVector4i*)dst);
@@ -1709,6 +1762,8 @@ public:
 			dst += dstpitch;
 			v2.gather32_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
+
+#endif
 		}
 	}
 
@@ -1741,6 +1796,19 @@ public:
 
 			GSVector4i::sw16rh(v0, v1, v2, v3);
 
+#if _M_SSE >= 0x501
+
+			ExpandRow4_32(v0, pal, dst);
+			dst += dstpitch;
+			ExpandRow4_32(v1, pal, dst);
+			dst += dstpitch;
+			ExpandRow4_32(v2, pal, dst);
+			dst += dstpitch;
+			ExpandRow4_32(v3, pal, dst);
+			dst += dstpitch;
+
+#else
+
 			v0.gather64_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
 			v1.gather64_8<>(pal, (GSVector4i*)dst);
@@ -1750,6 +1818,8 @@ public:
 			v3.gather64_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
 
+#endif
+
 			v0 = s[i * 8 + 4].xzyw();
 			v1 = s[i * 8 + 5].xzyw();
 			v2 = s[i * 8 + 6].xzyw();
@@ -1766,6 +1836,19 @@ public:
 
 			GSVector4i::sw16rl(v0, v1, v2, v3);
 
+#if _M_SSE >= 0x501
+
+			ExpandRow4_32(v0, pal, dst);
+			dst += dstpitch;
+			ExpandRow4_32(v1, pal, dst);
+			dst += dstpitch;
+			ExpandRow4_32(v2, pal, dst);
+			dst += dstpitch;
+			ExpandRow4_32(v3, pal, dst);
+			dst += dstpitch;
+
+#else
+
 			v0.gather64_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
 			v1.gather64_8<>(pal, (GSVector4i*)dst);
@@ -1774,6 +1857,8 @@ public:
 			dst += dstpitch;
 			v3.gather64_8<>(pal, (GSVector4i*)dst);
 			dst += dstpitch;
+
+#endif
 		}
 	}
 
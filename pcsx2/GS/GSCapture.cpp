@@ -389,6 +389,27 @@ static wil::com_ptr_nothrow<IPin> GetFirstPin(IBaseFilter* pBF, PIN_DIRECTION di
 
 #endif
 
+#if defined(__unix__)
+
+// Expands the %w/%h/%f placeholders of the capture_encoder_cmd setting with the
+// capture width, height and framerate.
+static std::string ExpandEncoderCmd(std::string cmd, const GSVector2i& size, float fps)
+{
+	auto replace = [&cmd](const char* token, const std::string& value)
+	{
+		for (size_t pos = cmd.find(token); pos != std::string::npos; pos = cmd.find(token, pos + value.size()))
+			cmd.replace(pos, 2, value);
+	};
+
+	replace("%w", format("%d", size.x));
+	replace("%h", format("%d", size.y));
+	replace("%f", format("%.4f", fps));
+
+	return cmd;
+}
+
+#endif
+
 //
 // GSCapture
 //
@@ -401,6 +422,7 @@ GSCapture::GSCapture()
 	m_threads = theApp.GetConfigI("capture_threads");
 #if defined(__unix__)
 	m_compression_level = theApp.GetConfigI("png_compression_level");
+	m_encoder_pipe = nullptr;
 #endif
 }
 
@@ -521,24 +543,54 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 	m_graph.query<IMediaControl>()->Run();
 	m_src.query<IGSSource>()->DeliverNewSegment();
 
+	m_frame = 0;
+
+	for (int i = 0; i < BUFFERS; i++)
+		m_buffers.push_back((uint8*)_aligned_malloc(m_size.x * m_size.y * 4, 32));
+
+	m_encoder = std::unique_ptr<GSJobQueue<Frame, BUFFERS>>(new GSJobQueue<Frame, BUFFERS>(
+		[this](Frame& frame) { EncodeFrame(frame); }));
+
 	m_capturing = true;
 	filename = convert_utf16_to_utf8(dlg.m_filename.erase(dlg.m_filename.length() - 3, 3) + L"wav");
 	return true;
 #elif defined(__unix__)
-	// Note I think it doesn't support multiple depth creation
-	GSmkdir(m_out_dir.c_str());
-
-	// Really cheap recording
 	m_frame = 0;
 	// Add option !!!
 	m_size.x = theApp.GetConfigI("CaptureWidth");
 	m_size.y = theApp.GetConfigI("CaptureHeight");
 
-	for (int i = 0; i < m_threads; i++)
+	// When an encoder command is configured, frames are piped to it raw and the
+	// encode happens out of process -- point it at ffmpeg with a vaapi/nvenc
+	// encoder and capture costs little more than the readback copy.  Example:
+	//   ffmpeg -f rawvideo -pix_fmt rgba -s %wx%h -r %f -i - -vaapi_device
+	//   /dev/dri/renderD128 -vf format=nv12,hwupload -c:v h264_vaapi out.mkv
+	const std::string cmd = theApp.GetConfigS("capture_encoder_cmd");
+	if (!cmd.empty())
+	{
+		m_encoder_pipe = popen(ExpandEncoderCmd(cmd, m_size, fps).c_str(), "w");
+		if (!m_encoder_pipe)
+			fprintf(stderr, "GSCapture: failed to start encoder '%s', falling back to PNG capture\n", cmd.c_str());
+	}
+
+	if (!m_encoder_pipe)
 	{
-		m_workers.push_back(std::unique_ptr<GSPng::Worker>(new GSPng::Worker(&GSPng::Process)));
+		// Really cheap recording
+		// Note I think it doesn't support multiple depth creation
+		GSmkdir(m_out_dir.c_str());
+
+		for (int i = 0; i < m_threads; i++)
+		{
+			m_workers.push_back(std::unique_ptr<GSPng::Worker>(new GSPng::Worker(&GSPng::Process)));
+		}
 	}
 
+	for (int i = 0; i < BUFFERS; i++)
+		m_buffers.push_back((uint8*)_aligned_malloc(m_size.x * m_size.y * 4, 32));
+
+	m_encoder = std::unique_ptr<GSJobQueue<Frame, BUFFERS>>(new GSJobQueue<Frame, BUFFERS>(
+		[this](Frame& frame) { EncodeFrame(frame); }));
+
 	m_capturing = true;
 	filename = m_out_dir + "/audio_recording.wav";
 	return true;
@@ -556,26 +608,61 @@ bool GSCapture::DeliverFrame(const void* bits, int pitch, bool rgba)
 		return false;
 	}
 
+	if (!m_capturing || m_buffers.empty())
+		return false;
+
+	// Hand the frame over to the encode thread through the spsc queue, the
+	// only work left here is the copy out of the mapped readback. Push only
+	// spins when the encoder is a full ring behind.
+
+	Frame frame;
+
+	frame.bits = m_buffers[m_frame % BUFFERS];
+	frame.pitch = m_size.x * 4;
+	frame.n = m_frame;
+	frame.rgba = rgba;
+
+	const uint8* src = (const uint8*)bits;
+	const int len = std::min(pitch, frame.pitch);
+
+	for (int j = 0; j < m_size.y; j++)
+	{
+		memcpy(frame.bits + j * frame.pitch, src + j * pitch, len);
+	}
+
+	m_encoder->Push(frame);
+
+	m_frame++;
+
+	return true;
+}
+
+void GSCapture::EncodeFrame(Frame& frame)
+{
 #ifdef _WIN32
 
 	if (m_src)
 	{
-		m_src.query<IGSSource>()->DeliverFrame(bits, pitch, rgba);
-
-		return true;
+		m_src.query<IGSSource>()->DeliverFrame(frame.bits, frame.pitch, frame.rgba);
 	}
 
 #elif defined(__unix__)
 
-	std::string out_file = m_out_dir + format("/frame.%010d.png", m_frame);
-	//GSPng::Save(GSPng::RGB_PNG, out_file, (uint8*)bits, m_size.x, m_size.y, pitch, m_compression_level);
-	m_workers[m_frame % m_threads]->Push(std::make_shared<GSPng::Transaction>(GSPng::RGB_PNG, out_file, static_cast<const uint8*>(bits), m_size.x, m_size.y, pitch, m_compression_level));
+	if (m_encoder_pipe)
+	{
+		// Tightly packed 32bpp frames; the channel order matches what the device
+		// read back (rgba from GL, bgra from the software renderer), which the
+		// encoder command's -pix_fmt has to agree with.
+		if (fwrite(frame.bits, (size_t)m_size.y * frame.pitch, 1, m_encoder_pipe) != 1)
+			fprintf(stderr, "GSCapture: encoder pipe write failed, frame %llu dropped\n", (unsigned long long)frame.n);
+		return;
+	}
 
-	m_frame++;
+	std::string out_file = m_out_dir + format("/frame.%010d.png", frame.n);
+	//GSPng::Save(GSPng::RGB_PNG, out_file, frame.bits, m_size.x, m_size.y, frame.pitch, m_compression_level);
+	m_workers[frame.n % m_threads]->Push(std::make_shared<GSPng::Transaction>(GSPng::RGB_PNG, out_file, frame.bits, m_size.x, m_size.y, frame.pitch, m_compression_level));
 
 #endif
-
-	return false;
 }
 
 bool GSCapture::EndCapture()
@@ -585,6 +672,24 @@ bool GSCapture::EndCapture()
 
 	std::lock_guard<std::recursive_mutex> lock(m_lock);
 
+	// Drain the encode thread before tearing anything down, the queued
+	// frames point into m_buffers
+
+	if (m_encoder)
+	{
+		m_encoder->Wait();
+		m_encoder.reset();
+	}
+
+	for (uint8* buffer : m_buffers)
+	{
+		_aligned_free(buffer);
+	}
+
+	m_buffers.clear();
+
+	m_frame = 0;
+
 #ifdef _WIN32
 
 	if (m_src)
@@ -600,9 +705,14 @@ bool GSCapture::EndCapture()
 	}
 
 #elif defined(__unix__)
-	m_workers.clear();
+	if (m_encoder_pipe)
+	{
+		// Closing the pipe is what tells the encoder to finalize the container.
+		pclose(m_encoder_pipe);
+		m_encoder_pipe = nullptr;
+	}
 
-	m_frame = 0;
+	m_workers.clear();
 
 #endif
 
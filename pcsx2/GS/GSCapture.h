@@ -25,6 +25,16 @@
 
 class GSCapture
 {
+	struct Frame
+	{
+		uint8* bits;
+		int pitch;
+		uint64 n;
+		bool rgba;
+	};
+
+	static const int BUFFERS = 4;
+
 	std::recursive_mutex m_lock;
 	bool m_capturing;
 	GSVector2i m_size;
@@ -32,6 +42,15 @@ class GSCapture
 	std::string m_out_dir;
 	int m_threads;
 
+	// Preallocated ring of capture buffers handed over to the encode thread
+	// through the job queue, DeliverFrame only has to copy the frame into
+	// the next slot. A slot cannot be overwritten before its frame has been
+	// encoded, the queue holds popped items until the callback returns.
+	std::vector<uint8*> m_buffers;
+	std::unique_ptr<GSJobQueue<Frame, BUFFERS>> m_encoder;
+
+	void EncodeFrame(Frame& frame);
+
 #ifdef _WIN32
 
 	wil::com_ptr_failfast<IGraphBuilder> m_graph;
@@ -42,6 +61,10 @@ class GSCapture
 	std::vector<std::unique_ptr<GSPng::Worker>> m_workers;
 	int m_compression_level;
 
+	// Pipe to an external encoder process (capture_encoder_cmd); when open the
+	// PNG workers above are bypassed entirely.
+	FILE* m_encoder_pipe;
+
 #endif
 
 public:
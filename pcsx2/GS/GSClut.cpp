@@ -29,6 +29,7 @@ GSClut::GSClut(GSLocalMemory* mem)
 	m_buff64 = (uint64*)&p[4096]; // 2k
 	m_write.dirty = true;
 	m_read.dirty = true;
+	m_read.dirty_mask = 0;
 
 	for (int i = 0; i < 16; i++)
 	{
@@ -155,11 +156,11 @@ void GSClut::Write(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
 	m_write.TEX0 = TEX0;
 	m_write.TEXCLUT = TEXCLUT;
 	m_write.dirty = false;
-	m_read.dirty = true;
 
 	(this->*m_wc[TEX0.CSM][TEX0.CPSM][TEX0.PSM])(TEX0, TEXCLUT);
 
-	// Mirror write to other half of buffer to simulate wrapping memory
+	// Mirror write to other half of buffer to simulate wrapping memory,
+	// and mark the written 16 entry slices for the incremental Read32 path
 
 	int offset = (TEX0.CSA & (TEX0.CPSM < PSM_PSMCT16 ? 15 : 31)) * 16;
 
@@ -169,6 +170,13 @@ void GSClut::Write(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
 
 		memcpy(m_clut + 512 + offset, m_clut + offset, sizeof(*m_clut) * std::min(size, 512 - offset));
 		memcpy(m_clut, m_clut + 512, sizeof(*m_clut) * std::max(0, size + offset - 512));
+
+		int start = offset >> 4;
+		int count = size >> 4;
+
+		uint32 mask = count >= 32 ? 0xffffffff : (1u << count) - 1;
+
+		m_read.dirty_mask |= (mask << start) | (start > 0 ? mask >> (32 - start) : 0);
 	}
 	else
 	{
@@ -176,9 +184,13 @@ void GSClut::Write(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
 
 		memcpy(m_clut + 512 + offset, m_clut + offset, sizeof(*m_clut) * size);
 
+		m_read.dirty_mask |= 1u << (offset >> 4);
+
 		if (TEX0.CPSM < PSM_PSMCT16)
 		{
 			memcpy(m_clut + 512 + 256 + offset, m_clut + 256 + offset, sizeof(*m_clut) * size);
+
+			m_read.dirty_mask |= 1u << (((offset + 256) >> 4) & 31);
 		}
 	}
 }
@@ -329,6 +341,7 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 		m_read.TEX0 = TEX0;
 		m_read.TEXA = TEXA;
 		m_read.dirty = false;
+		m_read.dirty_mask = 0;
 		m_read.adirty = true;
 
 		uint16* clut = m_clut;
@@ -372,6 +385,82 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 			}
 		}
 	}
+	else if (m_read.dirty_mask)
+	{
+		// same registers as the cached conversion, only refresh the 16 entry
+		// slices touched by CLUT writes since the last read
+
+		const uint32 dirty = m_read.dirty_mask;
+
+		m_read.dirty_mask = 0;
+		m_read.adirty = true;
+
+		uint16* clut = m_clut;
+
+		if (TEX0.CPSM == PSM_PSMCT32 || TEX0.CPSM == PSM_PSMCT24)
+		{
+			int offset = (TEX0.CSA & 15) << 4;
+
+			clut += offset;
+
+			switch (TEX0.PSM)
+			{
+				case PSM_PSMT8:
+				case PSM_PSMT8H:
+					for (int i = 0; i < 256; i += 16)
+					{
+						// each 16 color chunk reads a low and a high half slice
+
+						uint32 lo = 1u << (((offset + i) >> 4) & 31);
+						uint32 hi = 1u << (((offset + i + 256) >> 4) & 31);
+
+						if (dirty & (lo | hi))
+						{
+							ReadCLUT_T32_I4(&clut[i], &m_buff32[i]);
+						}
+					}
+					break;
+				case PSM_PSMT4:
+				case PSM_PSMT4HL:
+				case PSM_PSMT4HH:
+					if (dirty & ((1u << (offset >> 4)) | (1u << (((offset + 256) >> 4) & 31))))
+					{
+						ReadCLUT_T32_I4(clut, m_buff32);
+						ExpandCLUT64_T32_I8(m_buff32, (uint64*)m_buff64);
+					}
+					break;
+			}
+		}
+		else if (TEX0.CPSM == PSM_PSMCT16 || TEX0.CPSM == PSM_PSMCT16S)
+		{
+			int offset = TEX0.CSA << 4;
+
+			clut += offset;
+
+			switch (TEX0.PSM)
+			{
+				case PSM_PSMT8:
+				case PSM_PSMT8H:
+					for (int i = 0; i < 256; i += 16)
+					{
+						if (dirty & (1u << (((offset + i) >> 4) & 31)))
+						{
+							Expand16(&clut[i], &m_buff32[i], 16, TEXA);
+						}
+					}
+					break;
+				case PSM_PSMT4:
+				case PSM_PSMT4HL:
+				case PSM_PSMT4HH:
+					if (dirty & (1u << (offset >> 4)))
+					{
+						Expand16(clut, m_buff32, 16, TEXA);
+						ExpandCLUT64_T32_I8(m_buff32, (uint64*)m_buff64);
+					}
+					break;
+			}
+		}
+	}
 }
 
 void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
@@ -50,6 +50,7 @@ class alignas(32) GSClut : public GSAlignedClass<32>
 		bool dirty;
 		bool adirty;
 		int amin, amax;
+		uint32 dirty_mask; // one bit per 16 entry CSA slice written since the last conversion
 		bool IsDirty(const GIFRegTEX0& TEX0);
 		bool IsDirty(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 	} m_read;
@@ -71,6 +71,8 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	AppendRawData(1);
 	AppendRawData(static_cast<uint8>(field));
 
+	MarkFrame();
+
 	if (last)
 		m_extra_frames--;
 
@@ -107,6 +109,51 @@ void GSDump::AppendRawData(uint8 c)
 	Write(&c, 1);
 }
 
+//////////////////////////////////////////////////////////////////////
+// GSDumpV2 implementation
+//////////////////////////////////////////////////////////////////////
+
+GSDumpV2::GSDumpV2(const std::string& fn, uint32 crc, const freezeData& fd, const GSPrivRegSet* regs)
+	: GSDumpBase(fn + ".gs2")
+	, m_offset(0)
+{
+	AppendRawData("GSv2", 4);
+	AddHeader(crc, fd, regs);
+
+	// the first frame's packets start right after the header
+	m_index.push_back(m_offset);
+}
+
+GSDumpV2::~GSDumpV2()
+{
+	// the end entry points at the index itself
+
+	m_index.push_back(m_offset);
+
+	uint32 count = static_cast<uint32>(m_index.size());
+
+	Write(m_index.data(), sizeof(uint64) * count);
+	Write(&count, 4);
+	Write("GSv2", 4);
+}
+
+void GSDumpV2::AppendRawData(const void* data, size_t size)
+{
+	Write(data, size);
+	m_offset += size;
+}
+
+void GSDumpV2::AppendRawData(uint8 c)
+{
+	Write(&c, 1);
+	m_offset++;
+}
+
+void GSDumpV2::MarkFrame()
+{
+	m_index.push_back(m_offset);
+}
+
 //////////////////////////////////////////////////////////////////////
 // GSDumpXz implementation
 //////////////////////////////////////////////////////////////////////
@@ -36,6 +36,14 @@ ReadFIFO2 data (id == 2)
 Regs data (id == 3)
 - [PMODE/0x2000]
 
+V2 dump file format (.gs2), designed to be memory mapped by the replayer:
+- ["GSv2"/4] [v1 header] [id/1] [data/?] .. [id/1] [data/?] [index]
+- index: [frame offset/8] .. [frame offset/8] [end offset/8] [entry count/4] ["GSv2"/4]
+
+Frame offset n is the file offset of the first packet of frame n, the end
+offset points at the index itself, so any frame's packet span can be sliced
+out of the mapping without decoding the prefix.
+
 */
 
 class GSDumpBase
@@ -50,6 +58,7 @@ protected:
 
 	virtual void AppendRawData(const void* data, size_t size) = 0;
 	virtual void AppendRawData(uint8 c) = 0;
+	virtual void MarkFrame() {}
 
 public:
 	GSDumpBase(const std::string& fn);
@@ -70,6 +79,20 @@ public:
 	virtual ~GSDump() = default;
 };
 
+class GSDumpV2 final : public GSDumpBase
+{
+	uint64 m_offset;
+	std::vector<uint64> m_index;
+
+	void AppendRawData(const void* data, size_t size) final;
+	void AppendRawData(uint8 c) final;
+	void MarkFrame() final;
+
+public:
+	GSDumpV2(const std::string& fn, uint32 crc, const freezeData& fd, const GSPrivRegSet* regs);
+	virtual ~GSDumpV2();
+};
+
 class GSDumpXz final : public GSDumpBase
 {
 	lzma_stream m_strm;
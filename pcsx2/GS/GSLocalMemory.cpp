@@ -100,6 +100,33 @@ GSLocalMemory::GSLocalMemory()
 
 	memset(m_vm8, 0, m_vmsize);
 
+	int threads = theApp.GetConfigI("swizzle_threads");
+
+	for (int i = 0; i < threads; i++)
+	{
+		m_swizzle_workers.push_back(std::unique_ptr<GSSwizzleWorker>(new GSSwizzleWorker([](std::function<void()>& job)
+		{
+			ALIGN_STACK(32);
+
+			job();
+		})));
+	}
+
+	// The offset tables (and m_psm, which points into them) are static and
+	// depend only on the fixed GS swizzle layout, so build them once per
+	// process instead of redoing ~6MB of table writes on every GS open.
+	static bool s_tables_done = (InitAddressTables(), true);
+	(void)s_tables_done;
+}
+
+// One-time construction of the static address/offset tables.  Layout note:
+// pageOffset* keep their [bp][y][x] shape with x contiguous - that is already
+// the order ReadImageX/WriteImageX and the texture readers walk pixels in, so
+// steady-state locality is best served by leaving the layout alone and simply
+// not rebuilding it.  The per-entry PixelAddressOrg* math itself folds to
+// plain lookups of the constexpr block/column tables in GSTables.h.
+void GSLocalMemory::InitAddressTables()
+{
 	for (int bp = 0; bp < 32; bp++)
 	{
 		for (int y = 0; y < 32; y++) for (int x = 0; x < 64; x++)
@@ -767,6 +794,53 @@ void GSLocalMemory::WriteImageBlock(int l, int r, int y, int h, const uint8* src
 	}
 }
 
+// splits [top, bottom) into (worker count + 1) bands on block-row boundaries,
+// the last one is done on the calling thread while the workers chew on theirs
+
+void GSLocalMemory::ParallelBands(int top, int bottom, int align, const std::function<void(int, int)>& band)
+{
+	int bands = (int)m_swizzle_workers.size() + 1;
+	int rows = (bottom - top) / align;
+	int h = (rows + bands - 1) / bands * align;
+
+	size_t queued = 0;
+
+	for (; queued < m_swizzle_workers.size() && top + h < bottom; queued++, top += h)
+	{
+		int t = top;
+
+		m_swizzle_workers[queued]->Push([=]() { band(t, t + h); });
+	}
+
+	band(top, bottom);
+
+	for (size_t i = 0; i < queued; i++)
+	{
+		m_swizzle_workers[i]->Wait();
+	}
+}
+
+template <int psm, int bsx, int bsy, int alignment>
+void GSLocalMemory::WriteImageBlockBands(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
+{
+	// each band writes its own whole blocks, but short transfers are cheaper
+	// than a round trip through the worker queues
+
+	if (m_swizzle_workers.empty() || h < bsy * 8 || (r - l) * h < 128 * 128)
+	{
+		WriteImageBlock<psm, bsx, bsy, alignment>(l, r, y, h, src, srcpitch, BITBLTBUF);
+
+		return;
+	}
+
+	GIFRegBITBLTBUF blit = BITBLTBUF;
+
+	ParallelBands(y, y + h, bsy, [=](int top, int bottom)
+	{
+		WriteImageBlock<psm, bsx, bsy, alignment>(l, r, top, bottom - top, src + (top - y) * srcpitch, srcpitch, blit);
+	});
+}
+
 template <int psm, int bsx, int bsy>
 void GSLocalMemory::WriteImageLeftRight(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
 {
@@ -1030,15 +1104,15 @@ void GSLocalMemory::WriteImage(int& tx, int& ty, const uint8* src, int len, GIFR
 
 					if ((addr & 31) == 0 && (srcpitch & 31) == 0)
 					{
-						WriteImageBlock<psm, bsx, bsy, 32>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlockBands<psm, bsx, bsy, 32>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 					else if ((addr & 15) == 0 && (srcpitch & 15) == 0)
 					{
-						WriteImageBlock<psm, bsx, bsy, 16>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlockBands<psm, bsx, bsy, 16>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 					else
 					{
-						WriteImageBlock<psm, bsx, bsy, 0>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlockBands<psm, bsx, bsy, 0>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 
 					s += srcpitch * h2;
@@ -1986,14 +2060,45 @@ void GSLocalMemory::ReadTexture(const GSOffset* RESTRICT off, const GSVector4i&
 
 			if (!cr.rempty())
 			{
-				(this->*rtx)(off, cr, dst + (cr.left - r.left) * sizeof(uint32), dstpitch, TEXA);
+				ReadTextureBands(rtx, off, cr, dst + (cr.left - r.left) * sizeof(uint32), dstpitch, TEXA);
 			}
 		}
 	}
 	else
+	{
+		ReadTextureBands(rtx, off, r, dst, dstpitch, TEXA);
+	}
+}
+
+void GSLocalMemory::ReadTextureBands(readTexture rtx, const GSOffset* RESTRICT off, const GSVector4i& r, uint8* dst, int dstpitch, const GIFRegTEXA& TEXA)
+{
+	const GSVector2i& bs = m_psm[off->psm].bs;
+
+	// bands only read the blocks of their own rows, but short reads are
+	// cheaper than a round trip through the worker queues
+
+	if (m_swizzle_workers.empty() || (r.bottom - r.top) < bs.y * 8 || (r.right - r.left) * (r.bottom - r.top) < 128 * 128)
 	{
 		(this->*rtx)(off, r, dst, dstpitch, TEXA);
+
+		return;
 	}
+
+	// captured as plain ints, the closure may end up on the heap where it
+	// only gets malloc alignment
+
+	int left = r.left;
+	int right = r.right;
+	int rtop = r.top;
+
+	GIFRegTEXA texa = TEXA;
+
+	ParallelBands(r.top, r.bottom, bs.y, [=](int top, int bottom)
+	{
+		GSVector4i band(left, top, right, bottom);
+
+		(this->*rtx)(off, band, dst + (top - rtop) * dstpitch, dstpitch, texa);
+	});
 }
 
 // 32/8
@@ -20,6 +20,7 @@
 #include "GSVector.h"
 #include "GSBlock.h"
 #include "GSClut.h"
+#include "GSThread_CXX11.h"
 
 class GSOffset : public GSAlignedClass<32>
 {
@@ -175,6 +176,18 @@ protected:
 	std::unordered_map<uint32, GSPixelOffset4*> m_po4map;
 	std::unordered_map<uint64, std::vector<GSVector2i>*> m_p2tmap;
 
+	// optional worker pool for splitting large swizzle/deswizzle jobs into
+	// block-row bands, each band only touching its own 256 byte blocks
+
+	using GSSwizzleWorker = GSJobQueue<std::function<void()>, 32>;
+
+	std::vector<std::unique_ptr<GSSwizzleWorker>> m_swizzle_workers;
+
+	void ParallelBands(int top, int bottom, int align, const std::function<void(int, int)>& band);
+
+	// One-time (per process) construction of the static swizzle offset tables
+	static void InitAddressTables();
+
 public:
 	GSLocalMemory();
 	virtual ~GSLocalMemory();
@@ -186,46 +199,46 @@ public:
 
 	// address
 
-	static uint32 BlockNumber32(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber32(int x, int y, uint32 bp, uint32 bw)
 	{
 		return bp + (y & ~0x1f) * bw + ((x >> 1) & ~0x1f) + blockTable32[(y >> 3) & 3][(x >> 3) & 7];
 	}
 
-	static uint32 BlockNumber16(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber16(int x, int y, uint32 bp, uint32 bw)
 	{
 		return bp + ((y >> 1) & ~0x1f) * bw + ((x >> 1) & ~0x1f) + blockTable16[(y >> 3) & 7][(x >> 4) & 3];
 	}
 
-	static uint32 BlockNumber16S(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber16S(int x, int y, uint32 bp, uint32 bw)
 	{
 		return bp + ((y >> 1) & ~0x1f) * bw + ((x >> 1) & ~0x1f) + blockTable16S[(y >> 3) & 7][(x >> 4) & 3];
 	}
 
-	static uint32 BlockNumber8(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber8(int x, int y, uint32 bp, uint32 bw)
 	{
 		// ASSERT((bw & 1) == 0); // allowed for mipmap levels
 
 		return bp + ((y >> 1) & ~0x1f) * (bw >> 1) + ((x >> 2) & ~0x1f) + blockTable8[(y >> 4) & 3][(x >> 4) & 7];
 	}
 
-	static uint32 BlockNumber4(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber4(int x, int y, uint32 bp, uint32 bw)
 	{
 		// ASSERT((bw & 1) == 0); // allowed for mipmap levels
 
 		return bp + ((y >> 2) & ~0x1f) * (bw >> 1) + ((x >> 2) & ~0x1f) + blockTable4[(y >> 4) & 7][(x >> 5) & 3];
 	}
 
-	static uint32 BlockNumber32Z(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber32Z(int x, int y, uint32 bp, uint32 bw)
 	{
 		return bp + (y & ~0x1f) * bw + ((x >> 1) & ~0x1f) + blockTable32Z[(y >> 3) & 3][(x >> 3) & 7];
 	}
 
-	static uint32 BlockNumber16Z(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber16Z(int x, int y, uint32 bp, uint32 bw)
 	{
 		return bp + ((y >> 1) & ~0x1f) * bw + ((x >> 1) & ~0x1f) + blockTable16Z[(y >> 3) & 7][(x >> 4) & 3];
 	}
 
-	static uint32 BlockNumber16SZ(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 BlockNumber16SZ(int x, int y, uint32 bp, uint32 bw)
 	{
 		return bp + ((y >> 1) & ~0x1f) * bw + ((x >> 1) & ~0x1f) + blockTable16SZ[(y >> 3) & 7][(x >> 4) & 3];
 	}
@@ -275,42 +288,42 @@ public:
 		return &m_vm8[BlockNumber16SZ(x, y, bp, bw) << 8];
 	}
 
-	static uint32 PixelAddressOrg32(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg32(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber32(x, y, bp, bw) << 6) + columnTable32[y & 7][x & 7];
 	}
 
-	static uint32 PixelAddressOrg16(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg16(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber16(x, y, bp, bw) << 7) + columnTable16[y & 7][x & 15];
 	}
 
-	static uint32 PixelAddressOrg16S(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg16S(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber16S(x, y, bp, bw) << 7) + columnTable16[y & 7][x & 15];
 	}
 
-	static uint32 PixelAddressOrg8(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg8(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber8(x, y, bp, bw) << 8) + columnTable8[y & 15][x & 15];
 	}
 
-	static uint32 PixelAddressOrg4(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg4(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber4(x, y, bp, bw) << 9) + columnTable4[y & 15][x & 31];
 	}
 
-	static uint32 PixelAddressOrg32Z(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg32Z(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber32Z(x, y, bp, bw) << 6) + columnTable32[y & 7][x & 7];
 	}
 
-	static uint32 PixelAddressOrg16Z(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg16Z(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber16Z(x, y, bp, bw) << 7) + columnTable16[y & 7][x & 15];
 	}
 
-	static uint32 PixelAddressOrg16SZ(int x, int y, uint32 bp, uint32 bw)
+	constexpr static uint32 PixelAddressOrg16SZ(int x, int y, uint32 bp, uint32 bw)
 	{
 		return (BlockNumber16SZ(x, y, bp, bw) << 7) + columnTable16[y & 7][x & 15];
 	}
@@ -852,6 +865,9 @@ public:
 	template <int psm, int bsx, int bsy, int alignment>
 	void WriteImageBlock(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
+	template <int psm, int bsx, int bsy, int alignment>
+	void WriteImageBlockBands(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
+
 	template <int psm, int bsx, int bsy>
 	void WriteImageLeftRight(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
@@ -885,6 +901,7 @@ public:
 	void ReadTexture4HH(const GSOffset* RESTRICT off, const GSVector4i& r, uint8* dst, int dstpitch, const GIFRegTEXA& TEXA);
 
 	void ReadTexture(const GSOffset* RESTRICT off, const GSVector4i& r, uint8* dst, int dstpitch, const GIFRegTEXA& TEXA);
+	void ReadTextureBands(readTexture rtx, const GSOffset* RESTRICT off, const GSVector4i& r, uint8* dst, int dstpitch, const GIFRegTEXA& TEXA);
 
 	void ReadTextureBlock32(uint32 bp, uint8* dst, int dstpitch, const GIFRegTEXA& TEXA) const;
 	void ReadTextureBlock24(uint32 bp, uint8* dst, int dstpitch, const GIFRegTEXA& TEXA) const;
@@ -16,6 +16,11 @@
 #include "PrecompiledHeader.h"
 #include "GSLzma.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 GSDumpFile::GSDumpFile(char* filename, const char* repack_filename)
 {
 	m_fp = fopen(filename, "rb");
@@ -195,3 +200,94 @@ bool GSDumpRaw::Read(void* ptr, size_t size)
 
 	return false;
 }
+
+/******************************************************************/
+
+#if defined(__unix__) || defined(__APPLE__)
+
+GSDumpMmap::GSDumpMmap(char* filename, const char* repack_filename)
+	: GSDumpFile(filename, repack_filename)
+{
+	struct stat st;
+	if (fstat(fileno(m_fp), &st) < 0)
+	{
+		fprintf(stderr, "GSDumpMmap: failed to stat %s\n", filename);
+		throw "BAD"; // Just exit the program
+	}
+
+	m_size = st.st_size;
+	m_map = (uint8_t*)mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileno(m_fp), 0);
+	if (m_map == MAP_FAILED)
+	{
+		fprintf(stderr, "GSDumpMmap: failed to map %s: %s\n", filename, strerror(errno));
+		throw "BAD"; // Just exit the program
+	}
+
+	if (m_size < 16 || memcmp(m_map, "GSv2", 4) || memcmp(m_map + m_size - 4, "GSv2", 4))
+	{
+		fprintf(stderr, "GSDumpMmap: %s is not a v2 dump\n", filename);
+		throw "BAD"; // Just exit the program
+	}
+
+	uint32_t count;
+	memcpy(&count, m_map + m_size - 8, 4);
+
+	if (count < 2 || m_size < 16 + sizeof(uint64_t) * count)
+	{
+		fprintf(stderr, "GSDumpMmap: %s has a corrupted index\n", filename);
+		throw "BAD"; // Just exit the program
+	}
+
+	m_index = (const uint64_t*)(m_map + m_size - 8 - sizeof(uint64_t) * count);
+	m_frames = count - 1; // the end entry points at the index itself
+	m_packets_end = (size_t)m_index[count - 1];
+	m_pos = 4; // skip the magic, the v1 compatible header follows
+}
+
+GSDumpMmap::~GSDumpMmap()
+{
+	munmap(m_map, m_size);
+}
+
+bool GSDumpMmap::IsEof()
+{
+	return m_pos >= m_packets_end;
+}
+
+bool GSDumpMmap::Read(void* ptr, size_t size)
+{
+	if (m_pos + size > m_packets_end)
+		return false;
+
+	memcpy(ptr, m_map + m_pos, size);
+	m_pos += size;
+
+	Repack(ptr, size);
+
+	return true;
+}
+
+const uint8_t* GSDumpMmap::Map(size_t size)
+{
+	if (m_pos + size > m_packets_end)
+		return nullptr;
+
+	const uint8_t* ptr = m_map + m_pos;
+	m_pos += size;
+
+	Repack((void*)ptr, size);
+
+	return ptr;
+}
+
+bool GSDumpMmap::SeekToFrame(uint32_t frame)
+{
+	if (frame >= m_frames)
+		return false;
+
+	m_pos = (size_t)m_index[frame];
+
+	return true;
+}
+
+#endif
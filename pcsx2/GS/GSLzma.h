@@ -28,6 +28,10 @@ public:
 	virtual bool IsEof() = 0;
 	virtual bool Read(void* ptr, size_t size) = 0;
 
+	// Returns the next 'size' bytes without copying when the backing store is
+	// memory mapped, NULL means the caller has to fall back to Read.
+	virtual const uint8_t* Map(size_t size) { return nullptr; }
+
 	GSDumpFile(char* filename, const char* repack_filename);
 	virtual ~GSDumpFile();
 };
@@ -69,3 +73,33 @@ public:
 	bool IsEof() final;
 	bool Read(void* ptr, size_t size) final;
 };
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// V2 (.gs2) dumps, the whole file is mapped read only and packets are handed
+// out as spans of the mapping, the trailing index allows seeking to a frame
+// without parsing the packets before it.
+class GSDumpMmap : public GSDumpFile
+{
+	uint8_t* m_map;
+	size_t m_size;
+
+	size_t m_pos;
+	size_t m_packets_end;
+
+	const uint64_t* m_index;
+	uint32_t m_frames;
+
+public:
+	GSDumpMmap(char* filename, const char* repack_filename);
+	virtual ~GSDumpMmap();
+
+	bool IsEof() final;
+	bool Read(void* ptr, size_t size) final;
+	const uint8_t* Map(size_t size) final;
+
+	uint32_t GetFrameCount() const { return m_frames; }
+	bool SeekToFrame(uint32_t frame);
+};
+
+#endif
@@ -39,6 +39,16 @@ public:
 		Fillrate,
 		Quad,
 		SyncPoint,
+		Path1Transfer, // quadwords received per gif path, Path3Transfer
+		Path2Transfer, // covers both the new and the legacy transfer entry
+		Path3Transfer,
+		SurfacePoolHit, // FetchSurface reused a pooled surface instead of asking the driver
+		SurfacePoolMiss,
+		SurfacePoolMem, // bytes parked in the surface pool
+		GPUDraw,   // GPU ms spent on draw batches, from device timer queries
+		GPUUpload, // GPU ms spent on texture cache uploads
+		GPUMerge,  // GPU ms spent on the merge/interlace/present chain
+		EELatency, // ms from EE-side vsync submission to present, fed by the MTGS
 		CounterLast,
 	};
 
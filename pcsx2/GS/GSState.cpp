@@ -29,6 +29,7 @@ GSState::GSState()
 	, m_path3hack(0)
 	, m_init_read_fifo_supported(false)
 	, m_gsc(NULL)
+	, m_crc_hacks_active(true) // conservative until SetupCrcHack computes the real value
 	, m_skip(0)
 	, m_skip_offset(0)
 	, m_q(1.0f)
@@ -219,6 +220,13 @@ void GSState::SetFrameSkip(int skip)
 
 		m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZF2] = &GSState::GIFPackedRegHandlerNOP;
 		m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = &GSState::GIFPackedRegHandlerNOP;
+		m_fpGIFPackedRegHandlersC[GIF_REG_XYZF2RUN] = &GSState::GIFPackedRegHandlerNOP;
+		m_fpGIFPackedRegHandlersC[GIF_REG_XYZ2RUN] = &GSState::GIFPackedRegHandlerNOP;
+
+		m_fpGIFRegHandlersC[GIF_REG_STQRGBAXYZF2] = &GSState::GIFRegHandlerNOP;
+		m_fpGIFRegHandlersC[GIF_REG_STQRGBAXYZ2] = &GSState::GIFRegHandlerNOP;
+		m_fpGIFRegHandlersC[GIF_REG_XYZF2RUN] = &GSState::GIFRegHandlerNOP;
+		m_fpGIFRegHandlersC[GIF_REG_XYZ2RUN] = &GSState::GIFRegHandlerNOP;
 	}
 	else
 	{
@@ -265,6 +273,8 @@ void GSState::Reset()
 	m_vertex.next = 0;
 	m_index.tail = 0;
 
+	m_vt.AccReset();
+
 	m_texflush = true;
 }
 
@@ -297,7 +307,13 @@ void GSState::ResetHandlers()
 	m_fpGIFRegHandlerXYZ[P][2] = &GSState::GIFRegHandlerXYZ2<P, 0, auto_flush>; \
 	m_fpGIFRegHandlerXYZ[P][3] = &GSState::GIFRegHandlerXYZ2<P, 1, auto_flush>; \
 	m_fpGIFPackedRegHandlerSTQRGBAXYZF2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZF2<P, auto_flush>; \
-	m_fpGIFPackedRegHandlerSTQRGBAXYZ2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZ2<P, auto_flush>;
+	m_fpGIFPackedRegHandlerSTQRGBAXYZ2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZ2<P, auto_flush>; \
+	m_fpGIFPackedRegHandlerXYZF2RUN[P] = &GSState::GIFPackedRegHandlerXYZF2<P, auto_flush>; \
+	m_fpGIFPackedRegHandlerXYZ2RUN[P] = &GSState::GIFPackedRegHandlerXYZ2<P, auto_flush>; \
+	m_fpGIFRegHandlerSTRGBAQXYZF2[P] = &GSState::GIFRegHandlerSTRGBAQXYZF2<P, auto_flush>; \
+	m_fpGIFRegHandlerSTRGBAQXYZ2[P] = &GSState::GIFRegHandlerSTRGBAQXYZ2<P, auto_flush>; \
+	m_fpGIFRegHandlerXYZF2RUN[P] = &GSState::GIFRegHandlerXYZF2<P, auto_flush>; \
+	m_fpGIFRegHandlerXYZ2RUN[P] = &GSState::GIFRegHandlerXYZ2<P, auto_flush>;
 
 	if (m_userhacks_auto_flush)
 	{
@@ -757,6 +773,54 @@ void GSState::GIFPackedRegHandlerSTQRGBAXYZ2(const GIFPackedReg* RESTRICT r, uin
 	m_q = r[-3].STQ.Q; // remember the last one, STQ outputs this to the temp Q each time
 }
 
+template <uint32 prim, bool auto_flush>
+void GSState::GIFPackedRegHandlerXYZF2(const GIFPackedReg* RESTRICT r, uint32 size)
+{
+	ASSERT(size > 0);
+
+	const GIFPackedReg* RESTRICT r_end = r + size;
+
+	// color/tex don't change within the run, so hoist the UV part out of the loop
+	const GSVector4i uv = GSVector4i::load((int)m_v.UV);
+
+	while (r < r_end)
+	{
+		GSVector4i xy = GSVector4i::loadl(&r->u64[0]);
+		GSVector4i zf = GSVector4i::loadl(&r->u64[1]);
+		xy = xy.upl16(xy.srl<4>()).upl32(uv);
+		zf = zf.srl32(4) & GSVector4i::x00ffffff().upl32(GSVector4i::x000000ff());
+
+		m_v.m[1] = xy.upl32(zf);
+
+		VertexKick<prim, auto_flush>(r->XYZF2.Skip());
+
+		r++;
+	}
+}
+
+template <uint32 prim, bool auto_flush>
+void GSState::GIFPackedRegHandlerXYZ2(const GIFPackedReg* RESTRICT r, uint32 size)
+{
+	ASSERT(size > 0);
+
+	const GIFPackedReg* RESTRICT r_end = r + size;
+
+	const GSVector4i uv = GSVector4i::loadl(&m_v.UV);
+
+	while (r < r_end)
+	{
+		GSVector4i xy = GSVector4i::loadl(&r->u64[0]);
+		GSVector4i z = GSVector4i::loadl(&r->u64[1]);
+		GSVector4i xyz = xy.upl16(xy.srl<4>()).upl32(z);
+
+		m_v.m[1] = xyz.upl64(uv);
+
+		VertexKick<prim, auto_flush>(r->XYZ2.Skip());
+
+		r++;
+	}
+}
+
 void GSState::GIFPackedRegHandlerNOP(const GIFPackedReg* RESTRICT r, uint32 size)
 {
 }
@@ -885,6 +949,108 @@ void GSState::GIFRegHandlerXYZ2(const GIFReg* RESTRICT r)
 	VertexKick<prim, auto_flush>(adc);
 }
 
+template <uint32 prim, bool auto_flush>
+void GSState::GIFRegHandlerSTRGBAQXYZF2(const GIFReg* RESTRICT r, uint32 size)
+{
+	ASSERT(size > 0 && size % 3 == 0);
+
+	const GIFReg* RESTRICT r_end = r + size;
+
+	while (r < r_end)
+	{
+		GSVector4i st = GSVector4i::loadl(&r[0].ST);
+
+		GSVector4i rgbaq = GSVector4i::loadl(&r[1].RGBAQ);
+
+		GSVector4i q = rgbaq.blend8(GSVector4i::cast(GSVector4::m_one), rgbaq == GSVector4i::zero()).yyyy(); // see GIFRegHandlerRGBAQ
+		q = GSVector4i::cast(GSVector4::cast(q).replace_nan(GSVector4::m_max));
+
+		m_v.m[0] = st.upl64(rgbaq.upl32(q)); // TODO: only store the last one
+
+		GSVector4i xyzf = GSVector4i::loadl(&r[2].XYZF);
+		GSVector4i xyz = xyzf & (GSVector4i::xffffffff().upl32(GSVector4i::x00ffffff()));
+		GSVector4i uvf = GSVector4i::load((int)m_v.UV).upl32(xyzf.srl32(24).srl<4>());
+
+		m_v.m[1] = xyz.upl64(uvf); // TODO: only store the last one
+
+		VertexKick<prim, auto_flush>(0);
+
+		r += 3;
+	}
+}
+
+template <uint32 prim, bool auto_flush>
+void GSState::GIFRegHandlerSTRGBAQXYZ2(const GIFReg* RESTRICT r, uint32 size)
+{
+	ASSERT(size > 0 && size % 3 == 0);
+
+	const GIFReg* RESTRICT r_end = r + size;
+
+	while (r < r_end)
+	{
+		GSVector4i st = GSVector4i::loadl(&r[0].ST);
+
+		GSVector4i rgbaq = GSVector4i::loadl(&r[1].RGBAQ);
+
+		GSVector4i q = rgbaq.blend8(GSVector4i::cast(GSVector4::m_one), rgbaq == GSVector4i::zero()).yyyy(); // see GIFRegHandlerRGBAQ
+		q = GSVector4i::cast(GSVector4::cast(q).replace_nan(GSVector4::m_max));
+
+		m_v.m[0] = st.upl64(rgbaq.upl32(q)); // TODO: only store the last one
+
+		m_v.m[1] = GSVector4i::load(&r[2].XYZ, &m_v.UV); // TODO: only store the last one
+
+		VertexKick<prim, auto_flush>(0);
+
+		r += 3;
+	}
+}
+
+template <uint32 prim, bool auto_flush>
+void GSState::GIFRegHandlerXYZF2(const GIFReg* RESTRICT r, uint32 size)
+{
+	ASSERT(size > 0);
+
+	const GIFReg* RESTRICT r_end = r + size;
+
+	// color/tex don't change within the run, so hoist the UV part out of the loop
+	const GSVector4i uv = GSVector4i::load((int)m_v.UV);
+
+	while (r < r_end)
+	{
+		GSVector4i xyzf = GSVector4i::loadl(&r->XYZF);
+		GSVector4i xyz = xyzf & (GSVector4i::xffffffff().upl32(GSVector4i::x00ffffff()));
+
+		m_v.m[1] = xyz.upl64(uv.upl32(xyzf.srl32(24).srl<4>()));
+
+		VertexKick<prim, auto_flush>(0);
+
+		r++;
+	}
+}
+
+template <uint32 prim, bool auto_flush>
+void GSState::GIFRegHandlerXYZ2(const GIFReg* RESTRICT r, uint32 size)
+{
+	ASSERT(size > 0);
+
+	const GIFReg* RESTRICT r_end = r + size;
+
+	const GSVector4i uv = GSVector4i::loadl(&m_v.UV);
+
+	while (r < r_end)
+	{
+		m_v.m[1] = GSVector4i::loadl(&r->XYZ).upl64(uv);
+
+		VertexKick<prim, auto_flush>(0);
+
+		r++;
+	}
+}
+
+void GSState::GIFRegHandlerNOP(const GIFReg* RESTRICT r, uint32 size)
+{
+}
+
 template <int i>
 void GSState::ApplyTEX0(GIFRegTEX0& TEX0)
 {
@@ -1466,7 +1632,16 @@ void GSState::GIFRegHandlerTRXREG(const GIFReg* RESTRICT r)
 void GSState::GIFRegHandlerTRXDIR(const GIFReg* RESTRICT r)
 {
 	GL_REG("TRXDIR = 0x%x_%x", r->u32[1], r->u32[0]);
-	Flush();
+
+	FlushWrite();
+
+	// 2D heavy games interleave lots of small uploads with draws that share
+	// the exact same context. As long as the upload doesn't touch anything
+	// the queued prims read or write it can go ahead of them, merging all
+	// those draws into a single batch.
+
+	if (r->TRXDIR.XDIR != 0 || TransferOverlapsDraw())
+		FlushPrim();
 
 	m_env.TRXDIR = (GSVector4i)r->TRXDIR;
 
@@ -1532,6 +1707,63 @@ void GSState::Flush()
 	FlushPrim();
 }
 
+bool GSState::TransferOverlapsDraw() const
+{
+	// Conservative block range test for host -> local transfers, the scissor
+	// is the only extent known for the queued prims before they are flushed.
+
+	if (m_index.tail == 0)
+		return false;
+
+	const int w = m_env.TRXREG.RRW;
+	const int h = m_env.TRXREG.RRH;
+
+	if (w <= 0 || h <= 0)
+		return false;
+
+	const uint32 start = m_env.BITBLTBUF.DBP;
+	const uint32 end = GSLocalMemory::m_psm[m_env.BITBLTBUF.DPSM].bn(
+		m_env.TRXPOS.DSAX + w - 1, m_env.TRXPOS.DSAY + h - 1, start, m_env.BITBLTBUF.DBW);
+
+	const int sx = (int)m_context->SCISSOR.SCAX1;
+	const int sy = (int)m_context->SCISSOR.SCAY1;
+
+	const uint32 fb_start = m_context->FRAME.Block();
+	const uint32 fb_end = GSLocalMemory::m_psm[m_context->FRAME.PSM].bn(sx, sy, fb_start, m_context->FRAME.FBW);
+
+	const uint32 zb_start = m_context->ZBUF.Block();
+	const uint32 zb_end = GSLocalMemory::m_psm[m_context->ZBUF.PSM].bn(sx, sy, zb_start, m_context->FRAME.FBW);
+
+	// Block numbers wrap at MAX_BLOCKS on the real hardware, don't bother
+
+	if (end >= MAX_BLOCKS || fb_end >= MAX_BLOCKS || zb_end >= MAX_BLOCKS)
+		return true;
+
+	if (start <= fb_end && fb_start <= end)
+		return true;
+
+	if (start <= zb_end && zb_start <= end)
+		return true;
+
+	if (PRIM->TME)
+	{
+		if (m_context->TEX1.MXL > 0) // not worth chasing the mipmap levels
+			return true;
+
+		const uint32 tex_start = m_context->TEX0.TBP0;
+		const uint32 tex_end = GSLocalMemory::m_psm[m_context->TEX0.PSM].bn(
+			(1 << m_context->TEX0.TW) - 1, (1 << m_context->TEX0.TH) - 1, tex_start, m_context->TEX0.TBW);
+
+		// No need to check the CLUT, it was converted when TEX0 was written
+		// so uploading over it cannot change what the queued prims sample
+
+		if (tex_end >= MAX_BLOCKS || (start <= tex_end && tex_start <= end))
+			return true;
+	}
+
+	return false;
+}
+
 void GSState::FlushWrite()
 {
 	int len = m_tr.end - m_tr.start;
@@ -1683,6 +1915,8 @@ void GSState::FlushPrim()
 
 		m_vertex.head = 0;
 
+		m_vt.AccReset();
+
 		if (unused > 0)
 		{
 			memcpy(m_vertex.buff, buff, sizeof(GSVertex) * unused);
@@ -2247,6 +2481,22 @@ void GSState::Transfer(const uint8* mem, uint32 size)
 
 								break;
 
+							case GIFPath::TYPE_XYZF2: // position-only runs (particle bursts)
+
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_XYZF2RUN])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+
+							case GIFPath::TYPE_XYZ2:
+
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_XYZ2RUN])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+
 							default:
 
 								__assume(0);
@@ -2269,17 +2519,62 @@ void GSState::Transfer(const uint8* mem, uint32 size)
 
 				case GIF_FLG_REGLIST:
 
-					// TODO: do it similar to packed operation
-
 					size *= 2;
 
-					do
+					total = path.nloop * path.nreg;
+
+					// same idea as the packed fast paths: dispatch whole runs of the
+					// common layouts with one call instead of one call per register
+
+					if (path.type != GIFPath::TYPE_UNKNOWN && path.reg == 0 && size >= total)
 					{
-						(this->*m_fpGIFRegHandlers[path.GetReg() & 0x7F])((GIFReg*)mem);
+						size -= total;
 
-						mem += sizeof(GIFReg);
-						size--;
-					} while (path.StepReg() && size > 0);
+						switch (path.type)
+						{
+							case GIFPath::TYPE_STQRGBAXYZF2: // here this means ST/RGBAQ/XYZF2
+
+								(this->*m_fpGIFRegHandlersC[GIF_REG_STQRGBAXYZF2])((GIFReg*)mem, total);
+
+								break;
+
+							case GIFPath::TYPE_STQRGBAXYZ2:
+
+								(this->*m_fpGIFRegHandlersC[GIF_REG_STQRGBAXYZ2])((GIFReg*)mem, total);
+
+								break;
+
+							case GIFPath::TYPE_XYZF2:
+
+								(this->*m_fpGIFRegHandlersC[GIF_REG_XYZF2RUN])((GIFReg*)mem, total);
+
+								break;
+
+							case GIFPath::TYPE_XYZ2:
+
+								(this->*m_fpGIFRegHandlersC[GIF_REG_XYZ2RUN])((GIFReg*)mem, total);
+
+								break;
+
+							default:
+
+								__assume(0);
+						}
+
+						mem += total * sizeof(GIFReg);
+
+						path.nloop = 0;
+					}
+					else
+					{
+						do
+						{
+							(this->*m_fpGIFRegHandlers[path.GetReg() & 0x7F])((GIFReg*)mem);
+
+							mem += sizeof(GIFReg);
+							size--;
+						} while (path.StepReg() && size > 0);
+					}
 
 					if (size & 1)
 						mem += sizeof(GIFReg);
@@ -2351,6 +2646,11 @@ void GSState::Transfer(const uint8* mem, uint32 size)
 		m_dump->Transfer(index, start, mem - start);
 	}
 
+	if (mem > start)
+	{
+		m_perfmon.Put((GSPerfMon::counter_t)(GSPerfMon::Path1Transfer + (index < 2 ? index : 2)), (mem - start) / 16);
+	}
+
 	if (index == 0)
 	{
 		if (size == 0 && path.nloop > 0)
@@ -2643,6 +2943,13 @@ void GSState::UpdateVertexKick()
 
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZF2] = m_fpGIFPackedRegHandlerSTQRGBAXYZF2[prim];
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = m_fpGIFPackedRegHandlerSTQRGBAXYZ2[prim];
+	m_fpGIFPackedRegHandlersC[GIF_REG_XYZF2RUN] = m_fpGIFPackedRegHandlerXYZF2RUN[prim];
+	m_fpGIFPackedRegHandlersC[GIF_REG_XYZ2RUN] = m_fpGIFPackedRegHandlerXYZ2RUN[prim];
+
+	m_fpGIFRegHandlersC[GIF_REG_STQRGBAXYZF2] = m_fpGIFRegHandlerSTRGBAQXYZF2[prim];
+	m_fpGIFRegHandlersC[GIF_REG_STQRGBAXYZ2] = m_fpGIFRegHandlerSTRGBAQXYZ2[prim];
+	m_fpGIFRegHandlersC[GIF_REG_XYZF2RUN] = m_fpGIFRegHandlerXYZF2RUN[prim];
+	m_fpGIFRegHandlersC[GIF_REG_XYZ2RUN] = m_fpGIFRegHandlerXYZ2RUN[prim];
 }
 
 void GSState::GrowVertexBuffer()
@@ -2925,6 +3232,13 @@ __forceinline void GSState::VertexKick(uint32 skip)
 			__assume(0);
 	}
 
+	// fold the accepted prim into the vertex trace ranges so Update can skip
+	// rescanning the batch, stq draws need the per prim q divide and keep the
+	// scan path anyway (the count mismatch makes Update fall back)
+
+	if (!PRIM->TME || PRIM->FST)
+		m_vt.Accumulate<prim>(m_vertex.buff, buff);
+
 	if (auto_flush && PRIM->TME && (m_context->FRAME.Block() == m_context->TEX0.TBP0))
 		FlushPrim();
 }
@@ -42,6 +42,38 @@ struct GSFrameInfo
 
 typedef bool (*GetSkipCount)(const GSFrameInfo& fi, int& skip);
 
+// One compiled entry of the data-driven CRC hack engine (see GSHwHack.cpp).  Each
+// field matcher is an exact comparison enabled by its care flag; omitted fields are
+// wildcards.  Rules come from the crc_hack_rules file, so a new game fix is a text
+// edit rather than a rebuild.
+struct GSCrcHackRule
+{
+	uint32 crc;          // game CRC the rule belongs to
+	bool while_skipping; // evaluated only while a previous rule's skip is active
+
+	bool care_tme;   bool tme;
+	bool care_fbp;   uint32 fbp;
+	bool care_fpsm;  uint32 fpsm;
+	bool care_fbmsk; uint32 fbmsk;
+	bool care_tbp0;  uint32 tbp0;
+	bool care_tpsm;  uint32 tpsm;
+	bool care_tztst; uint32 tztst;
+
+	int skip; // new skip counter when the rule matches
+
+	bool Matches(const GSFrameInfo& fi) const
+	{
+		if (care_tme && fi.TME != tme)     return false;
+		if (care_fbp && fi.FBP != fbp)     return false;
+		if (care_fpsm && fi.FPSM != fpsm)  return false;
+		if (care_fbmsk && fi.FBMSK != fbmsk) return false;
+		if (care_tbp0 && fi.TBP0 != tbp0)  return false;
+		if (care_tpsm && fi.TPSM != tpsm)  return false;
+		if (care_tztst && fi.TZTST != tztst) return false;
+		return true;
+	}
+};
+
 class GSState : public GSAlignedClass<32>
 {
 	// RESTRICT prevents multiple loads of the same part of the register when accessing its bitfields (the compiler is happy to know that memory writes in-between will not go there)
@@ -69,12 +101,16 @@ class GSState : public GSAlignedClass<32>
 
 	typedef void (GSState::*GIFPackedRegHandlerC)(const GIFPackedReg* RESTRICT r, uint32 size);
 
-	GIFPackedRegHandlerC m_fpGIFPackedRegHandlersC[2];
+	GIFPackedRegHandlerC m_fpGIFPackedRegHandlersC[4];
 	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerSTQRGBAXYZF2[8];
 	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerSTQRGBAXYZ2[8];
+	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerXYZF2RUN[8];
+	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerXYZ2RUN[8];
 
 	template<uint32 prim, bool auto_flush> void GIFPackedRegHandlerSTQRGBAXYZF2(const GIFPackedReg* RESTRICT r, uint32 size);
 	template<uint32 prim, bool auto_flush> void GIFPackedRegHandlerSTQRGBAXYZ2(const GIFPackedReg* RESTRICT r, uint32 size);
+	template<uint32 prim, bool auto_flush> void GIFPackedRegHandlerXYZF2(const GIFPackedReg* RESTRICT r, uint32 size);
+	template<uint32 prim, bool auto_flush> void GIFPackedRegHandlerXYZ2(const GIFPackedReg* RESTRICT r, uint32 size);
 	void GIFPackedRegHandlerNOP(const GIFPackedReg* RESTRICT r, uint32 size);
 
 	template<int i> void ApplyTEX0(GIFRegTEX0& TEX0);
@@ -123,6 +159,20 @@ class GSState : public GSAlignedClass<32>
 	void GIFRegHandlerFINISH(const GIFReg* RESTRICT r);
 	void GIFRegHandlerLABEL(const GIFReg* RESTRICT r);
 
+	typedef void (GSState::*GIFRegHandlerC)(const GIFReg* RESTRICT r, uint32 size);
+
+	GIFRegHandlerC m_fpGIFRegHandlersC[4];
+	GIFRegHandlerC m_fpGIFRegHandlerSTRGBAQXYZF2[8];
+	GIFRegHandlerC m_fpGIFRegHandlerSTRGBAQXYZ2[8];
+	GIFRegHandlerC m_fpGIFRegHandlerXYZF2RUN[8];
+	GIFRegHandlerC m_fpGIFRegHandlerXYZ2RUN[8];
+
+	template<uint32 prim, bool auto_flush> void GIFRegHandlerSTRGBAQXYZF2(const GIFReg* RESTRICT r, uint32 size);
+	template<uint32 prim, bool auto_flush> void GIFRegHandlerSTRGBAQXYZ2(const GIFReg* RESTRICT r, uint32 size);
+	template<uint32 prim, bool auto_flush> void GIFRegHandlerXYZF2(const GIFReg* RESTRICT r, uint32 size);
+	template<uint32 prim, bool auto_flush> void GIFRegHandlerXYZ2(const GIFReg* RESTRICT r, uint32 size);
+	void GIFRegHandlerNOP(const GIFReg* RESTRICT r, uint32 size);
+
 	int m_version;
 	int m_sssize;
 
@@ -155,6 +205,15 @@ protected:
 	bool m_isPackedUV_HackFlag;
 	CRCHackLevel m_crc_hack_level;
 	GetSkipCount m_gsc;
+
+	// Flat decision list compiled for the current game; when non-empty it replaces
+	// the built-in m_gsc hook for this title.
+	std::vector<GSCrcHackRule> m_gsc_rules;
+
+	// Single fast-path predicate for IsBadFrame: false for the vast majority of
+	// titles that have no hack bound and no manual skipdraw configured.
+	bool m_crc_hacks_active;
+
 	int m_skip;
 	int m_skip_offset;
 	int m_userhacks_skipdraw;
@@ -251,6 +310,7 @@ public:
 	void Flush();
 	void FlushPrim();
 	void FlushWrite();
+	bool TransferOverlapsDraw() const;
 	virtual void Draw() = 0;
 	virtual void PurgePool() = 0;
 	virtual void InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r) {}
@@ -266,7 +326,7 @@ public:
 	void ReadFIFO(uint8* mem, int size);
 	template<int index> void Transfer(const uint8* mem, uint32 size);
 	int Freeze(freezeData* fd, bool sizeonly);
-	int Defrost(const freezeData* fd);
+	virtual int Defrost(const freezeData* fd);
 	void GetLastTag(uint32* tag)
 	{
 		*tag = m_path3hack;
@@ -17,6 +17,11 @@
 
 #include "GS.h"
 #include "common/boost_spsc_queue.hpp"
+#include "common/Threading.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
 
 template <class T, int CAPACITY>
 class GSJobQueue final
@@ -24,6 +29,7 @@ class GSJobQueue final
 private:
 	std::thread m_thread;
 	std::function<void(T&)> m_func;
+	int m_affinity;
 	bool m_exit;
 	ringbuffer_base<T, CAPACITY> m_queue;
 
@@ -34,6 +40,31 @@ private:
 
 	void ThreadProc()
 	{
+		if (m_affinity >= 0)
+		{
+			// pin the thread so it cannot migrate to another node, whatever
+			// scratch memory it touches first gets faulted in locally and
+			// stays that way
+
+#ifdef _WIN32
+			if (m_affinity < 64)
+				SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << m_affinity);
+#elif defined(__linux__)
+			cpu_set_t set;
+
+			CPU_ZERO(&set);
+			CPU_SET(m_affinity, &set);
+
+			pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+		}
+		else
+		{
+			// No explicit pin requested; still keep rasterizer workers on
+			// performance cores when the host is hybrid.
+			Threading::SetRoleAffinity(Threading::ThreadRole_Compute);
+		}
+
 		std::unique_lock<std::mutex> l(m_lock);
 
 		while (true)
@@ -62,8 +93,9 @@ private:
 	}
 
 public:
-	GSJobQueue(std::function<void(T&)> func)
+	GSJobQueue(std::function<void(T&)> func, int affinity = -1)
 		: m_func(func)
+		, m_affinity(affinity)
 		, m_exit(false)
 	{
 		m_thread = std::thread(&GSJobQueue::ThreadProc, this);
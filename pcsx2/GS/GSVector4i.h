@@ -410,6 +410,68 @@ public:
 		return store(load(a).min_i16(load(b)));
 	}
 
+	__forceinline GSVector4i hadd32(const GSVector4i& a) const
+	{
+		return GSVector4i(_mm_hadd_epi32(m, a));
+	}
+
+	__forceinline GSVector4i hadd32() const
+	{
+		return GSVector4i(_mm_hadd_epi32(m, m));
+	}
+
+	// Full horizontal reductions over the four 32-bit lanes. The result is
+	// splatted to every lane so it can keep feeding vector code; use
+	// extract32<0>() when the scalar is needed.
+
+	__forceinline GSVector4i hsum32() const
+	{
+		return hadd32().hadd32();
+	}
+
+	__forceinline GSVector4i hmin_i32() const
+	{
+		GSVector4i v = min_i32(zwzw());
+
+		return v.min_i32(v.yxwz()).xxxx();
+	}
+
+	__forceinline GSVector4i hmax_i32() const
+	{
+		GSVector4i v = max_i32(zwzw());
+
+		return v.max_i32(v.yxwz()).xxxx();
+	}
+
+	__forceinline GSVector4i hmin_u32() const
+	{
+		GSVector4i v = min_u32(zwzw());
+
+		return v.min_u32(v.yxwz()).xxxx();
+	}
+
+	__forceinline GSVector4i hmax_u32() const
+	{
+		GSVector4i v = max_u32(zwzw());
+
+		return v.max_u32(v.yxwz()).xxxx();
+	}
+
+	// Store only the 32-bit lanes whose mask lane is set (lanes must be all
+	// ones or all zeros), leaving the rest of the memory untouched. Below
+	// AVX2 this is a read/blend/write sequence, which rewrites the unselected
+	// lanes with their old value - don't use it on memory another thread may
+	// be writing concurrently.
+
+	__forceinline void maskstore32(void* p, const GSVector4i& mask) const
+	{
+#if _M_SSE >= 0x501
+		_mm_maskstore_epi32((int*)p, mask, m);
+#else
+		store<false>(p, load<false>(p).blend(*this, mask));
+#endif
+	}
+
 	__forceinline GSVector4i clamp8() const
 	{
 		return pu16().upl8();
@@ -300,6 +300,53 @@ public:
 		return GSVector8i(_mm256_max_epu32(m, a));
 	}
 
+	__forceinline GSVector8i hadd32(const GSVector8i& a) const
+	{
+		return GSVector8i(_mm256_hadd_epi32(m, a));
+	}
+
+	__forceinline GSVector8i hadd32() const
+	{
+		return GSVector8i(_mm256_hadd_epi32(m, m));
+	}
+
+	// Full horizontal reductions over the eight 32-bit lanes, splatted to
+	// every lane. vphaddd/vpminsd only work within each 128-bit half, so the
+	// halves are folded together first.
+
+	__forceinline GSVector8i hsum32() const
+	{
+		return broadcast32((extract<0>() + extract<1>()).hsum32());
+	}
+
+	__forceinline GSVector8i hmin_i32() const
+	{
+		return broadcast32(extract<0>().min_i32(extract<1>()).hmin_i32());
+	}
+
+	__forceinline GSVector8i hmax_i32() const
+	{
+		return broadcast32(extract<0>().max_i32(extract<1>()).hmax_i32());
+	}
+
+	__forceinline GSVector8i hmin_u32() const
+	{
+		return broadcast32(extract<0>().min_u32(extract<1>()).hmin_u32());
+	}
+
+	__forceinline GSVector8i hmax_u32() const
+	{
+		return broadcast32(extract<0>().max_u32(extract<1>()).hmax_u32());
+	}
+
+	// Store only the 32-bit lanes whose mask lane is set (lanes must be all
+	// ones or all zeros), leaving the rest of the memory untouched.
+
+	__forceinline void maskstore32(void* p, const GSVector8i& mask) const
+	{
+		_mm256_maskstore_epi32((int*)p, mask, m);
+	}
+
 	__forceinline GSVector8i clamp8() const
 	{
 		return pu16().upl8();
@@ -1070,6 +1117,28 @@ public:
 		return GSVector8i(_mm256_i32gather_epi32((const int*)ptr, m, 4));
 	}
 
+	template <class T>
+	__forceinline GSVector8i gather64_32(const T* ptr) const
+	{
+		GSVector4i v0;
+		GSVector4i v1;
+
+		GSVector4i a0 = extract<0>();
+
+		v0 = GSVector4i::loadl(&ptr[a0.extract32<0>()]);
+		v0 = v0.insert64<1>((int64)ptr[a0.extract32<1>()]);
+
+		v1 = GSVector4i::loadl(&ptr[a0.extract32<2>()]);
+		v1 = v1.insert64<1>((int64)ptr[a0.extract32<3>()]);
+
+		return cast(v0).insert<1>(v1);
+	}
+
+	__forceinline GSVector8i gather64_32(const uint64* ptr) const
+	{
+		return GSVector8i(_mm256_i32gather_epi64((const long long*)ptr, _mm256_castsi256_si128(m), 8));
+	}
+
 	template <class T1, class T2>
 	__forceinline GSVector8i gather32_32(const T1* ptr1, const T2* ptr2) const
 	{
@@ -16,9 +16,14 @@
 #include "PrecompiledHeader.h"
 #include "GS/GS.h"
 #include "GSDevice.h"
+#include "common/MemoryAccount.h"
 
 GSDevice::GSDevice()
-	: m_wnd()
+	: m_pool_size(0)
+	, m_pool_mem(0)
+	, m_pool_hits(0)
+	, m_pool_misses(0)
+	, m_wnd()
 	, m_vsync(false)
 	, m_rbswapped(false)
 	, m_backbuffer(NULL)
@@ -26,24 +31,34 @@ GSDevice::GSDevice()
 	, m_weavebob(NULL)
 	, m_blend(NULL)
 	, m_target_tmp(NULL)
+	, m_target_tmp2(NULL)
 	, m_current(NULL)
 	, m_frame(0)
+	, m_current_luma(false)
 {
 	memset(&m_vertex, 0, sizeof(m_vertex));
 	memset(&m_index, 0, sizeof(m_index));
 	m_linear_present = theApp.GetConfigB("linear_present");
+	// Compile shadeboost with the luma-in-alpha tail when FXAA may follow it,
+	// FXAA then runs without its transparency filter prepass.
+	m_sb_luma = theApp.GetConfigB("fxaa");
+	m_pool_budget = (size_t)theApp.GetConfigI("texture_pool_budget_mb") * _1mb;
 }
 
 GSDevice::~GSDevice()
 {
-	for (auto t : m_pool)
-		delete t;
+	SavePoolProfile();
+
+	for (auto& pool : m_pool)
+		for (auto t : pool)
+			delete t;
 
 	delete m_backbuffer;
 	delete m_merge;
 	delete m_weavebob;
 	delete m_blend;
 	delete m_target_tmp;
+	delete m_target_tmp2;
 }
 
 bool GSDevice::Create(const std::shared_ptr<GSWnd>& wnd)
@@ -55,22 +70,30 @@ bool GSDevice::Create(const std::shared_ptr<GSWnd>& wnd)
 
 bool GSDevice::Reset(int w, int h)
 {
-	for (auto t : m_pool)
-		delete t;
+	for (auto& pool : m_pool)
+	{
+		for (auto t : pool)
+			delete t;
+
+		pool.clear();
+	}
 
-	m_pool.clear();
+	m_pool_size = 0;
+	m_pool_mem = 0;
 
 	delete m_backbuffer;
 	delete m_merge;
 	delete m_weavebob;
 	delete m_blend;
 	delete m_target_tmp;
+	delete m_target_tmp2;
 
 	m_backbuffer = NULL;
 	m_merge = NULL;
 	m_weavebob = NULL;
 	m_blend = NULL;
 	m_target_tmp = NULL;
+	m_target_tmp2 = NULL;
 
 	m_current = NULL; // current is special, points to other textures, no need to delete
 
@@ -94,6 +117,8 @@ void GSDevice::Present(const GSVector4i& r, int shader)
 
 	GL_PUSH("Present");
 
+	BeginGPUTimer(GPUTimer_Merge);
+
 	// FIXME is it mandatory, it could be slow
 	ClearRenderTarget(m_backbuffer, 0);
 
@@ -107,6 +132,10 @@ void GSDevice::Present(const GSVector4i& r, int shader)
 		RenderOsd(m_backbuffer);
 	}
 
+	// the timer stops before the flip, the swap would charge the vsync wait
+	// to the GPU
+	EndGPUTimer(GPUTimer_Merge);
+
 	Flip();
 }
 
@@ -115,35 +144,59 @@ void GSDevice::Present(GSTexture* sTex, GSTexture* dTex, const GSVector4& dRect,
 	StretchRect(sTex, dTex, dRect, shader, m_linear_present);
 }
 
+// Surfaces only ever match within their size class, searching the other
+// buckets would be a waste of time.
+size_t GSDevice::PoolBucket(int w, int h)
+{
+	size_t bucket = 0;
+
+	for (int s = std::max(w, h) >> 1; s > 0; s >>= 1)
+		bucket++;
+
+	return std::min<size_t>(bucket, 15);
+}
+
+uint64 GSDevice::PoolShapeKey(int type, int w, int h, int format)
+{
+	return ((uint64)(type & 0xffff) << 48) | ((uint64)(format & 0xffff) << 32) | ((uint64)(w & 0xffff) << 16) | (uint64)(h & 0xffff);
+}
+
 GSTexture* GSDevice::FetchSurface(int type, int w, int h, int format)
 {
 	const GSVector2i size(w, h);
 
-	for (auto i = m_pool.begin(); i != m_pool.end(); ++i)
+	FastList<GSTexture*>& pool = m_pool[PoolBucket(w, h)];
+
+	for (auto i = pool.begin(); i != pool.end(); ++i)
 	{
 		GSTexture* t = *i;
 
 		if (t->GetType() == type && t->GetFormat() == format && t->GetSize() == size)
 		{
-			m_pool.erase(i);
+			pool.erase(i);
+
+			m_pool_size--;
+			m_pool_mem -= t->GetMemUsage();
+			m_pool_hits++;
 
 			return t;
 		}
 	}
 
+	m_pool_misses++;
+
+	// Remember the shape for the warm file of the next session. The cap only
+	// guards against degenerate cases, a game uses a few dozen shapes at most.
+	if (m_pool_profile.size() < 256)
+		m_pool_profile[PoolShapeKey(type, w, h, format)]++;
+
 	return CreateSurface(type, w, h, format);
 }
 
 void GSDevice::PrintMemoryUsage()
 {
 #ifdef ENABLE_OGL_DEBUG
-	uint32 pool = 0;
-	for (auto t : m_pool)
-	{
-		if (t)
-			pool += t->GetMemUsage();
-	}
-	GL_PERF("MEM: Surface Pool %dMB", pool >> 20u);
+	GL_PERF("MEM: Surface Pool %dMB", (uint32)(m_pool_mem >> 20u));
 #endif
 }
 
@@ -167,40 +220,162 @@ void GSDevice::Recycle(GSTexture* t)
 #endif
 		t->last_frame_used = m_frame;
 
-		m_pool.push_front(t);
+		m_pool[PoolBucket(t->GetWidth(), t->GetHeight())].push_front(t);
 
-		//printf("%d\n",m_pool.size());
+		m_pool_size++;
+		m_pool_mem += t->GetMemUsage();
 
-		while (m_pool.size() > 300)
-		{
-			delete m_pool.back();
+		//printf("%zd\n", m_pool_size);
 
-			m_pool.pop_back();
+		while (m_pool_size > 300 || (m_pool_budget && m_pool_mem > m_pool_budget && m_pool_size > 0))
+		{
+			EvictSurface(*LRUPool());
 		}
 	}
 }
 
+// The bucket holding the least recently used surface, i.e. the best victim
+// for eviction. NULL when the whole pool is empty.
+FastList<GSTexture*>* GSDevice::LRUPool()
+{
+	FastList<GSTexture*>* lru = NULL;
+
+	for (auto& pool : m_pool)
+	{
+		if (!pool.empty() && (lru == NULL || pool.back()->last_frame_used < lru->back()->last_frame_used))
+			lru = &pool;
+	}
+
+	return lru;
+}
+
+void GSDevice::EvictSurface(FastList<GSTexture*>& pool)
+{
+	GSTexture* t = pool.back();
+
+	m_pool_size--;
+	m_pool_mem -= t->GetMemUsage();
+
+	delete t;
+
+	pool.pop_back();
+}
+
 void GSDevice::AgePool()
 {
 	m_frame++;
 
-	while (m_pool.size() > 40 && m_frame - m_pool.back()->last_frame_used > 10)
+	while (m_pool_size > 40)
+	{
+		FastList<GSTexture*>* pool = LRUPool();
+
+		if (m_frame - pool->back()->last_frame_used <= 10)
+			break;
+
+		EvictSurface(*pool);
+	}
+
+	MemAccount::Set(MemAccount::Id_GSPool, m_pool_mem);
+}
+
+// File format: one "type format width height count" line per surface shape,
+// as written by SavePoolProfile. Lines starting with # are comments.
+void GSDevice::SetWarmFile(const std::string& path)
+{
+	m_warm_file = path;
+
+	FILE* f = px_fopen(path, "r");
+
+	if (f == NULL)
+		return; // first boot of this game, the profile gets written on teardown
+
+	char line[256];
+	int warmed = 0;
+
+	while (fgets(line, sizeof(line), f))
 	{
-		delete m_pool.back();
+		int type, format, w, h;
+		uint32 count;
 
-		m_pool.pop_back();
+		if (line[0] == '#' || sscanf(line, "%d %d %d %d %u", &type, &format, &w, &h, &count) != 5)
+			continue;
+
+		if (w <= 0 || h <= 0 || w > 16384 || h > 16384)
+			continue;
+
+		// Carry the shape over to the profile of this session, warmed shapes
+		// never miss so they wouldn't be recorded again otherwise.
+		m_pool_profile[PoolShapeKey(type, w, h, format)] = count;
+
+		for (uint32 i = 0; i < std::min<uint32>(count, 4); i++)
+		{
+			if (GSTexture* t = CreateSurface(type, w, h, format))
+			{
+				// last_frame_used stays at frame 0, so AgePool quickly evicts
+				// whatever the game doesn't claim in the first frames.
+				Recycle(t);
+
+				warmed++;
+			}
+		}
+	}
+
+	fclose(f);
+
+	if (warmed > 0)
+		printf("GS: pre-allocated %d pool surfaces from %s\n", warmed, path.c_str());
+}
+
+void GSDevice::SavePoolProfile()
+{
+	if (m_warm_file.empty() || m_pool_profile.empty())
+		return;
+
+	FILE* f = px_fopen(m_warm_file, "w");
+
+	if (f == NULL)
+		return;
+
+	fprintf(f, "# GS surface pool profile: type format width height count\n");
+
+	for (const auto& shape : m_pool_profile)
+	{
+		const uint64 key = shape.first;
+
+		fprintf(f, "%d %d %d %d %u\n",
+			(int)(key >> 48), (int)((key >> 32) & 0xffff),
+			(int)((key >> 16) & 0xffff), (int)(key & 0xffff),
+			std::min<uint32>(shape.second, 4));
 	}
+
+	fclose(f);
 }
 
 void GSDevice::PurgePool()
 {
 	// OOM emergency. Let's free this useless pool
-	while (!m_pool.empty())
+	for (auto& pool : m_pool)
 	{
-		delete m_pool.back();
+		while (!pool.empty())
+		{
+			delete pool.back();
 
-		m_pool.pop_back();
+			pool.pop_back();
+		}
 	}
+
+	m_pool_size = 0;
+	m_pool_mem = 0;
+}
+
+void GSDevice::GetPoolStats(uint32& hits, uint32& misses, size_t& mem)
+{
+	hits = m_pool_hits;
+	misses = m_pool_misses;
+	mem = m_pool_mem;
+
+	m_pool_hits = 0;
+	m_pool_misses = 0;
 }
 
 GSTexture* GSDevice::CreateSparseRenderTarget(int w, int h, int format)
@@ -261,8 +436,12 @@ void GSDevice::Merge(GSTexture* sTex[3], GSVector4* sRect, GSVector4* dRect, con
 			}
 		}
 
+		BeginGPUTimer(GPUTimer_Merge);
+
 		DoMerge(tex, sRect, m_merge, dRect, PMODE, EXTBUF, c);
 
+		EndGPUTimer(GPUTimer_Merge);
+
 		for (size_t i = 0; i < countof(tex); i++)
 		{
 			if (tex[i] != sTex[i])
@@ -277,10 +456,13 @@ void GSDevice::Merge(GSTexture* sTex[3], GSVector4* sRect, GSVector4* dRect, con
 	}
 
 	m_current = m_merge;
+	m_current_luma = false;
 }
 
 void GSDevice::Interlace(const GSVector2i& ds, int field, int mode, float yoffset)
 {
+	GPUTimerScope gts(this, GPUTimer_Merge);
+
 	ResizeTarget(&m_weavebob, ds.x, ds.y);
 
 	if (mode == 0 || mode == 2) // weave or blend
@@ -316,45 +498,71 @@ void GSDevice::Interlace(const GSVector2i& ds, int field, int mode, float yoffse
 	}
 }
 
+// The spare target a post pass can render into, i.e. whichever of the two
+// isn't holding the output of the previous pass.
+GSTexture** GSDevice::SpareTarget()
+{
+	return m_current == m_target_tmp ? &m_target_tmp2 : &m_target_tmp;
+}
+
 void GSDevice::ExternalFX()
 {
-	const GSVector2i s = m_current->GetSize();
+	GSTexture** tmp = SpareTarget();
 
-	if (ResizeTarget(&m_target_tmp))
+	if (ResizeTarget(tmp))
 	{
+		const GSVector2i s = m_current->GetSize();
+
 		const GSVector4 sRect(0, 0, 1, 1);
 		const GSVector4 dRect(0, 0, s.x, s.y);
 
-		StretchRect(m_current, sRect, m_target_tmp, dRect, ShaderConvert_TRANSPARENCY_FILTER, false);
-		DoExternalFX(m_target_tmp, m_current);
+		StretchRect(m_current, sRect, *tmp, dRect, ShaderConvert_TRANSPARENCY_FILTER, false);
+		DoExternalFX(*tmp, m_current);
+
+		m_current_luma = false;
 	}
 }
 
 void GSDevice::FXAA()
 {
-	const GSVector2i s = m_current->GetSize();
+	GSTexture** tmp = SpareTarget();
 
-	if (ResizeTarget(&m_target_tmp))
+	if (ResizeTarget(tmp))
 	{
-		const GSVector4 sRect(0, 0, 1, 1);
-		const GSVector4 dRect(0, 0, s.x, s.y);
+		if (m_current_luma)
+		{
+			// Shadeboost already left the luma the filter wants in the alpha
+			// channel, skip the transparency filter prepass.
+			DoFXAA(m_current, *tmp);
 
-		StretchRect(m_current, sRect, m_target_tmp, dRect, ShaderConvert_TRANSPARENCY_FILTER, false);
-		DoFXAA(m_target_tmp, m_current);
+			m_current = *tmp;
+			m_current_luma = false;
+		}
+		else
+		{
+			const GSVector2i s = m_current->GetSize();
+
+			const GSVector4 sRect(0, 0, 1, 1);
+			const GSVector4 dRect(0, 0, s.x, s.y);
+
+			StretchRect(m_current, sRect, *tmp, dRect, ShaderConvert_TRANSPARENCY_FILTER, false);
+			DoFXAA(*tmp, m_current);
+		}
 	}
 }
 
 void GSDevice::ShadeBoost()
 {
-	const GSVector2i s = m_current->GetSize();
+	GSTexture** tmp = SpareTarget();
 
-	if (ResizeTarget(&m_target_tmp))
+	if (ResizeTarget(tmp))
 	{
-		const GSVector4 sRect(0, 0, 1, 1);
-		const GSVector4 dRect(0, 0, s.x, s.y);
+		// Render straight into the spare target, the old identity copy that
+		// made in-place filtering possible was a wasted fullscreen pass.
+		DoShadeBoost(m_current, *tmp);
 
-		StretchRect(m_current, sRect, m_target_tmp, dRect, ShaderConvert_COPY, false);
-		DoShadeBoost(m_target_tmp, m_current);
+		m_current = *tmp;
+		m_current_luma = m_sb_luma;
 	}
 }
 
@@ -126,7 +126,34 @@ struct HWBlend
 class GSDevice : public GSAlignedClass<32>
 {
 private:
-	FastList<GSTexture*> m_pool;
+	// The pool is split into size class buckets (log2 of the larger
+	// dimension) so FetchSurface doesn't walk every retired surface when a
+	// game ping-pongs between render target sizes. Surfaces of a class are
+	// kept in MRU order, eviction always takes the globally oldest one.
+	std::array<FastList<GSTexture*>, 16> m_pool;
+	size_t m_pool_size;
+	size_t m_pool_mem;
+	// Pool memory budget in bytes (texture_pool_budget_mb); 0 disables it.
+	// The 300-surface cap still applies either way.
+	size_t m_pool_budget;
+	uint32 m_pool_hits;
+	uint32 m_pool_misses;
+
+	// Shapes (type/format/w/h) that went through a pool miss this session,
+	// with the number of misses seen. Dumped to the warm file on teardown so
+	// the next boot of the same game can pre-allocate them (SetWarmFile).
+	std::map<uint64, uint32> m_pool_profile;
+	std::string m_warm_file;
+
+	static size_t PoolBucket(int w, int h);
+	static uint64 PoolShapeKey(int type, int w, int h, int format);
+
+	GSTexture** SpareTarget();
+
+	FastList<GSTexture*>* LRUPool();
+	void EvictSurface(FastList<GSTexture*>& pool);
+	void SavePoolProfile();
+
 	static std::array<HWBlend, 3*3*3*3 + 1> m_blendMap;
 
 protected:
@@ -153,6 +180,7 @@ protected:
 	GSTexture* m_weavebob;
 	GSTexture* m_blend;
 	GSTexture* m_target_tmp;
+	GSTexture* m_target_tmp2; // second spare, post passes ping-pong between the two
 	GSTexture* m_current;
 	struct
 	{
@@ -164,6 +192,11 @@ protected:
 	} m_index;
 	unsigned int m_frame; // for ageing the pool
 	bool m_linear_present;
+	// True when the shadeboost shader was compiled with SB_LUMA_ALPHA, i.e.
+	// it leaves the luma FXAA wants in the alpha channel, so the transparency
+	// filter prepass of FXAA can be skipped when shadeboost ran just before.
+	bool m_sb_luma;
+	bool m_current_luma; // alpha of m_current holds the luma of this frame
 
 	virtual GSTexture* CreateSurface(int type, int w, int h, int format) = 0;
 	virtual GSTexture* FetchSurface(int type, int w, int h, int format);
@@ -208,6 +241,11 @@ public:
 	virtual bool HasDepthSparse() { return false; }
 	virtual bool HasColorSparse() { return false; }
 
+	// Memory the backend considers usable for textures, in bytes. Best
+	// effort, queried once at device creation; 0 when the backend has no way
+	// to tell.
+	virtual uint64 GetVRAMSize() { return 0; }
+
 	virtual void ClearRenderTarget(GSTexture* t, const GSVector4& c) {}
 	virtual void ClearRenderTarget(GSTexture* t, uint32 c) {}
 	virtual void ClearDepth(GSTexture* t) {}
@@ -251,6 +289,37 @@ public:
 	void AgePool();
 	void PurgePool();
 
+	// Loads the per-game warm file (written on teardown of the previous
+	// session) and pre-allocates the recorded surfaces into the pool, so the
+	// first scene hits the pool instead of stalling in the driver. Must be
+	// called from the GS thread, after the device is created.
+	void SetWarmFile(const std::string& path);
+
+	// Per frame pool statistics, the renderer hands them to GSPerfMon on
+	// VSync. Resets the hit/miss counts.
+	void GetPoolStats(uint32& hits, uint32& misses, size_t& mem);
+
+	enum GPUTimerType
+	{
+		GPUTimer_Draw,   // draw batches of the renderer
+		GPUTimer_Upload, // texture cache uploads
+		GPUTimer_Merge,  // merge/interlace/present chain
+		GPUTimer_Count,
+	};
+
+	// Brackets the GPU work of one category with timestamp queries. Results
+	// show up in GetGPUTimes (ms per category, per frame) once the GPU caught
+	// up, typically a frame or two later, so collection never stalls. Devices
+	// without timer query support report zeroes.
+	virtual void BeginGPUTimer(int type) {}
+	virtual void EndGPUTimer(int type) {}
+
+	virtual void GetGPUTimes(double* times)
+	{
+		for (int i = 0; i < GPUTimer_Count; i++)
+			times[i] = 0.0;
+	}
+
 	virtual void PrintMemoryUsage();
 
 	// Convert the GS blend equations to HW specific blend factors/ops
@@ -259,6 +328,23 @@ public:
 	uint16 GetBlendFlags(size_t index);
 };
 
+// RAII bracket for the GPU timers of GSDevice, mirrors GSPerfMonAutoTimer.
+class GPUTimerScope
+{
+	GSDevice* m_dev;
+	int m_type;
+
+public:
+	GPUTimerScope(GSDevice* dev, int type)
+		: m_dev(dev)
+		, m_type(type)
+	{
+		m_dev->BeginGPUTimer(m_type);
+	}
+
+	~GPUTimerScope() { m_dev->EndGPUTimer(m_type); }
+};
+
 struct GSAdapter
 {
 	uint32 vendor;
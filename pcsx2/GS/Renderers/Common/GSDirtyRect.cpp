@@ -76,3 +76,62 @@ const GSVector4i GSDirtyRectList::GetDirtyRectAndClear(const GIFRegTEX0& TEX0, c
 
 	return GSVector4i::zero();
 }
+
+const std::vector<GSVector4i> GSDirtyRectList::GetDirtyRectsAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size)
+{
+	std::vector<GSVector4i> rects;
+
+	const GSVector2i bs = GSLocalMemory::m_psm[TEX0.PSM].bs;
+
+	for (const auto& dirty_rect : *this)
+	{
+		GSVector4i r = dirty_rect.GetDirtyRect(TEX0).ralign<Align_Outside>(bs).rintersect(GSVector4i(0, 0, size.x, size.y));
+
+		if (r.rempty())
+			continue;
+
+		// merge when the union doesn't cover more area than the parts, so
+		// adjacent writes (streamed texture rows) coalesce while writes to
+		// opposite corners stay separate
+
+		for (size_t i = 0; i < rects.size();)
+		{
+			GSVector4i u = r.runion(rects[i]);
+
+			if ((int64)u.width() * u.height() <= (int64)r.width() * r.height() + (int64)rects[i].width() * rects[i].height())
+			{
+				r = u;
+
+				rects.erase(rects.begin() + i);
+
+				i = 0; // the union may now absorb earlier rects
+			}
+			else
+			{
+				i++;
+			}
+		}
+
+		rects.push_back(r);
+	}
+
+	clear();
+
+	// pathological write patterns fall back to one big upload instead of
+	// dozens of small ones
+
+	if (rects.size() > 8)
+	{
+		GSVector4i u = rects[0];
+
+		for (size_t i = 1; i < rects.size(); i++)
+		{
+			u = u.runion(rects[i]);
+		}
+
+		rects.resize(1);
+		rects[0] = u;
+	}
+
+	return rects;
+}
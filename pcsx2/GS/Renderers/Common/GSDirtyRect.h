@@ -37,4 +37,5 @@ class GSDirtyRectList : public std::vector<GSDirtyRect>
 public:
 	GSDirtyRectList() {}
 	const GSVector4i GetDirtyRectAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size);
+	const std::vector<GSVector4i> GetDirtyRectsAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size);
 };
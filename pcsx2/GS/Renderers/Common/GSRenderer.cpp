@@ -25,12 +25,16 @@ const unsigned int s_post_shader_nb = 5;
 const unsigned int s_mipmap_nb = 3;
 
 GSRenderer::GSRenderer()
-	: m_shader(0)
+	: m_capture_tex(NULL)
+	, m_snapshot_seq_frames(0)
+	, m_snapshot_seq_n(0)
+	, m_shader(0)
 	, m_shift_key(false)
 	, m_control_key(false)
 	, m_texture_shuffle(false)
 	, m_fmv_switch(false)
 	, m_real_size(0, 0)
+	, m_ee_latency(0.0)
 	, m_wnd()
 	, m_dev(NULL)
 {
@@ -44,6 +48,14 @@ GSRenderer::GSRenderer()
 	m_shaderfx    = theApp.GetConfigB("shaderfx");
 	m_shadeboost  = theApp.GetConfigB("ShadeBoost");
 	m_dithering   = theApp.GetConfigI("dithering_ps2"); // 0 off, 1 auto, 2 auto no scale
+
+	// 50/50/50 is the neutral setting, don't waste a fullscreen pass on it
+	if (theApp.GetConfigI("ShadeBoost_Saturation") == 50
+		&& theApp.GetConfigI("ShadeBoost_Brightness") == 50
+		&& theApp.GetConfigI("ShadeBoost_Contrast") == 50)
+	{
+		m_shadeboost = false;
+	}
 }
 
 GSRenderer::~GSRenderer()
@@ -53,6 +65,15 @@ GSRenderer::~GSRenderer()
 		m_dev->Reset(1, 1, GSDevice::Windowed);
 	}*/
 
+	if (m_capture_tex && m_dev)
+	{
+		m_dev->Recycle(m_capture_tex);
+	}
+
+	// Let queued screenshots hit the disk before the renderer goes away.
+	if (m_png_worker)
+		m_png_worker->Wait();
+
 	delete m_dev;
 }
 
@@ -312,24 +333,28 @@ GSVector4i GSRenderer::ComputeDrawRectangle(int width, int height) const
 
 	double targetAr = clientAr;
 
+	// Snapshot the GS window options; g_Conf itself belongs to the main thread and may
+	// be mid-update while we present.
+	const AppConfig::GSWindowOptions window = g_GSWindowConf.Read();
+
 	if (m_fmv_switch)
 	{
-		if (g_Conf->GSWindow.FMVAspectRatioSwitch == FMV_AspectRatio_Switch_4_3)
+		if (window.FMVAspectRatioSwitch == FMV_AspectRatio_Switch_4_3)
 		{
 			targetAr = 4.0 / 3.0;
 		}
-		else if (g_Conf->GSWindow.FMVAspectRatioSwitch == FMV_AspectRatio_Switch_16_9)
+		else if (window.FMVAspectRatioSwitch == FMV_AspectRatio_Switch_16_9)
 		{
 			targetAr = 16.0 / 9.0;
 		}
 	}
 	else
 	{
-		if (g_Conf->GSWindow.AspectRatio == AspectRatio_4_3)
+		if (window.AspectRatio == AspectRatio_4_3)
 		{
 			targetAr = 4.0 / 3.0;
 		}
-		else if (g_Conf->GSWindow.AspectRatio == AspectRatio_16_9)
+		else if (window.AspectRatio == AspectRatio_16_9)
 		{
 			targetAr = 16.0 / 9.0;
 		}
@@ -343,12 +368,12 @@ GSVector4i GSRenderer::ComputeDrawRectangle(int width, int height) const
 	else if (arr > 1)
 		target_height = std::floor(f_height / arr + 0.5);
 
-	float zoom = g_Conf->GSWindow.Zoom / 100.0;
+	float zoom = window.Zoom / 100.0;
 	if (zoom == 0) //auto zoom in untill black-bars are gone (while keeping the aspect ratio).
 		zoom = std::max((float)arr, (float)(1.0 / arr));
 
 	target_width *= zoom;
-	target_height *= zoom * g_Conf->GSWindow.StretchY / 100.0;
+	target_height *= zoom * window.StretchY / 100.0;
 
 	double target_x, target_y;
 	if (target_width > f_width)
@@ -361,8 +386,8 @@ GSVector4i GSRenderer::ComputeDrawRectangle(int width, int height) const
 		target_y = (f_height - target_height) * 0.5;
 
 	const double unit = .01 * std::min(target_x, target_y);
-	target_x += unit * g_Conf->GSWindow.OffsetX;
-	target_y += unit * g_Conf->GSWindow.OffsetY;
+	target_x += unit * window.OffsetX;
+	target_y += unit * window.OffsetY;
 
 	return GSVector4i(
 		static_cast<int>(std::floor(target_x)),
@@ -406,6 +431,31 @@ void GSRenderer::VSync(int field)
 
 	m_dev->AgePool();
 
+	{
+		uint32 hits, misses;
+		size_t mem;
+
+		m_dev->GetPoolStats(hits, misses, mem);
+
+		m_perfmon.Put(GSPerfMon::SurfacePoolHit, hits);
+		m_perfmon.Put(GSPerfMon::SurfacePoolMiss, misses);
+		m_perfmon.Put(GSPerfMon::SurfacePoolMem, (double)mem);
+	}
+
+	{
+		double gpu[GSDevice::GPUTimer_Count];
+
+		m_dev->GetGPUTimes(gpu);
+
+		m_perfmon.Put(GSPerfMon::GPUDraw, gpu[GSDevice::GPUTimer_Draw]);
+		m_perfmon.Put(GSPerfMon::GPUUpload, gpu[GSDevice::GPUTimer_Upload]);
+		m_perfmon.Put(GSPerfMon::GPUMerge, gpu[GSDevice::GPUTimer_Merge]);
+	}
+
+	// EE->present latency of the previous frame, measured by the MTGS from the
+	// timestamp it stamps into each vsync packet.
+	m_perfmon.Put(GSPerfMon::EELatency, m_ee_latency);
+
 	// osd
 
 	if ((m_perfmon.GetFrame() & 0x1f) == 0)
@@ -432,7 +482,7 @@ void GSRenderer::VSync(int field)
 				m_perfmon.GetFrame(), GetInternalResolution().x, GetInternalResolution().y, fps, (int)(100.0 * fps / GetTvRefreshRate()),
 				s2.c_str(),
 				theApp.m_gs_interlace[m_interlace].name.c_str(),
-				aspect_ratio_names[g_Conf->GSWindow.AspectRatio],
+				aspect_ratio_names[g_GSWindowConf.Read().AspectRatio],
 				(int)m_perfmon.Get(GSPerfMon::SyncPoint),
 				(int)m_perfmon.Get(GSPerfMon::Prim),
 				(int)m_perfmon.Get(GSPerfMon::Draw),
@@ -440,6 +490,28 @@ void GSRenderer::VSync(int field)
 				m_perfmon.Get(GSPerfMon::Swizzle) / 1024,
 				m_perfmon.Get(GSPerfMon::Unswizzle) / 1024);
 
+			// per path transfer volume (kqw), shows which gif path saturates the bus
+			s += format(" | %.1f/%.1f/%.1f kqw",
+				m_perfmon.Get(GSPerfMon::Path1Transfer) / 1024,
+				m_perfmon.Get(GSPerfMon::Path2Transfer) / 1024,
+				m_perfmon.Get(GSPerfMon::Path3Transfer) / 1024);
+
+			// GPU time per category (draw/upload/merge), zero without timer
+			// query support
+			s += format(" | GPU %.1f/%.1f/%.1f ms",
+				m_perfmon.Get(GSPerfMon::GPUDraw),
+				m_perfmon.Get(GSPerfMon::GPUUpload),
+				m_perfmon.Get(GSPerfMon::GPUMerge));
+
+			// input lag between the EE building a frame and it reaching the screen
+			s += format(" | lat %.1f ms", m_perfmon.Get(GSPerfMon::EELatency));
+
+			// surface pool efficiency, misses are driver allocations
+			s += format(" | pool %d/%d %dMB",
+				(int)m_perfmon.Get(GSPerfMon::SurfacePoolHit),
+				(int)m_perfmon.Get(GSPerfMon::SurfacePoolMiss),
+				(int)(m_perfmon.Get(GSPerfMon::SurfacePoolMem) / (1024 * 1024)));
+
 			double fillrate = m_perfmon.Get(GSPerfMon::Fillrate);
 
 			if (fillrate > 0)
@@ -519,7 +591,9 @@ void GSRenderer::VSync(int field)
 			fd.data = new u8[fd.size];
 			Freeze(&fd, false);
 
-			if (m_control_key)
+			if (theApp.GetConfigB("dump_v2"))
+				m_dump = std::unique_ptr<GSDumpBase>(new GSDumpV2(m_snapshot, m_crc, fd, m_regs));
+			else if (m_control_key)
 				m_dump = std::unique_ptr<GSDumpBase>(new GSDump(m_snapshot, m_crc, fd, m_regs));
 			else
 				m_dump = std::unique_ptr<GSDumpBase>(new GSDumpXz(m_snapshot, m_crc, fd, m_regs));
@@ -529,11 +603,31 @@ void GSRenderer::VSync(int field)
 
 		if (GSTexture* t = m_dev->GetCurrent())
 		{
-			t->Save(m_snapshot + ".png");
+			if (!m_png_worker)
+				m_png_worker = std::unique_ptr<GSPng::Worker>(new GSPng::Worker(&GSPng::Process));
+
+			t->Save(m_snapshot + ".png", m_png_worker.get());
+
+			// Batched sequence dump: with snapshot_frames > 1 the following frames
+			// are saved under the same basename for frame-by-frame comparisons.
+			const int frames = theApp.GetConfigI("snapshot_frames");
+			if (frames > 1)
+			{
+				m_snapshot_seq_base = m_snapshot;
+				m_snapshot_seq_frames = frames - 1;
+				m_snapshot_seq_n = 1;
+			}
 		}
 
 		m_snapshot.clear();
 	}
+	else if (m_snapshot_seq_frames > 0)
+	{
+		if (GSTexture* t = m_dev->GetCurrent())
+			t->Save(format("%s_f%03d.png", m_snapshot_seq_base.c_str(), m_snapshot_seq_n++), m_png_worker.get());
+
+		m_snapshot_seq_frames--;
+	}
 	else if (m_dump)
 	{
 		if (m_dump->VSync(field, !m_control_key, m_regs))
@@ -544,24 +638,39 @@ void GSRenderer::VSync(int field)
 
 	if (m_capture.IsCapturing())
 	{
+		GSTexture* offscreen = NULL;
+
 		if (GSTexture* current = m_dev->GetCurrent())
 		{
 			GSVector2i size = m_capture.GetSize();
 
-			if (GSTexture* offscreen = m_dev->CopyOffscreen(current, GSVector4(0, 0, 1, 1), size.x, size.y))
-			{
-				GSTexture::GSMap m;
+			offscreen = m_dev->CopyOffscreen(current, GSVector4(0, 0, 1, 1), size.x, size.y);
+		}
 
-				if (offscreen->Map(m))
-				{
-					m_capture.DeliverFrame(m.bits, m.pitch, !m_dev->IsRBSwapped());
+		// Deliver the copy queued on the previous vsync, the gpu had a whole
+		// frame to finish it so Map doesn't have to stall here
 
-					offscreen->Unmap();
-				}
+		if (m_capture_tex)
+		{
+			GSTexture::GSMap m;
 
-				m_dev->Recycle(offscreen);
+			if (m_capture_tex->Map(m))
+			{
+				m_capture.DeliverFrame(m.bits, m.pitch, !m_dev->IsRBSwapped());
+
+				m_capture_tex->Unmap();
 			}
+
+			m_dev->Recycle(m_capture_tex);
 		}
+
+		m_capture_tex = offscreen;
+	}
+	else if (m_capture_tex)
+	{
+		m_dev->Recycle(m_capture_tex);
+
+		m_capture_tex = NULL;
 	}
 }
 
@@ -611,6 +720,24 @@ bool GSRenderer::BeginCapture(std::string& filename)
 
 void GSRenderer::EndCapture()
 {
+	// deliver the in-flight readback before the encoder goes away
+
+	if (m_capture_tex)
+	{
+		GSTexture::GSMap m;
+
+		if (m_capture_tex->Map(m))
+		{
+			m_capture.DeliverFrame(m.bits, m.pitch, !m_dev->IsRBSwapped());
+
+			m_capture_tex->Unmap();
+		}
+
+		m_dev->Recycle(m_capture_tex);
+
+		m_capture_tex = NULL;
+	}
+
 	m_capture.EndCapture();
 }
 
@@ -23,7 +23,19 @@
 class GSRenderer : public GSState
 {
 	GSCapture m_capture;
+	GSTexture* m_capture_tex; // readback queued on the previous vsync
 	std::string m_snapshot;
+
+	// Snapshots are compressed on this worker (created on first use); the GS thread
+	// only pays for the readback copy.  The queue is bounded, so runaway requests
+	// apply back-pressure instead of hoarding raw 4K frames.
+	std::unique_ptr<GSPng::Worker> m_png_worker;
+
+	// Remaining frames of a batched sequence dump (snapshot_frames > 1).
+	std::string m_snapshot_seq_base;
+	int m_snapshot_seq_frames;
+	int m_snapshot_seq_n;
+
 	int m_shader;
 
 	bool Merge(int field);
@@ -42,6 +54,7 @@ protected:
 	bool m_texture_shuffle;
 	bool m_fmv_switch;
 	GSVector2i m_real_size;
+	double m_ee_latency; // EE vsync submission to present, ms (fed by the MTGS)
 
 	virtual GSTexture* GetOutput(int i, int& y_offset) = 0;
 	virtual GSTexture* GetFeedbackOutput() { return nullptr; }
@@ -68,6 +81,8 @@ public:
 	__fi bool GetFMVSwitch() const { return m_fmv_switch; }
 	__fi void SetFMVSwitch(bool enabled) { m_fmv_switch = enabled; }
 
+	__fi void SetEELatency(double ms) { m_ee_latency = ms; }
+
 	virtual bool BeginCapture(std::string& filename);
 	virtual void EndCapture();
 
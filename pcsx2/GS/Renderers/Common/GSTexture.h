@@ -16,6 +16,7 @@
 #pragma once
 
 #include "GS/GSVector.h"
+#include "GS/GSPng.h"
 
 class GSTexture
 {
@@ -60,7 +61,9 @@ public:
 	virtual bool Map(GSMap& m, const GSVector4i* r = NULL, int layer = 0) = 0;
 	virtual void Unmap() = 0;
 	virtual void GenerateMipmap() {}
-	virtual bool Save(const std::string& fn) = 0;
+	// When async is given the readback is deep-copied and handed to the worker for
+	// compression; only the copy runs on the calling (GS) thread.
+	virtual bool Save(const std::string& fn, GSPng::Worker* async = nullptr) = 0;
 	virtual uint32 GetID() { return 0; }
 
 	GSVector2 GetScale() const { return m_scale; }
@@ -26,6 +26,8 @@ GSVertexTrace::GSVertexTrace(const GSState* state)
 	m_force_filter = static_cast<BiFiltering>(theApp.GetConfigI("filter"));
 	memset(&m_alpha, 0, sizeof(m_alpha));
 
+	AccReset();
+
 	#define InitUpdate3(P, IIP, TME, FST, COLOR) \
 		m_fmm[0][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 0>; \
 		m_fmm[1][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 1>; \
@@ -57,16 +59,31 @@ void GSVertexTrace::Update(const void* vertex, const uint32* index, int v_count,
 	uint32 fst = m_state->PRIM->FST;
 	uint32 color = !(m_state->PRIM->TME && m_state->m_context->TEX0.TFX == TFX_DECAL && m_state->m_context->TEX0.TCC);
 
-	(this->*m_fmm[m_accurate_stq][color][fst][tme][iip][primclass])(vertex, index, i_count);
+	// VertexKick already accumulated the raw ranges of the kicked batch, the
+	// accumulator is consumed once, later Update calls on the same batch (OI
+	// hacks rewrite vertices) have to rescan
+
+	bool accumulated = m_acc.valid && m_acc.count == (uint32)i_count && (!tme || fst);
 
-	// Potential float overflow detected. Better uses the slower division instead
-	// Note: If Q is too big, 1/Q will end up as 0. 1e30 is a random number
-	// that feel big enough.
-	if (!fst && !m_accurate_stq && m_min.t.z > 1e30)
+	m_acc.valid = false;
+
+	if (accumulated)
+	{
+		UpdateFromAccumulator(iip, tme, fst, color);
+	}
+	else
 	{
-		fprintf(stderr, "Vertex Trace: float overflow detected ! min %e max %e\n", m_min.t.z, m_max.t.z);
-		m_accurate_stq = true;
 		(this->*m_fmm[m_accurate_stq][color][fst][tme][iip][primclass])(vertex, index, i_count);
+
+		// Potential float overflow detected. Better uses the slower division instead
+		// Note: If Q is too big, 1/Q will end up as 0. 1e30 is a random number
+		// that feel big enough.
+		if (!fst && !m_accurate_stq && m_min.t.z > 1e30)
+		{
+			fprintf(stderr, "Vertex Trace: float overflow detected ! min %e max %e\n", m_min.t.z, m_max.t.z);
+			m_accurate_stq = true;
+			(this->*m_fmm[m_accurate_stq][color][fst][tme][iip][primclass])(vertex, index, i_count);
+		}
 	}
 
 	m_eq.value = (m_min.c == m_max.c).mask() | ((m_min.p == m_max.p).mask() << 16) | ((m_min.t == m_max.t).mask() << 20);
@@ -150,6 +167,72 @@ void GSVertexTrace::Update(const void* vertex, const uint32* index, int v_count,
 	}
 }
 
+void GSVertexTrace::AccReset()
+{
+	m_acc.v1min = GSVector4i::xffffffff();
+	m_acc.v1max = GSVector4i::zero();
+	m_acc.zfmin = GSVector4i::xffffffff();
+	m_acc.zfmax = GSVector4i::zero();
+	m_acc.cmin = GSVector4i::xffffffff();
+	m_acc.cmax = GSVector4i::zero();
+	m_acc.cfmin = GSVector4i::xffffffff();
+	m_acc.cfmax = GSVector4i::zero();
+	m_acc.count = 0;
+	m_acc.valid = true;
+}
+
+void GSVertexTrace::UpdateFromAccumulator(uint32 iip, uint32 tme, uint32 fst, uint32 color)
+{
+	const GSDrawingContext* context = m_state->m_context;
+
+	// rebuild the [x, y, z, f] vectors FindMinMax would have produced
+
+	GSVector4i pmin = m_acc.v1min.upl16().upl64(m_acc.zfmin.ywyw());
+	GSVector4i pmax = m_acc.v1max.upl16().upl64(m_acc.zfmax.ywyw());
+
+	// see the FIXME in FindMinMax about the division by 2 of the depth
+
+	pmin = pmin.blend16<0x30>(pmin.srl32(1));
+	pmax = pmax.blend16<0x30>(pmax.srl32(1));
+
+	GSVector4 o(context->XYOFFSET);
+	GSVector4 s(1.0f / 16, 1.0f / 16, 2.0f, 1.0f);
+
+	m_min.p = (GSVector4(pmin) - o) * s;
+	m_max.p = (GSVector4(pmax) - o) * s;
+
+	if (tme)
+	{
+		// only fst draws are accumulated, stq needs the per prim q divide
+
+		ASSERT(fst);
+
+		s = GSVector4(1.0f / 16, 1.0f).xxyy();
+
+		m_min.t = GSVector4(m_acc.v1min.uph16()).xyxy() * s;
+		m_max.t = GSVector4(m_acc.v1max.uph16()).xyxy() * s;
+	}
+	else
+	{
+		m_min.t = GSVector4::zero();
+		m_max.t = GSVector4::zero();
+	}
+
+	if (color)
+	{
+		const GSVector4i& cmin = iip ? m_acc.cmin : m_acc.cfmin;
+		const GSVector4i& cmax = iip ? m_acc.cmax : m_acc.cfmax;
+
+		m_min.c = cmin.zzzz().u8to32();
+		m_max.c = cmax.zzzz().u8to32();
+	}
+	else
+	{
+		m_min.c = GSVector4i::zero();
+		m_max.c = GSVector4i::zero();
+	}
+}
+
 template <GS_PRIM_CLASS primclass, uint32 iip, uint32 tme, uint32 fst, uint32 color, uint32 accurate_stq>
 void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int count)
 {
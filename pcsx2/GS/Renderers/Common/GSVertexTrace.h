@@ -52,6 +52,24 @@ protected:
 	template <GS_PRIM_CLASS primclass, uint32 iip, uint32 tme, uint32 fst, uint32 color, uint32 accurate_stq>
 	void FindMinMax(const void* vertex, const uint32* index, int count);
 
+	// raw min/max accumulated by VertexKick per accepted prim, so Update
+	// doesn't have to rescan the whole batch (stq needs the per prim q
+	// divide and still takes the FindMinMax path)
+
+	struct alignas(32) Accumulator
+	{
+		GSVector4i v1min, v1max; // per 16 bit lane min/max of XYZUVF (x, y, u, v lanes used)
+		GSVector4i zfmin, zfmax; // per 32 bit lane min/max of XYZUVF (z, f lanes used), sprite f comes from the second vertex
+		GSVector4i cmin, cmax;   // color min/max over every vertex
+		GSVector4i cfmin, cfmax; // color min/max over the provoking vertex, for flat shading
+		uint32 count;            // indices accumulated, must match the flushed batch
+		bool valid;
+	};
+
+	Accumulator m_acc;
+
+	void UpdateFromAccumulator(uint32 iip, uint32 tme, uint32 fst, uint32 color);
+
 public:
 	GS_PRIM_CLASS m_primclass;
 
@@ -79,6 +97,71 @@ public:
 
 	void Update(const void* vertex, const uint32* index, int v_count, int i_count, GS_PRIM_CLASS primclass);
 
+	void AccReset();
+
+	template <uint32 prim>
+	__forceinline void Accumulate(const GSVertex* RESTRICT v, const uint32* RESTRICT index)
+	{
+		if (prim == GS_INVALID)
+			return;
+
+		const int n =
+			(prim == GS_POINTLIST) ? 1 :
+			(prim == GS_TRIANGLELIST || prim == GS_TRIANGLESTRIP || prim == GS_TRIANGLEFAN) ? 3 : 2;
+
+		GSVector4i v1min = m_acc.v1min;
+		GSVector4i v1max = m_acc.v1max;
+		GSVector4i zfmin = m_acc.zfmin;
+		GSVector4i zfmax = m_acc.zfmax;
+		GSVector4i cmin = m_acc.cmin;
+		GSVector4i cmax = m_acc.cmax;
+
+		for (int i = 0; i < n; i++)
+		{
+			GSVector4i c(v[index[i]].m[0]);
+			GSVector4i p(v[index[i]].m[1]);
+
+			v1min = v1min.min_u16(p);
+			v1max = v1max.max_u16(p);
+
+			if (prim != GS_SPRITE)
+			{
+				zfmin = zfmin.min_u32(p);
+				zfmax = zfmax.max_u32(p);
+			}
+
+			cmin = cmin.min_u8(c);
+			cmax = cmax.max_u8(c);
+		}
+
+		// sprites interpolate z between both vertices but take f from the
+		// second one only, like FindMinMax does
+
+		if (prim == GS_SPRITE)
+		{
+			GSVector4i p0(v[index[0]].m[1]);
+			GSVector4i p1(v[index[1]].m[1]);
+
+			p0 = p0.blend16<0xc0>(p1);
+
+			zfmin = zfmin.min_u32(p0.min_u32(p1));
+			zfmax = zfmax.max_u32(p0.max_u32(p1));
+		}
+
+		GSVector4i c(v[index[n - 1]].m[0]);
+
+		m_acc.cfmin = m_acc.cfmin.min_u8(c);
+		m_acc.cfmax = m_acc.cfmax.max_u8(c);
+
+		m_acc.v1min = v1min;
+		m_acc.v1max = v1max;
+		m_acc.zfmin = zfmin;
+		m_acc.zfmax = zfmax;
+		m_acc.cmin = cmin;
+		m_acc.cmax = cmax;
+		m_acc.count += n;
+	}
+
 	bool IsLinear() const { return m_filter.opt_linear; }
 	bool IsRealLinear() const { return m_filter.linear; }
 
@@ -28,8 +28,19 @@ GSDevice11::GSDevice11()
 	m_state.topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
 	m_state.bf = -1;
 
+	m_frame_latency_waitable = NULL;
+	m_swapchain_flags = 0;
+	m_allow_tearing = false;
+
+	for (int i = 0; i < GPUTimer_Count; i++)
+	{
+		m_gpu_timer_open[i] = -1;
+		m_gpu_times[i] = 0.0;
+	}
+
 	m_mipmap = theApp.GetConfigI("mipmap");
 	m_upscale_multiplier = theApp.GetConfigI("upscale_multiplier");
+	m_shader_cache_dir = theApp.GetConfigS("shader_cache_dir");
 
 	const BiFiltering nearest_filter = static_cast<BiFiltering>(theApp.GetConfigI("filter"));
 	const int aniso_level = theApp.GetConfigI("MaxAnisotropy");
@@ -123,6 +134,8 @@ bool GSDevice11::Create(const std::shared_ptr<GSWnd>& wnd)
 					if (desc.VendorId == 0x10DE)
 						nvidia_vendor = true;
 
+					m_vram_size = (uint64)desc.DedicatedVideoMemory;
+
 					adapter = std::move(enum_adapter);
 					driver_type = D3D_DRIVER_TYPE_UNKNOWN;
 					break;
@@ -167,24 +180,68 @@ bool GSDevice11::Create(const std::shared_ptr<GSWnd>& wnd)
 		swapchain_description.Width = 0;
 		swapchain_description.Height = 0;
 
-		swapchain_description.BufferCount = 2;
+		swapchain_description.BufferCount = 3;
 		swapchain_description.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
 		swapchain_description.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
 		swapchain_description.SampleDesc.Count = 1;
 		swapchain_description.SampleDesc.Quality = 0;
 
-		// TODO: update swap effect
-		swapchain_description.SwapEffect = DXGI_SWAP_EFFECT_DISCARD;
+		// The flip model keeps us on the compositor's fast path, and an unsynced
+		// present on a flip swapchain replaces any still-queued frame instead of
+		// appending to it -- mailbox-style latest-frame-wins.  It's also required
+		// for both the tearing flag and the frame latency waitable object below.
+		swapchain_description.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+
+		if (auto factory5 = factory.try_query<IDXGIFactory5>())
+		{
+			BOOL allow_tearing = FALSE;
+			if (SUCCEEDED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allow_tearing, sizeof(allow_tearing))))
+				m_allow_tearing = allow_tearing != FALSE;
+		}
+
+		m_swapchain_flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+		if (m_allow_tearing)
+			m_swapchain_flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
-		const HRESULT result = factory->CreateSwapChainForHwnd(
+		swapchain_description.Flags = m_swapchain_flags;
+
+		HRESULT result = factory->CreateSwapChainForHwnd(
 			m_dev.get(), reinterpret_cast<HWND>(m_wnd->GetHandle()),
 			&swapchain_description, nullptr, nullptr, m_swapchain.put());
 
+		if (FAILED(result))
+		{
+			// Older runtimes (Win7/8) reject the flip model and its flags; fall back
+			// to the legacy blit swapchain rather than refusing to start.
+			m_allow_tearing = false;
+			m_swapchain_flags = 0;
+
+			swapchain_description.BufferCount = 2;
+			swapchain_description.SwapEffect = DXGI_SWAP_EFFECT_DISCARD;
+			swapchain_description.Flags = 0;
+
+			result = factory->CreateSwapChainForHwnd(
+				m_dev.get(), reinterpret_cast<HWND>(m_wnd->GetHandle()),
+				&swapchain_description, nullptr, nullptr, m_swapchain.put());
+		}
+
 		if (FAILED(result))
 		{
 			fprintf(stderr, "D3D11: Failed to create swapchain (reason: %x)\n", result);
 			return false;
 		}
+
+		if (m_swapchain_flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT)
+		{
+			if (auto swapchain2 = m_swapchain.try_query<IDXGISwapChain2>())
+			{
+				// At most one frame in the present queue; Flip() blocks on this handle
+				// until the queue drains instead of stalling inside Present(), which
+				// removes about a frame of present-queue latency.
+				swapchain2->SetMaximumFrameLatency(1);
+				m_frame_latency_waitable = swapchain2->GetFrameLatencyWaitableObject();
+			}
+		}
 	}
 
 	if (!SetFeatureLevel(level, true))
@@ -309,6 +366,7 @@ bool GSDevice11::Create(const std::shared_ptr<GSWnd>& wnd)
 	sm_sboost.AddMacro("SB_SATURATION", std::max(0, std::min(theApp.GetConfigI("ShadeBoost_Saturation"), 100)));
 	sm_sboost.AddMacro("SB_BRIGHTNESS", std::max(0, std::min(theApp.GetConfigI("ShadeBoost_Brightness"), 100)));
 	sm_sboost.AddMacro("SB_CONTRAST", std::max(0, std::min(theApp.GetConfigI("ShadeBoost_Contrast"), 100)));
+	sm_sboost.AddMacro("SB_LUMA_ALPHA", m_sb_luma ? 1 : 0);
 
 	memset(&bd, 0, sizeof(bd));
 
@@ -433,7 +491,7 @@ bool GSDevice11::Reset(int w, int h)
 		memset(&scd, 0, sizeof(scd));
 
 		m_swapchain->GetDesc(&scd);
-		m_swapchain->ResizeBuffers(scd.BufferCount, w, h, scd.BufferDesc.Format, 0);
+		m_swapchain->ResizeBuffers(scd.BufferCount, w, h, scd.BufferDesc.Format, m_swapchain_flags);
 
 		wil::com_ptr_nothrow<ID3D11Texture2D> backbuffer;
 		if (FAILED(m_swapchain->GetBuffer(0, IID_PPV_ARGS(backbuffer.put()))))
@@ -454,7 +512,24 @@ void GSDevice11::SetVSync(int vsync)
 
 void GSDevice11::Flip()
 {
-	m_swapchain->Present(m_vsync, 0);
+	// Wait for the present queue to drain before handing over the next frame, so
+	// the block happens here (where MTGS can still be fed) rather than inside a
+	// future Present() with a finished frame already sitting in the queue.
+	if (m_frame_latency_waitable)
+		WaitForSingleObjectEx(m_frame_latency_waitable, 100, TRUE);
+
+	if (m_vsync)
+	{
+		m_swapchain->Present(1, 0);
+	}
+	else
+	{
+		// Unsynced flip-model presents are latest-frame-wins on their own; the
+		// tearing flag additionally lets a frame scan out immediately instead of
+		// waiting for the compositor, matching the old blit swapchain's behavior
+		// (and latency) with vsync disabled.
+		m_swapchain->Present(0, m_allow_tearing ? DXGI_PRESENT_ALLOW_TEARING : 0);
+	}
 }
 
 void GSDevice11::BeforeDraw()
@@ -530,6 +605,114 @@ void GSDevice11::DrawIndexedPrimitive(int offset, int count)
 	AfterDraw();
 }
 
+void GSDevice11::BeginGPUTimer(int type)
+{
+	ASSERT(m_gpu_timer_open[type] < 0); // brackets of one category don't nest
+
+	GPUTimerQuery q;
+
+	if (!m_gpu_timer_unused.empty())
+	{
+		q = std::move(m_gpu_timer_unused.back());
+		m_gpu_timer_unused.pop_back();
+	}
+	else
+	{
+		D3D11_QUERY_DESC desc;
+		memset(&desc, 0, sizeof(desc));
+
+		desc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+		m_dev->CreateQuery(&desc, q.disjoint.put());
+
+		desc.Query = D3D11_QUERY_TIMESTAMP;
+		m_dev->CreateQuery(&desc, q.begin.put());
+		m_dev->CreateQuery(&desc, q.end.put());
+	}
+
+	if (!q.disjoint || !q.begin || !q.end)
+		return;
+
+	q.type = type;
+
+	m_ctx->Begin(q.disjoint.get());
+	m_ctx->End(q.begin.get());
+
+	m_gpu_timer_open[type] = (int)m_gpu_timer_pending.size();
+	m_gpu_timer_pending.push_back(std::move(q));
+}
+
+void GSDevice11::EndGPUTimer(int type)
+{
+	const int i = m_gpu_timer_open[type];
+
+	if (i < 0)
+		return;
+
+	const GPUTimerQuery& q = m_gpu_timer_pending[i];
+
+	m_ctx->End(q.end.get());
+	m_ctx->End(q.disjoint.get());
+
+	m_gpu_timer_open[type] = -1;
+}
+
+void GSDevice11::GetGPUTimes(double* times)
+{
+	// Queries complete in submission order, stop at the first one the GPU
+	// hasn't reached yet and pick it up on the next frame.
+
+	size_t done = 0;
+
+	while (done < m_gpu_timer_pending.size())
+	{
+		const GPUTimerQuery& q = m_gpu_timer_pending[done];
+
+		bool open = false;
+
+		for (int t = 0; t < GPUTimer_Count; t++)
+			open |= m_gpu_timer_open[t] == (int)done;
+
+		if (open)
+			break;
+
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT dj;
+
+		if (m_ctx->GetData(q.disjoint.get(), &dj, sizeof(dj), 0) != S_OK)
+			break;
+
+		UINT64 t0 = 0;
+		UINT64 t1 = 0;
+
+		if (m_ctx->GetData(q.begin.get(), &t0, sizeof(t0), 0) == S_OK &&
+			m_ctx->GetData(q.end.get(), &t1, sizeof(t1), 0) == S_OK &&
+			!dj.Disjoint && dj.Frequency != 0)
+		{
+			m_gpu_times[q.type] += (double)(t1 - t0) * 1000.0 / dj.Frequency;
+		}
+
+		m_gpu_timer_unused.push_back(std::move(m_gpu_timer_pending[done]));
+
+		done++;
+	}
+
+	if (done > 0)
+	{
+		m_gpu_timer_pending.erase(m_gpu_timer_pending.begin(), m_gpu_timer_pending.begin() + done);
+
+		for (int t = 0; t < GPUTimer_Count; t++)
+		{
+			if (m_gpu_timer_open[t] >= 0)
+				m_gpu_timer_open[t] -= (int)done;
+		}
+	}
+
+	for (int t = 0; t < GPUTimer_Count; t++)
+	{
+		times[t] = m_gpu_times[t];
+		m_gpu_times[t] = 0.0;
+	}
+}
+
 void GSDevice11::ClearRenderTarget(GSTexture* t, const GSVector4& c)
 {
 	if (!t)
@@ -1443,6 +1626,18 @@ void GSDevice11::CreateShader(const std::vector<char>& source, const char* fn, I
 	}
 }
 
+static uint64 FnvHash(const void* data, size_t size, uint64 hash = 0xcbf29ce484222325ull)
+{
+	const uint8* p = (const uint8*)data;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		hash = (hash ^ p[i]) * 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
 void GSDevice11::CompileShader(const std::vector<char>& source, const char* fn, ID3DInclude* include, const char* entry, D3D_SHADER_MACRO* macro, ID3DBlob** shader, const std::string& shader_model)
 {
 	wil::com_ptr_nothrow<ID3DBlob> error;
@@ -1453,6 +1648,49 @@ void GSDevice11::CompileShader(const std::vector<char>& source, const char* fn,
 	flags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_AVOID_FLOW_CONTROL;
 #endif
 
+	std::string cache_fn;
+
+	if (!m_shader_cache_dir.empty())
+	{
+		// Dxbc doesn't depend on the driver, so the key only has to cover
+		// the compiler inputs.
+
+		uint64 key = FnvHash(source.data(), source.size());
+
+		key = FnvHash(entry, strlen(entry), key);
+		key = FnvHash(shader_model.c_str(), shader_model.size(), key);
+		key = FnvHash(&flags, sizeof(flags), key);
+
+		for (D3D_SHADER_MACRO* m = macro; m != nullptr && m->Name != nullptr; m++)
+		{
+			key = FnvHash(m->Name, strlen(m->Name), key);
+			key = FnvHash(m->Definition, strlen(m->Definition), key);
+		}
+
+		cache_fn = format("%s/%016llx.dxbc", m_shader_cache_dir.c_str(), (unsigned long long)key);
+
+		if (FILE* fp = fopen(cache_fn.c_str(), "rb"))
+		{
+			fseek(fp, 0, SEEK_END);
+			long size = ftell(fp);
+			fseek(fp, 0, SEEK_SET);
+
+			if (size > 0 && SUCCEEDED(D3DCreateBlob(size, shader)))
+			{
+				if (fread((*shader)->GetBufferPointer(), size, 1, fp) == 1)
+				{
+					fclose(fp);
+					return;
+				}
+
+				(*shader)->Release();
+				*shader = nullptr;
+			}
+
+			fclose(fp);
+		}
+	}
+
 	const HRESULT hr = D3DCompile(
 		source.data(), source.size(), fn, macro,
 		include, entry, shader_model.c_str(),
@@ -1463,6 +1701,17 @@ void GSDevice11::CompileShader(const std::vector<char>& source, const char* fn,
 
 	if (FAILED(hr))
 		throw GSRecoverableError();
+
+	if (!cache_fn.empty())
+	{
+		GSmkdir(m_shader_cache_dir.c_str());
+
+		if (FILE* fp = fopen(cache_fn.c_str(), "wb"))
+		{
+			fwrite((*shader)->GetBufferPointer(), (*shader)->GetBufferSize(), 1, fp);
+			fclose(fp);
+		}
+	}
 }
 
 uint16 GSDevice11::ConvertBlendEnum(uint16 generic)
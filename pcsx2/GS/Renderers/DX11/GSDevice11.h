@@ -410,6 +410,10 @@ private:
 	wil::com_ptr_nothrow<ID3D11Device> m_dev;
 	wil::com_ptr_nothrow<ID3D11DeviceContext> m_ctx;
 	wil::com_ptr_nothrow<IDXGISwapChain1> m_swapchain;
+	HANDLE m_frame_latency_waitable;
+	UINT m_swapchain_flags;
+	bool m_allow_tearing;
+	uint64 m_vram_size = 0; // DedicatedVideoMemory of the selected adapter
 	wil::com_ptr_nothrow<ID3D11Buffer> m_vb;
 	wil::com_ptr_nothrow<ID3D11Buffer> m_ib;
 
@@ -509,6 +513,22 @@ private:
 	GSConstantBuffer m_gs_cb_cache;
 	PSConstantBuffer m_ps_cb_cache;
 
+	// GPU timestamp brackets, see GSDevice::BeginGPUTimer. Each bracket gets
+	// its own disjoint query so the tick frequency stays valid across clock
+	// changes, results are polled in GetGPUTimes without stalling.
+	struct GPUTimerQuery
+	{
+		wil::com_ptr_nothrow<ID3D11Query> disjoint;
+		wil::com_ptr_nothrow<ID3D11Query> begin;
+		wil::com_ptr_nothrow<ID3D11Query> end;
+		int type;
+	};
+
+	std::vector<GPUTimerQuery> m_gpu_timer_pending;
+	std::vector<GPUTimerQuery> m_gpu_timer_unused;
+	int m_gpu_timer_open[GPUTimer_Count]; // index into pending, -1 when closed
+	double m_gpu_times[GPUTimer_Count]; // completed ms per category
+
 	std::unique_ptr<GSTexture> m_font;
 
 protected:
@@ -518,9 +538,17 @@ protected:
 		std::string model, vs, gs, ps, cs;
 	} m_shader;
 
+	// On disk ID3DBlob cache, dxbc is driver independent so the key only
+	// covers the compiler inputs. Empty when disabled.
+	std::string m_shader_cache_dir;
+
 public:
 	GSDevice11();
-	virtual ~GSDevice11() {}
+	virtual ~GSDevice11()
+	{
+		if (m_frame_latency_waitable)
+			CloseHandle(m_frame_latency_waitable);
+	}
 
 	bool SetFeatureLevel(D3D_FEATURE_LEVEL level, bool compat_mode);
 	void GetFeatureLevel(D3D_FEATURE_LEVEL& level) const { level = m_shader.level; }
@@ -530,10 +558,16 @@ public:
 	void Flip();
 	void SetVSync(int vsync) final;
 
+	uint64 GetVRAMSize() final { return m_vram_size; }
+
 	void DrawPrimitive() final;
 	void DrawIndexedPrimitive();
 	void DrawIndexedPrimitive(int offset, int count) final;
 
+	void BeginGPUTimer(int type) final;
+	void EndGPUTimer(int type) final;
+	void GetGPUTimes(double* times) final;
+
 	void ClearRenderTarget(GSTexture* t, const GSVector4& c) final;
 	void ClearRenderTarget(GSTexture* t, uint32 c) final;
 	void ClearDepth(GSTexture* t) final;
@@ -101,7 +101,7 @@ void GSTexture11::Unmap()
 	}
 }
 
-bool GSTexture11::Save(const std::string& fn)
+bool GSTexture11::Save(const std::string& fn, GSPng::Worker* async)
 {
 	D3D11_TEXTURE2D_DESC desc;
 
@@ -193,7 +193,19 @@ bool GSTexture11::Save(const std::string& fn)
 	}
 
 	int compression = theApp.GetConfigI("png_compression_level");
-	bool success = GSPng::Save(format, fn, static_cast<uint8*>(sm.pData), desc.Width, desc.Height, sm.RowPitch, compression);
+	bool success;
+
+	if (async)
+	{
+		// The transaction deep-copies the mapped readback, so the unmap below is
+		// safe and the compression runs on the worker.
+		async->Push(std::make_shared<GSPng::Transaction>(format, fn, static_cast<uint8*>(sm.pData), desc.Width, desc.Height, sm.RowPitch, compression));
+		success = true;
+	}
+	else
+	{
+		success = GSPng::Save(format, fn, static_cast<uint8*>(sm.pData), desc.Width, desc.Height, sm.RowPitch, compression);
+	}
 
 	m_ctx->Unmap(res.get(), 0);
 
@@ -1013,6 +1013,83 @@ bool GSC_XenosagaE3(const GSFrameInfo& fi, int& skip)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Data-driven side of the hack engine.  Rules live in the file named by the
+// crc_hack_rules setting, one per line:
+//
+//   crc=0x2F123E5B tme=1 fbp=0x03d80 tpsm=0x31 skip=48
+//   crc=0x2F123E5B resume=1 tme=1 fbp=0x00000 skip=0
+//
+// Values compare for equality (tme/fbp/fpsm/fbmsk/tbp0/tpsm/tztst); omitted
+// fields are wildcards.  A resume=1 rule is only evaluated while a skip is
+// active, matching the "start skipping / stop skipping" shape of most GSC_
+// functions above.  Lines starting with # are comments.
+static std::vector<GSCrcHackRule> s_crc_rules;
+static bool s_crc_rules_loaded = false;
+
+static void LoadCrcHackRules()
+{
+	if (s_crc_rules_loaded)
+		return;
+
+	s_crc_rules_loaded = true;
+
+	const std::string path = theApp.GetConfigS("crc_hack_rules");
+	if (path.empty())
+		return;
+
+	FILE* f = px_fopen(path, "r");
+	if (!f)
+	{
+		fprintf(stderr, "GSHwHack: failed to open rule file %s\n", path.c_str());
+		return;
+	}
+
+	char line[512];
+	while (fgets(line, sizeof(line), f))
+	{
+		if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+			continue;
+
+		GSCrcHackRule rule = {};
+		rule.skip = -1;
+		bool has_crc = false;
+
+		char key[32];
+		int value;
+		int pos = 0;
+		int len = 0;
+
+		// %i accepts both decimal and 0x-prefixed hex.
+		while (sscanf(line + pos, " %31[a-z0-9_]=%i%n", key, &value, &len) == 2)
+		{
+			pos += len;
+
+			if (strcmp(key, "crc") == 0)         { rule.crc = (uint32)value; has_crc = true; }
+			else if (strcmp(key, "resume") == 0) { rule.while_skipping = value != 0; }
+			else if (strcmp(key, "skip") == 0)   { rule.skip = value; }
+			else if (strcmp(key, "tme") == 0)    { rule.care_tme = true; rule.tme = value != 0; }
+			else if (strcmp(key, "fbp") == 0)    { rule.care_fbp = true; rule.fbp = (uint32)value; }
+			else if (strcmp(key, "fpsm") == 0)   { rule.care_fpsm = true; rule.fpsm = (uint32)value; }
+			else if (strcmp(key, "fbmsk") == 0)  { rule.care_fbmsk = true; rule.fbmsk = (uint32)value; }
+			else if (strcmp(key, "tbp0") == 0)   { rule.care_tbp0 = true; rule.tbp0 = (uint32)value; }
+			else if (strcmp(key, "tpsm") == 0)   { rule.care_tpsm = true; rule.tpsm = (uint32)value; }
+			else if (strcmp(key, "tztst") == 0)  { rule.care_tztst = true; rule.tztst = (uint32)value; }
+			else
+				fprintf(stderr, "GSHwHack: unknown rule key '%s'\n", key);
+		}
+
+		if (has_crc && rule.skip >= 0)
+			s_crc_rules.push_back(rule);
+		else
+			fprintf(stderr, "GSHwHack: rule needs at least crc= and skip=, ignored: %s", line);
+	}
+
+	fclose(f);
+
+	if (!s_crc_rules.empty())
+		printf("GSHwHack: loaded %d crc hack rules from %s\n", (int)s_crc_rules.size(), path.c_str());
+}
+
 void GSState::SetupCrcHack()
 {
 	GetSkipCount lut[CRC::TitleCount];
@@ -1114,6 +1191,26 @@ void GSState::SetupCrcHack()
 
 	m_gsc = lut[m_game.title];
 	g_crc_region = m_game.region;
+
+	// Compile the file rules for this game into a flat decision list.  When any
+	// exist they take precedence over the built-in hook, so a shipped fix can be
+	// corrected (or a new title covered) without touching the binary.
+	LoadCrcHackRules();
+
+	m_gsc_rules.clear();
+	for (const GSCrcHackRule& rule : s_crc_rules)
+	{
+		if (rule.crc == m_crc)
+			m_gsc_rules.push_back(rule);
+	}
+
+	if (!m_gsc_rules.empty())
+		printf("GSHwHack: %d rules active for crc 0x%08X (built-in hook %s)\n",
+			(int)m_gsc_rules.size(), m_crc, m_gsc ? "overridden" : "none");
+
+	// The one branch IsBadFrame tests per draw; everything below it only runs for
+	// the few titles that actually have hacks bound.
+	m_crc_hacks_active = (m_gsc != NULL) || !m_gsc_rules.empty() || (m_userhacks_skipdraw > 0);
 }
 
 #undef Dx_and_OGL
@@ -1122,6 +1219,11 @@ void GSState::SetupCrcHack()
 
 bool GSState::IsBadFrame()
 {
+	// Fast path: no hack bound to this title and no manual skipdraw -- the common
+	// case for the vast majority of games costs this single branch.
+	if (!m_crc_hacks_active && m_skip == 0)
+		return false;
+
 	GSFrameInfo fi;
 
 	fi.FBP = m_context->FRAME.Block();
@@ -1132,7 +1234,20 @@ bool GSState::IsBadFrame()
 	fi.TPSM = m_context->TEX0.PSM;
 	fi.TZTST = m_context->TEST.ZTST;
 
-	if (m_gsc && !m_gsc(fi, m_skip))
+	if (!m_gsc_rules.empty())
+	{
+		const bool skipping = m_skip != 0;
+
+		for (const GSCrcHackRule& rule : m_gsc_rules)
+		{
+			if (rule.while_skipping == skipping && rule.Matches(fi))
+			{
+				m_skip = rule.skip;
+				break;
+			}
+		}
+	}
+	else if (m_gsc && !m_gsc(fi, m_skip))
 	{
 		return false;
 	}
@@ -1600,7 +1600,11 @@ void GSRendererHW::Draw()
 
 	//
 
-	DrawPrims(rt_tex, ds_tex, m_src);
+	{
+		GPUTimerScope gts(m_dev, GSDevice::GPUTimer_Draw);
+
+		DrawPrims(rt_tex, ds_tex, m_src);
+	}
 
 	//
 
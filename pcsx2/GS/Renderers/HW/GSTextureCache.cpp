@@ -17,6 +17,7 @@
 #include "GSTextureCache.h"
 #include "GSRendererHW.h"
 #include "GS/GSUtil.h"
+#include "common/MemoryAccount.h"
 
 bool GSTextureCache::m_disable_partial_invalidation = false;
 bool GSTextureCache::m_wrap_gs_mem = false;
@@ -47,6 +48,7 @@ GSTextureCache::GSTextureCache(GSRenderer* r)
 	}
 
 	m_paltex = theApp.GetConfigB("paltex");
+	m_budget = (u64)theApp.GetConfigI("texture_cache_budget_mb") * _1mb;
 	m_crc_hack_level = theApp.GetConfigT<CRCHackLevel>("crc_hack_level");
 	if (m_crc_hack_level == CRCHackLevel::Automatic)
 		m_crc_hack_level = GSUtil::GetRecommendedCRCHackLevel(theApp.GetCurrentRendererType());
@@ -56,6 +58,11 @@ GSTextureCache::GSTextureCache(GSRenderer* r)
 	// Test: onimusha 3 PAL 60Hz
 	m_temp = (uint8*)_aligned_malloc(9 * 1024 * 1024, 32);
 
+	// the worker unswizzles queued source writes into m_temp while the GS
+	// thread hands the previous rect to the driver, see Source::Flush
+
+	m_convert.reset(new ConvertQueue([](ConvertJob& job) { job.src->ConvertWrite(job.index, job.dst, job.pitch); }));
+
 	m_texture_inside_rt_cache.reserve(m_texture_inside_rt_cache_size);
 }
 
@@ -65,6 +72,8 @@ GSTextureCache::~GSTextureCache()
 
 	m_texture_inside_rt_cache.clear();
 
+	m_convert.reset(); // before m_temp, the worker stages into it
+
 	_aligned_free(m_temp);
 }
 
@@ -158,12 +167,42 @@ GSTextureCache::Source* GSTextureCache::LookupDepthSource(const GIFRegTEX0& TEX0
 
 	if (dst)
 	{
+		// Reuse the shared source built by a previous draw of the frame when
+		// it still wraps the same target texture. Depth reading effects
+		// typically sample the buffer once per channel, rebuilding the source
+		// (and rehashing it) for each of those draws is pure overhead since
+		// the texture is shared, its content is always current.
+		auto range = m_src.m_exact.equal_range(SourceMap::ExactKey(TEX0));
+
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			Source* s = it->second;
+
+			if (s->m_shared_texture && s->m_texture == dst->m_texture)
+			{
+				GL_CACHE("TC depth: shared src hit: %d (0x%x, %s)",
+					s->m_texture ? s->m_texture->GetID() : 0,
+					TEX0.TBP0, psm_str(psm));
+
+				// the target can have grown since the source was created
+				s->m_valid_rect = dst->m_valid;
+				s->m_end_block = dst->m_end_block;
+
+				if (palette && s->m_palette && !s->ClutMatch({m_renderer->m_mem.m_clut, psm_s.pal}))
+				{
+					AttachPaletteToSource(s, psm_s.pal, true);
+				}
+
+				return s;
+			}
+		}
+
 		GL_CACHE("TC depth: dst %s hit: %d (0x%x, %s)", to_string(dst->m_type),
 			dst->m_texture ? dst->m_texture->GetID() : 0,
 			TEX0.TBP0, psm_str(psm));
 
 		// Create a shared texture source
-		src = new Source(m_renderer, TEX0, TEXA, m_temp, true);
+		src = new Source(m_renderer, TEX0, TEXA, m_temp, NULL, true);
 		src->m_texture = dst->m_texture;
 		src->m_shared_texture = true;
 		src->m_target = true; // So renderer can check if a conversion is required
@@ -173,16 +212,16 @@ GSTextureCache::Source* GSTextureCache::LookupDepthSource(const GIFRegTEX0& TEX0
 		src->m_valid_rect = dst->m_valid;
 		src->m_end_block = dst->m_end_block;
 
-		// Insert the texture in the hash set to keep track of it. But don't bother with
-		// texture cache list. It means that a new Source is created everytime we need it.
-		// If it is too expensive, one could cut memory allocation in Source constructor for this
-		// use case.
+		// Insert the texture in the hash set (and the exact lookup map so the
+		// next draw of the frame finds it again, see above) but don't bother
+		// with the texture cache list, IncAge throws shared sources away.
 		if (palette)
 		{
 			AttachPaletteToSource(src, psm_s.pal, true);
 		}
 
 		m_src.m_surfaces.insert(src);
+		src->m_exact_it = m_src.m_exact.emplace(SourceMap::ExactKey(TEX0), src);
 	}
 	else
 	{
@@ -228,13 +267,16 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 
 	Source* src = NULL;
 
-	auto& m = m_src.m_map[TEX0.TBP0 >> 5];
+	auto range = m_src.m_exact.equal_range(SourceMap::ExactKey(TEX0));
 
-	for (auto i = m.begin(); i != m.end(); ++i)
+	for (auto i = range.first; i != range.second; ++i)
 	{
-		Source* s = *i;
+		Source* s = i->second;
 
-		if (((TEX0.u32[0] ^ s->m_TEX0.u32[0]) | ((TEX0.u32[1] ^ s->m_TEX0.u32[1]) & 3)) != 0) // TBP0 TBW PSM TW TH
+		// Shared depth sources skip the page lists so memory writes don't
+		// invalidate them. Only LookupDepthSource may hand them out, it
+		// revalidates the underlying target on every draw.
+		if (s->m_shared_texture)
 			continue;
 
 		// Target are converted (AEM & palette) on the fly by the GPU. They don't need extra check
@@ -252,8 +294,6 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 				continue;
 		}
 
-		m.MoveFront(i.Index());
-
 		src = s;
 
 		break;
@@ -306,11 +346,14 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 					// 2/ even with upscaling
 					// 3/ for both Direct3D and OpenGL
 					if (m_cpu_fb_conversion && (psm == PSM_PSMT4 || psm == PSM_PSMT8))
+					{
 						// Forces 4-bit and 8-bit frame buffer conversion to be done on the CPU instead of the GPU, but performance will be slower.
 						// There is no dedicated shader to handle 4-bit conversion (Stuntman has been confirmed to use 4-bit).
 						// Direct3D10/11 and OpenGL support 8-bit fb conversion but don't render some corner cases properly (Harry Potter games).
 						// The hack can fix glitches in some games.
 						Read(t, t->m_valid);
+						FlushReads(); // the source is built from local memory right away
+					}
 					else
 						dst = t;
 
@@ -1065,6 +1108,8 @@ void GSTextureCache::InvalidateLocalMem(GSOffset* off, const GSVector4i& r)
 						Read(t, r.rintersect(t->m_valid));
 				}
 			}
+
+			FlushReads();
 		}
 		return;
 	}
@@ -1174,6 +1219,8 @@ void GSTextureCache::InvalidateLocalMem(GSOffset* off, const GSVector4i& r)
 	//	Read(rt2, GSVector4i(r.left, r.top + ymin, r.right, r.bottom + ymin));
 	//}
 
+	// the caller reads local memory as soon as we return
+	FlushReads();
 
 	// TODO: ds
 }
@@ -1219,8 +1266,10 @@ void GSTextureCache::IncAge()
 
 		if (s->m_shared_texture)
 		{
-			// Shared textures are temporary only added in the hash set but not in the texture
-			// cache list therefore you can't use RemoveAt
+			// Shared textures are temporary only added in the hash set (and
+			// the exact map) but not in the texture cache list therefore you
+			// can't use RemoveAt
+			m_src.m_exact.erase(s->m_exact_it);
 			i = m_src.m_surfaces.erase(i);
 			delete s;
 		}
@@ -1274,13 +1323,95 @@ void GSTextureCache::IncAge()
 			}
 		}
 	}
+
+	// texture_cache_budget_mb 0 means size the budget from the device: half
+	// of what the backend reports as usable for textures, leaving the other
+	// half to the surface pool, merge/interlace buffers and the swapchain.
+	// Resolved lazily because the device doesn't exist yet when the cache is
+	// constructed; backends that can't tell (GetVRAMSize() == 0) keep the
+	// cache unbounded as before.
+	if (m_budget == 0)
+	{
+		if (u64 vram = m_renderer->m_dev->GetVRAMSize())
+		{
+			m_budget = vram / 2;
+			printf("TC: budget set to %lluMB (half of %lluMB reported VRAM)\n",
+				(unsigned long long)(m_budget >> 20), (unsigned long long)(vram >> 20));
+		}
+	}
+
+	// Tally what the cache holds and enforce the budget.  Targets are the
+	// unbounded consumers -- their maxage of 400 frames lets hundreds of
+	// upscaled render targets pile up -- so eviction drops the least recently
+	// used target that wasn't touched this frame.  Sources age out within a
+	// few frames on their own.
+	u64 usage = 0;
+
+	for (Source* s : m_src.m_surfaces)
+	{
+		if (s->m_texture)
+			usage += s->m_texture->GetMemUsage();
+	}
+
+	for (int type = 0; type < 2; type++)
+	{
+		for (auto i = m_dst[type].begin(); i != m_dst[type].end(); ++i)
+		{
+			Target* t = *i;
+			if (t->m_texture)
+				usage += t->m_texture->GetMemUsage();
+		}
+	}
+
+	while (m_budget && usage > m_budget)
+	{
+		Target* victim = NULL;
+		int victim_type = 0;
+
+		for (int type = 0; type < 2; type++)
+		{
+			for (auto i = m_dst[type].begin(); i != m_dst[type].end(); ++i)
+			{
+				Target* t = *i;
+
+				if (t->m_age > 0 && (victim == NULL || t->m_age > victim->m_age))
+				{
+					victim = t;
+					victim_type = type;
+				}
+			}
+		}
+
+		if (victim == NULL)
+			break;
+
+		auto& list = m_dst[victim_type];
+		for (auto i = list.begin(); i != list.end(); ++i)
+		{
+			if (*i == victim)
+			{
+				list.erase(i);
+				break;
+			}
+		}
+
+		GL_CACHE("TC: Remove Target(%s): %d (0x%x) due to budget", to_string(victim_type),
+			victim->m_texture ? victim->m_texture->GetID() : 0,
+			victim->m_TEX0.TBP0);
+
+		if (victim->m_texture)
+			usage -= victim->m_texture->GetMemUsage();
+		delete victim;
+	}
+
+	MemAccount::Set(MemAccount::Id_GSTextureCache, usage);
 }
 
 //Fixme: Several issues in here. Not handling depth stencil, pitch conversion doesnt work.
 GSTextureCache::Source* GSTextureCache::CreateSource(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, Target* dst, bool half_right, int x_offset, int y_offset)
 {
 	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[TEX0.PSM];
-	Source* src = new Source(m_renderer, TEX0, TEXA, m_temp);
+	Source* src = new Source(m_renderer, TEX0, TEXA, m_temp, m_convert.get());
 
 	int tw = 1 << TEX0.TW;
 	int th = 1 << TEX0.TH;
@@ -1727,8 +1858,10 @@ bool GSTextureCache::Surface::Overlaps(uint32 bp, uint32 bw, uint32 psm, const G
 
 // GSTextureCache::Source
 
-GSTextureCache::Source::Source(GSRenderer* r, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, uint8* temp, bool dummy_container)
+GSTextureCache::Source::Source(GSRenderer* r, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, uint8* temp, ConvertQueue* convert, bool dummy_container)
 	: Surface(r, temp)
+	, m_convert(convert)
+	, m_convert_done(0)
 	, m_palette_obj(nullptr)
 	, m_palette(nullptr)
 	, m_valid_rect(0, 0)
@@ -1929,6 +2062,8 @@ void GSTextureCache::Source::Flush(uint32 count, int layer)
 	// these into an 8 bit format while the D3D surfaces are 32 bit.
 	// However the function is never called for these cases.  This is just for information
 	// should someone wish to use this function for these cases later.
+	GPUTimerScope gts(m_renderer->m_dev, GSDevice::GPUTimer_Upload);
+
 	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[m_TEX0.PSM];
 
 	int tw = 1 << m_TEX0.TW;
@@ -1952,13 +2087,61 @@ void GSTextureCache::Source::Flush(uint32 count, int layer)
 
 	uint8* buff = m_temp;
 
+	if (m_convert != NULL && count > 1)
+	{
+		// Unswizzle one rect ahead of the uploads on the worker, so the
+		// driver copy of rect i overlaps with the conversion of rect i + 1.
+		// The wait below doubles as the fence, the draw that consumes the
+		// texture cannot start before Flush returns.
+
+		const uint32 slice = 4 * 1024 * 1024; // half of m_temp with headroom, see the ctor of the cache
+
+		uint32 largest = 0;
+
+		for (uint32 i = 0; i < count; i++)
+		{
+			largest = std::max<uint32>(largest, pitch * m_write.rect[i].height());
+		}
+
+		if (largest <= slice)
+		{
+			m_convert_done.store(0, std::memory_order_relaxed);
+
+			m_convert->Push({this, 0, buff, pitch});
+
+			for (uint32 i = 0; i < count; i++)
+			{
+				if (i + 1 < count)
+				{
+					// the slice of rect i + 1 is free again, rect i - 1 has
+					// already been handed to the driver
+
+					m_convert->Push({this, i + 1, buff + ((i + 1) & 1) * slice, pitch});
+				}
+
+				while (m_convert_done.load(std::memory_order_acquire) <= i)
+				{
+					std::this_thread::yield();
+				}
+
+				m_texture->Update(m_write.rect[i].rintersect(tr), buff + (i & 1) * slice, pitch, layer);
+			}
+
+			m_write.count -= count;
+
+			ASSERT(m_write.count == 0); // Write only ever flushes a single rect early, nothing left to move down
+
+			return;
+		}
+	}
+
 	for (uint32 i = 0; i < count; i++)
 	{
 		GSVector4i r = m_write.rect[i];
 
 		if ((r > tr).mask() & 0xff00)
 		{
-			(mem.*rtx)(off, r, buff, pitch, m_TEXA);
+			mem.ReadTextureBands(rtx, off, r, buff, pitch, m_TEXA);
 
 			m_texture->Update(r.rintersect(tr), buff, pitch, layer);
 		}
@@ -1968,13 +2151,13 @@ void GSTextureCache::Source::Flush(uint32 count, int layer)
 
 			if (m_texture->Map(m, &r, layer))
 			{
-				(mem.*rtx)(off, r, m.bits, m.pitch, m_TEXA);
+				mem.ReadTextureBands(rtx, off, r, m.bits, m.pitch, m_TEXA);
 
 				m_texture->Unmap();
 			}
 			else
 			{
-				(mem.*rtx)(off, r, buff, pitch, m_TEXA);
+				mem.ReadTextureBands(rtx, off, r, buff, pitch, m_TEXA);
 
 				m_texture->Update(r, buff, pitch, layer);
 			}
@@ -1990,6 +2173,20 @@ void GSTextureCache::Source::Flush(uint32 count, int layer)
 	m_write.count -= count;
 }
 
+// Runs on the conversion worker, see the ctor of the cache. Only ever called
+// between the push and the matching wait in Flush, so the context offset,
+// TEXA and the write rects cannot change under it.
+void GSTextureCache::Source::ConvertWrite(uint32 index, uint8* dst, int pitch)
+{
+	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[m_TEX0.PSM];
+
+	GSLocalMemory::readTexture rtx = m_palette ? psm.rtxP : psm.rtx;
+
+	m_renderer->m_mem.ReadTextureBands(rtx, m_renderer->m_context->offset.tex, m_write.rect[index], dst, pitch, m_TEXA);
+
+	m_convert_done.fetch_add(1, std::memory_order_release);
+}
+
 bool GSTextureCache::Source::ClutMatch(PaletteKey palette_key)
 {
 	return PaletteKeyEqual()(palette_key, m_palette_obj->GetPaletteKey());
@@ -2014,13 +2211,6 @@ void GSTextureCache::Target::Update()
 {
 	Surface::UpdateAge();
 
-	// FIXME: the union of the rects may also update wrong parts of the render target (but a lot faster :)
-	// GH: it must be doable
-	// 1/ rescale the new t to the good size
-	// 2/ copy each rectangle (rescale the rectangle) (use CopyRect or multiple vertex)
-	// Alternate
-	// 1/ uses multiple vertex rectangle
-
 	GSVector2i t_size = default_rt_size;
 
 	// Ensure buffer width is at least of the minimum required value.
@@ -2029,9 +2219,13 @@ void GSTextureCache::Target::Update()
 	int buffer_width = m_TEX0.TBW << 6;
 	t_size.x = std::max(buffer_width, t_size.x);
 
-	GSVector4i r = m_dirty.GetDirtyRectAndClear(m_TEX0, t_size);
+	// Each dirty rect is uploaded on its own, the old union of all of them
+	// re-read (and overwrote) everything in between, costing megabytes of
+	// unswizzling per frame on games that stream textures through the target
+
+	const std::vector<GSVector4i> rects = m_dirty.GetDirtyRectsAndClear(m_TEX0, t_size);
 
-	if (r.rempty())
+	if (rects.empty())
 		return;
 
 	// No handling please
@@ -2057,54 +2251,59 @@ void GSTextureCache::Target::Update()
 		return;
 	}
 
-	int w = r.width();
-	int h = r.height();
-
 	GIFRegTEXA TEXA;
 
 	TEXA.AEM = 1;
 	TEXA.TA0 = 0;
 	TEXA.TA1 = 0x80;
 
-	GSTexture* t = m_renderer->m_dev->CreateTexture(w, h);
-
 	const GSOffset* off = m_renderer->m_mem.GetOffset(m_TEX0.TBP0, m_TEX0.TBW, m_TEX0.PSM);
 
-	GSTexture::GSMap m;
+	GPUTimerScope gts(m_renderer->m_dev, GSDevice::GPUTimer_Upload);
 
-	if (t->Map(m))
+	for (const GSVector4i& r : rects)
 	{
-		m_renderer->m_mem.ReadTexture(off, r, m.bits, m.pitch, TEXA);
+		int w = r.width();
+		int h = r.height();
 
-		t->Unmap();
-	}
-	else
-	{
-		int pitch = ((w + 3) & ~3) * 4;
+		GSTexture* t = m_renderer->m_dev->CreateTexture(w, h);
 
-		m_renderer->m_mem.ReadTexture(off, r, m_temp, pitch, TEXA);
+		GSTexture::GSMap m;
 
-		t->Update(r.rsize(), m_temp, pitch);
-	}
+		if (t->Map(m))
+		{
+			m_renderer->m_mem.ReadTexture(off, r, m.bits, m.pitch, TEXA);
 
-	// m_renderer->m_perfmon.Put(GSPerfMon::Unswizzle, w * h * 4);
+			t->Unmap();
+		}
+		else
+		{
+			int pitch = ((w + 3) & ~3) * 4;
 
-	// Copy the new GS memory content into the destination texture.
-	if (m_type == RenderTarget)
-	{
-		GL_INS("ERROR: Update RenderTarget 0x%x bw:%d (%d,%d => %d,%d)", m_TEX0.TBP0, m_TEX0.TBW, r.x, r.y, r.z, r.w);
+			m_renderer->m_mem.ReadTexture(off, r, m_temp, pitch, TEXA);
 
-		m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy());
-	}
-	else if (m_type == DepthStencil)
-	{
-		GL_INS("ERROR: Update DepthStencil 0x%x", m_TEX0.TBP0);
+			t->Update(r.rsize(), m_temp, pitch);
+		}
 
-		// FIXME linear or not?
-		m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy(), ShaderConvert_RGBA8_TO_FLOAT32);
-	}
+		// m_renderer->m_perfmon.Put(GSPerfMon::Unswizzle, w * h * 4);
 
-	m_renderer->m_dev->Recycle(t);
+		// Copy the new GS memory content into the destination texture.
+		if (m_type == RenderTarget)
+		{
+			GL_INS("ERROR: Update RenderTarget 0x%x bw:%d (%d,%d => %d,%d)", m_TEX0.TBP0, m_TEX0.TBW, r.x, r.y, r.z, r.w);
+
+			m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy());
+		}
+		else if (m_type == DepthStencil)
+		{
+			GL_INS("ERROR: Update DepthStencil 0x%x", m_TEX0.TBP0);
+
+			// FIXME linear or not?
+			m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy(), ShaderConvert_RGBA8_TO_FLOAT32);
+		}
+
+		m_renderer->m_dev->Recycle(t);
+	}
 }
 
 void GSTextureCache::Target::UpdateValidity(const GSVector4i& rect)
@@ -2123,6 +2322,8 @@ void GSTextureCache::SourceMap::Add(Source* s, const GIFRegTEX0& TEX0, GSOffset*
 {
 	m_surfaces.insert(s);
 
+	s->m_exact_it = m_exact.emplace(ExactKey(TEX0), s);
+
 	if (s->m_target)
 	{
 		// TODO
@@ -2165,6 +2366,8 @@ void GSTextureCache::SourceMap::RemoveAll()
 
 	m_surfaces.clear();
 
+	m_exact.clear();
+
 	for (size_t i = 0; i < countof(m_map); i++)
 	{
 		m_map[i].clear();
@@ -2175,6 +2378,8 @@ void GSTextureCache::SourceMap::RemoveAt(Source* s)
 {
 	m_surfaces.erase(s);
 
+	m_exact.erase(s->m_exact_it); // shared textures never get here, see IncAge
+
 	GL_CACHE("TC: Remove Src Texture: %d (0x%x)",
 			 s->m_texture ? s->m_texture->GetID() : 0,
 			 s->m_TEX0.TBP0);
@@ -97,6 +97,21 @@ public:
 		bool operator()(const PaletteKey& lhs, const PaletteKey& rhs) const;
 	};
 
+	class Source;
+
+	// One queued unswizzle of a write rect into a staging slice, run on the
+	// conversion worker while the GS thread hands the previous rect to the
+	// driver. See Source::Flush.
+	struct ConvertJob
+	{
+		Source* src;
+		uint32 index; // into Source::m_write.rect
+		uint8* dst;
+		int pitch;
+	};
+
+	typedef GSJobQueue<ConvertJob, 64> ConvertQueue;
+
 	class Source : public Surface
 	{
 		struct
@@ -105,6 +120,9 @@ public:
 			uint32 count;
 		} m_write;
 
+		ConvertQueue* m_convert; // owned by the cache, NULL for dummy containers
+		std::atomic<uint32> m_convert_done; // rects finished by the worker since the last Flush
+
 		void Write(const GSVector4i& r, int layer);
 		void Flush(uint32 count, int layer);
 
@@ -125,12 +143,16 @@ public:
 		GIFRegTEX0 m_layer_TEX0[7]; // Detect already loaded value
 		// Keep a GSTextureCache::SourceMap::m_map iterator to allow fast erase
 		std::array<uint16, MAX_PAGES> m_erase_it;
+		// Position in GSTextureCache::SourceMap::m_exact, also for fast erase
+		std::unordered_multimap<uint64, Source*>::iterator m_exact_it;
 		uint32* m_pages_as_bit;
 
 	public:
-		Source(GSRenderer* r, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, uint8* temp, bool dummy_container = false);
+		Source(GSRenderer* r, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, uint8* temp, ConvertQueue* convert, bool dummy_container = false);
 		virtual ~Source();
 
+		void ConvertWrite(uint32 index, uint8* dst, int pitch);
+
 		void Update(const GSVector4i& rect, int layer = 0);
 		void UpdateLayer(const GIFRegTEX0& TEX0, const GSVector4i& rect, int layer = 0);
 
@@ -180,9 +202,18 @@ public:
 	public:
 		std::unordered_set<Source*> m_surfaces;
 		std::array<FastList<Source*>, MAX_PAGES> m_map;
+		// Exact TEX0 matches in one hash probe, the per page lists are only
+		// walked by the invalidation code. Several sources may share a TEX0
+		// and differ by palette or TEXA, hence the multimap.
+		std::unordered_multimap<uint64, Source*> m_exact;
 		uint32 m_pages[16]; // bitmap of all pages
 		bool m_used;
 
+		static uint64 ExactKey(const GIFRegTEX0& TEX0)
+		{
+			return TEX0.u32[0] | ((uint64)(TEX0.u32[1] & 3) << 32); // TBP0 TBW PSM TW TH
+		}
+
 		SourceMap()
 			: m_used(false)
 		{
@@ -214,8 +245,13 @@ protected:
 	SourceMap m_src;
 	FastList<Target*> m_dst[2];
 	bool m_paltex;
+	// Cache memory budget in bytes. An explicit texture_cache_budget_mb wins;
+	// 0 (the default) sizes it from the VRAM the device reports once the
+	// device is up (see IncAge); a negative setting effectively disables it.
+	u64 m_budget;
 	bool m_preload_frame;
 	uint8* m_temp;
+	std::unique_ptr<ConvertQueue> m_convert; // unswizzles source writes one rect ahead of the uploads, see Source::Flush
 	bool m_can_convert_depth;
 	bool m_cpu_fb_conversion;
 	CRCHackLevel m_crc_hack_level;
@@ -238,6 +274,9 @@ public:
 	virtual ~GSTextureCache();
 	virtual void Read(Target* t, const GSVector4i& r) = 0;
 	virtual void Read(Source* t, const GSVector4i& r) = 0;
+	// Devices that queue Read transfers asynchronously finish them here,
+	// called before anyone looks at the local memory the reads write to.
+	virtual void FlushReads() {}
 	void RemoveAll();
 	void RemovePartial();
 
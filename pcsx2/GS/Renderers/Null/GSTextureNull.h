@@ -34,5 +34,5 @@ public:
 	bool Update(const GSVector4i& r, const void* data, int pitch, int layer = 0) { return true; }
 	bool Map(GSMap& m, const GSVector4i* r = NULL, int layer = 0) { return false; }
 	void Unmap() {}
-	bool Save(const std::string& fn) { return false; }
+	bool Save(const std::string& fn, GSPng::Worker* async = nullptr) { return false; }
 };
@@ -170,6 +170,7 @@ namespace GLLoader
 	bool buggy_sso_dual_src = false;
 
 	bool found_geometry_shader = true; // we require GL3.3 so geometry must be supported by default
+	bool found_GL_ARB_get_program_binary = false;
 	bool found_GL_ARB_clear_texture = false;
 	bool found_GL_ARB_get_texture_sub_image = false; // Not yet used
 	// DX11 GPU
@@ -323,6 +324,8 @@ namespace GLLoader
 			optional("GL_ARB_sparse_texture2");
 			// GL4.0
 			found_GL_ARB_gpu_shader5 = optional("GL_ARB_gpu_shader5");
+			// GL4.1
+			found_GL_ARB_get_program_binary = optional("GL_ARB_get_program_binary");
 			// GL4.2
 			found_GL_ARB_shader_image_load_store = optional("GL_ARB_shader_image_load_store");
 			// GL4.3
@@ -52,6 +52,8 @@ GSDeviceOGL::GSDeviceOGL()
 	, m_fbo(0)
 	, m_fbo_read(0)
 	, m_va(NULL)
+	, m_ps_sel_prev((uint64)-1)
+	, m_ps_prev(0)
 	, m_apitrace(0)
 	, m_palette_ss(0)
 	, m_vs_cb(NULL)
@@ -67,6 +69,13 @@ GSDeviceOGL::GSDeviceOGL()
 	memset(&m_shadeboost, 0, sizeof(m_shadeboost));
 	memset(&m_om_dss, 0, sizeof(m_om_dss));
 	memset(&m_profiler, 0, sizeof(m_profiler));
+
+	for (int i = 0; i < GPUTimer_Count; i++)
+	{
+		m_gpu_timer.open[i] = -1;
+		m_gpu_timer.times[i] = 0.0;
+	}
+
 	GLState::Clear();
 
 	m_mipmap = theApp.GetConfigI("mipmap");
@@ -131,6 +140,12 @@ GSDeviceOGL::~GSDeviceOGL()
 	glDeleteFramebuffers(1, &m_fbo);
 	glDeleteFramebuffers(1, &m_fbo_read);
 
+	for (const GPUTimerQuery& q : m_gpu_timer.pending)
+		glDeleteQueries(2, q.query);
+
+	if (!m_gpu_timer.unused.empty())
+		glDeleteQueries(m_gpu_timer.unused.size(), m_gpu_timer.unused.data());
+
 	// Delete HW FX
 	delete m_vs_cb;
 	delete m_ps_cb;
@@ -237,6 +252,105 @@ void GSDeviceOGL::GenerateProfilerData()
 	}
 }
 
+void GSDeviceOGL::BeginGPUTimer(int type)
+{
+	if (glQueryCounter == NULL)
+		return;
+
+	ASSERT(m_gpu_timer.open[type] < 0); // brackets of one category don't nest
+
+	GPUTimerQuery q;
+	q.type = type;
+
+	for (GLuint& id : q.query)
+	{
+		if (!m_gpu_timer.unused.empty())
+		{
+			id = m_gpu_timer.unused.back();
+			m_gpu_timer.unused.pop_back();
+		}
+		else
+		{
+			glGenQueries(1, &id);
+		}
+	}
+
+	glQueryCounter(q.query[0], GL_TIMESTAMP);
+
+	m_gpu_timer.open[type] = (int)m_gpu_timer.pending.size();
+	m_gpu_timer.pending.push_back(q);
+}
+
+void GSDeviceOGL::EndGPUTimer(int type)
+{
+	const int i = glQueryCounter != NULL ? m_gpu_timer.open[type] : -1;
+
+	if (i < 0)
+		return;
+
+	glQueryCounter(m_gpu_timer.pending[i].query[1], GL_TIMESTAMP);
+
+	m_gpu_timer.open[type] = -1;
+}
+
+void GSDeviceOGL::GetGPUTimes(double* times)
+{
+	// Queries complete in submission order, stop at the first one the GPU
+	// hasn't reached yet and pick it up on the next frame.
+
+	size_t done = 0;
+
+	while (done < m_gpu_timer.pending.size())
+	{
+		const GPUTimerQuery& q = m_gpu_timer.pending[done];
+
+		bool open = false;
+
+		for (int t = 0; t < GPUTimer_Count; t++)
+			open |= m_gpu_timer.open[t] == (int)done;
+
+		if (open)
+			break;
+
+		GLuint available = 0;
+
+		glGetQueryObjectuiv(q.query[1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (!available)
+			break;
+
+		GLuint64 t0 = 0;
+		GLuint64 t1 = 0;
+
+		glGetQueryObjectui64v(q.query[0], GL_QUERY_RESULT, &t0);
+		glGetQueryObjectui64v(q.query[1], GL_QUERY_RESULT, &t1);
+
+		m_gpu_timer.times[q.type] += (double)(t1 - t0) / 1000000.0;
+
+		m_gpu_timer.unused.push_back(q.query[0]);
+		m_gpu_timer.unused.push_back(q.query[1]);
+
+		done++;
+	}
+
+	if (done > 0)
+	{
+		m_gpu_timer.pending.erase(m_gpu_timer.pending.begin(), m_gpu_timer.pending.begin() + done);
+
+		for (int t = 0; t < GPUTimer_Count; t++)
+		{
+			if (m_gpu_timer.open[t] >= 0)
+				m_gpu_timer.open[t] -= (int)done;
+		}
+	}
+
+	for (int t = 0; t < GPUTimer_Count; t++)
+	{
+		times[t] = m_gpu_timer.times[t];
+		m_gpu_timer.times[t] = 0.0;
+	}
+}
+
 GSTexture* GSDeviceOGL::CreateSurface(int type, int w, int h, int fmt)
 {
 	GL_PUSH("Create surface");
@@ -476,7 +590,8 @@ bool GSDeviceOGL::Create(const std::shared_ptr<GSWnd>& wnd)
 		const int ShadeBoost_Saturation = std::max(0, std::min(theApp.GetConfigI("ShadeBoost_Saturation"), 100));
 		std::string shade_macro = format("#define SB_SATURATION %d.0\n", ShadeBoost_Saturation)
 			+ format("#define SB_BRIGHTNESS %d.0\n", ShadeBoost_Brightness)
-			+ format("#define SB_CONTRAST %d.0\n", ShadeBoost_Contrast);
+			+ format("#define SB_CONTRAST %d.0\n", ShadeBoost_Contrast)
+			+ format("#define SB_LUMA_ALPHA %d\n", m_sb_luma ? 1 : 0);
 
 		theApp.LoadResource(IDR_SHADEBOOST_GLSL, shader);
 
@@ -573,6 +688,8 @@ bool GSDeviceOGL::Create(const std::shared_ptr<GSWnd>& wnd)
 
 	fprintf(stdout, "Available VRAM/RAM:%lldMB for textures\n", GLState::available_vram >> 20u);
 
+	m_vram_size = (uint64)std::max<int64>(GLState::available_vram, 0);
+
 	// ****************************************************************
 	// Texture Font (OSD)
 	// ****************************************************************
@@ -1929,17 +2046,30 @@ void GSDeviceOGL::SetupCBMisc(const GSVector4i& channel)
 
 void GSDeviceOGL::SetupPipeline(const VSSelector& vsel, const GSSelector& gsel, const PSSelector& psel)
 {
-	auto i = m_ps.find(psel);
 	GLuint ps;
 
-	if (i == m_ps.end())
+	if (psel.key == m_ps_sel_prev)
 	{
-		ps = CompilePS(psel);
-		m_ps[psel] = ps;
+		// Same fragment shader as the previous draw, which is by far the
+		// most common case (DATE and colclip passes rebind it too).
+		ps = m_ps_prev;
 	}
 	else
 	{
-		ps = i->second;
+		auto i = m_ps.find(psel);
+
+		if (i == m_ps.end())
+		{
+			ps = CompilePS(psel);
+			m_ps[psel] = ps;
+		}
+		else
+		{
+			ps = i->second;
+		}
+
+		m_ps_sel_prev = psel.key;
+		m_ps_prev = ps;
 	}
 
 	{
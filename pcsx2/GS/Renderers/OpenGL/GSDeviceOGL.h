@@ -536,11 +536,34 @@ private:
 		GLuint timer() { return timer_query[last_query]; }
 	} m_profiler;
 
+	uint64 m_vram_size = 0; // see GetVRAMSize
+
+	// Generic GPU timestamp brackets, see GSDevice::BeginGPUTimer. Unlike
+	// m_profiler these are always on, results are polled in GetGPUTimes
+	// without ever stalling on the query.
+	struct GPUTimerQuery
+	{
+		GLuint query[2]; // timestamps at begin/end of the bracket
+		int type;
+	};
+
+	struct
+	{
+		std::vector<GPUTimerQuery> pending;
+		std::vector<GLuint> unused;
+		int open[GPUTimer_Count]; // index into pending, -1 when closed
+		double times[GPUTimer_Count]; // completed ms per category
+	} m_gpu_timer;
+
 	GLuint m_vs[1 << 1];
 	GLuint m_gs[1 << 3];
 	GLuint m_ps_ss[1 << 7];
 	GSDepthStencilOGL* m_om_dss[1 << 5];
 	std::unordered_map<uint64, GLuint> m_ps;
+	// Last used fragment shader. Consecutive draws mostly reuse the same
+	// selector, so SetupPipeline can skip the map probe entirely.
+	uint64 m_ps_sel_prev;
+	GLuint m_ps_prev;
 	GLuint m_apitrace;
 
 	GLuint m_palette_ss;
@@ -578,6 +601,10 @@ public:
 
 	void GenerateProfilerData();
 
+	void BeginGPUTimer(int type) final;
+	void EndGPUTimer(int type) final;
+	void GetGPUTimes(double* times) final;
+
 	// Used by OpenGL, so the same calling convention is required.
 	static void APIENTRY DebugOutputToFile(GLenum gl_source, GLenum gl_type, GLuint id, GLenum gl_severity, GLsizei gl_length, const GLchar* gl_message, const void* userParam);
 
@@ -631,6 +658,9 @@ public:
 	virtual bool HasColorSparse() { return GLLoader::found_compatible_GL_ARB_sparse_texture2; }
 	virtual bool HasDepthSparse() { return GLLoader::found_compatible_sparse_depth; }
 
+	// GLState::available_vram as computed at Create, before any texture ate into it
+	virtual uint64 GetVRAMSize() { return m_vram_size; }
+
 	void CreateTextureFX();
 	GLuint CompileVS(VSSelector sel);
 	GLuint CompileGS(GSSelector sel);
@@ -16,6 +16,7 @@
 #include "PrecompiledHeader.h"
 #include "GSShaderOGL.h"
 #include "GLState.h"
+#include "GS/GSUtil.h"
 
 #ifdef _WIN32
 #include "GS/resource.h"
@@ -23,12 +24,48 @@
 #include "GS_res.h"
 #endif
 
+static uint64 FnvHash(const void* data, size_t size, uint64 hash = 0xcbf29ce484222325ull)
+{
+	const uint8* p = (const uint8*)data;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		hash = (hash ^ p[i]) * 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
 GSShaderOGL::GSShaderOGL(bool debug)
 	: m_pipeline(0)
 	, m_debug_shader(debug)
+	, m_driver_key(0)
 {
 	theApp.LoadResource(IDR_COMMON_GLSL, m_common_header);
 
+	if (GLLoader::found_GL_ARB_get_program_binary)
+	{
+		m_cache_dir = theApp.GetConfigS("shader_cache_dir");
+	}
+
+	if (!m_cache_dir.empty())
+	{
+		GSmkdir(m_cache_dir.c_str());
+
+		// Mix the driver strings into every file name, a driver update
+		// invalidates all the binaries at once.
+
+		for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+		{
+			const char* s = (const char*)glGetString(name);
+
+			if (s != NULL)
+			{
+				m_driver_key = FnvHash(s, strlen(s), m_driver_key);
+			}
+		}
+	}
+
 	// Create a default pipeline
 	m_pipeline = LinkPipeline("HW pipe", 0, 0, 0);
 	BindPipeline(m_pipeline);
@@ -288,6 +325,30 @@ GLuint GSShaderOGL::Compile(const std::string& glsl_file, const std::string& ent
 	sources[1] = m_common_header.data();
 	sources[2] = glsl_h_code;
 
+	uint64 key = 0;
+
+	if (!m_cache_dir.empty())
+	{
+		// The header contains the macro selector and the GL options, so
+		// hashing the sources covers every permutation.
+
+		key = m_driver_key;
+
+		for (int i = 0; i < shader_nb; i++)
+		{
+			key = FnvHash(sources[i], strlen(sources[i]), key);
+		}
+
+		program = LoadProgram(key);
+
+		if (program)
+		{
+			m_prog_to_delete.push_back(program);
+
+			return program;
+		}
+	}
+
 	program = glCreateShaderProgramv(type, shader_nb, sources);
 
 	bool status = ValidateProgram(program);
@@ -300,11 +361,93 @@ GLuint GSShaderOGL::Compile(const std::string& glsl_file, const std::string& ent
 		fprintf(stderr, "\n");
 	}
 
+	if (!m_cache_dir.empty())
+	{
+		SaveProgram(key, program);
+	}
+
 	m_prog_to_delete.push_back(program);
 
 	return program;
 }
 
+// Binaries are only valid for the exact driver that wrote them, a reject
+// (stale file, changed GL state) just falls back to a normal compile.
+GLuint GSShaderOGL::LoadProgram(uint64 key)
+{
+	std::string fn = format("%s/%016llx.bin", m_cache_dir.c_str(), (unsigned long long)key);
+
+	FILE* fp = fopen(fn.c_str(), "rb");
+
+	if (fp == NULL)
+		return 0;
+
+	fseek(fp, 0, SEEK_END);
+	long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	GLuint p = 0;
+	GLenum fmt = 0;
+
+	if (size > (long)sizeof(fmt) && fread(&fmt, sizeof(fmt), 1, fp) == 1)
+	{
+		std::vector<char> binary(size - sizeof(fmt));
+
+		if (fread(binary.data(), binary.size(), 1, fp) == 1)
+		{
+			p = glCreateProgram();
+
+			glProgramParameteri(p, GL_PROGRAM_SEPARABLE, GL_TRUE);
+			glProgramBinary(p, fmt, binary.data(), binary.size());
+
+			GLint status = 0;
+			glGetProgramiv(p, GL_LINK_STATUS, &status);
+
+			if (!status)
+			{
+				glDeleteProgram(p);
+				p = 0;
+			}
+		}
+	}
+
+	fclose(fp);
+
+	return p;
+}
+
+void GSShaderOGL::SaveProgram(uint64 key, GLuint p)
+{
+	GLint status = 0;
+	glGetProgramiv(p, GL_LINK_STATUS, &status);
+
+	if (!status)
+		return; // don't cache failures
+
+	GLint length = 0;
+	glGetProgramiv(p, GL_PROGRAM_BINARY_LENGTH, &length);
+
+	if (length <= 0)
+		return;
+
+	std::vector<char> binary(length);
+	GLenum fmt = 0;
+
+	glGetProgramBinary(p, length, NULL, &fmt, binary.data());
+
+	std::string fn = format("%s/%016llx.bin", m_cache_dir.c_str(), (unsigned long long)key);
+
+	FILE* fp = fopen(fn.c_str(), "wb");
+
+	if (fp == NULL)
+		return;
+
+	fwrite(&fmt, sizeof(fmt), 1, fp);
+	fwrite(binary.data(), length, 1, fp);
+
+	fclose(fp);
+}
+
 // Same as above but for not-separated build
 GLuint GSShaderOGL::CompileShader(const std::string& glsl_file, const std::string& entry, GLenum type, const char* glsl_h_code, const std::string& macro_sel)
 {
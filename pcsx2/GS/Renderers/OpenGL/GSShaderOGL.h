@@ -34,6 +34,15 @@ class GSShaderOGL
 	std::string GenGlslHeader(const std::string& entry, GLenum type, const std::string& macro);
 	std::vector<char> m_common_header;
 
+	// On disk program binary cache so the second run of a game doesn't pay
+	// the glsl compile stall whenever a new selector shows up. Empty when
+	// disabled or GL_ARB_get_program_binary is missing.
+	std::string m_cache_dir;
+	uint64 m_driver_key; // binaries aren't portable across drivers
+
+	GLuint LoadProgram(uint64 key);
+	void SaveProgram(uint64 key, GLuint p);
+
 public:
 	GSShaderOGL(bool debug);
 	~GSShaderOGL();
@@ -21,6 +21,11 @@ GSTextureCacheOGL::GSTextureCacheOGL(GSRenderer* r)
 {
 }
 
+GSTextureCacheOGL::~GSTextureCacheOGL()
+{
+	FlushReads();
+}
+
 void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 {
 	if (!t->m_dirty.empty() || r.width() == 0 || r.height() == 0)
@@ -71,42 +76,66 @@ void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 
 	if (GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, r.width(), r.height(), fmt, ps_shader))
 	{
-		GSTexture::GSMap m;
-		GSVector4i r_offscreen(0, 0, r.width(), r.height());
+		// Queue the transfer behind a fence instead of stalling on it here.
+		// The GPU works through the copies of the remaining targets while
+		// the CPU swizzles the completed ones, FlushReads drains the queue
+		// before anyone reads the local memory.
 
-		if (offscreen->Map(m, &r_offscreen))
-		{
-			// TODO: block level write
+		((GSTextureOGL*)offscreen)->ReadbackAsync(GSVector4i(0, 0, r.width(), r.height()));
 
-			GSOffset* off = m_renderer->m_mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM);
+		m_pending_reads.push_back({offscreen, r, TEX0});
+	}
+}
 
-			switch (TEX0.PSM)
-			{
-				case PSM_PSMCT32:
-				case PSM_PSMZ32:
-					m_renderer->m_mem.WritePixel32(m.bits, m.pitch, off, r);
-					break;
-				case PSM_PSMCT24:
-				case PSM_PSMZ24:
-					m_renderer->m_mem.WritePixel24(m.bits, m.pitch, off, r);
-					break;
-				case PSM_PSMCT16:
-				case PSM_PSMCT16S:
-				case PSM_PSMZ16:
-				case PSM_PSMZ16S:
-					m_renderer->m_mem.WritePixel16(m.bits, m.pitch, off, r);
-					break;
-
-				default:
-					ASSERT(0);
-			}
+void GSTextureCacheOGL::Consume(const PendingRead& read)
+{
+	const GSVector4i& r = read.r;
 
-			offscreen->Unmap();
+	GSTexture::GSMap m;
+	GSVector4i r_offscreen(0, 0, r.width(), r.height());
+
+	if (read.offscreen->Map(m, &r_offscreen))
+	{
+		// TODO: block level write
+
+		GSOffset* off = m_renderer->m_mem.GetOffset(read.TEX0.TBP0, read.TEX0.TBW, read.TEX0.PSM);
+
+		switch (read.TEX0.PSM)
+		{
+			case PSM_PSMCT32:
+			case PSM_PSMZ32:
+				m_renderer->m_mem.WritePixel32(m.bits, m.pitch, off, r);
+				break;
+			case PSM_PSMCT24:
+			case PSM_PSMZ24:
+				m_renderer->m_mem.WritePixel24(m.bits, m.pitch, off, r);
+				break;
+			case PSM_PSMCT16:
+			case PSM_PSMCT16S:
+			case PSM_PSMZ16:
+			case PSM_PSMZ16S:
+				m_renderer->m_mem.WritePixel16(m.bits, m.pitch, off, r);
+				break;
+
+			default:
+				ASSERT(0);
 		}
 
-		// FIXME invalidate data
-		m_renderer->m_dev->Recycle(offscreen);
+		read.offscreen->Unmap();
 	}
+
+	// FIXME invalidate data
+	m_renderer->m_dev->Recycle(read.offscreen);
+}
+
+void GSTextureCacheOGL::FlushReads()
+{
+	for (const PendingRead& read : m_pending_reads)
+	{
+		Consume(read);
+	}
+
+	m_pending_reads.clear();
 }
 
 void GSTextureCacheOGL::Read(Source* t, const GSVector4i& r)
@@ -20,12 +20,27 @@
 
 class GSTextureCacheOGL final : public GSTextureCache
 {
+	// Readbacks in flight, the GPU->CPU transfer was queued with a fence
+	// but the data hasn't been swizzled into local memory yet.
+	struct PendingRead
+	{
+		GSTexture* offscreen;
+		GSVector4i r;
+		GIFRegTEX0 TEX0;
+	};
+
+	std::vector<PendingRead> m_pending_reads;
+
+	void Consume(const PendingRead& read);
+
 protected:
 	int Get8bitFormat() { return GL_R8; }
 
 	void Read(Target* t, const GSVector4i& r);
 	void Read(Source* t, const GSVector4i& r);
+	void FlushReads();
 
 public:
 	GSTextureCacheOGL(GSRenderer* r);
+	virtual ~GSTextureCacheOGL();
 };
@@ -165,7 +165,7 @@ namespace PboPool
 } // namespace PboPool
 
 GSTextureOGL::GSTextureOGL(int type, int w, int h, int format, GLuint fbo_read, bool mipmap)
-	: m_clean(false), m_generate_mipmap(true), m_local_buffer(nullptr), m_r_x(0), m_r_y(0), m_r_w(0), m_r_h(0), m_layer(0)
+	: m_clean(false), m_generate_mipmap(true), m_local_buffer(nullptr), m_pack_pbo(0), m_pack_fence(0), m_pack_mapped(false), m_r_x(0), m_r_y(0), m_r_w(0), m_r_h(0), m_layer(0)
 {
 	// OpenGL didn't like dimensions of size 0
 	m_size.x = std::max(1, w);
@@ -365,6 +365,12 @@ GSTextureOGL::~GSTextureOGL()
 
 	GLState::available_vram += m_mem_usage;
 
+	if (m_pack_fence)
+		glDeleteSync(m_pack_fence);
+
+	if (m_pack_pbo)
+		glDeleteBuffers(1, &m_pack_pbo);
+
 	if (m_local_buffer)
 		_aligned_free(m_local_buffer);
 }
@@ -426,13 +432,22 @@ bool GSTextureOGL::Update(const GSVector4i& r, const void* data, int pitch, int
 	char* src = (char*)data;
 	char* map = PboPool::Map(map_size);
 
-	// PERF: slow path of the texture upload. Dunno if we could do better maybe check if TC can keep row_byte == pitch
-	// Note: row_byte != pitch
-	for (int h = 0; h < r.height(); h++)
+	if (row_byte == (uint32)pitch)
+	{
+		// Tight rows, a single copy into the persistently mapped buffer is
+		// all the CPU side work of the whole upload
+		memcpy(map, src, map_size);
+	}
+	else
 	{
-		memcpy(map, src, row_byte);
-		map += row_byte;
-		src += pitch;
+		// PERF: slow path of the texture upload. Dunno if we could do better maybe check if TC can keep row_byte == pitch
+		// Note: row_byte != pitch
+		for (int h = 0; h < r.height(); h++)
+		{
+			memcpy(map, src, row_byte);
+			map += row_byte;
+			src += pitch;
+		}
 	}
 
 	PboPool::Unmap();
@@ -450,6 +465,42 @@ bool GSTextureOGL::Update(const GSVector4i& r, const void* data, int pitch, int
 	return true;
 }
 
+// Queues the GPU->CPU transfer of r into a pack buffer and returns without
+// draining the pipeline. The next Map of the same area only waits on the
+// fence, so the caller can issue several readbacks before converting any of
+// them. Offscreen textures only.
+void GSTextureOGL::ReadbackAsync(const GSVector4i& r)
+{
+	ASSERT(m_type == GSTexture::Offscreen);
+
+	if (m_pack_pbo == 0)
+	{
+		glGenBuffers(1, &m_pack_pbo);
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pack_pbo);
+		glBufferData(GL_PIXEL_PACK_BUFFER, m_size.x * m_size.y * 4, NULL, GL_STREAM_READ);
+	}
+	else
+	{
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pack_pbo);
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo_read);
+	glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture_id, 0);
+
+	glPixelStorei(GL_PACK_ALIGNMENT, 1u << m_int_shift);
+
+	glReadPixels(r.x, r.y, r.width(), r.height(), m_int_format, m_int_type, NULL);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	if (m_pack_fence)
+		glDeleteSync(m_pack_fence);
+
+	m_pack_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
 bool GSTextureOGL::Map(GSMap& m, const GSVector4i* _r, int layer)
 {
 	if (layer >= m_max_layer)
@@ -465,6 +516,31 @@ bool GSTextureOGL::Map(GSMap& m, const GSVector4i* _r, int layer)
 
 	if (m_type == GSTexture::Offscreen)
 	{
+		if (m_pack_fence)
+		{
+			// The transfer was queued by ReadbackAsync, only wait for it
+			// instead of draining the whole pipeline with glReadPixels.
+
+			glClientWaitSync(m_pack_fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+			glDeleteSync(m_pack_fence);
+			m_pack_fence = 0;
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pack_pbo);
+
+			m.bits = (uint8*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, r.height() * row_byte, GL_MAP_READ_BIT);
+
+			if (m.bits != NULL)
+			{
+				m_pack_mapped = true;
+
+				return true;
+			}
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+			return false;
+		}
+
 		// The fastest way will be to use a PBO to read the data asynchronously. Unfortunately GS
 		// architecture is waiting the data right now.
 
@@ -521,6 +597,16 @@ bool GSTextureOGL::Map(GSMap& m, const GSVector4i* _r, int layer)
 
 void GSTextureOGL::Unmap()
 {
+	if (m_pack_mapped)
+	{
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		m_pack_mapped = false;
+
+		return;
+	}
+
 	if (m_type == GSTexture::Texture || m_type == GSTexture::RenderTarget)
 	{
 
@@ -586,7 +672,7 @@ void GSTextureOGL::CommitPages(const GSVector2i& region, bool commit)
 	GLState::available_vram -= m_mem_usage;
 }
 
-bool GSTextureOGL::Save(const std::string& fn)
+bool GSTextureOGL::Save(const std::string& fn, GSPng::Worker* async)
 {
 	// Collect the texture data
 	uint32 pitch = 4 * m_committed_size.x;
@@ -646,6 +732,13 @@ bool GSTextureOGL::Save(const std::string& fn)
 	}
 
 	int compression = theApp.GetConfigI("png_compression_level");
+
+	if (async)
+	{
+		async->Push(std::make_shared<GSPng::Transaction>(fmt, fn, image.get(), m_committed_size.x, m_committed_size.y, pitch, compression));
+		return true;
+	}
+
 	return GSPng::Save(fmt, fn, image.get(), m_committed_size.x, m_committed_size.y, pitch, compression);
 }
 
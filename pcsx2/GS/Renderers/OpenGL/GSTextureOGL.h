@@ -42,6 +42,10 @@ private:
 	bool m_generate_mipmap;
 
 	uint8* m_local_buffer;
+	// Asynchronous offscreen readback, see ReadbackAsync
+	GLuint m_pack_pbo;
+	GLsync m_pack_fence;
+	bool m_pack_mapped;
 	// Avoid alignment constrain
 	//GSVector4i m_r;
 	int m_r_x;
@@ -64,10 +68,11 @@ public:
 	virtual ~GSTextureOGL();
 
 	bool Update(const GSVector4i& r, const void* data, int pitch, int layer = 0) final;
+	void ReadbackAsync(const GSVector4i& r);
 	bool Map(GSMap& m, const GSVector4i* r = NULL, int layer = 0) final;
 	void Unmap() final;
 	void GenerateMipmap() final;
-	bool Save(const std::string& fn) final;
+	bool Save(const std::string& fn, GSPng::Worker* async = nullptr) final;
 
 	bool IsBackbuffer() { return (m_type == GSTexture::Backbuffer); }
 	bool IsDss() { return (m_type == GSTexture::DepthStencil || m_type == GSTexture::SparseDepthStencil); }
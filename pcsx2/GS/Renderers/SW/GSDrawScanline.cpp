@@ -33,6 +33,22 @@ void GSDrawScanline::BeginDraw(const GSRasterizerData* data)
 {
 	memcpy(&m_global, &((const SharedData*)data)->global, sizeof(m_global));
 
+	if (m_global.sel.IsSolidRect())
+	{
+		// untextured, untested, unblended sprites only ever run DrawRect,
+		// don't pay for the selector map lookups on every one of them, 2d
+		// heavy games issue thousands of such rects per frame
+
+		m_sp = NULL;
+		m_ds = NULL;
+		m_de = NULL;
+		m_dr = (DrawRectPtr)&GSDrawScanline::DrawRect;
+
+		return;
+	}
+
+	m_dr = NULL;
+
 	if (m_global.sel.mmin && m_global.sel.lcm)
 	{
 #if defined(__GNUC__) && _M_SSE >= 0x501
@@ -74,15 +90,6 @@ void GSDrawScanline::BeginDraw(const GSRasterizerData* data)
 		m_de = NULL;
 	}
 
-	if (m_global.sel.IsSolidRect())
-	{
-		m_dr = (DrawRectPtr)&GSDrawScanline::DrawRect;
-	}
-	else
-	{
-		m_dr = NULL;
-	}
-
 	// doesn't need all bits => less functions generated
 
 	GSScanlineSelector sel;
@@ -103,9 +110,55 @@ void GSDrawScanline::BeginDraw(const GSRasterizerData* data)
 	m_sp = m_sp_map[sel];
 }
 
+void GSDrawScanline::Precompile(uint64 key)
+{
+	// compile everything BeginDraw would ask for with this selector, without
+	// drawing anything, so the first real draw doesn't hitch on the jit
+
+	GSScanlineSelector sel;
+
+	sel.key = key;
+
+	if (sel.IsSolidRect()) // never runs a jit kernel, see BeginDraw
+		return;
+
+	m_ds_map[sel];
+
+	if (sel.aa1)
+	{
+		GSScanlineSelector edge;
+
+		edge.key = sel.key;
+		edge.zwrite = 0;
+		edge.edge = 1;
+
+		m_ds_map[edge];
+	}
+
+	GSScanlineSelector sp;
+
+	sp.key = 0;
+
+	sp.iip = sel.iip;
+	sp.tfx = sel.tfx;
+	sp.tcc = sel.tcc;
+	sp.fst = sel.fst;
+	sp.fge = sel.fge;
+	sp.prim = sel.prim;
+	sp.fb = sel.fb;
+	sp.zb = sel.zb;
+	sp.zoverflow = sel.zoverflow;
+	sp.notest = sel.notest;
+
+	m_sp_map[sp];
+}
+
 void GSDrawScanline::EndDraw(uint64 frame, uint64 ticks, int actual, int total)
 {
-	m_ds_map.UpdateStats(frame, ticks, actual, total);
+	if (m_ds != NULL) // solid rects don't go through the map, see BeginDraw
+	{
+		m_ds_map.UpdateStats(frame, ticks, actual, total);
+	}
 }
 
 #ifndef ENABLE_JIT_RASTERIZER
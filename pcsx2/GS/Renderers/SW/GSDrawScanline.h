@@ -64,6 +64,8 @@ public:
 	void BeginDraw(const GSRasterizerData* data);
 	void EndDraw(uint64 frame, uint64 ticks, int actual, int total);
 
+	void Precompile(uint64 key);
+
 	void DrawRect(const GSVector4i& r, const GSVertexSW& v);
 
 #ifndef ENABLE_JIT_RASTERIZER
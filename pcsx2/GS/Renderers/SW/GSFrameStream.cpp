@@ -0,0 +1,156 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "GSFrameStream.h"
+
+std::mutex GSFrameStream::s_lock;
+std::deque<std::vector<uint8>> GSFrameStream::s_packets;
+
+GSFrameStream::GSFrameStream(int circuit)
+	: m_circuit(circuit)
+	, m_prev_w(0)
+	, m_prev_h(0)
+	, m_force(true)
+{
+	m_queue = std::unique_ptr<GSJobQueue<std::shared_ptr<Job>, 4>>(
+		new GSJobQueue<std::shared_ptr<Job>, 4>([this](std::shared_ptr<Job>& job) { Process(job); }));
+}
+
+GSFrameStream::~GSFrameStream()
+{
+	m_queue->Wait();
+}
+
+void GSFrameStream::Encode(const uint8* bits, int w, int h, int pitch)
+{
+	if (w <= 0 || h <= 0 || w >= 65536 || h >= 65536)
+		return;
+
+	if (w != m_prev_w || h != m_prev_h)
+	{
+		// a dimension change invalidates the delta base
+		m_prev_w = w;
+		m_prev_h = h;
+		m_prev.resize((size_t)w * h * 4);
+		m_force = true;
+	}
+
+	std::shared_ptr<Job> job(new Job());
+
+	std::vector<uint32> tiles;
+
+	for (int y = 0; y < h; y += TILE_SIZE)
+	{
+		const int th = std::min(TILE_SIZE, h - y);
+
+		for (int x = 0; x < w; x += TILE_SIZE)
+		{
+			const int tw = std::min(TILE_SIZE, w - x) * 4;
+
+			const uint8* src = bits + (size_t)y * pitch + (size_t)x * 4;
+			uint8* prev = m_prev.data() + ((size_t)y * w + x) * 4;
+
+			bool dirty = m_force;
+
+			for (int row = 0; !dirty && row < th; row++)
+				dirty = memcmp(src + (size_t)row * pitch, prev + (size_t)row * w * 4, tw) != 0;
+
+			if (!dirty)
+				continue;
+
+			tiles.push_back((uint32)x | ((uint32)y << 16));
+
+			for (int row = 0; row < th; row++)
+			{
+				const uint8* s = src + (size_t)row * pitch;
+
+				memcpy(prev + (size_t)row * w * 4, s, tw);
+
+				job->raw.insert(job->raw.end(), s, s + tw);
+			}
+		}
+	}
+
+	m_force = false;
+
+	if (tiles.empty())
+		return; // nothing changed, nothing to ship
+
+	PacketHeader ph;
+
+	ph.magic = 0x31465347; // 'GSF1'
+	ph.width = (uint16)w;
+	ph.height = (uint16)h;
+	ph.circuit = (uint8)m_circuit;
+	ph.tile_size = TILE_SIZE;
+	ph.tile_count = (uint16)tiles.size();
+	ph.raw_size = (uint32)job->raw.size();
+	ph.comp_size = 0; // the worker fills it in once the deflate is done
+
+	job->header.resize(sizeof(ph) + tiles.size() * sizeof(uint32));
+
+	memcpy(job->header.data(), &ph, sizeof(ph));
+	memcpy(job->header.data() + sizeof(ph), tiles.data(), tiles.size() * sizeof(uint32));
+
+	m_queue->Push(job);
+}
+
+void GSFrameStream::Process(std::shared_ptr<Job>& job)
+{
+	uLongf comp_size = compressBound((uLong)job->raw.size());
+
+	std::vector<uint8> packet(job->header.size() + comp_size);
+
+	memcpy(packet.data(), job->header.data(), job->header.size());
+
+	if (compress2(packet.data() + job->header.size(), &comp_size, job->raw.data(), (uLong)job->raw.size(), Z_BEST_SPEED) != Z_OK)
+		return;
+
+	packet.resize(job->header.size() + comp_size);
+
+	((PacketHeader*)packet.data())->comp_size = (uint32)comp_size;
+
+	std::lock_guard<std::mutex> l(s_lock);
+
+	s_packets.push_back(std::move(packet));
+
+	// an absent or slow consumer must not pile up frames
+	while (s_packets.size() > 4)
+		s_packets.pop_front();
+}
+
+size_t GSFrameStream::Fetch(void* dst, size_t available)
+{
+	std::lock_guard<std::mutex> l(s_lock);
+
+	if (s_packets.empty())
+		return 0;
+
+	const std::vector<uint8>& packet = s_packets.front();
+	const size_t size = packet.size();
+
+	if (dst == NULL)
+		return size; // size query, the packet stays queued
+
+	if (size > available)
+		return 0;
+
+	memcpy(dst, packet.data(), size);
+
+	s_packets.pop_front();
+
+	return size;
+}
@@ -0,0 +1,81 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "GS/GSThread_CXX11.h"
+#include <deque>
+
+// Optional delta encoder for the CPU-side output of the SW renderer
+// ("frame_stream" config). Each frame is cut into 64x64 tiles, only the
+// tiles that changed since the previous frame are kept, deflate-compressed
+// on a worker thread and queued as a packet. An external consumer (remote
+// display) drains the queue with GSfetchEncodedFrame; the local present
+// path is untouched.
+class GSFrameStream
+{
+	struct Job
+	{
+		std::vector<uint8> header; // packet header + tile list, shipped as is
+		std::vector<uint8> raw;    // changed tile pixels, input of the deflate
+	};
+
+public:
+#pragma pack(push, 1)
+	struct PacketHeader
+	{
+		uint32 magic; // 'GSF1'
+		uint16 width;
+		uint16 height;
+		uint8 circuit; // read circuit (DISPFB index) this frame came from
+		uint8 tile_size;
+		uint16 tile_count;
+		uint32 raw_size;  // total size of the tile pixels before compression
+		uint32 comp_size; // size of the deflate payload closing the packet
+
+		// followed by tile_count uint32 tile positions (x | y << 16, in
+		// pixels), then comp_size bytes of deflate data holding the RGBA32
+		// pixels of the listed tiles in order, row major within each tile
+	};
+#pragma pack(pop)
+
+	GSFrameStream(int circuit);
+	~GSFrameStream();
+
+	void Encode(const uint8* bits, int w, int h, int pitch);
+
+	// Copies the oldest pending packet into dst and returns its size, 0 when
+	// nothing is pending (or dst is too small). With dst == NULL the size of
+	// the oldest packet is returned and the packet stays queued, so a caller
+	// can size its buffer first.
+	static size_t Fetch(void* dst, size_t available);
+
+private:
+	static const int TILE_SIZE = 64;
+
+	void Process(std::shared_ptr<Job>& job);
+
+	int m_circuit;
+	std::vector<uint8> m_prev; // previous frame, w * 4 byte rows
+	int m_prev_w;
+	int m_prev_h;
+	bool m_force; // retransmit everything, the delta base is invalid
+
+	std::unique_ptr<GSJobQueue<std::shared_ptr<Job>, 4>> m_queue;
+
+	// the fetch side is shared with the consumer thread
+	static std::mutex s_lock;
+	static std::deque<std::vector<uint8>> s_packets;
+};
@@ -30,8 +30,18 @@ static int compute_best_thread_height(int threads)
 
 	if (th > 0 && th < 9)
 		return th;
-	else
-		return 4;
+
+	// Keep the whole interleave period (threads << th) short enough that
+	// draws covering only part of the screen still hit every worker, a big
+	// pool with 16 scanline segments would idle most threads on anything
+	// under (threads * 16) lines. One segment keeps spanning whole blocks.
+
+	th = 4;
+
+	while (th > 3 && (threads << th) > 64)
+		th--;
+
+	return th;
 }
 
 GSRasterizer::GSRasterizer(IDrawScanline* ds, int id, int threads, GSPerfMon* perfmon)
@@ -59,11 +69,26 @@ GSRasterizer::GSRasterizer(IDrawScanline* ds, int id, int threads, GSPerfMon* pe
 			m_scanline[row] = i == id ? 1 : 0;
 		}
 	}
+
+	// each worker only ever touches its own scanline segments, so it can keep
+	// its own coarse z cells without synchronizing with the others
+
+	m_hiz_rows = rows;
+	m_hiz = (float*)_aligned_malloc(rows * HIZ_COLS * sizeof(float), 64);
+
+	// not cleared here on purpose, the first epoch mismatch in Draw does it
+	// on the worker thread, so the pages get faulted in on the node the
+	// worker runs on
+
+	m_hiz_epoch = (uint32)-1;
+	m_hiz_test = false;
+	m_hiz_update = false;
 }
 
 GSRasterizer::~GSRasterizer()
 {
 	_aligned_free(m_scanline);
+	_aligned_free(m_hiz);
 
 	if (m_edge.buff != NULL)
 		vmfree(m_edge.buff, sizeof(GSVertexSW) * 2048);
@@ -80,7 +105,7 @@ bool GSRasterizer::IsOneOfMyScanlines(int top) const
 
 bool GSRasterizer::IsOneOfMyScanlines(int top, int bottom) const
 {
-	ASSERT(top >= 0 && top < 2048 && bottom >= 0 && bottom < 2048);
+	ASSERT(top >= 0 && top < 2048 && bottom >= 0 && bottom <= 2048);
 
 	top = top >> m_thread_height;
 	bottom = (bottom + (1 << m_thread_height) - 1) >> m_thread_height;
@@ -128,6 +153,14 @@ int GSRasterizer::GetPixels(bool reset)
 	return pixels;
 }
 
+void GSRasterizer::Precompile(const std::vector<uint64>& keys)
+{
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		m_ds->Precompile(keys[i]);
+	}
+}
+
 void GSRasterizer::Draw(GSRasterizerData* data)
 {
 	GSPerfMonAutoTimer pmat(m_perfmon, GSPerfMon::WorkerDraw0 + m_id);
@@ -138,6 +171,8 @@ void GSRasterizer::Draw(GSRasterizerData* data)
 	m_pixels.actual = 0;
 	m_pixels.total = 0;
 
+	data->Prepare();
+
 	data->start = __rdtsc();
 
 	m_ds->BeginDraw(data);
@@ -156,6 +191,19 @@ void GSRasterizer::Draw(GSRasterizerData* data)
 	m_fscissor_x = GSVector4(data->scissor).xzxz();
 	m_fscissor_y = GSVector4(data->scissor).ywyw();
 
+	m_hiz_test = data->hiz_test;
+	m_hiz_update = data->hiz_update;
+
+	if ((m_hiz_test || m_hiz_update) && m_hiz_epoch != data->hiz_epoch)
+	{
+		// the depth buffer moved or something else wrote to it, whatever the
+		// cells learned is stale
+
+		memset(m_hiz, 0, m_hiz_rows * HIZ_COLS * sizeof(float));
+
+		m_hiz_epoch = data->hiz_epoch;
+	}
+
 	switch (data->primclass)
 	{
 		case GS_POINT_CLASS:
@@ -198,16 +246,34 @@ void GSRasterizer::Draw(GSRasterizerData* data)
 			{
 				do
 				{
-					DrawTriangle(vertex, index);
-					index += 3;
+					int n = std::min<int>((index_end - index) / 3, 4);
+					int m = m_threads > 1 ? ClassifyTriangles(vertex, index, n) : (1 << n) - 1;
+
+					for (int i = 0; i < n; i++, index += 3)
+					{
+						if (m & (1 << i))
+						{
+							DrawTriangle(vertex, index);
+						}
+					}
 				} while (index < index_end);
 			}
 			else
 			{
+				static const uint32 batch_index[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
 				do
 				{
-					DrawTriangle(vertex, tmp_index);
-					vertex += 3;
+					int n = std::min<int>((vertex_end - vertex) / 3, 4);
+					int m = m_threads > 1 ? ClassifyTriangles(vertex, batch_index, n) : (1 << n) - 1;
+
+					for (int i = 0; i < n; i++, vertex += 3)
+					{
+						if (m & (1 << i))
+						{
+							DrawTriangle(vertex, tmp_index);
+						}
+					}
 				} while (vertex < vertex_end);
 			}
 
@@ -419,6 +485,9 @@ void GSRasterizer::DrawTriangle(const GSVertexSW* vertex, const uint32* index)
 	GSVertexSW2 dedge;
 	GSVertexSW2 dscan;
 
+	if (m_hiz_test && HiZTest(vertex[index[0]], vertex[index[1]], vertex[index[2]]))
+		return;
+
 	GSVector4 y0011 = vertex[index[0]].p.yyyy(vertex[index[1]].p);
 	GSVector4 y1221 = vertex[index[1]].p.yyyy(vertex[index[2]].p).xzzx();
 
@@ -547,6 +616,9 @@ void GSRasterizer::DrawTriangle(const GSVertexSW* vertex, const uint32* index)
 
 		Flush(vertex, index, GSVertexSW::zero(), true);
 	}
+
+	if (m_hiz_update)
+		HiZUpdate(vertex[index[0]], vertex[index[1]], vertex[index[2]]);
 }
 
 void GSRasterizer::DrawTriangleSection(int top, int bottom, GSVertexSW2& edge, const GSVertexSW2& dedge, const GSVertexSW2& dscan, const GSVector4& p0)
@@ -610,6 +682,9 @@ void GSRasterizer::DrawTriangle(const GSVertexSW* vertex, const uint32* index)
 	GSVertexSW dedge;
 	GSVertexSW dscan;
 
+	if (m_hiz_test && HiZTest(vertex[index[0]], vertex[index[1]], vertex[index[2]]))
+		return;
+
 	GSVector4 y0011 = vertex[index[0]].p.yyyy(vertex[index[1]].p);
 	GSVector4 y1221 = vertex[index[1]].p.yyyy(vertex[index[2]].p).xzzx();
 
@@ -738,6 +813,9 @@ void GSRasterizer::DrawTriangle(const GSVertexSW* vertex, const uint32* index)
 
 		Flush(vertex, index, GSVertexSW::zero(), true);
 	}
+
+	if (m_hiz_update)
+		HiZUpdate(vertex[index[0]], vertex[index[1]], vertex[index[2]]);
 }
 
 void GSRasterizer::DrawTriangleSection(int top, int bottom, GSVertexSW& edge, const GSVertexSW& dedge, const GSVertexSW& dscan, const GSVector4& p0)
@@ -796,6 +874,182 @@ void GSRasterizer::DrawTriangleSection(int top, int bottom, GSVertexSW& edge, co
 
 #endif
 
+// Classifies up to four triangles at once, one per vector lane, and returns a
+// bitmask of the ones that may touch a scanline owned by this worker. With
+// the small triangles character models are made of most triangles belong
+// entirely to other workers, rejecting them here is much cheaper than running
+// the edge equation setup for them. The bounds are padded by a pixel on each
+// side to cover the rounding of the aa1 edge loops.
+
+int GSRasterizer::ClassifyTriangles(const GSVertexSW* vertex, const uint32* index, int count) const
+{
+	ASSERT(count >= 1 && count <= 4);
+
+	const uint32* i0 = index;
+	const uint32* i1 = index + (count > 1 ? 3 : 0);
+	const uint32* i2 = index + (count > 2 ? 6 : 0);
+	const uint32* i3 = index + (count > 3 ? 9 : 0);
+
+	GSVector4 y0(vertex[i0[0]].p.y, vertex[i1[0]].p.y, vertex[i2[0]].p.y, vertex[i3[0]].p.y);
+	GSVector4 y1(vertex[i0[1]].p.y, vertex[i1[1]].p.y, vertex[i2[1]].p.y, vertex[i3[1]].p.y);
+	GSVector4 y2(vertex[i0[2]].p.y, vertex[i1[2]].p.y, vertex[i2[2]].p.y, vertex[i3[2]].p.y);
+
+	GSVector4 st = m_fscissor_y.xxxx();
+	GSVector4 sb = m_fscissor_y.yyyy();
+
+	GSVector4 top = (y0.min(y1).min(y2).ceil() - GSVector4(1.0f)).max(st).min(sb);
+	GSVector4 bottom = (y0.max(y1).max(y2).ceil() + GSVector4(2.0f)).min(sb).max(st);
+
+	GSVector4i t(top);
+	GSVector4i b(bottom);
+
+	int mask = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		if (IsOneOfMyScanlines(t.i32[i], b.i32[i]))
+		{
+			mask |= 1 << i;
+		}
+	}
+
+	return mask;
+}
+
+// Coarse occlusion test against the min-z cells. Only draws the renderer
+// marked as hiz_test get here, for those a failed GEQUAL/GREATER z test
+// discards the pixel entirely, so when the stored z under every cell the
+// triangle may touch lies above its z range nothing would be drawn and the
+// whole setup can be skipped.
+
+bool GSRasterizer::HiZTest(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& v2) const
+{
+	GSVector4 pmin = v0.p.min(v1.p).min(v2.p);
+	GSVector4 pmax = v0.p.max(v1.p).max(v2.p);
+
+	GSVector4i r = GSVector4i(pmin.floor().xyxy(pmax.ceil())).rintersect(m_scissor);
+
+	if (r.rempty())
+		return true; // cannot reach any pixel, same as occluded
+
+	// interpolation in the scanline loop is not exact, keep a safety margin
+
+	float zmax = pmax.z * 1.000004f + 2.0f;
+
+	int top = r.y >> m_thread_height;
+	int bottom = (r.w + (1 << m_thread_height) - 1) >> m_thread_height;
+
+	int left = r.x >> HIZ_SHIFT;
+	int right = (r.z + (1 << HIZ_SHIFT) - 1) >> HIZ_SHIFT;
+
+	for (int i = top; i < bottom; i++)
+	{
+		if (m_scanline[i] == 0)
+			continue;
+
+		const float* RESTRICT row = &m_hiz[i * HIZ_COLS];
+
+		for (int j = left; j < right; j++)
+		{
+			if (row[j] <= zmax) // 0 = unknown, can never reject
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Raise the min-z of every cell the triangle covers completely. Only draws
+// the renderer marked as hiz_update get here (GEQUAL/GREATER z test with z
+// write and nothing that can kill pixels), those either leave the stored z
+// alone or replace it with their own, which is never below the triangle
+// minimum. Coverage is checked with edge functions on the cell corners
+// pushed one pixel outwards, that absorbs the rounding of the scanline
+// rasterization.
+
+void GSRasterizer::HiZUpdate(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& v2)
+{
+	GSVector4 pmin = v0.p.min(v1.p).min(v2.p);
+	GSVector4 pmax = v0.p.max(v1.p).max(v2.p);
+
+	float zmin = pmin.z * 0.999996f - 2.0f;
+
+	if (zmin <= 0.0f)
+		return; // nothing to learn, 0 means unknown
+
+	float area = (v1.p.x - v0.p.x) * (v2.p.y - v0.p.y) - (v1.p.y - v0.p.y) * (v2.p.x - v0.p.x);
+
+	if (area == 0.0f)
+		return;
+
+	float ex[3] = {v1.p.x - v0.p.x, v2.p.x - v1.p.x, v0.p.x - v2.p.x};
+	float ey[3] = {v1.p.y - v0.p.y, v2.p.y - v1.p.y, v0.p.y - v2.p.y};
+	float px[3] = {v0.p.x, v1.p.x, v2.p.x};
+	float py[3] = {v0.p.y, v1.p.y, v2.p.y};
+
+	GSVector4i r = GSVector4i(pmin.floor().xyxy(pmax.ceil())).rintersect(m_scissor);
+
+	if (r.rempty())
+		return;
+
+	int top = r.y >> m_thread_height;
+	int bottom = (r.w + (1 << m_thread_height) - 1) >> m_thread_height;
+
+	int left = r.x >> HIZ_SHIFT;
+	int right = (r.z + (1 << HIZ_SHIFT) - 1) >> HIZ_SHIFT;
+
+	for (int i = top; i < bottom; i++)
+	{
+		if (m_scanline[i] == 0)
+			continue;
+
+		int cy0 = i << m_thread_height;
+		int cy1 = cy0 + (1 << m_thread_height);
+
+		// the draw does not write outside of the scissor, cells sticking out
+		// of it are only partially covered and cannot be trusted
+
+		if (cy0 < m_scissor.y || cy1 > m_scissor.w)
+			continue;
+
+		float* RESTRICT row = &m_hiz[i * HIZ_COLS];
+
+		for (int j = left; j < right; j++)
+		{
+			int cx0 = j << HIZ_SHIFT;
+			int cx1 = cx0 + (1 << HIZ_SHIFT);
+
+			if (cx0 < m_scissor.x || cx1 > m_scissor.z)
+				continue;
+
+			bool inside = true;
+
+			for (int k = 0; k < 4 && inside; k++)
+			{
+				float cx = (k & 1) ? (float)cx1 : (float)(cx0 - 1);
+				float cy = (k & 2) ? (float)cy1 : (float)(cy0 - 1);
+
+				for (int l = 0; l < 3; l++)
+				{
+					// the third vertex is at -area, inside means the same side
+
+					if (((cx - px[l]) * ey[l] - (cy - py[l]) * ex[l]) * area >= 0.0f)
+					{
+						inside = false;
+
+						break;
+					}
+				}
+			}
+
+			if (inside && row[j] < zmin)
+			{
+				row[j] = zmin;
+			}
+		}
+	}
+}
+
 void GSRasterizer::DrawSprite(const GSVertexSW* vertex, const uint32* index)
 {
 	const GSVertexSW& v0 = vertex[index[0]];
@@ -1242,3 +1496,16 @@ int GSRasterizerList::GetPixels(bool reset)
 
 	return pixels;
 }
+
+void GSRasterizerList::Precompile(const std::vector<uint64>& keys)
+{
+	// each worker owns its own code generator maps, only safe while they
+	// are all idle (the caller has to Sync first)
+
+	ASSERT(IsSynced());
+
+	for (size_t i = 0; i < m_r.size(); i++)
+	{
+		m_r[i]->Precompile(keys);
+	}
+}
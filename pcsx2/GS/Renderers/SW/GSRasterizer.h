@@ -39,6 +39,9 @@ public:
 	uint64 start;
 	int pixels;
 	int counter;
+	uint32 hiz_epoch; // generation of the depth buffer, the workers drop their cells when it changes
+	bool hiz_test;    // occlusion test against the cells is meaningful for this draw
+	bool hiz_update;  // draw can only raise the stored z, the cells may learn from it
 
 	GSRasterizerData()
 		: scissor(GSVector4i::zero())
@@ -52,6 +55,9 @@ public:
 		, frame(0)
 		, start(0)
 		, pixels(0)
+		, hiz_epoch(0)
+		, hiz_test(false)
+		, hiz_update(false)
 	{
 		counter = s_counter++;
 	}
@@ -61,6 +67,11 @@ public:
 		if (buff != NULL)
 			_aligned_free(buff);
 	}
+
+	// called by each worker before it starts drawing, may block until the
+	// data is ready (texture expansion running on another thread)
+
+	virtual void Prepare() {}
 };
 
 class IDrawScanline : public GSAlignedClass<32>
@@ -89,6 +100,9 @@ public:
 	virtual void BeginDraw(const GSRasterizerData* data) = 0;
 	virtual void EndDraw(uint64 frame, uint64 ticks, int actual, int total) = 0;
 
+	// compile everything a selector needs ahead of its first draw
+	virtual void Precompile(uint64 key) = 0;
+
 #ifdef ENABLE_JIT_RASTERIZER
 
 	__forceinline void SetupPrim(const GSVertexSW* vertex, const uint32* index, const GSVertexSW& dscan) { m_sp(vertex, index, dscan); }
@@ -120,18 +134,26 @@ public:
 	virtual void Sync() = 0;
 	virtual bool IsSynced() const = 0;
 	virtual int GetPixels(bool reset = true) = 0;
+	virtual void Precompile(const std::vector<uint64>& keys) = 0;
 	virtual void PrintStats() = 0;
 };
 
 class alignas(32) GSRasterizer : public IRasterizer
 {
 protected:
+	enum { HIZ_SHIFT = 6, HIZ_COLS = 2048 >> HIZ_SHIFT }; // 64 pixel wide cells
+
 	GSPerfMon* m_perfmon;
 	IDrawScanline* m_ds;
 	int m_id;
 	int m_threads;
 	int m_thread_height;
 	uint8* m_scanline;
+	float* m_hiz; // min of the stored z under each cell, 0 = unknown, one row per scanline segment
+	int m_hiz_rows;
+	uint32 m_hiz_epoch;
+	bool m_hiz_test;
+	bool m_hiz_update;
 	GSVector4i m_scissor;
 	GSVector4 m_fscissor_x;
 	GSVector4 m_fscissor_y;
@@ -144,8 +166,12 @@ protected:
 	void DrawPoint(const GSVertexSW* vertex, int vertex_count, const uint32* index, int index_count);
 	void DrawLine(const GSVertexSW* vertex, const uint32* index);
 	void DrawTriangle(const GSVertexSW* vertex, const uint32* index);
+	int ClassifyTriangles(const GSVertexSW* vertex, const uint32* index, int count) const;
 	void DrawSprite(const GSVertexSW* vertex, const uint32* index);
 
+	bool HiZTest(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& v2) const;
+	void HiZUpdate(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& v2);
+
 #if _M_SSE >= 0x501
 	__forceinline void DrawTriangleSection(int top, int bottom, GSVertexSW2& edge, const GSVertexSW2& dedge, const GSVertexSW2& dscan, const GSVector4& p0);
 #else
@@ -176,6 +202,7 @@ public:
 	void Sync() {}
 	bool IsSynced() const { return true; }
 	int GetPixels(bool reset);
+	void Precompile(const std::vector<uint64>& keys);
 	void PrintStats() { m_ds->PrintStats(); }
 };
 
@@ -208,12 +235,19 @@ public:
 
 		GSRasterizerList* rl = new GSRasterizerList(threads, perfmon);
 
+		// opt-in pinning for multi socket machines, keeps every worker (and
+		// the memory it faults in) on one node, cpu 0 is left to the gs thread
+
+		bool pin = theApp.GetConfigB("extrathreads_affinity");
+		int cpus = std::max<int>(std::thread::hardware_concurrency(), 1);
+
 		for (int i = 0; i < threads; i++)
 		{
 			rl->m_r.push_back(std::unique_ptr<GSRasterizer>(new GSRasterizer(new DS(), i, threads, perfmon)));
 			auto& r = *rl->m_r[i];
 			rl->m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
-				[&r](std::shared_ptr<GSRasterizerData>& item) { r.Draw(item.get()); })));
+				[&r](std::shared_ptr<GSRasterizerData>& item) { r.Draw(item.get()); },
+				pin ? (i + 1) % cpus : -1)));
 		}
 
 		return rl;
@@ -225,5 +259,6 @@ public:
 	void Sync();
 	bool IsSynced() const;
 	int GetPixels(bool reset);
+	void Precompile(const std::vector<uint64>& keys);
 	void PrintStats() {}
 };
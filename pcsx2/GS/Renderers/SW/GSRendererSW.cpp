@@ -36,8 +36,31 @@ GSRendererSW::GSRendererSW(int threads)
 
 	m_rl = GSRasterizerList::Create<GSDrawScanline>(threads, &m_perfmon);
 
+	if (threads > 0)
+	{
+		// expand/deswizzle textures off the GS thread, overlapped with the
+		// scanline work of the draws already queued
+
+		m_tex_updater = std::unique_ptr<GSJobQueue<std::shared_ptr<GSRasterizerData>, 256>>(
+			new GSJobQueue<std::shared_ptr<GSRasterizerData>, 256>(
+				[](std::shared_ptr<GSRasterizerData>& item)
+				{
+					SharedData* sd = (SharedData*)item.get();
+
+					sd->UpdateSource();
+
+					sd->m_tex_ready.store(true, std::memory_order_release);
+				}));
+	}
+
 	m_output = (uint8*)_aligned_malloc(1024 * 1024 * sizeof(uint32), 32);
 
+	if (theApp.GetConfigB("frame_stream"))
+	{
+		for (int i = 0; i < 2; i++)
+			m_frame_stream[i] = std::unique_ptr<GSFrameStream>(new GSFrameStream(i));
+	}
+
 	for (uint32 i = 0; i < countof(m_fzb_pages); i++)
 	{
 		m_fzb_pages[i] = 0;
@@ -47,6 +70,19 @@ GSRendererSW::GSRendererSW(int threads)
 		m_tex_pages[i] = 0;
 	}
 
+	m_hiz_key = 0;
+	m_hiz_epoch = 0;
+
+	memset(m_hiz_pages, 0, sizeof(m_hiz_pages));
+
+	memset(m_output_pages, 0, sizeof(m_output_pages));
+
+	m_output_key[0] = m_output_key[1] = (uint32)-1; // force the first readback
+	m_output_texa[0] = m_output_texa[1] = 0;
+
+	m_scanline_cache_dir = theApp.GetConfigS("scanline_cache_dir");
+	m_scanline_keys_dirty = false;
+
 	#define InitCVB2(P, Q) \
 		m_cvb[P][0][0][Q] = &GSRendererSW::ConvertVertexBuffer<P, 0, 0, Q>; \
 		m_cvb[P][0][1][Q] = &GSRendererSW::ConvertVertexBuffer<P, 0, 1, Q>; \
@@ -75,6 +111,10 @@ GSRendererSW::GSRendererSW(int threads)
 
 GSRendererSW::~GSRendererSW()
 {
+	SaveScanlineCache();
+
+	m_tex_updater.reset(); // joins its thread, must go before the texture cache
+
 	delete m_tc;
 
 	for (size_t i = 0; i < countof(m_texture); i++)
@@ -87,19 +127,105 @@ GSRendererSW::~GSRendererSW()
 	_aligned_free(m_output);
 }
 
+void GSRendererSW::SetGameCRC(uint32 crc, int options)
+{
+	GSRenderer::SetGameCRC(crc, options);
+
+	if (m_scanline_cache_dir.empty() || crc == 0)
+		return;
+
+	// compile the kernels for every selector recorded on a previous run of
+	// this game now, while nothing is queued, instead of hitching at first
+	// use during gameplay
+
+	std::string fn = format("%s/sel_%08x.txt", m_scanline_cache_dir.c_str(), crc);
+
+	FILE* fp = fopen(fn.c_str(), "r");
+
+	if (fp == NULL)
+		return;
+
+	std::vector<uint64> keys;
+
+	unsigned long long key;
+
+	while (fscanf(fp, "%llx", &key) == 1)
+	{
+		if (m_scanline_keys.insert(key).second)
+		{
+			keys.push_back(key);
+		}
+	}
+
+	fclose(fp);
+
+	if (!keys.empty())
+	{
+		Sync(8); // the workers compile into their own maps, they must be idle
+
+		m_rl->Precompile(keys);
+
+		printf("GS: precompiled %zu scanline selectors for %08x\n", keys.size(), crc);
+	}
+}
+
+void GSRendererSW::SaveScanlineCache()
+{
+	if (!m_scanline_keys_dirty || m_scanline_cache_dir.empty() || m_crc == 0)
+		return;
+
+	m_scanline_keys_dirty = false;
+
+	GSmkdir(m_scanline_cache_dir.c_str());
+
+	std::string fn = format("%s/sel_%08x.txt", m_scanline_cache_dir.c_str(), m_crc);
+
+	if (FILE* fp = fopen(fn.c_str(), "w"))
+	{
+		for (auto key : m_scanline_keys)
+		{
+			fprintf(fp, "%016llx\n", (unsigned long long)key);
+		}
+
+		fclose(fp);
+	}
+}
+
 void GSRendererSW::Reset()
 {
 	Sync(-1);
 
 	m_tc->RemoveAll();
 
+	InvalidateHiZ();
+
+	memset(m_output_pages, 0xff, sizeof(m_output_pages)); // local memory is gone
+
 	GSRenderer::Reset();
 }
 
+int GSRendererSW::Defrost(const freezeData* fd)
+{
+	int ret = GSRenderer::Defrost(fd);
+
+	memset(m_output_pages, 0xff, sizeof(m_output_pages)); // the state replaced all of local memory
+
+	return ret;
+}
+
 void GSRendererSW::VSync(int field)
 {
 	Sync(0); // IncAge might delete a cached texture in use
 
+	// the updater's queue may still hold the last reference to a draw for a
+	// moment after the workers are done with it
+	if (m_tex_updater != nullptr)
+		m_tex_updater->Wait();
+
+	m_draw_arena.Reset(); // every SharedData of this frame is destroyed by now
+
+	SaveScanlineCache(); // cheap, only rewrites the file when new selectors appeared
+
 	if (0) if (LOG)
 	{
 		fprintf(s_fp, "%llu\n", m_perfmon.GetFrame());
@@ -161,6 +287,10 @@ GSTexture* GSRendererSW::GetOutput(int i, int& y_offset)
 
 	// TODO: round up bottom
 
+	GSTexture* t = m_texture[i];
+
+	bool fresh = t == NULL || t->GetWidth() != w || t->GetHeight() != h;
+
 	if (m_dev->ResizeTexture(&m_texture[i], w, h))
 	{
 		static int pitch = 1024 * 4;
@@ -169,9 +299,62 @@ GSTexture* GSRendererSW::GetOutput(int i, int& y_offset)
 
 		const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[DISPFB.PSM];
 
-		(m_mem.*psm.rtx)(m_mem.GetOffset(DISPFB.Block(), DISPFB.FBW, DISPFB.PSM), r.ralign<Align_Outside>(psm.bs), m_output, pitch, m_env.TEXA);
+		// the readback is incremental, only the page rows someone wrote to
+		// since the last vsync are deswizzled again, a static menu then
+		// reuses the old texture as is
+
+		uint32 key = DISPFB.Block() | (DISPFB.FBW << 14) | (DISPFB.PSM << 20);
+
+		if (fresh || key != m_output_key[i] || m_env.TEXA.u64 != m_output_texa[i])
+		{
+			m_output_key[i] = key;
+			m_output_texa[i] = m_env.TEXA.u64;
+
+			memset(m_output_pages[i], 0xff, sizeof(m_output_pages[i]));
+		}
+
+		// DISPFB.Block() is always page aligned, the display is FBW pages
+		// wide, so the dirty bitmap maps back to page rows directly
+
+		uint32 first = DISPFB.Block() >> 5;
+		int rows = (h + psm.pgs.y - 1) / psm.pgs.y;
 
-		m_texture[i]->Update(r, m_output, pitch);
+		int top = rows;
+		int bottom = 0;
+
+		for (int j = 0; j < rows; j++)
+		{
+			for (int k = 0; k < (int)DISPFB.FBW; k++)
+			{
+				uint32 p = (first + j * DISPFB.FBW + k) % MAX_PAGES;
+
+				if (m_output_pages[i][p >> 5] & (1 << (p & 31)))
+				{
+					m_output_pages[i][p >> 5] &= ~(1 << (p & 31));
+
+					top = std::min<int>(top, j);
+					bottom = j + 1;
+				}
+			}
+		}
+
+		if (top < bottom)
+		{
+			GSVector4i dirty(0, top * psm.pgs.y, w, std::min<int>(bottom * psm.pgs.y, h));
+
+			uint8* out = m_output + dirty.top * pitch;
+
+			(m_mem.*psm.rtx)(m_mem.GetOffset(DISPFB.Block(), DISPFB.FBW, DISPFB.PSM), dirty.ralign<Align_Outside>(psm.bs), out, pitch, m_env.TEXA);
+
+			m_texture[i]->Update(dirty, out, pitch);
+		}
+
+		if (m_frame_stream[i])
+		{
+			// m_output always holds the full deswizzled frame of this
+			// circuit, the encoder does its own (tile based) delta
+			m_frame_stream[i]->Encode(m_output, w, h, pitch);
+		}
 
 		if (s_dump)
 		{
@@ -340,12 +523,14 @@ void GSRendererSW::Draw()
 {
 	const GSDrawingContext* context = m_context;
 
-	SharedData* sd = new SharedData(this);
+	SharedData* sd = m_draw_arena.New<SharedData>(this);
 
-	std::shared_ptr<GSRasterizerData> data(sd);
+	// the deleter only runs the destructor; the memory is reclaimed wholesale
+	// when the arena resets at vsync
+	std::shared_ptr<GSRasterizerData> data(sd, [](GSRasterizerData* p) { p->~GSRasterizerData(); });
 
 	sd->primclass = m_vt.m_primclass;
-	sd->buff = (uint8*)_aligned_malloc(sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1) + sizeof(uint32) * m_index.tail, 64);
+	sd->buff = (uint8*)m_draw_arena.Alloc(sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1) + sizeof(uint32) * m_index.tail, 64);
 	sd->vertex = (GSVertexSW*)sd->buff;
 	sd->vertex_count = m_vertex.next;
 	sd->index = (uint32*)(sd->buff + sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1));
@@ -440,6 +625,101 @@ void GSRendererSW::Draw()
 
 	sd->UsePages(fb_pages, m_context->offset.fb->psm, zb_pages, m_context->offset.zb->psm);
 
+	// qualify the draw for the coarse per worker z cells, see HiZTest and
+	// HiZUpdate in GSRasterizer, anything the cells cannot follow has to
+	// bump the epoch so the workers drop them
+
+	{
+		GSScanlineSelector sel = sd->global.sel;
+
+		uint32 hiz_key = context->ZBUF.ZBP | (context->ZBUF.PSM << 9) | (context->FRAME.FBW << 13);
+
+		if (hiz_key != m_hiz_key)
+		{
+			m_hiz_key = hiz_key;
+
+			InvalidateHiZ();
+		}
+
+		// zoverflow/zclamp mangle the z value before the compare, leave those to the scanline code
+
+		bool ztest = sel.ztst >= ZTST_GEQUAL && !sel.zoverflow && !sel.zclamp;
+
+		bool monotone = ztest && sel.zwrite && !sel.ftest && !sel.aa1 && zb_pages != NULL;
+
+		if (monotone && sel.fwrite && fb_pages != NULL)
+		{
+			// color writes into the depth buffer would clobber z mid draw
+
+			uint32 zbmp[16];
+
+			memset(zbmp, 0, sizeof(zbmp));
+
+			for (const uint32* p = zb_pages; *p != GSOffset::EOP; p++)
+			{
+				zbmp[*p >> 5] |= 1 << (*p & 31);
+			}
+
+			for (const uint32* p = fb_pages; *p != GSOffset::EOP; p++)
+			{
+				if (zbmp[*p >> 5] & (1 << (*p & 31)))
+				{
+					monotone = false;
+
+					break;
+				}
+			}
+		}
+
+		bool dirty = false;
+
+		if (sel.fwrite && fb_pages != NULL)
+		{
+			for (const uint32* p = fb_pages; *p != GSOffset::EOP && !dirty; p++)
+			{
+				dirty = (m_hiz_pages[*p >> 5] & (1 << (*p & 31))) != 0;
+			}
+		}
+
+		if (!monotone && sel.zwrite && zb_pages != NULL)
+		{
+			for (const uint32* p = zb_pages; *p != GSOffset::EOP && !dirty; p++)
+			{
+				dirty = (m_hiz_pages[*p >> 5] & (1 << (*p & 31))) != 0;
+			}
+		}
+
+		if (dirty)
+		{
+			InvalidateHiZ();
+		}
+
+		sd->hiz_epoch = m_hiz_epoch;
+		sd->hiz_test = ztest && m_vt.m_primclass == GS_TRIANGLE_CLASS;
+		sd->hiz_update = monotone && m_vt.m_primclass == GS_TRIANGLE_CLASS;
+
+		if (sd->hiz_update)
+		{
+			for (const uint32* p = zb_pages; *p != GSOffset::EOP; p++)
+			{
+				m_hiz_pages[*p >> 5] |= 1 << (*p & 31);
+			}
+		}
+
+		// remember what the draw writes so GetOutput can skip the vsync
+		// readback while the displayed pages stay untouched
+
+		if (sel.fwrite && fb_pages != NULL)
+		{
+			MarkOutputDirty(fb_pages);
+		}
+
+		if (sel.zwrite && zb_pages != NULL)
+		{
+			MarkOutputDirty(zb_pages);
+		}
+	}
+
 	//
 
 	if (s_dump)
@@ -546,6 +826,11 @@ void GSRendererSW::Queue(std::shared_ptr<GSRasterizerData>& item)
 {
 	SharedData* sd = (SharedData*)item.get();
 
+	if (!m_scanline_cache_dir.empty() && m_scanline_keys.insert(sd->global.sel.key).second)
+	{
+		m_scanline_keys_dirty = true;
+	}
+
 	if (sd->m_syncpoint == SharedData::SyncSource)
 	{
 		Sync(4);
@@ -553,7 +838,19 @@ void GSRendererSW::Queue(std::shared_ptr<GSRasterizerData>& item)
 
 	// update previously invalidated parts
 
-	sd->UpdateSource();
+	if (m_tex_updater != nullptr && sd->m_tex[0].t != NULL)
+	{
+		// later draws cannot overwrite what the texture reads before the
+		// expansion is done, every worker stops in Prepare until then
+
+		sd->m_tex_ready = false;
+
+		m_tex_updater->Push(item);
+	}
+	else
+	{
+		sd->UpdateSource();
+	}
 
 	if (sd->m_syncpoint == SharedData::SyncTarget)
 	{
@@ -660,6 +957,20 @@ void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 		}
 	}
 
+	for (uint32* RESTRICT p = m_tmp_pages; *p != GSOffset::EOP; p++)
+	{
+		if (m_hiz_pages[*p >> 5] & (1 << (*p & 31)))
+		{
+			// the transfer lands on depth pages the hiz cells learned from
+
+			InvalidateHiZ();
+
+			break;
+		}
+	}
+
+	MarkOutputDirty(m_tmp_pages);
+
 	m_tc->InvalidatePages(m_tmp_pages, off->psm); // if texture update runs on a thread and Sync(5) happens then this must come later
 }
 
@@ -689,6 +1000,24 @@ void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 	}
 }
 
+void GSRendererSW::InvalidateHiZ()
+{
+	m_hiz_epoch++;
+
+	memset(m_hiz_pages, 0, sizeof(m_hiz_pages));
+}
+
+void GSRendererSW::MarkOutputDirty(const uint32* pages)
+{
+	for (const uint32* p = pages; *p != GSOffset::EOP; p++)
+	{
+		uint32 o = 1 << (*p & 31);
+
+		m_output_pages[0][*p >> 5] |= o;
+		m_output_pages[1][*p >> 5] |= o;
+	}
+}
+
 void GSRendererSW::UsePages(const uint32* pages, const int type)
 {
 	for (const uint32* p = pages; *p != GSOffset::EOP; p++)
@@ -1120,6 +1449,27 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 					mxl--; // don't sample beyond the last level (TODO: add a dummy level instead?)
 				}
 
+				if (!gd.sel.lcm && gd.sel.mmin == 1)
+				{
+					// the lod range of the whole draw often rounds to a single
+					// level, then the per pixel selection in the scanline code
+					// can be skipped, m_lod is the exact lod min/max since q
+					// is interpolated linearly and the formula is monotone
+
+					float lx = std::min<float>(std::max<float>(m_vt.m_lod.x, 0.0f), 8.0f);
+					float ly = std::min<float>(std::max<float>(m_vt.m_lod.y, 0.0f), 8.0f);
+
+					int lodx = std::min<int>((int)(lx * 65536.0f), mxl);
+					int lody = std::min<int>((int)(ly * 65536.0f), mxl);
+
+					if (((lodx + 0x8000) & 0xffff0000) == ((lody + 0x8000) & 0xffff0000))
+					{
+						k = lodx;
+
+						gd.sel.lcm = 1;
+					}
+				}
+
 				if (gd.sel.fst)
 				{
 					ASSERT(gd.sel.lcm == 1);
@@ -1429,6 +1779,7 @@ GSRendererSW::SharedData::SharedData(GSRendererSW* parent)
 	, m_zpsm(0)
 	, m_using_pages(false)
 	, m_syncpoint(SyncNone)
+	, m_tex_ready(true)
 {
 	m_tex[0].t = NULL;
 
@@ -1456,6 +1807,21 @@ GSRendererSW::SharedData::~SharedData()
 			global.sel.hi, global.sel.lo);
 		fflush(s_fp);
 	}
+
+	// the vertex/index buffer lives in the parent's draw arena; keep the base
+	// destructor from freeing it
+	buff = NULL;
+}
+
+void GSRendererSW::SharedData::Prepare()
+{
+	// the update thread receives the draws in the same order as the workers,
+	// it is usually ahead and this returns immediately
+
+	while (!m_tex_ready.load(std::memory_order_acquire))
+	{
+		std::this_thread::yield();
+	}
 }
 
 //static TransactionScope::Lock s_lock;
@@ -17,6 +17,8 @@
 
 #include "GSTextureCacheSW.h"
 #include "GSDrawScanline.h"
+#include "GSFrameStream.h"
+#include "common/BumpArena.h"
 
 class GSRendererSW : public GSRenderer
 {
@@ -48,10 +50,15 @@ class GSRendererSW : public GSRenderer
 			SyncTarget
 		} m_syncpoint;
 
+	public:
+		std::atomic<bool> m_tex_ready; // set by the texture update thread, see Prepare
+
 	public:
 		SharedData(GSRendererSW* parent);
 		virtual ~SharedData();
 
+		void Prepare();
+
 		void UsePages(const uint32* fb_pages, int fpsm, const uint32* zb_pages, int zpsm);
 		void ReleasePages();
 
@@ -68,7 +75,13 @@ class GSRendererSW : public GSRenderer
 
 protected:
 	IRasterizer* m_rl;
+	// runs texture expansion one draw ahead of the workers, they cannot
+	// overtake it because each of them waits in SharedData::Prepare
+	std::unique_ptr<GSJobQueue<std::shared_ptr<GSRasterizerData>, 256>> m_tex_updater;
 	GSTextureCacheSW* m_tc;
+	// per-frame storage for the SharedData and vertex/index buffers handed to
+	// the workers; reset in VSync once everything is synced
+	BumpArena m_draw_arena;
 	GSTexture* m_texture[2];
 	uint8* m_output;
 	GSPixelOffset4* m_fzb;
@@ -77,10 +90,23 @@ protected:
 	std::atomic<uint32> m_fzb_pages[512]; // uint16 frame/zbuf pages interleaved
 	std::atomic<uint16> m_tex_pages[512];
 	uint32 m_tmp_pages[512 + 1];
+	uint32 m_hiz_key;
+	uint32 m_hiz_epoch;
+	uint32 m_hiz_pages[16]; // page bitmap of everything the hiz cells learned from
+	uint32 m_output_pages[2][16]; // pages written since the last readback of each output
+	uint32 m_output_key[2];
+	uint64 m_output_texa[2];
+	std::unique_ptr<GSFrameStream> m_frame_stream[2]; // delta encoders for remote display, NULL unless frame_stream is set
+	std::string m_scanline_cache_dir;
+	std::unordered_set<uint64> m_scanline_keys; // selectors seen this run, persisted per game crc
+	bool m_scanline_keys_dirty;
 
 	void Reset();
+	int Defrost(const freezeData* fd);
 	void VSync(int field);
 	void ResetDevice();
+	void SetGameCRC(uint32 crc, int options);
+	void SaveScanlineCache();
 	GSTexture* GetOutput(int i, int& y_offset);
 	GSTexture* GetFeedbackOutput();
 
@@ -96,6 +122,9 @@ protected:
 	bool CheckTargetPages(const uint32* fb_pages, const uint32* zb_pages, const GSVector4i& r);
 	bool CheckSourcePages(SharedData* sd);
 
+	void InvalidateHiZ();
+	void MarkOutputDirty(const uint32* pages);
+
 	bool GetScanlineGlobalData(SharedData* data);
 
 public:
@@ -79,7 +79,7 @@ void GSTextureSW::Unmap()
 	m_mapped.clear(std::memory_order_release);
 }
 
-bool GSTextureSW::Save(const std::string& fn)
+bool GSTextureSW::Save(const std::string& fn, GSPng::Worker* async)
 {
 #ifdef ENABLE_OGL_DEBUG
 	GSPng::Format fmt = GSPng::RGB_A_PNG;
@@ -87,5 +87,12 @@ bool GSTextureSW::Save(const std::string& fn)
 	GSPng::Format fmt = GSPng::RGB_PNG;
 #endif
 	int compression = theApp.GetConfigI("png_compression_level");
+
+	if (async)
+	{
+		async->Push(std::make_shared<GSPng::Transaction>(fmt, fn, static_cast<uint8*>(m_data), m_size.x, m_size.y, m_pitch, compression));
+		return true;
+	}
+
 	return GSPng::Save(fmt, fn, static_cast<uint8*>(m_data), m_size.x, m_size.y, m_pitch, compression);
 }
@@ -32,5 +32,5 @@ public:
 	bool Update(const GSVector4i& r, const void* data, int pitch, int layer = 0);
 	bool Map(GSMap& m, const GSVector4i* r = NULL, int layer = 0);
 	void Unmap();
-	bool Save(const std::string& fn);
+	bool Save(const std::string& fn, GSPng::Worker* async = nullptr);
 };
@@ -46,10 +46,20 @@ vec4 ContrastSaturationBrightness(vec4 color)
 }
 
 
+#ifndef SB_LUMA_ALPHA
+#define SB_LUMA_ALPHA 0
+#endif
+
 void ps_main()
 {
     vec4 c = texture(TextureSampler, PSin.t);
-    SV_Target0 = ContrastSaturationBrightness(c);
+    c = ContrastSaturationBrightness(c);
+#if SB_LUMA_ALPHA
+    // Same luma the transparency filter of convert.glsl computes, lets a
+    // following FXAA pass run without its prepass.
+    c.a = dot(c.rgb, vec3(0.299, 0.587, 0.114));
+#endif
+    SV_Target0 = c;
 }
 
 
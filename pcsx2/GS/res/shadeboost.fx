@@ -44,10 +44,20 @@ struct PS_INPUT
 	float2 t : TEXCOORD0;
 };
 
+#ifndef SB_LUMA_ALPHA
+#define SB_LUMA_ALPHA 0
+#endif
+
 float4 ps_main(PS_INPUT input) : SV_Target0
 {
 	float4 c = Texture.Sample(Sampler, input.t);
-	return ContrastSaturationBrightness(c);
+	c = ContrastSaturationBrightness(c);
+#if SB_LUMA_ALPHA
+	// Same luma the transparency filter of convert.fx computes, lets a
+	// following FXAA pass run without its prepass.
+	c.a = dot(c.rgb, float3(0.299, 0.587, 0.114));
+#endif
+	return c;
 }
 
 #endif
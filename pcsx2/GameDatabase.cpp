@@ -22,6 +22,7 @@
 #include "yaml-cpp/yaml.h"
 #include <fstream>
 #include <algorithm>
+#include <iterator>
 
 std::string strToLower(std::string str)
 {
@@ -186,10 +187,36 @@ GameDatabaseSchema::GameEntry YamlGameDatabaseImpl::findGame(const std::string s
 {
 	std::string serialLower = strToLower(serial);
 	Console.WriteLn(fmt::format("[GameDB] Searching for '{}' in GameDB", serialLower));
-	if (gameDb.count(serialLower) == 1)
+
+	auto cached = gameDb.find(serialLower);
+	if (cached != gameDb.end())
 	{
 		Console.WriteLn(fmt::format("[GameDB] Found '{}' in GameDB", serialLower));
-		return gameDb[serialLower];
+		return cached->second;
+	}
+
+	auto indexed = gameIndex.find(serialLower);
+	if (indexed != gameIndex.end())
+	{
+		// the entry hasn't been needed before, parse it out of the raw file now
+		GameDatabaseSchema::GameEntry entry;
+		try
+		{
+			YAML::Node data = YAML::Load(std::string(rawDb + indexed->second.offset, indexed->second.length));
+			entry = entryFromYaml(serialLower, data.begin()->second);
+		}
+		catch (const std::exception& e)
+		{
+			Console.Error(fmt::format("[GameDB] Invalid GameDB syntax detected on serial: '{}'. Error Details - {}", serialLower, e.what()));
+			entry.isValid = false;
+		}
+		gameDb[serialLower] = entry;
+
+		if (entry.isValid)
+		{
+			Console.WriteLn(fmt::format("[GameDB] Found '{}' in GameDB", serialLower));
+		}
+		return entry;
 	}
 
 	Console.Error(fmt::format("[GameDB] Could not find '{}' in GameDB", serialLower));
@@ -200,7 +227,13 @@ GameDatabaseSchema::GameEntry YamlGameDatabaseImpl::findGame(const std::string s
 
 int YamlGameDatabaseImpl::numGames()
 {
-	return gameDb.size();
+	return gameIndex.size();
+}
+
+YamlGameDatabaseImpl::~YamlGameDatabaseImpl()
+{
+	if (rawDbMapping)
+		HostSys::MunmapFile(rawDbMapping, rawDbSize);
 }
 
 bool YamlGameDatabaseImpl::initDatabase(std::ifstream& stream)
@@ -212,32 +245,84 @@ bool YamlGameDatabaseImpl::initDatabase(std::ifstream& stream)
 			Console.Error("[GameDB] Unable to open GameDB file.");
 			return false;
 		}
-		// yaml-cpp has memory leak issues if you persist and modify a YAML::Node
-		// convert to a map and throw it away instead!
-		YAML::Node data = YAML::Load(stream);
-		for (const auto& entry : data)
+
+		rawDbStorage.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		rawDb = rawDbStorage.data();
+		rawDbSize = rawDbStorage.size();
+	}
+	catch (const std::exception& e)
+	{
+		Console.Error(fmt::format("[GameDB] Error occured when initializing GameDB: {}", e.what()));
+		return false;
+	}
+
+	return buildIndex();
+}
+
+bool YamlGameDatabaseImpl::initDatabase(const wxString& filePath)
+{
+	// A read-only mapping beats copying the text onto the heap: the pages stay backed
+	// by the page cache, so any number of instances on the machine share one physical
+	// copy of the database.
+	rawDbMapping = HostSys::MmapFile(filePath, rawDbSize);
+	if (!rawDbMapping)
+		return false;
+
+	rawDb = (const char*)rawDbMapping;
+	return buildIndex();
+}
+
+// Parsing the entire file into a YAML document costs several seconds and tens of
+// megabytes for a database this size, and a given session only ever looks at a
+// handful of entries.  So just index which byte range of the file belongs to which
+// serial here, and parse single entries on demand in findGame().
+//
+// Serials are the top level keys of the document, and yaml-cpp keeps entries
+// self-contained (no anchors/aliases), so every line that starts at column 0 with a
+// key begins a new entry.
+bool YamlGameDatabaseImpl::buildIndex()
+{
+	try
+	{
+		std::string currentSerial;
+		size_t currentOffset = 0;
+		size_t lineStart = 0;
+		while (lineStart < rawDbSize)
 		{
-			// we don't want to throw away the entire GameDB file if a single entry is made incorrectly,
-			// but we do want to yell about it so it can be corrected
-			try
+			const char* nl = (const char*)memchr(rawDb + lineStart, '\n', rawDbSize - lineStart);
+			const size_t lineEnd = nl ? (size_t)(nl - rawDb) : rawDbSize;
+
+			const char first = rawDb[lineStart];
+			if (first != ' ' && first != '\t' && first != '#' && first != '\r' && first != '\n' && lineStart != lineEnd)
 			{
-				// Serials and CRCs must be inserted as lower-case, as that is how they are retrieved
-				// this is because the application may pass a lowercase CRC or serial along
-				//
-				// However, YAML's keys are as expected case-sensitive, so we have to explicitly do our own duplicate checking
-				std::string serial = strToLower(entry.first.as<std::string>());
-				if (gameDb.count(serial) == 1)
+				const char* colon = (const char*)memchr(rawDb + lineStart, ':', lineEnd - lineStart);
+				if (colon)
 				{
-					Console.Error(fmt::format("[GameDB] Duplicate serial '{}' found in GameDB. Skipping, Serials are case-insensitive!", serial));
-					continue;
+					if (!currentSerial.empty())
+						gameIndex[currentSerial] = {currentOffset, lineStart - currentOffset};
+
+					// Serials and CRCs must be inserted as lower-case, as that is how they are retrieved
+					// this is because the application may pass a lowercase CRC or serial along
+					//
+					// However, YAML's keys are as expected case-sensitive, so we have to explicitly do our own duplicate checking
+					std::string serial = strToLower(std::string(rawDb + lineStart, colon - (rawDb + lineStart)));
+					if (gameIndex.count(serial) == 1)
+					{
+						Console.Error(fmt::format("[GameDB] Duplicate serial '{}' found in GameDB. Skipping, Serials are case-insensitive!", serial));
+						currentSerial.clear();
+					}
+					else
+					{
+						currentSerial = serial;
+						currentOffset = lineStart;
+					}
 				}
-				gameDb[serial] = entryFromYaml(serial, entry.second);
-			}
-			catch (const YAML::RepresentationException& e)
-			{
-				Console.Error(fmt::format("[GameDB] Invalid GameDB syntax detected. Error Details - {}", e.msg));
 			}
+
+			lineStart = lineEnd + 1;
 		}
+		if (!currentSerial.empty())
+			gameIndex[currentSerial] = {currentOffset, rawDbSize - currentOffset};
 	}
 	catch (const std::exception& e)
 	{
@@ -94,12 +94,34 @@ public:
 class YamlGameDatabaseImpl : public IGameDatabase
 {
 public:
+	virtual ~YamlGameDatabaseImpl();
+
 	bool initDatabase(std::ifstream& stream) override;
+	// Preferred entry point: maps the file read-only instead of copying it, so
+	// concurrently running instances share one page-cache copy of the database text.
+	// Returns false if the file couldn't be mapped; use the stream overload then.
+	bool initDatabase(const wxString& filePath);
 	GameDatabaseSchema::GameEntry findGame(const std::string serial) override;
 	int numGames() override;
 
 private:
+	// the raw text of the database file; individual entries are parsed out of this
+	// on demand, which keeps startup down to a single linear scan of the file.
+	// points either at rawDbMapping or into rawDbStorage
+	const char* rawDb = nullptr;
+	size_t rawDbSize = 0;
+	void* rawDbMapping = nullptr;
+	std::string rawDbStorage;
+	// maps serials to the byte range their entry occupies in rawDb
+	struct RawEntryRange
+	{
+		size_t offset;
+		size_t length;
+	};
+	std::unordered_map<std::string, RawEntryRange> gameIndex;
+	// entries that have already been parsed, so each one only pays the YAML cost once
 	std::unordered_map<std::string, GameDatabaseSchema::GameEntry> gameDb;
+	bool buildIndex();
 	GameDatabaseSchema::GameEntry entryFromYaml(const std::string serial, const YAML::Node& node);
 
 	std::vector<std::string> convertMultiLineStringToVector(const std::string multiLineString);
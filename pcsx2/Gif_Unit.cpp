@@ -20,6 +20,7 @@
 #include "Gif_Unit.h"
 #include "Vif_Dma.h"
 #include "MTVU.h"
+#include "DebugTools/Tracepoint.h"
 
 Gif_Unit gifUnit;
 
@@ -205,14 +206,27 @@ void Gif_AddGSPacketMTVU(GS_Packet& gsPack, GIF_PATH path)
 	GetMTGS().SendSimpleGSPacket(GS_RINGTYPE_MTVU_GSPACKET, 0, 0, path);
 }
 
+// Queues a finished GS packet for the MTGS thread. The default path is zero
+// copy: only a small tag goes through the ring buffer, the GS thread reads
+// the data straight out of the path buffer and signals completion by
+// decrementing readAmount (the fence CopyGSPacketData waits on before it
+// reuses that part of the buffer). The single copy that remains - EE memory
+// into the path buffer - is what allows the EE to reuse its memory right
+// after the DMA, dropping it would just trade a memcpy for an EE stall.
 void Gif_AddCompletedGSPacket(GS_Packet& gsPack, GIF_PATH path)
 {
 	//DevCon.WriteLn("Adding Completed Gif Packet [size=%x]", gsPack.size);
 	if (COPY_GS_PACKET_TO_MTGS)
 	{
 		GetMTGS().PrepDataPacket(path, gsPack.size / 16);
-		MemCopy_WrappedDest((u128*)&gifUnit.gifPath[path].buffer[gsPack.offset], RingBuffer.m_Ring,
-							GetMTGS().m_packet_writepos, RingBufferSize, gsPack.size / 16);
+		// Big image transfers get streamed past the cache -- at that size they'd
+		// only evict rec blocks and the GS thread misses to DRAM regardless.
+		if (gsPack.size >= _256kb)
+			MemCopy_WrappedDest_NT((u128*)&gifUnit.gifPath[path].buffer[gsPack.offset], RingBuffer.m_Ring,
+								   GetMTGS().m_packet_writepos, RingBufferSize, gsPack.size / 16);
+		else
+			MemCopy_WrappedDest((u128*)&gifUnit.gifPath[path].buffer[gsPack.offset], RingBuffer.m_Ring,
+								GetMTGS().m_packet_writepos, RingBufferSize, gsPack.size / 16);
 		GetMTGS().SendDataPacket();
 	}
 	else
@@ -235,6 +249,50 @@ void Gif_MTGS_Wait(bool isMTVU)
 	GetMTGS().WaitGS(false, true, isMTVU);
 }
 
+// --- GIF stream statistics -------------------------------------------------
+// Per-frame packet counts, byte volume and a log2 size histogram per path,
+// folded into the tracepoint rings at vsync.  When the GS thread saturates,
+// the histogram says whether the load is many small packets (dispatch bound)
+// or raw volume (bandwidth bound).  Relaxed atomics: path 1 records from the
+// MTVU thread while the flush runs on the EE thread.
+
+static std::atomic<u32> s_gifPackets[3];
+static std::atomic<u32> s_gifBytes[3];
+static std::atomic<u32> s_gifSizeHist[3][16];
+
+void Gif_RecordPacketStats(u32 path, u32 size)
+{
+	Tracepoint::Record(TRACE_GIF_PACKET, path, size);
+
+	s_gifPackets[path].fetch_add(1, std::memory_order_relaxed);
+	s_gifBytes[path].fetch_add(size, std::memory_order_relaxed);
+
+	u32 bucket = 0;
+	while (bucket < 15 && (2u << bucket) <= size)
+		bucket++;
+	s_gifSizeHist[path][bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void Gif_FlushFrameStats()
+{
+	for (u32 path = 0; path < 3; path++)
+	{
+		const u32 packets = s_gifPackets[path].exchange(0, std::memory_order_relaxed);
+		const u32 bytes = s_gifBytes[path].exchange(0, std::memory_order_relaxed);
+
+		if (!packets)
+			continue;
+
+		Tracepoint::Record(TRACE_GIF_FRAME_STATS, (path << 28) | packets, bytes);
+
+		for (u32 b = 0; b < 16; b++)
+		{
+			if (const u32 n = s_gifSizeHist[path][b].exchange(0, std::memory_order_relaxed))
+				Tracepoint::Record(TRACE_GIF_SIZE_HIST, (path << 8) | b, n);
+		}
+	}
+}
+
 void SaveStateBase::gifPathFreeze(u32 path)
 {
 
@@ -30,6 +30,8 @@ extern bool Gif_HandlerAD(u8* pMem);
 extern bool Gif_HandlerAD_MTVU(u8* pMem);
 extern bool Gif_HandlerAD_Debug(u8* pMem);
 extern void Gif_AddBlankGSPacket(u32 size, GIF_PATH path);
+extern void Gif_RecordPacketStats(u32 path, u32 size);
+extern void Gif_FlushFrameStats();
 extern void Gif_AddGSPacketMTVU(GS_Packet& gsPack, GIF_PATH path);
 extern void Gif_AddCompletedGSPacket(GS_Packet& gsPack, GIF_PATH path);
 extern void Gif_ParsePacket(u8* data, u32 size, GIF_PATH path);
@@ -598,6 +600,7 @@ struct Gif_Unit
 			Gif_Path& path1 = gifPath[GIF_PATH_1];
 			if (tranType == GIF_TRANS_XGKICK)
 			{ // This is on the MTVU thread
+				Gif_RecordPacketStats(GIF_PATH_1, size);
 				path1.CopyGSPacketData(pMem, size, aligned);
 				path1.ExecuteGSPacketMTVU();
 				return size;
@@ -663,6 +666,10 @@ struct Gif_Unit
 			} // DirectHL Stall
 		}
 
+		// Only counted once the data is actually accepted; the stall cases
+		// above return before getting here and retry later.
+		Gif_RecordPacketStats(tranType & 3, size);
+
 		gifPath[tranType & 3].CopyGSPacketData(pMem, size, aligned);
 		size -= Execute(tranType == GIF_TRANS_DMA, false);
 		return size;
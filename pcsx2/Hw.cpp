@@ -22,6 +22,7 @@
 #include "Gif_Unit.h"
 #include "IopCommon.h"
 #include "SPU2/spu2.h"
+#include "DebugTools/Tracepoint.h"
 
 using namespace R5900;
 
@@ -135,6 +136,7 @@ void hwIntcIrq(int n)
 
 void hwDmacIrq(int n)
 {
+	Tracepoint::Record(TRACE_EE_DMA_IRQ, n);
 	psHu32(DMAC_STAT) |= 1<<n;
 	if(psHu16(DMAC_STAT+2) & (1<<n))cpuTestDMACInts();
 }
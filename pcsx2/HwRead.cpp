@@ -90,6 +90,11 @@ mem32_t __fastcall _hwRead32(u32 mem)
 				return psHu32(INTC_STAT);
 			}
 
+			// Interrupt handlers read the mask right alongside the status, so give it
+			// the same early-out rather than running it through the SBUS checks below.
+			if (mem == INTC_MASK)
+				return psHu32(INTC_MASK);
+
 			// todo: psx mode: this is new
 			if (((mem & 0x1FFFFFFF) >= EEMemoryMap::SBUS_PS1_Start) && ((mem & 0x1FFFFFFF) < EEMemoryMap::SBUS_PS1_End)) {
 				return PGIFr((mem & 0x1FFFFFFF));
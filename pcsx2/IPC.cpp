@@ -482,6 +482,41 @@ SocketIPC::IPCBuffer SocketIPC::ParseCommand(char* buf, char* ret_buffer, u32 bu
 				ret_cnt += 4;
 				break;
 			}
+			case MsgReadBytes:
+			{
+				if (!m_vm->HasActiveMachine())
+					goto error;
+				if (!SafetyChecks(buf_cnt, 8, ret_cnt, 0, buf_size))
+					goto error;
+				const u32 a = FromArray<u32>(&buf[buf_cnt], 0);
+				const u32 size = FromArray<u32>(&buf[buf_cnt], 4);
+				// the size is client controlled so we have to bound it before
+				// handing it to SafetyChecks as a reply size
+				if (size >= MAX_IPC_RETURN_SIZE || !SafetyChecks(buf_cnt, 8, ret_cnt, size, buf_size))
+					goto error;
+				// bulk copy in 64 bit strides when aligned so that sampling a
+				// big block costs one command header instead of one command
+				// per word
+				u32 off = 0;
+				if ((a & 7) == 0)
+				{
+					while (off + 8 <= size)
+					{
+						u64 res = 0;
+						memRead64(a + off, &res);
+						ToArray(ret_buffer, res, ret_cnt + off);
+						off += 8;
+					}
+				}
+				while (off < size)
+				{
+					ToArray(ret_buffer, memRead8(a + off), ret_cnt + off);
+					off++;
+				}
+				ret_cnt += size;
+				buf_cnt += 8;
+				break;
+			}
 			default:
 			{
 			error:
@@ -105,6 +105,7 @@ protected:
 		MsgUUID = 0xD,          /**< Returns the game UUID. */
 		MsgGameVersion = 0xE,   /**< Returns the game verion. */
 		MsgStatus = 0xF,        /**< Returns the emulator status. */
+		MsgReadBytes = 0x10,    /**< Read an arbitrarily sized block of memory. */
 		MsgUnimplemented = 0xFF /**< Unimplemented IPC message. */
 	};
 
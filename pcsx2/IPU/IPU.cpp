@@ -935,6 +935,14 @@ __fi void IPUCMD_WRITE(u32 val)
 	//if(!ipu1ch.chcr.STR) hwIntcIrq(INTC_IPU);
 }
 
+// Note on threading: moving this decoder off the EE thread has been looked at
+// and doesn't work out.  The decoder *pulls* its input on demand -- running the
+// IPU1 chain DMA (tag walks through guest RAM) from inside ipu_fifo.in.read --
+// so speculative decode-ahead would race against the game writing its next
+// chunk of stream data; and BP/OFC/TOP register reads plus the IPU interrupts
+// are synchronously visible to the EE, which would force a fence at practically
+// every step of the dispatcher anyway.  Cheaper decode (SIMD IDCT, direct fifo
+// drain) is the productive direction here; see Idct.cpp and IPU_Fifo.cpp.
 __noinline void IPUWorker()
 {
 	pxAssert(ipuRegs.ctrl.BUSY);
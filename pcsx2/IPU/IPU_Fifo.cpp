@@ -109,11 +109,10 @@ int IPU_Fifo_Output::write(const u32 *value, uint size)
 	pxAssertMsg(size>0, "Invalid size==0 when calling IPU_Fifo_Output::write");
 
 	uint origsize = size;
-	/*do {*/
-		//IPU0dma();
-	
+	do
+	{
 		uint transsize = std::min(size, 8 - (uint)ipuRegs.ctrl.OFC);
-		if(!transsize) return 0;
+		if(!transsize) break;
 
 		ipuRegs.ctrl.OFC += transsize;
 		size -= transsize;
@@ -124,7 +123,16 @@ int IPU_Fifo_Output::write(const u32 *value, uint size)
 			value += 4;
 			--transsize;
 		}
-	/*} while(true);*/
+
+		// The fifo only holds 8 qwords, so without help the decoder has to
+		// suspend and take a full trip through the dma event loop for every
+		// 8 qwords of a 64-qword macroblock.  While an IPU0 transfer is
+		// actively draining, push the fifo straight out to the destination
+		// instead, so the whole block goes in one go.
+		if (!size)
+			break;
+	} while (IPU0drainFifo());
+
 	if(ipu0ch.chcr.STR)
 		IPU_INT_FROM(64);
 	return origsize - size;
@@ -188,6 +188,52 @@ int IPU1dma()
 	return totalqwc;
 }
 
+// Drains the output fifo directly to the IPU0 DMA destination, bypassing the
+// 8-qwords-per-event round trips through the dma event loop.  Called from the
+// fifo write handler while the decoder is producing; the end-of-transfer IRQ
+// still goes through ipu0Interrupt via the event scheduled here.  Returns true
+// if any data moved (so the caller can keep filling the fifo).
+bool IPU0drainFifo()
+{
+	if (!ipuRegs.ctrl.OFC)
+		return false;
+
+	if (!ipu0ch.chcr.STR || ipu0ch.qwc == 0)
+		return false;
+
+	tDMA_TAG* pMem = dmaGetAddr(ipu0ch.madr, true);
+	if (pMem == NULL)
+		return false;
+
+	const int readsize = std::min(ipu0ch.qwc, (u32)ipuRegs.ctrl.OFC);
+	ipu_fifo.out.read(pMem, readsize);
+
+	ipu0ch.madr += readsize << 4;
+	ipu0ch.qwc -= readsize;
+
+	if (dmacRegs.ctrl.STS == STS_fromIPU && ipu0ch.qwc == 0)   // STS == fromIPU
+	{
+		dmacRegs.stadr.ADDR = ipu0ch.madr;
+		switch (dmacRegs.ctrl.STD)
+		{
+			case NO_STD:
+				break;
+			case STD_GIF: // GIF
+				g_nDMATransfer.GIFSTALL = true;
+				break;
+			case STD_VIF1: // VIF
+				g_nDMATransfer.VIFSTALL = true;
+				break;
+			case STD_SIF1:
+				g_nDMATransfer.SIFSTALL = true;
+				break;
+		}
+	}
+
+	IPU_INT_FROM(readsize * BIAS);
+	return true;
+}
+
 void IPU0dma()
 {
 	if(!ipuRegs.ctrl.OFC) 
@@ -88,6 +88,7 @@ extern void ipu1Interrupt();
 extern void dmaIPU0();
 extern void dmaIPU1();
 extern void IPU0dma();
+extern bool IPU0drainFifo();
 extern int IPU1dma();
 
 extern void ipuDmaReset();
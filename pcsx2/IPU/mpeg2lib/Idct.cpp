@@ -22,9 +22,10 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
 
-// [TODO] : There are modern SSE versions of idct (idct_mmx.c) in the mpeg2 libs that we
-// should probably upgrade to.  They use their own raw-style intrinsics and not the intel
-// compiler-integrated ones.
+// The column pass and the clip/copy are SSE2 (see idct_col4 below); the row
+// pass is deliberately scalar because of its all-zero-AC shortcut.  libmpeg2's
+// own idct_mmx.c was considered instead, but it is a different fixed-point
+// network and does not produce the same output as this one.
 
 #include "PrecompiledHeader.h"
 
@@ -114,45 +115,82 @@ static __fi void idct_row (s16 * const block)
     block[7] = (a0 - b0) >> 8;
 }
 
-static __fi void idct_col (s16 * const block)
+// The column pass runs the same butterfly network on all eight columns with
+// no data-dependent branches, so it vectorizes four columns at a time in
+// 32-bit lanes -- a direct transcription of the old scalar idct_col, and
+// bit-exact with it.  The row pass stays scalar: its all-zero-AC shortcut
+// fires for most rows of a typical stream and is worth more than the SIMD.
+
+// SSE2 has no 32-bit low multiply; the unsigned 32x32->64 multiply produces
+// the correct low halves regardless of sign.
+static __fi __m128i idct_mullo32(const __m128i& a, const __m128i& b)
 {
-    int d0, d1, d2, d3;
-    int a0, a1, a2, a3, b0, b1, b2, b3;
-    int t0, t1, t2, t3;
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    even = _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0));
+    odd  = _mm_shuffle_epi32(odd,  _MM_SHUFFLE(0, 0, 2, 0));
+    return _mm_unpacklo_epi32(even, odd);
+}
 
-    d0 = (block[8*0] << 11) + 65536;
-    d1 = block[8*1];
-    d2 = block[8*2] << 11;
-    d3 = block[8*3];
-    t0 = d0 + d2;
-    t1 = d0 - d2;
-    BUTTERFLY (t2, t3, W6, W2, d3, d1);
-    a0 = t0 + t2;
-    a1 = t1 + t3;
-    a2 = t1 - t3;
-    a3 = t0 - t2;
+// sign-extends four s16 coefficients to 32-bit lanes
+static __fi __m128i idct_load4(const s16* p)
+{
+    return _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i*)p)), 16);
+}
 
-    d0 = block[8*4];
-    d1 = block[8*5];
-    d2 = block[8*6];
-    d3 = block[8*7];
-    BUTTERFLY (t0, t1, W7, W1, d3, d0);
-    BUTTERFLY (t2, t3, W3, W5, d1, d2);
-    b0 = t0 + t2;
-    b3 = t1 + t3;
-    t0 = (t0 - t2) >> 8;
-    t1 = (t1 - t3) >> 8;
-    b1 = (t0 + t1) * 181;
-    b2 = (t0 - t1) * 181;
-
-    block[8*0] = (a0 + b0) >> 17;
-    block[8*1] = (a1 + b1) >> 17;
-    block[8*2] = (a2 + b2) >> 17;
-    block[8*3] = (a3 + b3) >> 17;
-    block[8*4] = (a3 - b3) >> 17;
-    block[8*5] = (a2 - b2) >> 17;
-    block[8*6] = (a1 - b1) >> 17;
-    block[8*7] = (a0 - b0) >> 17;
+// truncates to 16 bits exactly as the scalar s16 stores did
+static __fi void idct_store4(s16* p, __m128i x)
+{
+    x = _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+    _mm_storel_epi64((__m128i*)p, _mm_packs_epi32(x, x));
+}
+
+static __fi void idct_butterfly4(__m128i& t0, __m128i& t1, int w0, int w1, const __m128i& d0, const __m128i& d1)
+{
+    __m128i tmp = idct_mullo32(_mm_set1_epi32(w0), _mm_add_epi32(d0, d1));
+    t0 = _mm_add_epi32(tmp, idct_mullo32(_mm_set1_epi32(w1 - w0), d1));
+    t1 = _mm_sub_epi32(tmp, idct_mullo32(_mm_set1_epi32(w1 + w0), d0));
+}
+
+static __fi void idct_col4 (s16 * const block)
+{
+    __m128i d0, d1, d2, d3;
+    __m128i a0, a1, a2, a3, b0, b1, b2, b3;
+    __m128i t0, t1, t2, t3;
+
+    d0 = _mm_add_epi32(_mm_slli_epi32(idct_load4(block + 8*0), 11), _mm_set1_epi32(65536));
+    d1 = idct_load4(block + 8*1);
+    d2 = _mm_slli_epi32(idct_load4(block + 8*2), 11);
+    d3 = idct_load4(block + 8*3);
+    t0 = _mm_add_epi32(d0, d2);
+    t1 = _mm_sub_epi32(d0, d2);
+    idct_butterfly4 (t2, t3, W6, W2, d3, d1);
+    a0 = _mm_add_epi32(t0, t2);
+    a1 = _mm_add_epi32(t1, t3);
+    a2 = _mm_sub_epi32(t1, t3);
+    a3 = _mm_sub_epi32(t0, t2);
+
+    d0 = idct_load4(block + 8*4);
+    d1 = idct_load4(block + 8*5);
+    d2 = idct_load4(block + 8*6);
+    d3 = idct_load4(block + 8*7);
+    idct_butterfly4 (t0, t1, W7, W1, d3, d0);
+    idct_butterfly4 (t2, t3, W3, W5, d1, d2);
+    b0 = _mm_add_epi32(t0, t2);
+    b3 = _mm_add_epi32(t1, t3);
+    t0 = _mm_srai_epi32(_mm_sub_epi32(t0, t2), 8);
+    t1 = _mm_srai_epi32(_mm_sub_epi32(t1, t3), 8);
+    b1 = idct_mullo32(_mm_set1_epi32(181), _mm_add_epi32(t0, t1));
+    b2 = idct_mullo32(_mm_set1_epi32(181), _mm_sub_epi32(t0, t1));
+
+    idct_store4(block + 8*0, _mm_srai_epi32(_mm_add_epi32(a0, b0), 17));
+    idct_store4(block + 8*1, _mm_srai_epi32(_mm_add_epi32(a1, b1), 17));
+    idct_store4(block + 8*2, _mm_srai_epi32(_mm_add_epi32(a2, b2), 17));
+    idct_store4(block + 8*3, _mm_srai_epi32(_mm_add_epi32(a3, b3), 17));
+    idct_store4(block + 8*4, _mm_srai_epi32(_mm_sub_epi32(a3, b3), 17));
+    idct_store4(block + 8*5, _mm_srai_epi32(_mm_sub_epi32(a2, b2), 17));
+    idct_store4(block + 8*6, _mm_srai_epi32(_mm_sub_epi32(a1, b1), 17));
+    idct_store4(block + 8*7, _mm_srai_epi32(_mm_sub_epi32(a0, b0), 17));
 }
 
 __ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
@@ -161,25 +199,26 @@ __ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
 
     for (i = 0; i < 8; i++)
 		idct_row (block + 8 * i);
-    for (i = 0; i < 8; i++)
-		idct_col (block + i);
-
-	__m128 zero = _mm_setzero_ps();
-    do {
-		dest[0] = CLIP (block[0]);
-		dest[1] = CLIP (block[1]);
-		dest[2] = CLIP (block[2]);
-		dest[3] = CLIP (block[3]);
-		dest[4] = CLIP (block[4]);
-		dest[5] = CLIP (block[5]);
-		dest[6] = CLIP (block[6]);
-		dest[7] = CLIP (block[7]);
-
-		_mm_store_ps((float*)block, zero);
-
-		dest += stride;
-		block += 8;
-    } while (--i);
+
+	idct_col4 (block);
+	idct_col4 (block + 4);
+
+	// packus saturates to 0..255, which is what the CLIP lut did.
+	__m128i zero = _mm_setzero_si128();
+	for (i = 0; i < 8; i += 2) {
+		__m128i packed = _mm_packus_epi16(
+			_mm_load_si128((__m128i*)block),
+			_mm_load_si128((__m128i*)(block + 8)));
+
+		_mm_storel_epi64((__m128i*)dest, packed);
+		_mm_storel_epi64((__m128i*)(dest + stride), _mm_unpackhi_epi64(packed, packed));
+
+		_mm_store_si128((__m128i*)block, zero);
+		_mm_store_si128((__m128i*)(block + 8), zero);
+
+		dest += stride * 2;
+		block += 16;
+	}
 }
 
 
@@ -193,9 +232,11 @@ __ri void mpeg2_idct_add (const int last, s16 * block, s16 * dest, const int str
 		int i;
 		for (i = 0; i < 8; i++)
 			idct_row (block + 8 * i);
-		for (i = 0; i < 8; i++)
-			idct_col (block + i);
 
+		idct_col4 (block);
+		idct_col4 (block + 4);
+
+		i = 8;
 		__m128 zero = _mm_setzero_ps();
 		do {
 			_mm_store_ps((float*)dest, _mm_load_ps((float*)block));
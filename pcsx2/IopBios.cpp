@@ -21,6 +21,7 @@
 #include <ctype.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <unordered_map>
 #include "ghc/filesystem.h"
 
 #if !defined(S_ISREG) && defined(S_IFMT) && defined(S_IFREG)
@@ -882,15 +883,30 @@ namespace R3000A
 		}
 	} // namespace sifcmd
 
+	// The import table for an entry point is found by scanning backwards for the
+	// magic word -- up to 8kb of memory reads per call, and the interpreter does
+	// this for every import stub it executes.  Remember resolved entry points and
+	// just re-check the magic on later calls; a module unload/reload that moves
+	// the table fails that check and triggers a fresh scan, so the cache never
+	// needs explicit invalidation.
+	static std::unordered_map<u32, u32> irxImportTableCache;
+
 	u32 irxImportTableAddr(u32 entrypc)
 	{
 		u32 i;
 
+		auto cached = irxImportTableCache.find(entrypc);
+		if (cached != irxImportTableCache.end() && iopMemRead32(cached->second) == 0x41e00000)
+			return cached->second;
+
 		i = entrypc - 0x18;
 		while (entrypc - i < 0x2000)
 		{
 			if (iopMemRead32(i) == 0x41e00000)
+			{
+				irxImportTableCache[entrypc] = i;
 				return i;
+			}
 			i -= 4;
 		}
 
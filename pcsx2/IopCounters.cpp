@@ -77,7 +77,7 @@ static void _rcntSet(int cntidx)
 	u64 overflowCap = (cntidx >= 3) ? 0x100000000ULL : 0x10000;
 	u64 c;
 
-	const psxCounter& counter = psxCounters[cntidx];
+	psxCounter& counter = psxCounters[cntidx];
 
 	// psxNextCounter is relative to the psxRegs.cycle when rcntUpdate() was last called.
 	// However, the current _rcntSet could be called at any cycle count, so we need to take
@@ -92,12 +92,20 @@ static void _rcntSet(int cntidx)
 	if (counter.count > overflowCap || counter.count > counter.target)
 	{
 		psxNextCounter = 4;
+		counter.CycleT = (s32)psxRegs.cycle; // due immediately
 		return;
 	}
 
 	c = (u64)((overflowCap - counter.count) * counter.rate) - (psxRegs.cycle - counter.sCycleT);
 	c += psxRegs.cycle - psxNextsCounter; // adjust for time passed since last rcntUpdate();
 
+	// Cache this counter's own next-interesting cycle (overflow or target,
+	// whichever comes first) so that rcntUpdate() can skip counters that
+	// can't have reached anything yet.  Clamped to keep the wraparound
+	// comparison in rcntUpdate() well-defined; an early deadline just costs
+	// a recompute.
+	u64 deadline = c;
+
 	if (c < (u64)psxNextCounter)
 	{
 		psxNextCounter = (u32)c;
@@ -106,11 +114,22 @@ static void _rcntSet(int cntidx)
 
 	//if((counter.mode & 0x10) == 0 || psxCounters[i].target > 0xffff) continue;
 	if (counter.target & IOPCNT_FUTURE_TARGET)
+	{
+		if (deadline > 0x40000000)
+			deadline = 0x40000000;
+		counter.CycleT = (s32)(psxNextsCounter + (u32)deadline);
 		return;
+	}
 
 	c = (s64)((counter.target - counter.count) * counter.rate) - (psxRegs.cycle - counter.sCycleT);
 	c += psxRegs.cycle - psxNextsCounter; // adjust for time passed since last rcntUpdate();
 
+	if (c < deadline)
+		deadline = c;
+	if (deadline > 0x40000000)
+		deadline = 0x40000000;
+	counter.CycleT = (s32)(psxNextsCounter + (u32)deadline);
+
 	if (c < (u64)psxNextCounter)
 	{
 		psxNextCounter = (u32)c;
@@ -468,6 +487,13 @@ void psxRcntUpdate()
 		if (change <= 0)
 			continue;
 
+		// Nothing interesting can have happened if the counter's own deadline
+		// (cached by _rcntSet) is still ahead of us -- leave the count where
+		// it is (readers derive the live value from sCycleT anyway) and skip
+		// the divide here and the target/overflow tests below.
+		if ((s32)(psxRegs.cycle - (u32)psxCounters[i].CycleT) < 0)
+			continue;
+
 		psxCounters[i].count += change / psxCounters[i].rate;
 		if (psxCounters[i].rate != 1)
 		{
@@ -490,6 +516,8 @@ void psxRcntUpdate()
 			continue;
 		if (psxCounters[i].mode & IOPCNT_STOPPED)
 			continue;
+		if ((s32)(psxRegs.cycle - (u32)psxCounters[i].CycleT) < 0)
+			continue; // not due yet; the count above wasn't advanced either
 
 		_rcntTestTarget(i);
 		_rcntTestOverflow(i);
@@ -883,5 +911,13 @@ void SaveStateBase::psxRcntFreeze()
 	Freeze(psxNextsCounter);
 
 	if (IsLoading())
+	{
 		psxRcntSetGates();
+
+		// Mark every counter as due so the first rcntUpdate after the load
+		// re-derives the cached deadlines (older states carry a meaningless
+		// CycleT for counters 0-5).
+		for (int i = 0; i < 6; i++)
+			psxCounters[i].CycleT = (s32)psxRegs.cycle;
+	}
 }
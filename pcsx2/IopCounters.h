@@ -21,6 +21,10 @@ struct psxCounter {
     u32 mode;
 	u32 rate, interrupt;
 	u32 sCycleT;
+
+	// Counters 6/7 (SPU2/USB tickers): cycles remaining until the next tick.
+	// Counters 0-5: absolute psxRegs.cycle of the next target/overflow, as
+	// cached by _rcntSet so rcntUpdate can skip counters that aren't due.
 	s32 CycleT;
 };
 
@@ -21,6 +21,7 @@
 //#include "R3000A.h"
 #include "IopCommon.h"
 #include "common/MathUtils.h"
+#include <emmintrin.h>
 #ifdef GTE_DUMP
 #define G_OP(name,delay) fprintf(gteLog, "* : %08X : %02d : %s\n", psxRegs.code, delay, name);
 #define G_SD(reg)  fprintf(gteLog, "+D%02d : %08X\n", reg, psxRegs.CP2D.r[reg]);
@@ -542,10 +543,32 @@ else gteIR3=(long)gteMAC3; \
 
 //********END OF LIMITATIONS**********************************/
 
+// 3x3 matrix * vector core shared by RTPS/RTPT and MVMVA.  pmaddwd does each
+// row's multiply-accumulate two products at a time; the pairwise sums wrap at
+// 32 bits, which is exactly the arithmetic of the scalar int expressions this
+// replaces, so the results (overflow cases included) are unchanged.  The
+// matrix must be nine contiguous s16s in row-major order, which is true of
+// the rotation, light and color matrices alike.
+__inline void gteMatrixVector(const s16* m, s16 vx, s16 vy, s16 vz, s32& ssx, s32& ssy, s32& ssz)
+{
+	const __m128i vec = _mm_set_epi16(0, vz, vy, vx, 0, vz, vy, vx);
+	const __m128i row12 = _mm_set_epi16(0, m[5], m[4], m[3], 0, m[2], m[1], m[0]);
+	const __m128i row3 = _mm_set_epi16(0, 0, 0, 0, 0, m[8], m[7], m[6]);
+
+	s32 dot[4];
+	_mm_storeu_si128((__m128i*)dot, _mm_madd_epi16(row12, vec));
+	ssx = dot[0] + dot[1];
+	ssy = dot[2] + dot[3];
+	_mm_storeu_si128((__m128i*)dot, _mm_madd_epi16(row3, vec));
+	ssz = dot[0] + dot[1];
+}
+
 #define GTE_RTPS1(vn) { \
-	gteMAC1 = FNC_OVERFLOW1(((signed long)(gteR11*gteVX##vn + gteR12*gteVY##vn + gteR13*gteVZ##vn)>>12) + gteTRX); \
-	gteMAC2 = FNC_OVERFLOW2(((signed long)(gteR21*gteVX##vn + gteR22*gteVY##vn + gteR23*gteVZ##vn)>>12) + gteTRY); \
-	gteMAC3 = FNC_OVERFLOW3(((signed long)(gteR31*gteVX##vn + gteR32*gteVY##vn + gteR33*gteVZ##vn)>>12) + gteTRZ); \
+	s32 _ssx, _ssy, _ssz; \
+	gteMatrixVector((s16*)psxRegs.CP2C.r, gteVX##vn, gteVY##vn, gteVZ##vn, _ssx, _ssy, _ssz); \
+	gteMAC1 = FNC_OVERFLOW1(((signed long)_ssx>>12) + gteTRX); \
+	gteMAC2 = FNC_OVERFLOW2(((signed long)_ssy>>12) + gteTRY); \
+	gteMAC3 = FNC_OVERFLOW3(((signed long)_ssz>>12) + gteTRZ); \
 }
 
 /*	gteMAC1 = NC_OVERFLOW1(((signed long)(gteR11*gteVX0 + gteR12*gteVY0 + gteR13*gteVZ0)>>12) + gteTRX);
@@ -943,9 +966,9 @@ void gteRTPT() {
 #define gte_C33 gteLB3
 
 #define _MVMVA_FUNC(_v0, _v1, _v2, mx) { \
-	SSX = (_v0) * mx##11 + (_v1) * mx##12 + (_v2) * mx##13; \
-	SSY = (_v0) * mx##21 + (_v1) * mx##22 + (_v2) * mx##23; \
-	SSZ = (_v0) * mx##31 + (_v1) * mx##32 + (_v2) * mx##33; \
+	s32 _ssx, _ssy, _ssz; \
+	gteMatrixVector(&mx##11, (_v0), (_v1), (_v2), _ssx, _ssy, _ssz); \
+	SSX = _ssx; SSY = _ssy; SSZ = _ssz; \
 }
 
 void gteMVMVA() {
@@ -21,6 +21,7 @@ FlatFileReader::FlatFileReader(bool shareWrite) : shareWrite(shareWrite)
 	m_blocksize = 2048;
 	m_fd = -1;
 	m_aio_context = 0;
+	m_async_inflight = false;
 }
 
 FlatFileReader::~FlatFileReader(void)
@@ -42,8 +43,14 @@ bool FlatFileReader::Open(const wxString& fileName)
 
 int FlatFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 {
-	BeginRead(pBuffer, sector, count);
-	return FinishRead();
+	// Synchronous reads don't need to bounce through the aio context -- a
+	// plain pread is one syscall instead of two, and leaves the queue free
+	// for any async read already in flight.
+	u64 offset = sector * (s64)m_blocksize + m_dataoffset;
+
+	ssize_t bytes = pread(m_fd, pBuffer, count * m_blocksize, offset);
+
+	return (bytes < 0) ? -1 : 1;
 }
 
 void FlatFileReader::BeginRead(void* pBuffer, uint sector, uint count)
@@ -57,20 +64,29 @@ void FlatFileReader::BeginRead(void* pBuffer, uint sector, uint count)
 	struct iocb* iocbs = &iocb;
 
 	io_prep_pread(&iocb, m_fd, pBuffer, bytesToRead, offset);
-	io_submit(m_aio_context, 1, &iocbs);
+	m_async_inflight = (io_submit(m_aio_context, 1, &iocbs) == 1);
 }
 
 int FlatFileReader::FinishRead(void)
 {
+	if (!m_async_inflight)
+		return -1;
+
 	int min_nr = 1;
 	int max_nr = 1;
 	struct io_event events[max_nr];
 
 	int event = io_getevents(m_aio_context, min_nr, max_nr, events, NULL);
+	m_async_inflight = false;
 	if (event < 1) {
 		return -1;
 	}
 
+	// res holds the pread result: byte count, or a negative errno.
+	if ((s64)events[0].res < 0) {
+		return -1;
+	}
+
 	return 1;
 }
 
@@ -23,6 +23,8 @@
 #include "Gif_Unit.h"
 #include "MTVU.h"
 #include "Elfheader.h"
+#include "DebugTools/Tracepoint.h"
+#include "FrameProfiler.h"
 #include "gui/Dialogs/ModalPopups.h"
 #ifdef _WIN32
 #include "PAD/Windows/PAD.h"
@@ -121,6 +123,11 @@ void SysMtgsThread::OnStart()
 	m_SignalRingEnable = false;
 	m_SignalRingPosition = 0;
 
+	m_VsyncQueueLimit = EmuConfig.GS.VsyncQueueSize;
+	m_LastVsyncStamp = 0;
+	m_FrameLatencyEMA = 0;
+	m_FrameIntervalEMA = 0;
+
 	m_CopyDataTally = 0;
 
 	_parent::OnStart();
@@ -152,6 +159,7 @@ void SysMtgsThread::ResetGS()
 	m_ReadPos = m_WritePos.load();
 	m_QueuedFrameCount = 0;
 	m_VsyncSignalListener = 0;
+	m_LastVsyncStamp = 0;
 
 	MTGS_LOG("MTGS: Sending Reset...");
 	SendSimplePacket(GS_RINGTYPE_RESET, 0, 0, 0);
@@ -174,8 +182,11 @@ void SysMtgsThread::PostVsyncStart()
 	// 256-byte copy is only a few dozen cycles -- executed 60 times a second -- so probably
 	// not worth the effort or overhead of trying to selectively avoid it.
 
+	Tracepoint::Record(TRACE_GS_VSYNC);
+	FrameProfiler::OnVsync(m_QueuedFrameCount.load(std::memory_order_relaxed));
+
 	uint packsize = sizeof(RingCmdPacket_Vsync) / 16;
-	PrepDataPacket(GS_RINGTYPE_VSYNC, packsize);
+	PrepDataPacket(GS_RINGTYPE_VSYNC, packsize + 1);
 	MemCopy_WrappedDest((u128*)PS2MEM_GS, RingBuffer.m_Ring, m_packet_writepos, RingBufferSize, 0xf);
 
 	u32* remainder = (u32*)GetDataPacketPtr();
@@ -184,6 +195,14 @@ void SysMtgsThread::PostVsyncStart()
 	(GSRegSIGBLID&)remainder[2] = GSSIGLBLID;
 	m_packet_writepos = (m_packet_writepos + 1) & RingBufferMask;
 
+	// Creation timestamp of this vsync, appended after the reg dump.  The GS
+	// thread compares it against the present time to measure how far the EE
+	// is running ahead of the screen (see the VSYNC ring handler).
+	u64* stamp = (u64*)GetDataPacketPtr();
+	stamp[0] = GetCPUTicks();
+	stamp[1] = 0;
+	m_packet_writepos = (m_packet_writepos + 1) & RingBufferMask;
+
 	SendDataPacket();
 
 	// Vsyncs should always start the GS thread, regardless of how little has actually be queued.
@@ -201,7 +220,10 @@ void SysMtgsThread::PostVsyncStart()
 	// If those are needed back, it's better to increase the VsyncQueueSize via PCSX_vm.ini.
 	// (The Xenosaga engine is known to run into this, due to it throwing bulks of data in one frame followed by 2 empty frames.)
 
-	if ((m_QueuedFrameCount.fetch_add(1) < EmuConfig.GS.VsyncQueueSize) /*|| (!EmuConfig.GS.VsyncEnable && !EmuConfig.GS.FrameLimitEnable)*/)
+	// The queue cap starts at VsyncQueueSize and is lowered by the GS thread
+	// when the measured EE->present latency shows the queue merely adding lag
+	// (see the VSYNC ring handler).
+	if ((m_QueuedFrameCount.fetch_add(1) < m_VsyncQueueLimit.load(std::memory_order_relaxed)) /*|| (!EmuConfig.GS.VsyncEnable && !EmuConfig.GS.FrameLimitEnable)*/)
 		return;
 
 	m_VsyncSignalListener.store(true, std::memory_order_release);
@@ -310,6 +332,18 @@ void SysMtgsThread::ExecuteTaskInThread()
 
 	RingBufferLock busy(*this);
 
+	// Spin budget for the wait below, in SpinWait (pause) iterations. The EE
+	// batches wakeups (see SendDataPacket), so under load the next packet
+	// usually lands within a few microseconds of the ring going empty and the
+	// semaphore round trip - a futex sleep plus a futex wake - costs more
+	// than simply polling for it. The budget tunes itself to the packet
+	// inter-arrival time: a successful spin doubles it, a fall-through to the
+	// blocking wait halves it, so an idle GS thread stops burning cycles
+	// after a handful of misses.
+	static const u32 SpinBudgetMin = 32;
+	static const u32 SpinBudgetMax = 32768;
+	u32 spinBudget = SpinBudgetMin;
+
 	while (true)
 	{
 		busy.Release();
@@ -318,7 +352,31 @@ void SysMtgsThread::ExecuteTaskInThread()
 		// is very optimized (only 1 instruction test in most cases), so no point in trying
 		// to avoid it.
 
-		m_sem_event.WaitWithoutYield();
+		bool spunToWork = false;
+		for (u32 spin = 0; spin < spinBudget; ++spin)
+		{
+			if (m_ReadPos.load(std::memory_order_relaxed) != m_WritePos.load(std::memory_order_relaxed))
+			{
+				spunToWork = true;
+				break;
+			}
+			SpinWait();
+		}
+
+		if (spunToWork)
+		{
+			// Work arrived before the budget ran out. The EE may still post the
+			// event once its tally threshold is reached; the stale token merely
+			// causes one cheap empty iteration of the loop below.
+			if ((spinBudget *= 2) > SpinBudgetMax)
+				spinBudget = SpinBudgetMax;
+		}
+		else
+		{
+			if ((spinBudget /= 2) < SpinBudgetMin)
+				spinBudget = SpinBudgetMin;
+			m_sem_event.WaitWithoutYield();
+		}
 		StateCheckInThread();
 		busy.Acquire();
 
@@ -426,6 +484,9 @@ void SysMtgsThread::ExecuteTaskInThread()
 				}
 				break;
 #endif
+				// The zero copy path: the ring only carried the tag, the data
+				// is consumed directly from the gif path buffer and the EE is
+				// released by the readAmount decrement below.
 				case GS_RINGTYPE_GSPACKET:
 				{
 					Gif_Path& path = gifUnit.gifPath[tag.data[2]];
@@ -477,9 +538,43 @@ void SysMtgsThread::ExecuteTaskInThread()
 							((u32&)RingBuffer.Regs[0x1010]) = remainder[1];
 							((GSRegSIGBLID&)RingBuffer.Regs[0x1080]) = (GSRegSIGBLID&)remainder[2];
 
+							// EE-side creation time of this vsync, appended after the reg dump.
+							const u64 stamp = *(u64*)&RingBuffer[(datapos + 0x10) & RingBufferMask];
+
 							// CSR & 0x2000; is the pageflip id.
+							const u64 presentstart = GetCPUTicks();
 							GSvsync(((u32&)RingBuffer.Regs[0x1000]) & 0x2000);
 							gsFrameSkip();
+							FrameProfiler::AddPhase(FrameProfiler::Phase_Present, GetCPUTicks() - presentstart);
+
+							// Frame pacing: GSvsync() presented the frame, so right here
+							// (now - stamp) is the full EE->GS->present latency.  Smooth it
+							// (and the EE's vsync interval) with eighth-weight moving
+							// averages so single hitches don't thrash the queue cap below.
+							// With a deterministic clock the queue cap must not drift with
+							// host timing, so leave it at the configured depth.
+							const u64 now = GetCPUTicks();
+							if (!EmuConfig.DeterministicClock && m_LastVsyncStamp != 0 && stamp > m_LastVsyncStamp)
+							{
+								m_FrameLatencyEMA += ((s64)(now - stamp) - m_FrameLatencyEMA) >> 3;
+								m_FrameIntervalEMA += ((s64)(stamp - m_LastVsyncStamp) - m_FrameIntervalEMA) >> 3;
+
+								// When the GS is the bottleneck the queue saturates and the
+								// latency settles around (cap + 2) frames of input lag; run-
+								// ahead the EE can't cash in anyway, so lower the cap until
+								// the latency fits.  An EE-bound game never trips this and
+								// keeps the full configured queue depth.
+								int limit = EmuConfig.GS.VsyncQueueSize;
+								if (m_FrameIntervalEMA > 0)
+								{
+									while (limit > 0 && m_FrameLatencyEMA > (s64)(limit + 1) * m_FrameIntervalEMA)
+										limit--;
+								}
+								m_VsyncQueueLimit.store(limit, std::memory_order_relaxed);
+
+								GSSetEELatency((now - stamp) * 1000.0 / GetTickFrequency());
+							}
+							m_LastVsyncStamp = stamp;
 
 							m_QueuedFrameCount.fetch_sub(1);
 							if (m_VsyncSignalListener.exchange(false))
@@ -632,6 +727,9 @@ void SysMtgsThread::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 	if (!pxAssertDev(IsOpen(), "MTGS Warning!  WaitGS issued on a closed thread."))
 		return;
 
+	Tracepoint::Record(TRACE_GS_WAIT_BEGIN, weakWait, isMTVU);
+	const u64 waitstart = GetCPUTicks();
+
 	Gif_Path& path = gifUnit.gifPath[GIF_PATH_1];
 	u32 startP1Packs = weakWait ? path.GetPendingGSPackets() : 0;
 
@@ -669,6 +767,10 @@ void SysMtgsThread::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 		// Completely synchronize GS and MTGS register states.
 		memcpy(RingBuffer.Regs, PS2MEM_GS, sizeof(RingBuffer.Regs));
 	}
+
+	Tracepoint::Record(TRACE_GS_WAIT_END);
+	if (!isMTVU) // MTVU waits are counted by their caller, not as EE time
+		FrameProfiler::AddPhase(FrameProfiler::Phase_GSWait, GetCPUTicks() - waitstart);
 }
 
 // Sets the gsEvent flag and releases a timeslice.
@@ -18,12 +18,16 @@
 #include "MTVU.h"
 #include "newVif.h"
 #include "Gif_Unit.h"
+#include "FrameProfiler.h"
 
 __aligned16 VU_Thread vu1Thread(CpuVU1, VU1);
 
 #define MTVU_ALWAYS_KICK 0
 #define MTVU_SYNC_MODE 0
 
+#define MTVU_SPIN_COUNT 4000                  // Spins before the VU thread sleeps on an empty ring
+#define MTVU_KICK_BATCH (_4kb / sizeof(s32))  // Queued u32's that force a VU thread wake-up
+
 // Rounds up a size in bytes for size in u32's
 static __fi u32 size_u32(u32 x) { return (x + 3) >> 2; }
 
@@ -87,6 +91,8 @@ VU_Thread::VU_Thread(BaseVUmicroCPU*& _vuCPU, VURegs& _vuRegs)
 	, vuRegs(_vuRegs)
 {
 	m_name = L"MTVU";
+	buffer_size = mtvu_default_ring_size;
+	buffer = (u32*)_aligned_malloc(buffer_size * sizeof(u32), 64);
 	Reset();
 }
 
@@ -97,6 +103,7 @@ VU_Thread::~VU_Thread()
 		pxThread::Cancel();
 	}
 	DESTRUCTOR_CATCHALL
+	safe_aligned_free(buffer);
 }
 
 void VU_Thread::Reset()
@@ -107,6 +114,7 @@ void VU_Thread::Reset()
 	isBusy = false;
 	m_ato_write_pos = 0;
 	m_write_pos = 0;
+	m_last_kick_pos = 0;
 	m_ato_read_pos = 0;
 	m_read_pos = 0;
 	memzero(vif);
@@ -118,6 +126,8 @@ void VU_Thread::Reset()
 
 void VU_Thread::ExecuteTaskInThread()
 {
+	Threading::SetRoleAffinity(Threading::ThreadRole_Compute);
+
 	PCSX2_PAGEFAULT_PROTECT
 	{
 		ExecuteRingBuffer();
@@ -125,11 +135,46 @@ void VU_Thread::ExecuteTaskInThread()
 	PCSX2_PAGEFAULT_EXCEPT;
 }
 
+// Resizes the ring buffer; only safe while the VU thread has no pending packets
+void VU_Thread::SetRingSize(u32 size_mb)
+{
+	pxAssert(IsDone());
+	ScopedLock lock(mtxBusy);
+
+	safe_aligned_free(buffer);
+	buffer_size = (size_mb * _1mb) / sizeof(u32);
+	buffer = (u32*)_aligned_malloc(buffer_size * sizeof(u32), 64);
+
+	m_ato_write_pos = 0;
+	m_write_pos = 0;
+	m_last_kick_pos = 0;
+	m_ato_read_pos = 0;
+	m_read_pos = 0;
+}
+
+// Spins a short while waiting for the EE thread to queue more work.  Returns
+// false if nothing showed up and the caller should block on the semaphore;
+// VIF tends to send packets back-to-back, and a few thousand pause
+// instructions are much cheaper than a context switch per packet.
+__ri bool VU_Thread::SpinWaitForData()
+{
+	for (s32 i = 0; i < MTVU_SPIN_COUNT; i++)
+	{
+		if (m_ato_read_pos.load(std::memory_order_relaxed) != GetWritePos())
+			return true;
+		Threading::SpinWait();
+	}
+	return false;
+}
+
 void VU_Thread::ExecuteRingBuffer()
 {
 	for (;;)
 	{
-		semaEvent.WaitWithoutYield();
+		// A semaphore post can arrive for work we already picked up while
+		// spinning; the extra count just makes the next wait fall through.
+		if (!SpinWaitForData())
+			semaEvent.WaitWithoutYield();
 		ScopedLockBool lock(mtxBusy, isBusy);
 		while (m_ato_read_pos.load(std::memory_order_relaxed) != GetWritePos())
 		{
@@ -415,6 +460,20 @@ void VU_Thread::KickStart(bool forceKick)
 		semaEvent.Post();
 }
 
+// Wakes the VU thread only once a decent batch of data has accumulated, so
+// many small VIF packets cost a single semaphore post instead of one each.
+// Anything that must see results promptly (ExecuteVU, the wait paths) still
+// kicks directly.  EE thread only, like the rest of the write interface.
+__fi void VU_Thread::KickStartBatched()
+{
+	const s32 pending = m_write_pos - m_last_kick_pos;
+	if ((pending < 0) || (pending >= (s32)MTVU_KICK_BATCH)) // Negative means the ring wrapped
+	{
+		m_last_kick_pos = m_write_pos;
+		KickStart();
+	}
+}
+
 bool VU_Thread::IsDone()
 {
 	return GetReadPos() == GetWritePos();
@@ -423,6 +482,7 @@ bool VU_Thread::IsDone()
 void VU_Thread::WaitVU()
 {
 	MTVU_LOG("MTVU - WaitVU!");
+	const u64 start = GetCPUTicks();
 	for (;;)
 	{
 		if (IsDone())
@@ -433,6 +493,7 @@ void VU_Thread::WaitVU()
 		std::this_thread::yield(); // Give a chance to the MTVU thread to actually start
 		ScopedLock lock(mtxBusy);
 	}
+	FrameProfiler::AddPhase(FrameProfiler::Phase_VU1Wait, GetCPUTicks() - start);
 }
 
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
@@ -446,6 +507,7 @@ void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
 	Write(vif_itop);
 	CommitWritePos();
 	gifUnit.TransferGSPacketData(GIF_TRANS_MTVU, NULL, 0);
+	m_last_kick_pos = m_write_pos;
 	KickStart();
 	u32 cycles = std::min(Get_vuCycles(), 3000u);
 	cpuRegs.cycle += cycles * EmuConfig.Speedhacks.EECycleSkip;
@@ -464,7 +526,7 @@ void VU_Thread::VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, u8* data, u32
 	Write(size);
 	Write(data, size);
 	CommitWritePos();
-	KickStart();
+	KickStartBatched();
 }
 
 void VU_Thread::WriteMicroMem(u32 vu_micro_addr, void* data, u32 size)
@@ -476,7 +538,7 @@ void VU_Thread::WriteMicroMem(u32 vu_micro_addr, void* data, u32 size)
 	Write(size);
 	Write(data, size);
 	CommitWritePos();
-	KickStart();
+	KickStartBatched();
 }
 
 void VU_Thread::WriteDataMem(u32 vu_data_addr, void* data, u32 size)
@@ -488,7 +550,7 @@ void VU_Thread::WriteDataMem(u32 vu_data_addr, void* data, u32 size)
 	Write(size);
 	Write(data, size);
 	CommitWritePos();
-	KickStart();
+	KickStartBatched();
 }
 
 void VU_Thread::WriteCol(vifStruct& _vif)
@@ -498,7 +560,7 @@ void VU_Thread::WriteCol(vifStruct& _vif)
 	Write(MTVU_VIF_WRITE_COL);
 	Write(&_vif.MaskCol, sizeof(_vif.MaskCol));
 	CommitWritePos();
-	KickStart();
+	KickStartBatched();
 }
 
 void VU_Thread::WriteRow(vifStruct& _vif)
@@ -508,5 +570,5 @@ void VU_Thread::WriteRow(vifStruct& _vif)
 	Write(MTVU_VIF_WRITE_ROW);
 	Write(&_vif.MaskRow, sizeof(_vif.MaskRow));
 	CommitWritePos();
-	KickStart();
+	KickStartBatched();
 }
@@ -26,16 +26,24 @@
 // - This class should only be accessed from the EE thread...
 // - buffer_size must be power of 2
 // - ring-buffer has no complete pending packets when read_pos==write_pos
+// - This thread is only used for VU1.  A second lane for VU0 was evaluated
+//   and rejected: in macro mode CTC2/CFC2/QMTC2/QMFC2 can touch any VU0
+//   register between any two VU0 instructions, so every COP2 transfer would
+//   have to round-trip with the worker, and micro-mode programs already run
+//   interleaved with the EE in kickstarted slices (see microVU_Macro.inl).
+//   The average VU0 program is far too short to amortize those syncs.
 class VU_Thread : public pxThread {
-	static const s32 buffer_size = (_1mb * 16) / sizeof(s32);
+	static const s32 mtvu_default_ring_size = (_1mb * 16) / sizeof(s32); // In u32's; must be power of 2
 
-	u32 buffer[buffer_size];
+	s32  buffer_size; // Ring size in u32's (configurable through SetRingSize)
+	u32* buffer;
 	// Note: keep atomic on separate cache line to avoid CPU conflict
 	__aligned(64) std::atomic<bool> isBusy;   // Is thread processing data?
 	__aligned(64) std::atomic<int> m_ato_read_pos; // Only modified by VU thread
 	__aligned(64) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
 	__aligned(64) int  m_read_pos; // temporary read pos (local to the VU thread)
 	int  m_write_pos; // temporary write pos (local to the EE thread)
+	int  m_last_kick_pos; // write_pos as of the last wake-up (local to the EE thread)
 	Mutex     mtxBusy;
 	Semaphore semaEvent;
 	BaseVUmicroCPU*& vuCPU;
@@ -65,6 +73,10 @@ public:
 
 	void Reset();
 
+	// Resizes the ring buffer (size in megabytes, must be a power of 2).
+	// EE thread only, and the VU thread must be done with its packets.
+	void SetRingSize(u32 size_mb);
+
 	// Get MTVU to start processing its packets if it isn't already
 	void KickStart(bool forceKick = false);
 
@@ -96,6 +108,10 @@ protected:
 private:
 	void ExecuteRingBuffer();
 
+	bool SpinWaitForData();
+
+	void KickStartBatched();
+
 	void WaitOnSize(s32 size);
 	void ReserveSpace(s32 size);
 
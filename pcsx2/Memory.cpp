@@ -36,8 +36,10 @@ BIOS
 
 #include "PrecompiledHeader.h"
 #include <wx/file.h>
+#include <wx/ffile.h>
 
 #include "IopCommon.h"
+#include "PathDefs.h"
 #include "GS.h"
 #include "VUmicro.h"
 #include "MTVU.h"
@@ -902,10 +904,26 @@ struct vtlb_PageProtectionInfo
 	u32 ReverseRamMap;
 
 	vtlb_ProtectionMode Mode;
+
+	// Snapshot tracking (incremental savestates): true if the page has not been written
+	// since the last mmap_SyncRamSnapshot.  A clean page is always write-protected, so
+	// the fault handler below is guaranteed to see (and flag) the first write to it.
+	bool SnapshotClean;
 };
 
 static __aligned16 vtlb_PageProtectionInfo m_PageProtectInfo[Ps2MemSize::MainRam >> 12];
 
+// SMC heatmap: per-page counts of the three protection events, indexed by ram
+// page (same indexing as m_PageProtectInfo but deliberately not part of it --
+// block tracking resets wipe that table on every eerecReset, while these are
+// meant to span a whole play session).
+static u32 m_SmcFaultClears[Ps2MemSize::MainRam >> 12];   // write faults that cleared a protected page
+static u32 m_SmcBlockDiscards[Ps2MemSize::MainRam >> 12]; // manual blocks failing their integrity check
+static u32 m_SmcPageResets[Ps2MemSize::MainRam >> 12];    // manual pages cycled back to write protection
+
+static bool m_SnapshotArmed = false;
+static u8* m_SnapshotDest = NULL;
+
 
 // returns:
 //  ProtMode_NotRequired - unchecked block (resides in ROM, thus is integrity is constant)
@@ -946,6 +964,11 @@ void mmap_MarkCountedRamPage( u32 paddr )
 	if( m_PageProtectInfo[rampage].Mode == ProtMode_Write )
 		return;		// skip town if we're already protected.
 
+	// Re-protection means the page cycled through manual mode and back
+	// (dyna_page_reset) -- that's one full thrash cycle for the heatmap.
+	if( m_PageProtectInfo[rampage].Mode == ProtMode_Manual )
+		m_SmcPageResets[rampage]++;
+
 	eeRecPerfLog.Write( (m_PageProtectInfo[rampage].Mode == ProtMode_Manual) ?
 		"Re-protecting page @ 0x%05x" : "Protected page @ 0x%05x",
 		paddr>>12
@@ -971,9 +994,65 @@ static __fi void mmap_ClearCpuBlock( uint offset )
 
 	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadWrite() );
 	m_PageProtectInfo[rampage].Mode = ProtMode_Manual;
+	m_SmcFaultClears[rampage]++;
 	Cpu->Clear( m_PageProtectInfo[rampage].ReverseRamMap, 0x400 );
 }
 
+// Called from the recompiler when a manually-protected block fails its pre-execution
+// integrity check (dyna_block_discard); paddr is the physical start of the block.
+void mmap_RecordBlockDiscard( u32 paddr )
+{
+	pxAssert( eeMem );
+
+	uptr rampage = (uptr)PSM( paddr & ~0xfff ) - (uptr)eeMem->Main;
+
+	if (rampage < Ps2MemSize::MainRam)
+		m_SmcBlockDiscards[rampage >> 12]++;
+}
+
+// Writes the accumulated per-page SMC statistics to logs/smcheatmap.txt, one line per
+// page that saw at least one protection event.  The counts accumulate from boot, so
+// successive dumps during a session show how hot pages develop over time.
+void mmap_DumpSmcHeatmap()
+{
+	PathDefs::GetLogs().Mkdir();
+	const wxString filename(Path::Combine(PathDefs::GetLogs().ToString(), L"smcheatmap.txt"));
+	wxFFile file(filename, L"w");
+	if (!file.IsOpened())
+	{
+		Console.Warning("SmcHeatmap: could not write '%ls'.", WX_STR(filename));
+		return;
+	}
+
+	file.Write(L"# paddr      faultclears  discards  resets  mode\n");
+
+	uint pages = 0;
+	u64 clears = 0, discards = 0, resets = 0;
+
+	for (uint i = 0; i < (Ps2MemSize::MainRam >> 12); i++)
+	{
+		if (!m_SmcFaultClears[i] && !m_SmcBlockDiscards[i] && !m_SmcPageResets[i])
+			continue;
+
+		// ReverseRamMap holds the paddr that last mapped onto this ram page;
+		// outside of exotic TLB remappings it's simply the page address.
+		static const char modes[] = {'n', 'w', 'm', '-'};
+		file.Write(pxsFmt("0x%08x  %11u  %8u  %6u  %c\n",
+			m_PageProtectInfo[i].ReverseRamMap, m_SmcFaultClears[i],
+			m_SmcBlockDiscards[i], m_SmcPageResets[i],
+			modes[m_PageProtectInfo[i].Mode & 3]));
+
+		pages++;
+		clears += m_SmcFaultClears[i];
+		discards += m_SmcBlockDiscards[i];
+		resets += m_SmcPageResets[i];
+	}
+
+	Console.WriteLn(Color_StrongGreen,
+		"SmcHeatmap: %u pages (%llu fault clears, %llu discards, %llu resets) written to '%ls'.",
+		pages, clears, discards, resets, WX_STR(filename));
+}
+
 void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& handled )
 {
 	pxAssert( eeMem );
@@ -982,10 +1061,74 @@ void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& h
 	uptr offset = info.addr - (uptr)eeMem->Main;
 	if( offset >= Ps2MemSize::MainRam ) return;
 
-	mmap_ClearCpuBlock( offset );
+	uint rampage = offset >> 12;
+
+	// The page may be protected for either (or both) of two reasons: the recompiler
+	// has code in it, or it's clean with respect to the last RAM snapshot.  The write
+	// dirties the snapshot either way; the block clear is only the recompiler's business.
+	const bool wasSnapshotClean = m_SnapshotArmed && m_PageProtectInfo[rampage].SnapshotClean;
+	m_PageProtectInfo[rampage].SnapshotClean = false;
+
+	if( wasSnapshotClean && (m_PageProtectInfo[rampage].Mode != ProtMode_Write) )
+		HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadWrite() );
+	else
+		mmap_ClearCpuBlock( offset );
+
 	handled = true;
 }
 
+// Copies main memory into dest, copying only pages dirtied since the last sync against
+// the same buffer.  Clean pages are kept write-protected between syncs so the fault
+// handler above can flag the first write to each; a page that was never re-dirtied costs
+// nothing at all.  The caller gets a buffer that exactly matches eeMem->Main without
+// paying for a full 32MB copy on every save.
+uint mmap_SyncRamSnapshot( u8* dest )
+{
+	pxAssert( eeMem );
+
+	const uint pagecount = Ps2MemSize::MainRam >> 12;
+
+	// First sync, new destination, or tracking was reset: full copy and re-arm.
+	// The blanket write-protect is fine for pages the recompiler already has under
+	// ProtMode_Write -- they were read-only to begin with.
+	if( !m_SnapshotArmed || (dest != m_SnapshotDest) )
+	{
+		memcpy( dest, eeMem->Main, Ps2MemSize::MainRam );
+		for( uint i=0; i<pagecount; ++i )
+			m_PageProtectInfo[i].SnapshotClean = true;
+
+		HostSys::MemProtect( eeMem->Main, Ps2MemSize::MainRam, PageAccess_ReadOnly() );
+		m_SnapshotArmed = true;
+		m_SnapshotDest = dest;
+		return pagecount;
+	}
+
+	uint copied = 0;
+
+	for( uint i=0; i<pagecount; )
+	{
+		if( m_PageProtectInfo[i].SnapshotClean )
+		{
+			++i;
+			continue;
+		}
+
+		// Batch runs of dirty pages so the copy and the mprotect are done per-run
+		// rather than per-page.
+		uint end = i;
+		while( (end < pagecount) && !m_PageProtectInfo[end].SnapshotClean )
+			m_PageProtectInfo[end++].SnapshotClean = true;
+
+		memcpy( dest + (i<<12), &eeMem->Main[i<<12], (end-i)<<12 );
+		HostSys::MemProtect( &eeMem->Main[i<<12], (end-i)<<12, PageAccess_ReadOnly() );
+
+		copied += end - i;
+		i = end;
+	}
+
+	return copied;
+}
+
 // Clears all block tracking statuses, manual protection flags, and write protection.
 // This does not clear any recompiler blocks.  It is assumed (and necessary) for the caller
 // to ensure the EErec is also reset in conjunction with calling this function.
@@ -995,4 +1138,8 @@ void mmap_ResetBlockTracking()
 	//DbgCon.WriteLn( "vtlb/mmap: Block Tracking reset..." );
 	memzero( m_PageProtectInfo );
 	if (eeMem) HostSys::MemProtect( eeMem->Main, Ps2MemSize::MainRam, PageAccess_ReadWrite() );
+
+	// All pages just went writable behind the snapshot's back, so the next sync must
+	// start over with a full copy.
+	m_SnapshotArmed = false;
 }
@@ -127,6 +127,14 @@ enum vtlb_ProtectionMode
 extern vtlb_ProtectionMode mmap_GetRamPageInfo( u32 paddr );
 extern void mmap_MarkCountedRamPage( u32 paddr );
 extern void mmap_ResetBlockTracking();
+extern void mmap_RecordBlockDiscard( u32 paddr );
+extern void mmap_DumpSmcHeatmap();
+
+// Copies main memory into dest (which must be Ps2MemSize::MainRam bytes), copying only
+// the pages that were dirtied since the previous sync against the same dest.  Uses the
+// same write-protection machinery as the recompiler's block tracking, so the first sync
+// (or any sync after a tracking reset) is a full copy.  Returns the number of pages copied.
+extern uint mmap_SyncRamSnapshot( u8* dest );
 
 #define memRead8 vtlb_memRead<mem8_t>
 #define memRead16 vtlb_memRead<mem16_t>
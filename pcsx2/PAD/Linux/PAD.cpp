@@ -18,6 +18,7 @@
 #include <fcntl.h>
 #include <stdarg.h>
 
+#include "common/General.h"
 #include "keyboard.h"
 #include "PAD.h"
 #include "state_management.h"
@@ -44,7 +45,34 @@ FILE* padLog = NULL;
 
 KeyStatus g_key_status;
 
-MtQueue<keyEvent> g_ev_fifo;
+MtRing<TimedKeyEvent, 128> g_ev_fifo;
+
+// Rolling input-to-poll latency: time between an event being received from
+// the host (PADWriteEvent) and the vsync poll that consumes it.  Logged
+// periodically so end-to-end input lag can be measured when tuning.
+static u64 s_latency_total_ticks = 0;
+static u64 s_latency_max_ticks = 0;
+static u32 s_latency_events = 0;
+
+void PADTrackEventLatency(u64 pushed_ticks)
+{
+	const u64 latency = GetCPUTicks() - pushed_ticks;
+
+	s_latency_total_ticks += latency;
+	if (latency > s_latency_max_ticks)
+		s_latency_max_ticks = latency;
+
+	if (++s_latency_events == 256)
+	{
+		const double to_ms = 1000.0 / (double)GetTickFrequency();
+		DevCon.WriteLn("PAD: input->poll latency over last 256 events: avg %.2fms, max %.2fms",
+					   (double)(s_latency_total_ticks / 256) * to_ms,
+					   (double)s_latency_max_ticks * to_ms);
+		s_latency_total_ticks = 0;
+		s_latency_max_ticks = 0;
+		s_latency_events = 0;
+	}
+}
 
 
 void __LogToConsole(const char* fmt, ...)
@@ -259,7 +287,8 @@ keyEvent* PADkeyEvent()
 	}
 #endif
 #ifdef __unix__
-	if (g_ev_fifo.size() == 0)
+	TimedKeyEvent tev;
+	if (!g_ev_fifo.dequeue(&tev))
 	{
 		// PAD_LOG("No events in queue, returning empty event\n");
 		s_event = event;
@@ -267,7 +296,8 @@ keyEvent* PADkeyEvent()
 		event.key = 0;
 		return &s_event;
 	}
-	s_event = g_ev_fifo.dequeue();
+	PADTrackEventLatency(tev.pushed_ticks);
+	s_event = tev.evt;
 
 	AnalyzeKeyEvent(s_event);
 	// PAD_LOG("Returning Event. Event Type: %d, Key: %d\n", s_event.evt, s_event.key);
@@ -286,6 +316,7 @@ void PADWriteEvent(keyEvent& evt)
 	// if (evt.evt != 6) { // Skip mouse move events for logging
 	//     PAD_LOG("Pushing Event. Event Type: %d, Key: %d\n", evt.evt, evt.key);
 	// }
-	g_ev_fifo.push(evt);
+	if (!g_ev_fifo.push({evt, GetCPUTicks()}))
+		Console.Warning("PAD: Event ring full, dropped event (type %d, key %d)", evt.evt, evt.key);
 }
 #endif
@@ -16,7 +16,7 @@
 #pragma once
 
 #include "Global.h"
-#include "common/mt_queue.h"
+#include "common/mt_ring.h"
 
 enum PadOptions
 {
@@ -33,7 +33,21 @@ extern FILE* padLog;
 extern void initLogging();
 
 extern keyEvent event;
-extern MtQueue<keyEvent> g_ev_fifo;
+
+// Input event stamped with the time it was received from the host, so the
+// consumer can measure how long events sit in the ring before a poll picks
+// them up.
+struct TimedKeyEvent
+{
+	keyEvent evt;
+	u64 pushed_ticks;
+};
+
+extern MtRing<TimedKeyEvent, 128> g_ev_fifo;
+
+// Feeds the rolling input-to-poll latency statistics; call with the
+// pushed_ticks of every event taken out of g_ev_fifo.
+void PADTrackEventLatency(u64 pushed_ticks);
 
 s32 _PADopen(void* pDsp);
 void _PADclose();
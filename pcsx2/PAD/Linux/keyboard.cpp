@@ -21,9 +21,8 @@
 #include "Global.h"
 #include "keyboard.h"
 
-#include "common/mt_queue.h"
+#include "PAD.h"
 extern keyEvent event;
-extern MtQueue<keyEvent> g_ev_fifo;
 
 /// g_key_status.press but with proper handling for analog buttons
 static void PressButton(u32 pad, u32 button)
@@ -262,7 +261,10 @@ void UpdateKeyboardInput()
 	XEvent E = {0};
 
 	// Keyboard input send by PCSX2
-	g_ev_fifo.consume_all(AnalyzeKeyEvent);
+	g_ev_fifo.consume_all([](TimedKeyEvent& e) {
+		PADTrackEventLatency(e.pushed_ticks);
+		AnalyzeKeyEvent(e.evt);
+	});
 
 	// keyboard input
 	while (XPending(GSdsp) > 0)
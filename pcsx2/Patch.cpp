@@ -37,6 +37,10 @@ extern void _ApplyPatch(IniPatch* p);
 
 std::vector<IniPatch> Patch;
 
+// Patch indices partitioned by their "place" value, so the per-vsync apply loops walk
+// exactly the continuously-applied entries instead of filtering the whole list each time.
+static std::vector<size_t> PatchesByPlace[_PPT_END_MARKER];
+
 wxString strgametitle;
 
 struct PatchTextTable
@@ -167,6 +171,8 @@ void inifile_process(wxTextFile& f1)
 void ForgetLoadedPatches()
 {
 	Patch.clear();
+	for (auto& place : PatchesByPlace)
+		place.clear();
 }
 
 static int _LoadPatchFiles(const wxDirName& folderName, wxString& fileSpec, const wxString& friendlyName, int& numberFoundPatchFiles)
@@ -340,6 +346,7 @@ namespace PatchFunc
 
 			iPatch.enabled = 1; // omg success!!
 			Patch.push_back(iPatch);
+			PatchesByPlace[iPatch.placetopatch].push_back(Patch.size() - 1);
 		}
 		catch (wxString& exmsg)
 		{
@@ -353,9 +360,6 @@ namespace PatchFunc
 // This is for applying patches directly to memory
 void ApplyLoadedPatches(patch_place_type place)
 {
-	for (auto& i : Patch)
-	{
-		if (i.placetopatch == place)
-			_ApplyPatch(&i);
-	}
+	for (size_t i : PatchesByPlace[place])
+		_ApplyPatch(&Patch[i]);
 }
@@ -61,6 +61,7 @@ namespace PathDefs
 	extern wxDirName GetLangs();
 	extern wxDirName GetCheats();
 	extern wxDirName GetCheatsWS();
+	extern wxDirName GetCache();
 	extern wxDirName GetDocs();
 
 	extern wxDirName Get( FoldersEnum_t folderidx );
@@ -78,6 +79,7 @@ namespace PathDefs
 		extern const wxDirName& Langs();
 		extern const wxDirName& Cheats();
 		extern const wxDirName& CheatsWS();
+		extern const wxDirName& Cache();
 		extern const wxDirName& Docs();
 	}
 }
@@ -92,6 +92,7 @@ void Pcsx2Config::SpeedhackOptions::LoadSave(IniInterface& ini)
 	IniBitBool(vuFlagHack);
 	IniBitBool(vuThread);
 	IniBitBool(vu1Instant);
+	IniBitBool(eeCycleAuto);
 }
 
 void Pcsx2Config::ProfilerOptions::LoadSave( IniInterface& ini )
@@ -423,6 +424,7 @@ void Pcsx2Config::LoadSave( IniInterface& ini )
 	IniBitBool( CdvdVerboseReads );
 	IniBitBool( CdvdDumpBlocks );
 	IniBitBool( CdvdShareWrite );
+	IniBitBool( CdvdPrecache );
 	IniBitBool( EnablePatches );
 	IniBitBool( EnableCheats );
 	IniBitBool( EnableIPC );
@@ -433,8 +435,11 @@ void Pcsx2Config::LoadSave( IniInterface& ini )
 	IniBitBool( ConsoleToStdio );
 	IniBitBool( HostFs );
 	IniBitBool( FullBootConfig );
+	IniBitBool( DeterministicClock );
 
 	IniBitBool( BackupSavestate );
+	IniBitBool( IncrementalSavestates );
+	IniBitBool( EnableRewind );
 	IniBitBool( McdEnableEjection );
 	IniBitBool( McdFolderAutoManage );
 	IniBitBool( MultitapPort0_Enabled );
@@ -0,0 +1,129 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2014  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "AsyncFileReader.h"
+
+PrecachedFileReader::PrecachedFileReader(AsyncFileReader* source, u8* data)
+	: m_data(data)
+	, m_blocks(source->GetBlockCount())
+	, m_lresult(0)
+{
+	m_filename = source->GetFilename();
+	m_blocksize = source->GetBlockSize();
+
+	// m_dataoffset deliberately stays 0: the source reader already applied its
+	// offset while the image was being loaded, so the buffer holds plain blocks.
+}
+
+PrecachedFileReader::~PrecachedFileReader(void)
+{
+	Close();
+}
+
+AsyncFileReader* PrecachedFileReader::Precache(AsyncFileReader* source)
+{
+	const uint blocks = source->GetBlockCount();
+	const uint blocksize = source->GetBlockSize();
+	const u64 size = (u64)blocks * blocksize;
+
+	if (!blocks || !blocksize || size != (size_t)size)
+		return source;
+
+	u8* data = (u8*)malloc(size);
+	if (!data)
+	{
+		Console.Warning("(CDVD) Precache: not enough memory for a %u MB image, using the normal reader.",
+						(uint)(size / _1mb));
+		return source;
+	}
+
+	Console.WriteLn(Color_StrongBlue, "(CDVD) Precaching iso image (%u MB)...", (uint)(size / _1mb));
+
+	// Load in slices large enough to keep the disk streaming, small enough for
+	// sensible progress reporting.
+	const uint step = std::max<uint>(1, (32 * _1mb) / blocksize);
+	uint lastpct = 0;
+
+	for (uint lsn = 0; lsn < blocks; lsn += step)
+	{
+		const uint count = std::min(step, blocks - lsn);
+		if (source->ReadSync(data + (u64)lsn * blocksize, lsn, count) < 0)
+		{
+			Console.Warning("(CDVD) Precache: read error at sector %u, using the normal reader.", lsn);
+			free(data);
+			return source;
+		}
+
+		const uint pct = (uint)((u64)(lsn + count) * 100 / blocks);
+		if (pct / 10 != lastpct / 10)
+		{
+			Console.WriteLn("(CDVD) Precache: %u%%", pct);
+			lastpct = pct;
+		}
+	}
+
+	AsyncFileReader* cached = new PrecachedFileReader(source, data);
+
+	source->Close();
+	delete source;
+
+	return cached;
+}
+
+bool PrecachedFileReader::Open(const wxString& fileName)
+{
+	// The image was already loaded by Precache; there is nothing to reopen.
+	m_filename = fileName;
+	return m_data != NULL;
+}
+
+int PrecachedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
+{
+	if (!m_data || (u64)sector + count > m_blocks)
+		return -1;
+
+	memcpy(pBuffer, m_data + (u64)sector * m_blocksize, (size_t)count * m_blocksize);
+
+	return count * m_blocksize;
+}
+
+void PrecachedFileReader::BeginRead(void* pBuffer, uint sector, uint count)
+{
+	m_lresult = ReadSync(pBuffer, sector, count);
+}
+
+int PrecachedFileReader::FinishRead(void)
+{
+	return m_lresult;
+}
+
+void PrecachedFileReader::CancelRead(void)
+{
+}
+
+void PrecachedFileReader::Close(void)
+{
+	if (m_data)
+	{
+		free(m_data);
+		m_data = NULL;
+	}
+}
+
+uint PrecachedFileReader::GetBlockCount(void) const
+{
+	return m_blocks;
+}
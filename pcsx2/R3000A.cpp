@@ -20,6 +20,7 @@
 #include "Sio.h"
 #include "Sif.h"
 #include "DebugTools/Breakpoints.h"
+#include "FrameProfiler.h"
 #include "R5900OpcodeTables.h"
 
 using namespace R3000A;
@@ -199,6 +200,11 @@ static __fi void _psxTestInterrupts()
 
 __ri void iopEventTest()
 {
+	// When called mid-timeslice (from the IOP's own branch test) the time
+	// since the previous boundary was spent running IOP code; when called
+	// from the EE event test the slice is empty, so this attributes nothing.
+	FrameProfiler::AccountSlice(FrameProfiler::Ctx_IOP);
+
 	if( psxTestCycle( psxNextsCounter, psxNextCounter ) )
 	{
 		psxRcntUpdate();
@@ -228,6 +234,9 @@ __ri void iopEventTest()
 			iopEventAction = true;
 		}
 	}
+
+	// IOP counter updates and DMA/CDVD handler servicing above.
+	FrameProfiler::AccountSlice(FrameProfiler::Ctx_Events);
 }
 
 void iopTestIntc()
@@ -269,8 +278,9 @@ int psxIsBreakpointNeeded(u32 addr)
 	if (CBreakPoints::IsAddressBreakPoint(BREAKPOINT_IOP, addr))
 		bpFlags += 1;
 
-	// there may be a breakpoint in the delay slot
-	if (psxIsBranchOrJump(addr) && CBreakPoints::IsAddressBreakPoint(BREAKPOINT_IOP, addr + 4))
+	// there may be a breakpoint in the delay slot; probe the address first so
+	// the opcode fetch/decode only happens when it can actually matter
+	if (CBreakPoints::IsAddressBreakPoint(BREAKPOINT_IOP, addr + 4) && psxIsBranchOrJump(addr))
 		bpFlags += 2;
 
 	return bpFlags;
@@ -37,7 +37,10 @@
 #include "GameDatabase.h"
 
 #include "DebugTools/Breakpoints.h"
+#include "DebugTools/Tracepoint.h"
+#include "FrameProfiler.h"
 #include "R5900OpcodeTables.h"
+#include "gui/AppSaveStates.h"
 
 using namespace R5900;	// for R5900 disasm tools
 
@@ -287,10 +290,20 @@ static __fi void _cpuTestInterrupts()
 		//Console.Write("DMAC Disabled or suspended");
 		return;
 	}
+
+	// Nothing queued at all is the common case when the event test fired for
+	// a counter deadline or an IOP timeslice, so get out before testing the
+	// individual channels.
+	if (!(cpuRegs.interrupt & ((1 << DMAC_VIF1) | (1 << DMAC_GIF) | (1 << DMAC_SIF0) | (1 << DMAC_SIF1)
+		| (1 << DMAC_VIF0) | (1 << DMAC_FROM_IPU) | (1 << DMAC_TO_IPU)
+		| (1 << DMAC_FROM_SPR) | (1 << DMAC_TO_SPR) | (1 << DMAC_MFIFO_VIF) | (1 << DMAC_MFIFO_GIF)
+		| (1 << VIF_VU0_FINISH) | (1 << VIF_VU1_FINISH))))
+		return;
+
 	/* These are 'pcsx2 interrupts', they handle asynchronous stuff
 	   that depends on the cycle timings */
 
-	TESTINT(DMAC_VIF1,		vif1Interrupt);	
+	TESTINT(DMAC_VIF1,		vif1Interrupt);
 	TESTINT(DMAC_GIF,		gifInterrupt);
 	TESTINT(DMAC_SIF0,		EEsif0Interrupt);
 	TESTINT(DMAC_SIF1,		EEsif1Interrupt);
@@ -370,6 +383,14 @@ __fi void _cpuEventTest_Shared()
 	ScopedBool etest(eeEventTestIsActive);
 	g_nextEventCycle = cpuRegs.cycle + eeWaitCycles;
 
+	Tracepoint::Record(TRACE_EE_EVENT_TEST, cpuRegs.cycle);
+
+	// Everything since the previous boundary was the EE running guest code;
+	// whether that was the game or the kernel/BIOS is told by where the PC
+	// sits now (kseg holds the kernel, useg the game).
+	FrameProfiler::AccountSlice((cpuRegs.pc >= 0x80000000) ?
+		FrameProfiler::Ctx_EEKernel : FrameProfiler::Ctx_EEUser);
+
 	// ---- INTC / DMAC (CPU-level Exceptions) -----------------
 	// Done first because exceptions raised during event tests need to be postponed a few
 	// cycles (fixes Grandia II [PAL], which does a spin loop on a vsync and expects to
@@ -410,6 +431,10 @@ __fi void _cpuEventTest_Shared()
 	else
 		_cpuTestInterrupts();
 
+	// Counter updates and the INTC/DMAC handlers above share a bucket: they
+	// are all event servicing on behalf of the guest.
+	FrameProfiler::AccountSlice(FrameProfiler::Ctx_Events);
+
 	// ---- IOP -------------
 	// * It's important to run a iopEventTest before calling ExecuteBlock. This
 	//   is because the IOP does not always perform branch tests before returning
@@ -437,12 +462,16 @@ __fi void _cpuEventTest_Shared()
 		iopEventAction = false;
 	}
 
+	FrameProfiler::AccountSlice(FrameProfiler::Ctx_IOP);
+
 	// ---- VU Sync -------------
 	// We're in a EventTest.  All dynarec registers are flushed
 	// so there is no need to freeze registers here.
 	CpuVU0->ExecuteBlock();
 	CpuVU1->ExecuteBlock();
 
+	FrameProfiler::AccountSlice(FrameProfiler::Ctx_VU);
+
 	// ---- Schedule Next Event Test --------------
 
 	if( EEsCycle > 192 )
@@ -680,6 +709,11 @@ void __fastcall eeloadHook()
 	// into EELOAD's memory.
 	if (g_SkipBiosHack && elfname.empty())
 	{
+		// The machine state here is a function of the BIOS alone: every fast boot spends
+		// the same ~20 virtual seconds of bringup to reach this point.  Capture it once
+		// per BIOS so later boots can restore it instead (see StateCopy_TryBootTemplate).
+		StateCopy_CaptureBootTemplate();
+
 		std::string elftoload;
 		if (!elf_override.IsEmpty())
 		{
@@ -781,8 +815,9 @@ int isBreakpointNeeded(u32 addr)
 	if (CBreakPoints::IsAddressBreakPoint(BREAKPOINT_EE, addr))
 		bpFlags += 1;
 
-	// there may be a breakpoint in the delay slot
-	if (isBranchOrJump(addr) && CBreakPoints::IsAddressBreakPoint(BREAKPOINT_EE, addr+4))
+	// there may be a breakpoint in the delay slot; probe the address first so
+	// the opcode fetch/decode only happens when it can actually matter
+	if (CBreakPoints::IsAddressBreakPoint(BREAKPOINT_EE, addr+4) && isBranchOrJump(addr))
 		bpFlags += 2;
 
 	return bpFlags;
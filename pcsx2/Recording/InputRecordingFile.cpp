@@ -60,6 +60,8 @@ bool InputRecordingFile::Close()
 	{
 		return false;
 	}
+	flushFrameBlock();
+	bufferedFrame = -1;
 	fclose(recordingFile);
 	recordingFile = nullptr;
 	filename = "";
@@ -104,6 +106,8 @@ void InputRecordingFile::IncrementUndoCount()
 
 bool InputRecordingFile::open(const wxString path, bool newRecording)
 {
+	bufferedFrame = -1;
+	bufferedFrameDirty = false;
 	if (newRecording)
 	{
 		if ((recordingFile = wxFopen(path, L"wb+")) != nullptr)
@@ -143,19 +147,56 @@ bool InputRecordingFile::OpenExisting(const wxString& path)
 	return open(path, false);
 }
 
-bool InputRecordingFile::ReadKeyBuffer(u8 &result, const uint &frame, const uint port, const uint bufIndex)
+bool InputRecordingFile::flushFrameBlock()
 {
-	if (recordingFile == nullptr)
+	if (!bufferedFrameDirty)
+	{
+		return true;
+	}
+	if (fseek(recordingFile, getRecordingBlockSeekPoint(bufferedFrame), SEEK_SET) != 0
+		|| fwrite(frameBlockBuffer, 1, inputBytesPerFrame, recordingFile) != inputBytesPerFrame)
 	{
 		return false;
 	}
+	bufferedFrameDirty = false;
+	fflush(recordingFile);
+	return true;
+}
 
-	long seek = getRecordingBlockSeekPoint(frame) + controllerInputBytes * port + bufIndex;
-	if (fseek(recordingFile, seek, SEEK_SET) != 0 || fread(&result, 1, 1, recordingFile) != 1)
+bool InputRecordingFile::bufferFrame(const long frame, const bool forWrite)
+{
+	if (frame == bufferedFrame)
+	{
+		return true;
+	}
+	if (!flushFrameBlock())
+	{
+		return false;
+	}
+	if (fseek(recordingFile, getRecordingBlockSeekPoint(frame), SEEK_SET) != 0
+		|| fread(frameBlockBuffer, 1, inputBytesPerFrame, recordingFile) != inputBytesPerFrame)
+	{
+		// The frame does not exist in the file yet, which is only fine when
+		// we're about to record it
+		if (!forWrite)
+		{
+			return false;
+		}
+		clearerr(recordingFile);
+		memset(frameBlockBuffer, 0, inputBytesPerFrame);
+	}
+	bufferedFrame = frame;
+	return true;
+}
+
+bool InputRecordingFile::ReadKeyBuffer(u8 &result, const uint &frame, const uint port, const uint bufIndex)
+{
+	if (recordingFile == nullptr || !bufferFrame(frame, false))
 	{
 		return false;
 	}
 
+	result = frameBlockBuffer[controllerInputBytes * port + bufIndex];
 	return true;
 }
 
@@ -189,19 +230,13 @@ bool InputRecordingFile::WriteHeader()
 
 bool InputRecordingFile::WriteKeyBuffer(const uint &frame, const uint port, const uint bufIndex, const u8 &buf)
 {
-	if (recordingFile == nullptr)
+	if (recordingFile == nullptr || !bufferFrame(frame, true))
 	{
 		return false;
 	}
 
-	long seek = getRecordingBlockSeekPoint(frame) + 18 * port + bufIndex;
-
-	if (fseek(recordingFile, seek, SEEK_SET) != 0 || fwrite(&buf, 1, 1, recordingFile) != 1)
-	{
-		return false;
-	}
-
-	fflush(recordingFile);
+	frameBlockBuffer[controllerInputBytes * port + bufIndex] = buf;
+	bufferedFrameDirty = true;
 	return true;
 }
 
@@ -105,6 +105,20 @@ private:
 	long totalFrames = 0;
 	unsigned long undoCount = 0;
 
+	// Single-frame block cache. Input data is produced and consumed a byte at
+	// a time, so buffering the active frame's block keeps file access down to
+	// one read/write per frame instead of one per byte.
+	u8 frameBlockBuffer[inputBytesPerFrame] = {};
+	long bufferedFrame = -1;
+	bool bufferedFrameDirty = false;
+
+	// Makes the given frame's block the buffered one, flushing the previous
+	// block if it has pending writes. When writing past the end of the file
+	// the block starts out zeroed.
+	bool bufferFrame(const long frame, const bool forWrite);
+	// Writes the buffered block back to the file if it has pending writes
+	bool flushFrameBlock();
+
 	// Calculates the position of the current frame in the input recording
 	long getRecordingBlockSeekPoint(const long& frame);
 	bool open(const wxString path, bool newRecording);
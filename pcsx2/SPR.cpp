@@ -81,18 +81,24 @@ static void TestClearVUs(u32 madr, u32 qwc, bool isWrite)
 	}
 }
 
+// Both directions use the temporal memcpy_fast deliberately: scratchpad DMA is
+// the EE's double-buffering workhorse, so whatever lands on either side is
+// nearly always read again within a frame -- streaming it past the cache
+// (memcpy_nt) would just turn those reads into DRAM misses.
 static void memcpy_to_spr(u32 dst, u8* src, size_t size)
 {
 	dst &= _16kb - 1;
 
-	if (dst + size >= _16kb) {
+	// Note: > and not >=, a copy ending exactly at the top of the scratchpad
+	// doesn't wrap and can go through the single memcpy below.
+	if (dst + size > _16kb) {
 		size_t end = _16kb - dst;
-		memcpy(&psSu128(dst), src, end);
+		memcpy_fast(&psSu128(dst), src, end);
 
 		src += end;
-		memcpy(&psSu128(0)  , src, size - end);
+		memcpy_fast(&psSu128(0)  , src, size - end);
 	} else {
-		memcpy(&psSu128(dst), src, size);
+		memcpy_fast(&psSu128(dst), src, size);
 	}
 }
 
@@ -100,14 +106,15 @@ static void memcpy_from_spr(u8* dst, u32 src, size_t size)
 {
 	src &= _16kb - 1;
 
-	if (src + size >= _16kb) {
+	// Same boundary note as memcpy_to_spr above.
+	if (src + size > _16kb) {
 		size_t end = _16kb - src;
-		memcpy(dst, &psSu128(src), end);
+		memcpy_fast(dst, &psSu128(src), end);
 
 		dst += end;
-		memcpy(dst, &psSu128(0)  , size - end);
+		memcpy_fast(dst, &psSu128(0)  , size - end);
 	} else {
-		memcpy(dst, &psSu128(src), size);
+		memcpy_fast(dst, &psSu128(src), size);
 	}
 }
 
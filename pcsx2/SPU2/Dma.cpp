@@ -129,6 +129,21 @@ void V_Core::AutoDMAReadBuffer(int mode) //mode: 0= split stereo; 1 = do not spl
 	}
 	else
 	{
+		// Fast path for the usual streaming refill (FMVs stream ADMA
+		// constantly): a full left+right half-buffer pair lands at 0x2000+spos
+		// and 0x2200+spos, which are contiguous in SPU RAM, so both halves can
+		// be pulled from IOP memory with a single bulk copy.
+		if (leftbuffer && size == 0x200)
+		{
+			if (DMAPtr != nullptr)
+				memcpy(GetMemPtr(0x2000 + (Index << 10) + (spos & ~0x200)), DMAPtr + InputDataProgress, 0x400);
+			InputDataTransferred += 0x400;
+			InputDataLeft -= 0x200;
+			InputDataProgress += 0x200;
+			size = 0;
+			InputPosWrite += 0x100;
+		}
+
 		while (size)
 		{
 			if (!leftbuffer)
@@ -274,6 +289,7 @@ void V_Core::FinishDMAwrite()
 
 	const u32 buff1size = (buff1end - ActiveTSA);
 	memcpy(GetMemPtr(ActiveTSA), DMAPtr, buff1size * 2);
+	spu2M_MarkDirtyRange(ActiveTSA, buff1size);
 
 	u32 TDA;
 
@@ -294,6 +310,7 @@ void V_Core::FinishDMAwrite()
 		// Emulation Grayarea: Should addresses wrap around to zero, or wrap around to
 		// 0x2800?  Hard to know for sure (almost no games depend on this)
 		memcpy(GetMemPtr(0), DMAPtr, buff2end * 2);
+		spu2M_MarkDirtyRange(0, buff2end);
 		TDA = (buff2end) & 0xfffff;
 
 		// Flag interrupt?  If IRQA occurs between start and dest, flag it.
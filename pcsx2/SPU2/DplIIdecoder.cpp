@@ -95,8 +95,14 @@ void ProcessDplIISample32(const StereoOut32& src, Stereo51Out32DplII* s)
 	// Equalize the power levels for L/R
 	float B = std::min(0.9f, std::max(-0.9f, Balance));
 
-	float VL = L / (1 - B); // if B>0, it means R>L, so increase L, else decrease L
-	float VR = R / (1 + B); // vice-versa
+	// if B>0, it means R>L, so increase L, else decrease L (and vice-versa
+	// for R).  L/(1-B) and R/(1+B) folded into a single division by the
+	// product -- this runs per sample on the output callback thread, and the
+	// two divides were the most expensive thing in here.
+	float BInv = 1.0f / ((1 - B) * (1 + B));
+
+	float VL = L * (1 + B) * BInv;
+	float VR = R * (1 - B) * BInv;
 
 	// 1.73+1.22 = 2.94; 2.94 = 0.34 = 0.9996; Close enough.
 	// The range for VL/VR is approximately 0..1,
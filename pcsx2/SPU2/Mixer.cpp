@@ -132,6 +132,12 @@ static void __forceinline IncrementNextA(V_Core& thiscore, uint voiceidx)
 // invalided when DMA transfers and memory writes are performed.
 PcmCacheEntry* pcm_cache_data = nullptr;
 
+// Private decode targets used when a voice contests a cache line that another
+// voice validated with different decoder history (see GetNextDataBuffered).
+// Kept out of V_Voice so the savestate layout is unaffected; after a state
+// load SBuffer is re-pointed into the cache, same as before.
+static s16 pcm_contested_data[2][V_Core::NumVoices][pcm_DecodedSamplesPerBlock];
+
 int g_counter_cache_hits = 0;
 int g_counter_cache_misses = 0;
 int g_counter_cache_ignores = 0;
@@ -227,6 +233,21 @@ static __forceinline s32 GetNextDataBuffered(V_Core& thiscore, uint voiceidx)
 			if (IsDevBuild)
 				g_counter_cache_hits++;
 		}
+		else if (cacheLine.Validated && vc.NextA >= SPU2_DYN_MEMLINE)
+		{
+			// Contested block: another voice has this block cached with a
+			// different decoder history.  Decode into this voice's private
+			// buffer instead of evicting, so voices streaming the same sample
+			// data out of phase (layered SFX) don't thrash the line between
+			// them -- the contested voice pays for its decode either way.
+
+			vc.SBuffer = pcm_contested_data[thiscore.Index][voiceidx];
+
+			if (IsDevBuild)
+				g_counter_cache_misses++;
+
+			XA_decode_block(vc.SBuffer, memptr, vc.Prev1, vc.Prev2);
+		}
 		else
 		{
 			// Only flag the cache if it's a non-dynamic memory range.
@@ -553,6 +574,7 @@ static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 }
 
 
+template <int InterpType>
 static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
@@ -582,34 +604,7 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 		if (vc.Noise)
 			Value = GetNoiseValues(thiscore);
 		else
-		{
-			// Optimization : Forceinline'd Templated Dispatch Table.  Any halfwit compiler will
-			// turn this into a clever jump dispatch table (no call/rets, no compares, uber-efficient!)
-
-			switch (Interpolation)
-			{
-				case 0:
-					Value = GetVoiceValues<0>(thiscore, voiceidx);
-					break;
-				case 1:
-					Value = GetVoiceValues<1>(thiscore, voiceidx);
-					break;
-				case 2:
-					Value = GetVoiceValues<2>(thiscore, voiceidx);
-					break;
-				case 3:
-					Value = GetVoiceValues<3>(thiscore, voiceidx);
-					break;
-				case 4:
-					Value = GetVoiceValues<4>(thiscore, voiceidx);
-					break;
-				case 5:
-					Value = GetVoiceValues<5>(thiscore, voiceidx);
-					break;
-
-					jNO_DEFAULT;
-			}
-		}
+			Value = GetVoiceValues<InterpType>(thiscore, voiceidx);
 
 		// Update and Apply ADSR  (applies to normal and noise sources)
 		//
@@ -644,13 +639,14 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 const VoiceMixSet VoiceMixSet::Empty((StereoOut32()), (StereoOut32())); // Don't use SteroOut32::Empty because C++ doesn't make any dep/order checks on global initializers.
 
-static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
+template <int InterpType>
+static __forceinline void _MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
 
 	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
-		StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+		StereoOut32 VVal(MixVoice<InterpType>(coreidx, voiceidx));
 
 		// Note: Results from MixVoice are ranged at 16 bits.
 
@@ -661,6 +657,37 @@ static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 	}
 }
 
+static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
+{
+	// Optimization : Forceinline'd Templated Dispatch Table.  The interpolation
+	// mode is fixed for the whole voice block, so pick the specialized loop once
+	// here instead of re-dispatching (and re-branching) per voice per sample.
+
+	switch (Interpolation)
+	{
+		case 0:
+			_MixCoreVoices<0>(dest, coreidx);
+			break;
+		case 1:
+			_MixCoreVoices<1>(dest, coreidx);
+			break;
+		case 2:
+			_MixCoreVoices<2>(dest, coreidx);
+			break;
+		case 3:
+			_MixCoreVoices<3>(dest, coreidx);
+			break;
+		case 4:
+			_MixCoreVoices<4>(dest, coreidx);
+			break;
+		case 5:
+			_MixCoreVoices<5>(dest, coreidx);
+			break;
+
+			jNO_DEFAULT;
+	}
+}
+
 StereoOut32 V_Core::Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext)
 {
 	MasterVol.Update();
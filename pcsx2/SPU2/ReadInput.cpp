@@ -106,16 +106,20 @@ StereoOut32 V_Core::ReadInput()
 	StereoOut32 retval;
 	s16 ReadIndex = OutPos;
 
+	// Left input buffer address; the right buffer sits 0x200 words above it.
+	// (computed once -- this runs for every sample of both cores)
+	const u32 LeftAddr = 0x2000 + (Index << 10) + ReadIndex;
+
 	for (int i = 0; i < 2; i++)
-		if (Cores[i].IRQEnable && (0x2000 + (Index << 10) + ReadIndex) == (Cores[i].IRQA & 0xfffffdff))
+		if (Cores[i].IRQEnable && LeftAddr == (Cores[i].IRQA & 0xfffffdff))
 			SetIrqCall(i);
 
 	// PlayMode & 2 is Bypass Mode, so it doesn't go through the SPU
 	if (Index == 1 || (Index == 0 && (PlayMode & 2) == 0))
 	{
 		retval = StereoOut32(
-			(s32)(*GetMemPtr(0x2000 + (Index << 10) + ReadIndex)),
-			(s32)(*GetMemPtr(0x2200 + (Index << 10) + ReadIndex)));
+			(s32)(*GetMemPtr(LeftAddr)),
+			(s32)(*GetMemPtr(LeftAddr + 0x200)));
 	}
 
 #ifdef PCSX2_DEVBUILD
@@ -95,16 +95,21 @@ static constexpr std::array<s32, NUM_TAPS> filter_coefs = {
 
 s32 __forceinline V_Core::ReverbDownsample(bool right)
 {
+	// The buffer mirrors every sample at x and x+64, so starting from the wrapped
+	// base index the taps can be read as a straight run -- which also lets the
+	// compiler vectorize the filter instead of recomputing a masked index per tap.
+	const s32* buf = &RevbDownBuf[right][(RevbSampleBufPos - NUM_TAPS) & 63];
+
 	s32 out = 0;
 
 	// Skipping the 0 coefs.
 	for (u32 i = 0; i < NUM_TAPS; i += 2)
 	{
-		out += RevbDownBuf[right][((RevbSampleBufPos - NUM_TAPS) + i) & 63] * filter_coefs[i];
+		out += buf[i] * filter_coefs[i];
 	}
 
 	// We also skipped the middle so add that in.
-	out += RevbDownBuf[right][((RevbSampleBufPos - NUM_TAPS) + 19) & 63] * filter_coefs[19];
+	out += buf[19] * filter_coefs[19];
 
 	out >>= 15;
 	Clampify(out, (s32)INT16_MIN, (s32)INT16_MAX);
@@ -115,23 +120,28 @@ s32 __forceinline V_Core::ReverbDownsample(bool right)
 
 StereoOut32 __forceinline V_Core::ReverbUpsample(bool phase)
 {
+	// Same contiguous-run trick as ReverbDownsample (samples mirrored at x+64).
+	const u32 base = ((RevbSampleBufPos - NUM_TAPS) >> 1) & 63;
+	const s32* lbuf = &RevbUpBuf[0][base];
+	const s32* rbuf = &RevbUpBuf[1][base];
+
 	s32 ls = 0, rs = 0;
 
 	if (phase)
 	{
-		ls += RevbUpBuf[0][(((RevbSampleBufPos - NUM_TAPS) >> 1) + 9) & 63] * filter_coefs[19];
-		rs += RevbUpBuf[1][(((RevbSampleBufPos - NUM_TAPS) >> 1) + 9) & 63] * filter_coefs[19];
+		ls += lbuf[9] * filter_coefs[19];
+		rs += rbuf[9] * filter_coefs[19];
 	}
 	else
 	{
 
 		for (u32 i = 0; i < (NUM_TAPS >> 1) + 1; i++)
 		{
-			ls += RevbUpBuf[0][(((RevbSampleBufPos - NUM_TAPS) >> 1) + i) & 63] * filter_coefs[i * 2];
+			ls += lbuf[i] * filter_coefs[i * 2];
 		}
 		for (u32 i = 0; i < (NUM_TAPS >> 1) + 1; i++)
 		{
-			rs += RevbUpBuf[1][(((RevbSampleBufPos - NUM_TAPS) >> 1) + i) & 63] * filter_coefs[i * 2];
+			rs += rbuf[i] * filter_coefs[i * 2];
 		}
 	}
 
@@ -152,8 +162,11 @@ StereoOut32 V_Core::DoReverb(const StereoOut32& Input)
 		return StereoOut32::Empty;
 	}
 
+	// Mirrored write; see the buffer declaration in defs.h.
 	RevbDownBuf[0][RevbSampleBufPos & 63] = Input.Left;
 	RevbDownBuf[1][RevbSampleBufPos & 63] = Input.Right;
+	RevbDownBuf[0][(RevbSampleBufPos & 63) + 64] = Input.Left;
+	RevbDownBuf[1][(RevbSampleBufPos & 63) + 64] = Input.Right;
 
 	bool R = Cycles & 1;
 
@@ -233,7 +246,9 @@ StereoOut32 V_Core::DoReverb(const StereoOut32& Input)
 		_spu2mem[apf2_dst] = clamp_mix(apf2);
 	}
 
-	RevbUpBuf[R][(RevbSampleBufPos >> 1) & 63] = clamp_mix(out);
+	const s32 upsample = clamp_mix(out);
+	RevbUpBuf[R][(RevbSampleBufPos >> 1) & 63] = upsample;
+	RevbUpBuf[R][((RevbSampleBufPos >> 1) & 63) + 64] = upsample;
 
 	RevbSampleBufPos++;
 
@@ -16,6 +16,10 @@
 #include "PrecompiledHeader.h"
 #include "Global.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 
 StereoOut32 StereoOut32::Empty(0, 0);
 
@@ -108,14 +112,42 @@ int FindOutputModuleById(const wchar_t* omodid)
 
 StereoOut32* SndBuffer::m_buffer;
 s32 SndBuffer::m_size;
-__aligned(4) volatile s32 SndBuffer::m_rpos;
-__aligned(4) volatile s32 SndBuffer::m_wpos;
+std::atomic<s32> SndBuffer::m_rpos;
+std::atomic<s32> SndBuffer::m_wpos;
 
 bool SndBuffer::m_underrun_freeze;
 StereoOut32* SndBuffer::sndTempBuffer = nullptr;
 StereoOut16* SndBuffer::sndTempBuffer16 = nullptr;
+StereoOut32* SndBuffer::sndWriteBuffer = nullptr;
 int SndBuffer::sndTempProgress = 0;
 
+// --------------------------------------------------------------------------------------
+//  Output worker thread
+// --------------------------------------------------------------------------------------
+// Timestretching is by far the most expensive part of audio output, and it used
+// to run inline with whatever IOP time slice happened to finish a packet --
+// stealing cycles from the EE/IOP thread every 64 samples.  Finished packets
+// are instead handed to a worker through this small SPSC queue (same
+// producer/consumer pattern as the output ring itself), and the stretcher and
+// all ring writes run on the worker.  The queue is bounded, so the emu thread
+// never drifts ahead by more than WorkerQueuePackets packets (~43ms); if the
+// worker stalls behind a clogged output device, packets are dropped just like
+// a ring overrun would drop them.
+static const int WorkerQueuePackets = 32;
+
+static StereoOut32* workerQueue = nullptr;
+static std::atomic<int> workerQueueRead(0);
+static std::atomic<int> workerQueueWrite(0);
+
+static std::thread workerThread;
+static std::mutex workerMutex;
+static std::condition_variable workerWake;
+static bool workerRunning = false;
+
+// Savestate loads happen on the emu thread, but the stretcher state belongs to
+// the worker; ClearContents posts the reset here instead of calling in.
+static std::atomic<bool> workerClearPending(false);
+
 int GetAlignedBufferSize(int comp)
 {
 	return (comp + SndOutPacketSize - 1) & ~(SndOutPacketSize - 1);
@@ -172,7 +204,9 @@ void SndBuffer::_InitFail()
 int SndBuffer::_GetApproximateDataInBuffer()
 {
 	// WARNING: not necessarily 100% up to date by the time it's used, but it will have to do.
-	return (m_wpos + m_size - m_rpos) % m_size;
+	// The acquire loads pair with the release stores below, so whatever fill level we
+	// compute, the corresponding sample data is already visible to this thread.
+	return (m_wpos.load(std::memory_order_acquire) + m_size - m_rpos.load(std::memory_order_acquire)) % m_size;
 }
 
 void SndBuffer::_WriteSamples_Internal(StereoOut32* bData, int nSamples)
@@ -180,29 +214,35 @@ void SndBuffer::_WriteSamples_Internal(StereoOut32* bData, int nSamples)
 	// WARNING: This assumes the write will NOT wrap around,
 	// and also assumes there's enough free space in the buffer.
 
-	memcpy(m_buffer + m_wpos, bData, nSamples * sizeof(StereoOut32));
-	m_wpos = (m_wpos + nSamples) % m_size;
+	const s32 wpos = m_wpos.load(std::memory_order_relaxed);
+	memcpy(m_buffer + wpos, bData, nSamples * sizeof(StereoOut32));
+
+	// Publish the new write position only after the samples are in the buffer.
+	m_wpos.store((wpos + nSamples) % m_size, std::memory_order_release);
 }
 
 void SndBuffer::_DropSamples_Internal(int nSamples)
 {
-	m_rpos = (m_rpos + nSamples) % m_size;
+	// Release, so the producer can't recycle this region before our reads of it are done.
+	m_rpos.store((m_rpos.load(std::memory_order_relaxed) + nSamples) % m_size, std::memory_order_release);
 }
 
 void SndBuffer::_ReadSamples_Internal(StereoOut32* bData, int nSamples)
 {
 	// WARNING: This assumes the read will NOT wrap around,
 	// and also assumes there's enough data in the buffer.
-	memcpy(bData, m_buffer + m_rpos, nSamples * sizeof(StereoOut32));
+	memcpy(bData, m_buffer + m_rpos.load(std::memory_order_relaxed), nSamples * sizeof(StereoOut32));
 	_DropSamples_Internal(nSamples);
 }
 
 void SndBuffer::_WriteSamples_Safe(StereoOut32* bData, int nSamples)
 {
 	// WARNING: This code assumes there's only ONE writing process.
-	if ((m_size - m_wpos) < nSamples)
+	const s32 wpos = m_wpos.load(std::memory_order_relaxed);
+
+	if ((m_size - wpos) < nSamples)
 	{
-		int b1 = m_size - m_wpos;
+		int b1 = m_size - wpos;
 		int b2 = nSamples - b1;
 
 		_WriteSamples_Internal(bData, b1);
@@ -217,9 +257,11 @@ void SndBuffer::_WriteSamples_Safe(StereoOut32* bData, int nSamples)
 void SndBuffer::_ReadSamples_Safe(StereoOut32* bData, int nSamples)
 {
 	// WARNING: This code assumes there's only ONE reading process.
-	if ((m_size - m_rpos) < nSamples)
+	const s32 rpos = m_rpos.load(std::memory_order_relaxed);
+
+	if ((m_size - rpos) < nSamples)
 	{
-		int b1 = m_size - m_rpos;
+		int b1 = m_size - rpos;
 		int b2 = nSamples - b1;
 
 		_ReadSamples_Internal(bData, b1);
@@ -259,7 +301,8 @@ void SndBuffer::ReadSamples(T* bData)
 		pxAssume(nSamples <= SndOutPacketSize);
 
 		// WARNING: This code assumes there's only ONE reading process.
-		int b1 = m_size - m_rpos;
+		const s32 rpos = m_rpos.load(std::memory_order_relaxed);
+		int b1 = m_size - rpos;
 
 		if (b1 > nSamples)
 			b1 = nSamples;
@@ -268,7 +311,7 @@ void SndBuffer::ReadSamples(T* bData)
 		{
 			// First part
 			for (int i = 0; i < b1; i++)
-				bData[i].AdjustFrom(m_buffer[i + m_rpos]);
+				bData[i].AdjustFrom(m_buffer[i + rpos]);
 
 			// Second part
 			int b2 = nSamples - b1;
@@ -279,7 +322,7 @@ void SndBuffer::ReadSamples(T* bData)
 		{
 			// First part
 			for (int i = 0; i < b1; i++)
-				bData[i].ResampleFrom(m_buffer[i + m_rpos]);
+				bData[i].ResampleFrom(m_buffer[i + rpos]);
 
 			// Second part
 			int b2 = nSamples - b1;
@@ -370,6 +413,70 @@ void SndBuffer::_WriteSamples(StereoOut32* bData, int nSamples)
 	_WriteSamples_Safe(bData, nSamples);
 }
 
+void SndBuffer::_EnqueuePacket(const StereoOut32* src)
+{
+	const int wpos = workerQueueWrite.load(std::memory_order_relaxed);
+	const int next = (wpos + 1) % WorkerQueuePackets;
+
+	if (next == workerQueueRead.load(std::memory_order_acquire))
+	{
+		// The worker is stalled behind a clogged output device.  Drop the
+		// packet, same as the ring itself does on overrun.
+		if (MsgOverruns())
+			ConLog(" * SPU2 > Worker queue overrun!\n");
+		return;
+	}
+
+	memcpy(&workerQueue[wpos * SndOutPacketSize], src, sizeof(StereoOut32) * SndOutPacketSize);
+
+	{
+		// Publishing under the lock pairs with the predicate check in
+		// _WorkerProc; without it a wakeup could slip in between the worker's
+		// check and its wait and be lost.
+		std::lock_guard<std::mutex> locker(workerMutex);
+		workerQueueWrite.store(next, std::memory_order_release);
+	}
+	workerWake.notify_one();
+}
+
+void SndBuffer::_WorkerProc()
+{
+	std::unique_lock<std::mutex> lock(workerMutex);
+
+	while (true)
+	{
+		workerWake.wait(lock, []() {
+			return !workerRunning || workerClearPending.load(std::memory_order_relaxed) ||
+				   workerQueueRead.load(std::memory_order_relaxed) != workerQueueWrite.load(std::memory_order_relaxed);
+		});
+
+		if (!workerRunning)
+			break;
+
+		lock.unlock();
+
+		if (workerClearPending.exchange(false))
+			soundtouchClearContents();
+
+		int rpos;
+		while ((rpos = workerQueueRead.load(std::memory_order_relaxed)) !=
+			   workerQueueWrite.load(std::memory_order_acquire))
+		{
+			memcpy(sndTempBuffer, &workerQueue[rpos * SndOutPacketSize], sizeof(StereoOut32) * SndOutPacketSize);
+
+			// Free the slot before processing; the packet is already out of it.
+			workerQueueRead.store((rpos + 1) % WorkerQueuePackets, std::memory_order_release);
+
+			if (SynchMode == 0) // TimeStrech on
+				timeStretchWrite();
+			else
+				_WriteSamples(sndTempBuffer, SndOutPacketSize);
+		}
+
+		lock.lock();
+	}
+}
+
 void SndBuffer::Init()
 {
 	if (mods[OutputModule] == nullptr)
@@ -395,6 +502,8 @@ void SndBuffer::Init()
 
 		sndTempBuffer = new StereoOut32[SndOutPacketSize];
 		sndTempBuffer16 = new StereoOut16[SndOutPacketSize * 2]; // in case of leftovers.
+		sndWriteBuffer = new StereoOut32[SndOutPacketSize];
+		workerQueue = new StereoOut32[WorkerQueuePackets * SndOutPacketSize];
 	}
 	catch (std::bad_alloc&)
 	{
@@ -412,10 +521,28 @@ void SndBuffer::Init()
 	// initialize module
 	if (mods[OutputModule]->Init() == -1)
 		_InitFail();
+
+	// Spin up the output worker.  If module init failed we're on the null
+	// output now, which never queues a packet, so the worker just idles.
+	workerQueueRead = 0;
+	workerQueueWrite = 0;
+	workerClearPending = false;
+	workerRunning = true;
+	workerThread = std::thread(_WorkerProc);
 }
 
 void SndBuffer::Cleanup()
 {
+	if (workerThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> locker(workerMutex);
+			workerRunning = false;
+		}
+		workerWake.notify_one();
+		workerThread.join();
+	}
+
 	mods[OutputModule]->Close();
 
 	soundtouchCleanup();
@@ -423,6 +550,8 @@ void SndBuffer::Cleanup()
 	safe_delete_array(m_buffer);
 	safe_delete_array(sndTempBuffer);
 	safe_delete_array(sndTempBuffer16);
+	safe_delete_array(sndWriteBuffer);
+	safe_delete_array(workerQueue);
 }
 
 int SndBuffer::m_dsp_progress = 0;
@@ -432,7 +561,17 @@ int SndBuffer::ssFreeze = 0;
 
 void SndBuffer::ClearContents()
 {
-	SndBuffer::soundtouchClearContents();
+	if (workerThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> locker(workerMutex);
+			workerClearPending.store(true, std::memory_order_relaxed);
+		}
+		workerWake.notify_one();
+	}
+	else
+		SndBuffer::soundtouchClearContents();
+
 	SndBuffer::ssFreeze = 256; //Delays sound output for about 1 second.
 }
 
@@ -447,7 +586,7 @@ void SndBuffer::Write(const StereoOut32& Sample)
 	if (mods[OutputModule] == &NullOut) // null output doesn't need buffering or stretching! :p
 		return;
 
-	sndTempBuffer[sndTempProgress++] = Sample;
+	sndWriteBuffer[sndTempProgress++] = Sample;
 
 	// If we haven't accumulated a full packet yet, do nothing more:
 	if (sndTempProgress < SndOutPacketSize)
@@ -459,17 +598,20 @@ void SndBuffer::Write(const StereoOut32& Sample)
 	{
 		ssFreeze--;
 		// Play silence
-		std::fill_n(sndTempBuffer, SndOutPacketSize, StereoOut32{});
+		std::fill_n(sndWriteBuffer, SndOutPacketSize, StereoOut32{});
 	}
 #ifndef __POSIX__
 	if (dspPluginEnabled)
 	{
 		// Convert in, send to winamp DSP, and convert out.
+		// (the DSP plugin stays on this thread -- winamp plugins make no
+		// promises about which thread they're called from, but changing it
+		// out from under them mid-stream is asking for trouble)
 
 		int ei = m_dsp_progress;
 		for (int i = 0; i < SndOutPacketSize; ++i, ++ei)
 		{
-			sndTempBuffer16[ei] = sndTempBuffer[i].DownSample();
+			sndTempBuffer16[ei] = sndWriteBuffer[i].DownSample();
 		}
 		m_dsp_progress += DspProcess((s16*)sndTempBuffer16 + m_dsp_progress, SndOutPacketSize);
 
@@ -479,13 +621,10 @@ void SndBuffer::Write(const StereoOut32& Sample)
 		{
 			for (int i = 0; i < SndOutPacketSize; ++i, ++ei)
 			{
-				sndTempBuffer[i] = sndTempBuffer16[ei].UpSample();
+				sndWriteBuffer[i] = sndTempBuffer16[ei].UpSample();
 			}
 
-			if (SynchMode == 0) // TimeStrech on
-				timeStretchWrite();
-			else
-				_WriteSamples(sndTempBuffer, SndOutPacketSize);
+			_EnqueuePacket(sndWriteBuffer);
 
 			m_dsp_progress -= SndOutPacketSize;
 		}
@@ -500,10 +639,7 @@ void SndBuffer::Write(const StereoOut32& Sample)
 #endif
 	else
 	{
-		if (SynchMode == 0) // TimeStrech on
-			timeStretchWrite();
-		else
-			_WriteSamples(sndTempBuffer, SndOutPacketSize);
+		_EnqueuePacket(sndWriteBuffer);
 	}
 }
 
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <atomic>
+
 // Number of stereo samples per SndOut block.
 // All drivers must work in units of this size when communicating with
 // SndOut.
@@ -569,6 +571,10 @@ private:
 	static StereoOut32* sndTempBuffer;
 	static StereoOut16* sndTempBuffer16;
 
+	// packet accumulation buffer for the emu thread; sndTempBuffer belongs to
+	// the output worker (it's the stretcher's working buffer).
+	static StereoOut32* sndWriteBuffer;
+
 	static int sndTempProgress;
 	static int m_dsp_progress;
 
@@ -578,8 +584,13 @@ private:
 	static StereoOut32* m_buffer;
 	static s32 m_size;
 
-	static __aligned(4) volatile s32 m_rpos;
-	static __aligned(4) volatile s32 m_wpos;
+	// Single-producer (mixer thread) / single-consumer (device callback) ring
+	// indices.  Atomics with release/acquire ordering, so the sample data is
+	// always visible to the other thread before the index that publishes it --
+	// plain volatile doesn't stop the compiler reordering the memcpy past the
+	// index store.
+	static std::atomic<s32> m_rpos;
+	static std::atomic<s32> m_wpos;
 
 	static float lastEmergencyAdj;
 	static float cTempo;
@@ -593,6 +604,7 @@ private:
 	static void soundtouchClearContents();
 	static void soundtouchCleanup();
 	static void timeStretchWrite();
+	static void timeStretchLinearWrite(float tempo);
 	static void timeStretchUnderrun();
 	static s32 timeStretchOverrun();
 
@@ -601,6 +613,9 @@ private:
 	static void UpdateTempoChangeSoundTouch();
 	static void UpdateTempoChangeSoundTouch2();
 
+	static void _EnqueuePacket(const StereoOut32* src);
+	static void _WorkerProc();
+
 	static void _WriteSamples(StereoOut32* bData, int nSamples);
 
 	static void _WriteSamples_Safe(StereoOut32* bData, int nSamples);
@@ -613,6 +628,11 @@ private:
 	static int _GetApproximateDataInBuffer();
 
 public:
+	// Buffer depth health for consumers outside SPU2 (the adaptive EE cycle
+	// controller): same -1.0 (underflow) .. 1.0 (overflow) scale the
+	// timestretcher works with, 0 (nominal) when output isn't running.
+	static float GetBufferStatus();
+
 	static void UpdateTempoChangeAsyncMixing();
 	static void Init();
 	static void Cleanup();
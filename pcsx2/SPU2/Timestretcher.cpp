@@ -60,6 +60,18 @@ float SndBuffer::GetStatusPct()
 	return result;
 }
 
+float SndBuffer::GetBufferStatus()
+{
+	if (m_buffer == NULL)
+		return 0.0f;
+
+	// A frozen buffer is the strongest "we're not keeping up" signal there is.
+	if (m_underrun_freeze)
+		return -1.0f;
+
+	return GetStatusPct();
+}
+
 
 //Alternative simple tempo adjustment. Based only on the soundtouch buffer state.
 //Base algorithm: aim at specific average number of samples at the buffer (by GUI), and adjust tempo simply by current/target.
@@ -106,6 +118,30 @@ unsigned int AVERAGING_WINDOW = 50.0 * targetIPS / 750;
 
 #define STRETCHER_RESET_THRESHOLD 5
 int gRequestStretcherReset = STRETCHER_RESET_THRESHOLD;
+
+//SoundTouch bypass: running the stretcher at a 1:1 ratio is pure overhead (the
+//  TDStretch overlap search costs the same whether it changes anything or not),
+//  which matters on the low-end machines that need the stretcher the most.
+//  Once the controller below settles into its 1:1 hysteresis state we drain
+//  SoundTouch and take it out of the path entirely.  Small drifts (up to
+//  LinearStretchLimit) are then covered by a cheap linear resampler; only when
+//  the required adjustment grows beyond that is SoundTouch re-engaged, so the
+//  two paths don't flip-flop per buffer.
+static const float LinearStretchLimit = 0.06f; //largest |tempo-1| the linear fallback may cover
+static const float LinearStretchDeadzone = 0.01f; //below this the packet is passed through untouched
+
+static bool stretchBypassed = false;
+static float rawTempo = 1.0f; //controller output before the 1:1 hysteresis override
+
+//linear fallback state: fractional read position and the last input frame,
+//  carried across packets so the interpolation stays continuous.
+static float linearPhase = 0.0f;
+static StereoOut32 linearPrev;
+
+//hysteresis state of UpdateTempoChangeSoundTouch2, at file scope so the bypass
+//  logic in timeStretchWrite can force an exit when it re-engages SoundTouch.
+static bool inside_hysteresis = false;
+static int hys_ok_count = 0;
 //Adds a value to the running average buffer, and return the new running average.
 float addToAvg(float val)
 {
@@ -154,9 +190,7 @@ void SndBuffer::UpdateTempoChangeSoundTouch2()
 	//base aim at buffer filled %
 	float baseTargetFullness = (double)targetSamplesReservoir; ///(double)m_size;//0.05;
 
-	//state vars
-	static bool inside_hysteresis;      //=false;
-	static int hys_ok_count;            //=0;
+	//state vars (inside_hysteresis/hys_ok_count live at file scope, see above)
 	static float dynamicTargetFullness; //=baseTargetFullness;
 	if (gRequestStretcherReset >= STRETCHER_RESET_THRESHOLD)
 	{
@@ -239,6 +273,8 @@ void SndBuffer::UpdateTempoChangeSoundTouch2()
 		hys_ok_count = 0;
 	}
 
+	rawTempo = tempoAdjust;
+
 	if (inside_hysteresis)
 		tempoAdjust = 1.0;
 
@@ -484,8 +520,72 @@ static void CvtPacketToInt(StereoOut32* srcdest, uint size)
 		*dest = (StereoOut32)*src;
 }
 
+// Cheap resampler used while SoundTouch is bypassed: stretches the packet in
+// sndTempBuffer by 'tempo' with simple linear interpolation.  At the few
+// percent of adjustment the bypass allows, the quality difference against the
+// full stretcher is inaudible.
+void SndBuffer::timeStretchLinearWrite(float tempo)
+{
+	StereoOut32 out[SndOutPacketSize * 2];
+	uint got = 0;
+
+	while (linearPhase < SndOutPacketSize && got < SndOutPacketSize * 2)
+	{
+		const int pos = (int)linearPhase;
+		const float frac = linearPhase - pos;
+		const StereoOut32& s0 = (pos == 0) ? linearPrev : sndTempBuffer[pos - 1];
+		const StereoOut32& s1 = sndTempBuffer[pos];
+
+		out[got].Left = s0.Left + (s32)(frac * (s1.Left - s0.Left));
+		out[got].Right = s0.Right + (s32)(frac * (s1.Right - s0.Right));
+		got++;
+
+		linearPhase += tempo;
+	}
+
+	linearPhase -= SndOutPacketSize;
+	linearPrev = sndTempBuffer[SndOutPacketSize - 1];
+
+	_WriteSamples(out, got);
+}
+
 void SndBuffer::timeStretchWrite()
 {
+	if (stretchBypassed)
+	{
+		if (fabsf(rawTempo - 1.0f) > LinearStretchLimit)
+		{
+			// The drift outgrew what the linear fallback can mask.  Hand the
+			// stream back to SoundTouch (it was drained on bypass entry, so
+			// nothing is lost), and force the controller out of its 1:1 state
+			// right away instead of waiting for its own, wider exit threshold.
+			if (MsgOverruns())
+				ConLog("~~~~~~> stretch: Bypass off (tempo: %f)\n", rawTempo);
+			stretchBypassed = false;
+			inside_hysteresis = false;
+			hys_ok_count = 0;
+		}
+		else
+		{
+			if (fabsf(rawTempo - 1.0f) <= LinearStretchDeadzone)
+			{
+				// Effectively 1:1: pass the packet through untouched.  Small
+				// uncorrected drifts just move the buffer fill a little, and
+				// the controller folds that back into rawTempo.
+				linearPhase = 0.0f;
+				linearPrev = sndTempBuffer[SndOutPacketSize - 1];
+				_WriteSamples(sndTempBuffer, SndOutPacketSize);
+			}
+			else
+				timeStretchLinearWrite(rawTempo);
+
+			// The controller keeps running on the real buffer state so it can
+			// tell us when to re-engage.
+			UpdateTempoChangeSoundTouch2();
+			return;
+		}
+	}
+
 	// data prediction helps keep the tempo adjustments more accurate.
 	// The timestretcher returns packets in belated "clump" form.
 	// Meaning that most of the time we'll get nothing back, and then
@@ -512,6 +612,26 @@ void SndBuffer::timeStretchWrite()
 	UpdateTempoChangeSoundTouch();
 #else
 	UpdateTempoChangeSoundTouch2();
+
+	if (!stretchBypassed && inside_hysteresis)
+	{
+		// Settled at 1:1.  Flush what's still inside SoundTouch so no audio is
+		// lost across the switch (the tail is padded with a little silence,
+		// which the controller absorbs), then stop feeding it until the speed
+		// actually diverges again.
+		if (MsgOverruns())
+			ConLog("======> stretch: Bypass on\n");
+		pSoundTouch->flush();
+		while (tempProgress = pSoundTouch->receiveSamples((float*)sndTempBuffer, SndOutPacketSize),
+			   tempProgress != 0)
+		{
+			CvtPacketToInt(sndTempBuffer, tempProgress);
+			_WriteSamples(sndTempBuffer, tempProgress);
+		}
+		linearPhase = 0.0f;
+		linearPrev = StereoOut32::Empty;
+		stretchBypassed = true;
+	}
 #endif
 }
 
@@ -530,6 +650,11 @@ void SndBuffer::soundtouchInit()
 
 	// some timestretch management vars:
 
+	stretchBypassed = false;
+	rawTempo = 1.0f;
+	linearPhase = 0.0f;
+	linearPrev = StereoOut32::Empty;
+
 	cTempo = 1.0;
 	eTempo = 1.0;
 	lastPct = 0;
@@ -547,6 +672,11 @@ void SndBuffer::soundtouchClearContents()
 	pSoundTouch->clear();
 	pSoundTouch->setTempo(1);
 
+	stretchBypassed = false;
+	rawTempo = 1.0f;
+	linearPhase = 0.0f;
+	linearPrev = StereoOut32::Empty;
+
 	cTempo = 1.0;
 	eTempo = 1.0;
 	lastPct = 0;
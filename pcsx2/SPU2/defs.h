@@ -31,6 +31,13 @@ extern s16 spu2M_Read(u32 addr);
 extern void spu2M_Write(u32 addr, s16 value);
 extern void spu2M_Write(u32 addr, u16 value);
 
+// Dirty-page journal for SPU2 RAM; see the notes in spu2sys.cpp.
+static const u32 spu2M_WordsPerDirtyPage = 0x1000; // 8kb pages, 256 of them
+static const u32 spu2M_DirtyPageCount = 0x100000 / spu2M_WordsPerDirtyPage;
+extern u32 spu2M_DirtyPageMap[spu2M_DirtyPageCount / 32];
+extern void spu2M_MarkDirtyRange(u32 addr, u32 words);
+extern void spu2M_ClearDirtyPages();
+
 
 struct V_VolumeLR
 {
@@ -417,8 +424,10 @@ struct V_Core
 	V_Reverb Revb;              // Reverb Registers
 	V_ReverbBuffers RevBuffers; // buffer pointers for reverb, pre-calculated and pre-clipped.
 
-	s32 RevbDownBuf[2][64]; // Downsample buffer for reverb, one for each channel
-	s32 RevbUpBuf[2][64]; // Upsample buffer for reverb, one for each channel
+	// Each sample is written twice, at x and x+64, so the resampling FIRs can
+	// read their taps as one contiguous run without masking every index.
+	s32 RevbDownBuf[2][128]; // Downsample buffer for reverb, one for each channel
+	s32 RevbUpBuf[2][128]; // Upsample buffer for reverb, one for each channel
 	u32 RevbSampleBufPos;
 	u32 EffectsStartA;
 	u32 EffectsEndA;
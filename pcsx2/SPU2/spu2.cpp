@@ -124,6 +124,8 @@ s32 SPU2reset(PS2Modes isRunningPSXMode)
 		memset(_spu2mem + 0x2800, 7, 0x10); // from BIOS reversal. Locks the voices so they don't run free.
 		memset(_spu2mem + 0xe870, 7, 0x10); // Loop which gets left over by the BIOS, Megaman X7 relies on it being there.
 
+		spu2M_MarkDirtyRange(0, 0x100000); // the whole of RAM just changed
+
 		Spdif.Info = 0; // Reset IRQ Status if it got set in a previously run game
 
 		Cores[0].Init(0);
@@ -417,6 +419,11 @@ void SPU2async(u32 cycles)
 #endif
 }
 
+float SPU2getBufferStatus()
+{
+	return SndBuffer::GetBufferStatus();
+}
+
 u16 SPU2read(u32 rmem)
 {
 	u16 ret = 0xDEAD;
@@ -40,6 +40,9 @@ bool SPU2setupRecording(const std::string* filename);
 void SPU2endRecording();
 
 void SPU2async(u32 cycles);
+// Output buffer depth on a -1.0 (underflow) .. 1.0 (overflow) scale; 0 when
+// audio output isn't running.  Consumed by the adaptive EE cycle controller.
+float SPU2getBufferStatus();
 s32 SPU2freeze(FreezeAction mode, freezeData* data);
 void SPU2configure();
 
@@ -24,7 +24,7 @@ namespace SPU2Savestate
 
 	// versioning for saves.
 	// Increment this when changes to the savestate system are made.
-	static const u32 SAVE_VERSION = 0x000e;
+	static const u32 SAVE_VERSION = 0x000f;
 
 	static void wipe_the_cache()
 	{
@@ -110,8 +110,13 @@ s32 __fastcall SPU2Savestate::ThawIt(DataBlock& spud)
 		if (spu2regs)
 			memcpy(spu2regs, spud.unkregs, sizeof(spud.unkregs));
 		if (_spu2mem)
+		{
 			memcpy(_spu2mem, spud.mem, sizeof(spud.mem));
 
+			// All of RAM just changed; incremental snapshots have to resync.
+			spu2M_MarkDirtyRange(0, 0x100000);
+		}
+
 		memcpy(Cores, spud.Cores, sizeof(Cores));
 		memcpy(&Spdif, &spud.Spdif, sizeof(Spdif));
 
@@ -75,6 +75,41 @@ __forceinline s16 spu2M_Read(u32 addr)
 	return *GetMemPtr(addr & 0xfffff);
 }
 
+// --------------------------------------------------------------------------------------
+//  SPU2 RAM dirty-page journal
+// --------------------------------------------------------------------------------------
+// Records which 8kb pages of SPU2 RAM have been written since the journal was
+// last cleared, so an incremental snapshotter (a rewind ring, for instance) can
+// copy just the changed pages instead of the full 2MB every time.  Register and
+// TSA writes mark pages through spu2M_Write below; the bulk DMA copies in
+// Dma.cpp mark their target ranges.  Two areas are treated as always dirty
+// rather than instrumenting their per-sample mixer stores:
+//   - the dynamic output area below SPU2_DYN_MEMLINE, and
+//   - the cores' reverb work areas while effects are enabled (flagged by
+//     spu2M_ClearDirtyPages, so a freshly cleared journal starts with them set).
+
+u32 spu2M_DirtyPageMap[spu2M_DirtyPageCount / 32];
+
+void spu2M_MarkDirtyRange(u32 addr, u32 words)
+{
+	const u32 first = (addr & 0xfffff) / spu2M_WordsPerDirtyPage;
+	const u32 last = ((addr & 0xfffff) + words - 1) / spu2M_WordsPerDirtyPage;
+
+	for (u32 page = first; page <= last && page < spu2M_DirtyPageCount; page++)
+		spu2M_DirtyPageMap[page >> 5] |= 1u << (page & 31);
+}
+
+void spu2M_ClearDirtyPages()
+{
+	memset(spu2M_DirtyPageMap, 0, sizeof(spu2M_DirtyPageMap));
+
+	spu2M_MarkDirtyRange(0, SPU2_DYN_MEMLINE);
+
+	for (int c = 0; c < 2; c++)
+		if (Cores[c].FxEnable && Cores[c].EffectsBufferSize > 0)
+			spu2M_MarkDirtyRange(Cores[c].EffectsStartA, Cores[c].EffectsBufferSize);
+}
+
 // writes a signed value to the SPU2 ram
 // Invalidates the ADPCM cache in the process.
 __forceinline void spu2M_Write(u32 addr, s16 value)
@@ -88,6 +123,9 @@ __forceinline void spu2M_Write(u32 addr, s16 value)
 		const int cacheIdx = addr / pcm_WordsPerBlock;
 		pcm_cache_data[cacheIdx].Validated = false;
 
+		const u32 page = addr / spu2M_WordsPerDirtyPage;
+		spu2M_DirtyPageMap[page >> 5] |= 1u << (page & 31);
+
 		if (MsgToConsole() && MsgCache())
 			ConLog("* SPU2: PcmCache Block Clear at 0x%x (cacheIdx=0x%x)\n", addr, cacheIdx);
 	}
@@ -441,11 +479,13 @@ __forceinline void TimeUpdate(u32 cClocks)
 		Cycles++;
 
 		// Start Queued Voices, they start after 2T (Tested on real HW)
+		// (KeyOn is zero almost every tick, so don't walk the voices for nothing)
 		for(int c = 0; c < 2; c++)
-			for (int v = 0; v < 24; v++)
-				if(Cores[c].KeyOn & (1 << v))
-					if(StartQueuedVoice(c, v))
-						Cores[c].KeyOn &= ~(1 << v);
+			if (Cores[c].KeyOn)
+				for (int v = 0; v < 24; v++)
+					if(Cores[c].KeyOn & (1 << v))
+						if(StartQueuedVoice(c, v))
+							Cores[c].KeyOn &= ~(1 << v);
 		// Note: IOP does not use MMX regs, so no need to save them.
 		//SaveMMXRegs();
 		Mix();
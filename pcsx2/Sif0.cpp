@@ -83,7 +83,46 @@ static __fi bool WriteIOPtoFifo()
 	sif0.iop.cycles += writeSize; //1 word per cycle
 	sif0.iop.counter -= writeSize;
 
-	
+
+	return true;
+}
+
+// Fast path: when the fifo is drained and both ends are in their data phase,
+// bouncing through the 128 word fifo just costs an extra copy and loop
+// iterations per 32 qwords.  Move whole qwords straight from IOP ram to the
+// EE destination instead; tags and the junk padding still go through the
+// fifo, and the cycle accounting matches the two step path exactly.
+static __fi bool WriteIOPtoEEDirect()
+{
+	const int readSize = std::min((s32)sif0ch.qwc, sif0.iop.counter >> 2);
+
+	tDMA_TAG *ptag;
+
+	ptag = sif0ch.getAddr(sif0ch.madr, DMAC_SIF0, true);
+	if (ptag == NULL)
+	{
+		DevCon.Warning("Write IOP to EE direct: ptag == NULL");
+		return false;
+	}
+
+	SIF_LOG("Write IOP to EE direct: %lX qw to %08X", readSize, sif0ch.madr);
+
+	memcpy(ptag, iopPhysMem(hw_dma9.madr), readSize << 4);
+
+	hw_dma9.madr += readSize << 4;
+	sif0.iop.cycles += readSize << 2; //1 word per cycle
+	sif0.iop.counter -= readSize << 2;
+
+	sif0ch.madr += readSize << 4;
+	sif0.ee.cycles += readSize;	// fixme : BIAS is factored in above
+	sif0ch.qwc -= readSize;
+
+	if (sif0ch.qwc == 0 && dmacRegs.ctrl.STS == STS_SIF0)
+	{
+		if ((sif0ch.chcr.MOD == NORMAL_MODE) || ((sif0ch.chcr.TAG >> 28) & 0x7) == TAG_CNTS)
+			dmacRegs.stadr.ADDR = sif0ch.madr;
+	}
+
 	return true;
 }
 
@@ -284,8 +323,15 @@ static __fi void HandleIOPTransfer()
 	}
 	else
 	{
-		// Write IOP to Fifo.
-		if (sif0.fifo.sif_free() > 0)
+		// Skip the fifo when it is empty and the EE side is waiting on data;
+		// see WriteIOPtoEEDirect.
+		if (sif0.fifo.size == 0 && sif0.iop.counter >= 4 &&
+			sif0.ee.busy && sif0ch.chcr.STR && sif0ch.qwc > 0 &&
+			WriteIOPtoEEDirect())
+		{
+			// All handled above.
+		}
+		else if (sif0.fifo.sif_free() > 0) // Write IOP to Fifo.
 		{
 			WriteIOPtoFifo();
 		}
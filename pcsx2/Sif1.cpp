@@ -79,6 +79,40 @@ static __fi bool WriteFifoToIOP()
 	return true;
 }
 
+// Fast path: when the fifo is drained and the IOP side is in its data phase,
+// move whole qwords straight from the EE source into IOP ram instead of
+// bouncing them through the 128 word fifo.  Tags (and TTE tag writes) still
+// go through the fifo, and the cycle accounting matches the two step path.
+static __fi bool WriteEEtoIOPDirect()
+{
+	const int writeSize = std::min((s32)sif1ch.qwc, sif1.iop.counter >> 2);
+
+	tDMA_TAG *ptag;
+
+	ptag = sif1ch.getAddr(sif1ch.madr, DMAC_SIF1, false);
+	if (ptag == NULL)
+	{
+		DevCon.Warning("Write EE to IOP direct: ptag == NULL");
+		return false;
+	}
+
+	SIF_LOG("Sif 1: Write EE to IOP direct, %04X qw to %08X", writeSize, hw_dma10.madr);
+
+	memcpy(iopPhysMem(hw_dma10.madr), ptag, writeSize << 4);
+	psxCpu->Clear(hw_dma10.madr, writeSize << 2);
+
+	sif1ch.madr += writeSize << 4;
+	hwDmacSrcTadrInc(sif1ch);
+	sif1.ee.cycles += writeSize;		// fixme : BIAS is factored in above
+	sif1ch.qwc -= writeSize;
+
+	hw_dma10.madr += writeSize << 4;
+	sif1.iop.cycles += writeSize;		// fixme: should be >> 2
+	sif1.iop.counter -= writeSize << 2;
+
+	return true;
+}
+
 // Get a tag and process it.
 static __fi bool ProcessEETag()
 {
@@ -228,7 +262,16 @@ static __fi void HandleEETransfer()
 			}
 				//DevCon.Warning("SIF1 stall control Not Implemented"); // STD == fromSIF1
 		}
-		if (sif1.fifo.sif_free() > 0)
+		// Skip the fifo when it is empty and the IOP side already knows how
+		// much it wants; see WriteEEtoIOPDirect.  Stall controlled transfers
+		// keep the fifo-paced path so the STD check above stays accurate.
+		if (sif1.fifo.size == 0 && sif1.iop.busy && sif1.iop.counter >= 4 &&
+			dmacRegs.ctrl.STD != STD_SIF1 &&
+			WriteEEtoIOPDirect())
+		{
+			// All handled above.
+		}
+		else if (sif1.fifo.sif_free() > 0)
 		{
 			WriteEEtoFifo();
 		}
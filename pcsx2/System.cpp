@@ -39,6 +39,7 @@ RecompiledCodeReserve::RecompiledCodeReserve( const wxString& name, uint defComm
 	: VirtualMemoryReserve( name, defCommit )
 {
 	m_prot_mode		= PageAccess_Any();
+	m_account		= MemAccount::Id_RecCache;
 }
 
 RecompiledCodeReserve::~RecompiledCodeReserve()
@@ -256,7 +256,13 @@ void SysCoreThread::GameStartingInThread()
 {
 	GetMTGS().SendGameCRC(ElfCRC);
 
-	MIPSAnalyst::ScanForFunctions(ElfTextRange.first, ElfTextRange.first + ElfTextRange.second, true);
+	// The function scan reads the whole text range through the debug
+	// interface, so reuse the cached result when this ELF was seen before.
+	if (!MIPSAnalyst::LoadFunctionsFromCache(ElfCRC, true))
+	{
+		MIPSAnalyst::ScanForFunctions(ElfTextRange.first, ElfTextRange.first + ElfTextRange.second, true);
+		MIPSAnalyst::SaveFunctionsToCache(ElfCRC);
+	}
 	symbolMap.UpdateActiveSymbols();
 	sApp.PostAppMethod(&Pcsx2App::resetDebugger);
 
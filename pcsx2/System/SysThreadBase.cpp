@@ -269,6 +269,10 @@ void SysThreadBase::Resume()
 
 void SysThreadBase::OnStartInThread()
 {
+	// Emulation threads (EE core, MTGS) are latency-critical; keep them off
+	// efficiency cores on hybrid hosts.  No-op when the host is homogeneous.
+	Threading::SetRoleAffinity(Threading::ThreadRole_Compute);
+
 	m_RunningLock.Acquire();
 	_parent::OnStartInThread();
 	m_ExecMode = ExecMode_Closing;
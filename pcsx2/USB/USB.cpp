@@ -575,6 +575,20 @@ void USBasync(u32 cycles)
 	{
 		while ((uint64_t)remaining >= qemu_ohci->eof_timer)
 		{
+			// When nothing is queued on the bus, collapse every frame this slice
+			// covers into one cheap counter advance instead of running the full
+			// boundary processing once per emulated millisecond.
+			if (ohci_frame_has_no_work(qemu_ohci))
+			{
+				const u32 frames = 1 + (u32)((remaining - qemu_ohci->eof_timer) / usb_frame_time);
+				remaining -= qemu_ohci->eof_timer + (s64)(frames - 1) * usb_frame_time;
+				qemu_ohci->eof_timer = 0;
+				ohci_skip_idle_frames(qemu_ohci, frames);
+				if (!qemu_ohci->eof_timer)
+					break;
+				continue;
+			}
+
 			remaining -= qemu_ohci->eof_timer;
 			qemu_ohci->eof_timer = 0;
 			ohci_frame_boundary(qemu_ohci);
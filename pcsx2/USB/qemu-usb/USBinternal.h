@@ -301,6 +301,8 @@ OHCIState* ohci_create(uint32_t base, int ports);
 uint32_t ohci_mem_read(OHCIState* ohci, uint32_t addr);
 void ohci_mem_write(OHCIState* ohci, uint32_t addr, uint32_t value);
 void ohci_frame_boundary(void* opaque);
+int ohci_frame_has_no_work(OHCIState* ohci);
+void ohci_skip_idle_frames(OHCIState* ohci, uint32_t frames);
 
 void ohci_hard_reset(OHCIState* ohci);
 void ohci_soft_reset(OHCIState* ohci);
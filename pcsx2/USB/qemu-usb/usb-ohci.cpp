@@ -1240,6 +1240,55 @@ void ohci_frame_boundary(void* opaque)
 	ohci_put_hcca(ohci, &hcca);
 }
 
+/* True when the upcoming frame boundary has no TD work queued: no flagged
+ * control/bulk work, no pending packet or done queue writeback, and (with the
+ * periodic list enabled) no ED in any of the 32 interrupt slots.  The caller
+ * may then advance over whole idle frames with ohci_skip_idle_frames()
+ * instead of running full boundary processing per frame.
+ */
+int ohci_frame_has_no_work(OHCIState* ohci)
+{
+	if (ohci->async_td || ohci->done != 0 || ohci->done_count != 7)
+		return 0;
+	if (ohci->old_ctl != ohci->ctl)
+		return 0;
+	if ((ohci->ctl & OHCI_CTL_CLE) && (ohci->status & OHCI_STATUS_CLF))
+		return 0;
+	if ((ohci->ctl & OHCI_CTL_BLE) && (ohci->status & OHCI_STATUS_BLF))
+		return 0;
+	/* the driver wants an interrupt on every SOF, don't batch those */
+	if (ohci->intr & OHCI_INTR_SF)
+		return 0;
+	if (ohci->ctl & OHCI_CTL_PLE)
+	{
+		struct ohci_hcca hcca;
+		cpu_physical_memory_read(ohci->hcca, (uint8_t*)&hcca, sizeof(hcca));
+		for (int i = 0; i < 32; i++)
+		{
+			if (hcca.intr[i] != 0)
+				return 0;
+		}
+	}
+	return 1;
+}
+
+/* Advance the frame counter over idle frames without servicing the (empty)
+ * lists.  The SF status bit is still raised so polling drivers observe
+ * progress; this is equivalent to the per-frame path since the guest can't
+ * run in between the frames being collapsed anyway.
+ */
+void ohci_skip_idle_frames(OHCIState* ohci, uint32_t frames)
+{
+	struct ohci_hcca hcca;
+	cpu_physical_memory_read(ohci->hcca, (uint8_t*)&hcca, sizeof(hcca));
+
+	ohci->frame_number = (ohci->frame_number + frames) & 0xffff;
+	hcca.frame = cpu_to_le16(ohci->frame_number);
+
+	ohci_sof(ohci);
+	ohci_put_hcca(ohci, &hcca);
+}
+
 /* Start sending SOF tokens across the USB bus, lists are processed in
  * next frame
  */
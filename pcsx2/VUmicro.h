@@ -254,6 +254,10 @@ public:
 extern BaseVUmicroCPU* CpuVU0;
 extern BaseVUmicroCPU* CpuVU1;
 
+// Prints per-microprogram execution counts and host timings for both VUs to
+// the console (microVU only; counters accumulate from the last rec reset).
+extern void mVUdumpProgramTimings();
+
 
 // VU0
 extern void vu0ResetRegs();
@@ -65,6 +65,10 @@ void SaveStateBase::vif1Freeze()
 
 	Freeze(nVif[1].bSize);
 	FreezeMem(nVif[1].buffer, nVif[1].bSize);
+
+	// The FIFO window's buffered GS qwords aren't part of the state.
+	if (!IsSaving())
+		vif1FifoClearBuffered();
 }
 
 //------------------------------------------------------------------
@@ -250,6 +254,10 @@ __fi void vif1STAT(u32 value)
 	/* Only FDR bit is writable, so mask the rest */
 	if ((vif1Regs.stat.FDR) ^ ((tVIF_STAT&)value).FDR)
 	{
+		// A direction change clears the hardware FIFO, so anything the FIFO
+		// window buffered from the GS is gone with it.
+		vif1FifoClearBuffered();
+
 		bool isStalled = false;
 		// different so can't be stalled
 		if (vif1Regs.stat.test(VIF1_STAT_INT | VIF1_STAT_VSS | VIF1_STAT_VIS | VIF1_STAT_VFS))
@@ -18,6 +18,7 @@
 #include "Vif_Dma.h"
 #include "VUmicro.h"
 #include "newVif.h"
+#include "DebugTools/Tracepoint.h"
 
 u32 g_vif0Cycles = 0;
 
@@ -277,6 +278,7 @@ void dmaVIF0()
 	        vif0ch.chcr._u32, vif0ch.madr, vif0ch.qwc,
 	        vif0ch.tadr, vif0ch.asr0, vif0ch.asr1);
 
+	Tracepoint::Record(TRACE_VIF0_KICK, vif0ch.chcr._u32, vif0ch.qwc);
 	g_vif0Cycles = 0;
 		
 	if (vif0ch.qwc > 0)   // Normal Mode
@@ -19,6 +19,7 @@
 #include "GS.h"
 #include "Gif_Unit.h"
 #include "VUmicro.h"
+#include "DebugTools/Tracepoint.h"
 #include "newVif.h"
 #include "MTVU.h"
 
@@ -69,10 +70,18 @@ void vif1TransferToMemory()
 		pxAssert(p3.isDone() || !p3.gifTag.isValid);
 	}
 
-	GetMTGS().WaitGS();
-	GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO2, size, pMem);
-	GetMTGS().WaitGS(false); // wait without reg sync
-	GSreadFIFO2((u8*)pMem, size);
+	// The FIFO window may already have pulled the start of this download out
+	// of the GS, consume that first (see vif1FifoReadBuffered).
+	const u32 buffered = vif1FifoReadBuffered(pMem, size);
+	const u32 remaining = size - buffered;
+
+	if (remaining)
+	{
+		GetMTGS().WaitGS();
+		GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO2, remaining, pMem + buffered);
+		GetMTGS().WaitGS(false); // wait without reg sync
+		GSreadFIFO2((u8*)(pMem + buffered), remaining);
+	}
 //	pMem += size;
 
 	//Some games such as Alex Ferguson's Player Manager 2001 reads less than GSLastDownloadSize by VIF then reads the remainder by FIFO
@@ -429,6 +438,7 @@ void dmaVIF1()
 	        vif1ch.chcr._u32, vif1ch.madr, vif1ch.qwc,
 	        vif1ch.tadr, vif1ch.asr0, vif1ch.asr1);
 
+	Tracepoint::Record(TRACE_VIF1_KICK, vif1ch.chcr._u32, vif1ch.qwc);
 	g_vif1Cycles = 0;
 	vif1.inprogress = 0;
 
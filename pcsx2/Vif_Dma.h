@@ -109,6 +109,10 @@ extern void vif1Interrupt();
 extern void vif1VUFinish();
 extern void vif1Reset();
 
+// Buffered side of the VIF1 FIFO window (GS downloads), see FiFo.cpp.
+extern u32  vif1FifoReadBuffered(u128* dst, u32 qwc);
+extern void vif1FifoClearBuffered();
+
 typedef int __fastcall FnType_VifCmdHandler(int pass, const u32 *data);
 typedef FnType_VifCmdHandler* Fnptr_VifCmdHandler;
 
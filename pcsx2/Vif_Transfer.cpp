@@ -17,6 +17,7 @@
 #include "Common.h"
 #include "Vif_Dma.h"
 #include "newVif.h"
+#include "DebugTools/Tracepoint.h"
 
 //------------------------------------------------------------------
 // VifCode Transfer Interpreter (Vif0/Vif1)
@@ -27,9 +28,16 @@ _vifT void vifTransferLoop(u32* &data) {
 	vifStruct& vifX = GetVifX;
 
 	u32& pSize = vifX.vifpacketsize;
-	
+
 	int ret = 0;
 
+	// Handlers only ever clear vifX.cmd, so the dispatch table lookup can be
+	// done once per vifcode instead of once per processed word.  Multi-word
+	// commands (UNPACK/MPG/DIRECT) re-enter this loop many times with the
+	// same cmd, including across packets - hence the initial resolve.
+	Fnptr_VifCmdHandler cmdHandler = vifCmdHandler[idx][vifX.cmd & 0x7f];
+	const bool traceActive = IsDevBuild && SysTrace.EE.VIFcode.IsActive();
+
 	vifXRegs.stat.VPS |= VPS_TRANSFERRING;
 	vifXRegs.stat.ER1  = false;
 	//VIF_LOG("Starting VIF%d loop, pSize = %x, stalled = %x", idx, pSize, vifX.vifstalled.enabled );
@@ -39,7 +47,7 @@ _vifT void vifTransferLoop(u32* &data) {
 
 			if(!vifXRegs.err.MII)
 			{
-				if(vifX.irq && !CHECK_VIF1STALLHACK) 
+				if(vifX.irq && !CHECK_VIF1STALLHACK)
 					break;
 
 				vifX.irq      |= data[0] >> 31;
@@ -47,16 +55,16 @@ _vifT void vifTransferLoop(u32* &data) {
 
 			vifXRegs.code = data[0];
 			vifX.cmd	  = data[0] >> 24;
-			
-			
+			cmdHandler    = vifCmdHandler[idx][vifX.cmd & 0x7f];
+
 			VIF_LOG("New VifCMD %x tagsize %x irq %d", vifX.cmd, vifX.tag.size, vifX.irq);
-			if (IsDevBuild && SysTrace.EE.VIFcode.IsActive()) {
+			if (traceActive) {
 				// Pass 2 means "log it"
-				vifCmdHandler[idx][vifX.cmd & 0x7f](2, data);
+				cmdHandler(2, data);
 			}
 		}
 
-		ret = vifCmdHandler[idx][vifX.cmd & 0x7f](vifX.pass, data);
+		ret = cmdHandler(vifX.pass, data);
 		data   += ret;
 		pSize  -= ret;
 		if (vifX.vifstalled.enabled)
@@ -77,6 +85,10 @@ _vifT static __fi bool vifTransfer(u32 *data, int size, bool TTE) {
 	vifX.vifpacketsize = size;
 	vifTransferLoop<idx>(data);
 
+	// VIFcode stream volume per unit; frame boundaries come from the
+	// TRACE_GS_VSYNC records already in the rings.
+	Tracepoint::Record(TRACE_VIF_TRANSFER, idx, (size - vifX.vifpacketsize) * 4);
+
 	transferred += size - vifX.vifpacketsize;
 
 	//Make this a minimum of 1 cycle so if it's the end of the packet it doesnt just fall through.
@@ -30,13 +30,15 @@ protected:
 	wxString	m_filename;
 	uptr		m_dataidx;
 	size_t		m_datasize;
-	
+	const u8*	m_extdata;
+
 public:
 	ArchiveEntry( const wxString& filename=wxEmptyString )
 		: m_filename( filename )
 	{
 		m_dataidx	= 0;
 		m_datasize	= 0;
+		m_extdata	= NULL;
 	}
 
 	virtual ~ArchiveEntry() = default;
@@ -53,6 +55,14 @@ public:
 		return *this;
 	}
 
+	// Sources the entry's data from an external buffer instead of the shared entry list
+	// buffer.  The buffer must remain valid (and unmodified) until compression finishes.
+	ArchiveEntry& SetExternalData( const u8* data )
+	{
+		m_extdata = data;
+		return *this;
+	}
+
 	wxString GetFilename() const
 	{
 		return m_filename;
@@ -67,6 +77,11 @@ public:
 	{
 		return m_datasize;
 	}
+
+	const u8* GetExternalData() const
+	{
+		return m_extdata;
+	}
 };
 
 typedef SafeArray< u8 > ArchiveDataBuffer;
@@ -140,70 +155,10 @@ public:
 };
 
 // --------------------------------------------------------------------------------------
-//  BaseCompressThread
+//  CompressArchiveToDisk
 // --------------------------------------------------------------------------------------
-class BaseCompressThread
-	: public pxThread
-{
-	typedef pxThread _parent;
-
-protected:
-	pxOutputStream*					m_gzfp;
-	ArchiveEntryList*				m_src_list;
-	bool							m_PendingSaveFlag;
-	
-	wxString						m_final_filename;
-
-public:
-	virtual ~BaseCompressThread();
-
-	BaseCompressThread& SetSource( ArchiveEntryList* srcdata )
-	{
-		m_src_list = srcdata;
-		return *this;
-	}
-
-	BaseCompressThread& SetSource( ArchiveEntryList& srcdata )
-	{
-		m_src_list = &srcdata;
-		return *this;
-	}
-
-	BaseCompressThread& SetOutStream( pxOutputStream* out )
-	{
-		m_gzfp = out;
-		return *this;
-	}
-
-	BaseCompressThread& SetOutStream( pxOutputStream& out )
-	{
-		m_gzfp = &out;
-		return *this;
-	}
-
-	BaseCompressThread& SetFinishedPath( const wxString& path )
-	{
-		m_final_filename = path;
-		return *this;
-	}
-
-	wxString GetStreamName() const { return m_gzfp->GetStreamName(); }
-
-	BaseCompressThread& SetTargetFilename(const wxString& filename)
-	{
-		m_final_filename = filename;
-		return *this;
-	}
-	
-protected:
-	BaseCompressThread()
-	{
-		m_gzfp				= NULL;
-		m_src_list			= NULL;
-		m_PendingSaveFlag	= false;
-	}
-
-	void SetPendingSave();
-	void ExecuteTaskInThread();
-	void OnCleanupInThread();
-};
+// Writes the given entry list through 'out' (which wraps a temp file) and moves the
+// result over destpath when done.  Takes ownership of both the list and the stream,
+// and holds the app's pending-save guard for the duration.  Intended to be queued on
+// Threading::TaskPool rather than given a short-lived thread of its own.
+extern void CompressArchiveToDisk( ArchiveEntryList* srclist, pxOutputStream* out, const wxString& destpath );
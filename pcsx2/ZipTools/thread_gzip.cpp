@@ -22,77 +22,61 @@
 #include "wx/wfstream.h"
 
 
-BaseCompressThread::~BaseCompressThread()
+void CompressArchiveToDisk( ArchiveEntryList* srclist, pxOutputStream* out, const wxString& destpath )
 {
-	try {
-		_parent::Cancel();
-		if( m_PendingSaveFlag )
-		{
-			wxGetApp().ClearPendingSave();
-			m_PendingSaveFlag = false;
-		}
-	}
-	DESTRUCTOR_CATCHALL
-}
-
-void BaseCompressThread::SetPendingSave()
-{
-	wxGetApp().StartPendingSave();
-	m_PendingSaveFlag = true;
-}
-
-void BaseCompressThread::ExecuteTaskInThread()
-{
-	// TODO : Add an API to PersistentThread for this! :)  --air
-	//SetThreadPriority( THREAD_PRIORITY_BELOW_NORMAL );
-
 	// Notes:
 	//  * Safeguard against corruption by writing to a temp file, and then copying the final
 	//    result over the original.
 
-	if( !m_src_list ) return;
-	SetPendingSave();
-	
-	Yield( 3 );
+	std::unique_ptr<ArchiveEntryList> src( srclist );
+	std::unique_ptr<pxOutputStream> gzfp( out );
 
-	uint listlen = m_src_list->GetLength();
-	for( uint i=0; i<listlen; ++i )
+	if( !src ) return;
+	wxGetApp().StartPendingSave();
+
+	try
 	{
-		const ArchiveEntry& entry = (*m_src_list)[i];
-		if (!entry.GetDataSize()) continue;
-
-		wxArchiveOutputStream& woot = *(wxArchiveOutputStream*)m_gzfp->GetWxStreamBase();
-		woot.PutNextEntry( entry.GetFilename() );
-
-		static const uint BlockSize = 0x64000;
-		uint curidx = 0;
-
-		do {
-			uint thisBlockSize = std::min( BlockSize, entry.GetDataSize() - curidx );
-			m_gzfp->Write(m_src_list->GetPtr( entry.GetDataIndex() + curidx ), thisBlockSize);
-			curidx += thisBlockSize;
-			Yield( 2 );
-		} while( curidx < entry.GetDataSize() );
-		
-		woot.CloseEntry();
-	}
+		pxYield( 3 );
 
-	m_gzfp->Close();
+		uint listlen = src->GetLength();
+		for( uint i=0; i<listlen; ++i )
+		{
+			const ArchiveEntry& entry = (*src)[i];
+			if (!entry.GetDataSize()) continue;
+
+			wxArchiveOutputStream& woot = *(wxArchiveOutputStream*)gzfp->GetWxStreamBase();
+			woot.PutNextEntry( entry.GetFilename() );
+
+			static const uint BlockSize = 0x64000;
+			uint curidx = 0;
+
+			do {
+				uint thisBlockSize = std::min( BlockSize, entry.GetDataSize() - curidx );
+				const u8* srcptr = entry.GetExternalData()
+					? entry.GetExternalData() + curidx
+					: src->GetPtr( entry.GetDataIndex() + curidx );
+				gzfp->Write(srcptr, thisBlockSize);
+				curidx += thisBlockSize;
+				pxYield( 2 );
+			} while( curidx < entry.GetDataSize() );
+
+			woot.CloseEntry();
+		}
 
-	if( !wxRenameFile( m_gzfp->GetStreamName(), m_final_filename, true ) )
-		throw Exception::BadStream( m_final_filename )
-		.SetDiagMsg(L"Failed to move or copy the temporary archive to the destination filename.")
-		.SetUserMsg(_("The savestate was not properly saved. The temporary file was created successfully but could not be moved to its final resting place."));
+		gzfp->Close();
 
-	Console.WriteLn( "(gzipThread) Data saved to disk without error." );
-}
+		if( !wxRenameFile( gzfp->GetStreamName(), destpath, true ) )
+			throw Exception::BadStream( destpath )
+			.SetDiagMsg(L"Failed to move or copy the temporary archive to the destination filename.")
+			.SetUserMsg(_("The savestate was not properly saved. The temporary file was created successfully but could not be moved to its final resting place."));
 
-void BaseCompressThread::OnCleanupInThread()
-{
-	_parent::OnCleanupInThread();
-	wxGetApp().DeleteThread( this );
+		Console.WriteLn( "(gzipThread) Data saved to disk without error." );
+	}
+	catch( ... )
+	{
+		wxGetApp().ClearPendingSave();
+		throw;
+	}
 
-	safe_delete(m_gzfp);
-	safe_delete(m_src_list);
+	wxGetApp().ClearPendingSave();
 }
-
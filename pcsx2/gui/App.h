@@ -23,6 +23,8 @@
 
 #include "pxEventThread.h"
 
+#include "common/ThreadPool.h"
+
 #include "AppCommon.h"
 #include "AppCoreThread.h"
 #include "RecentIsoList.h"
@@ -339,6 +341,21 @@ public:
 	bool SysAutoRunElf;
 	bool SysAutoRunIrx;
 
+	// Savestate to load once the autorun boot has executed (--state).  Cleared
+	// after use so later in-session reboots don't re-apply it.
+	wxString StateFile;
+
+	// Input recording to replay after boot (--play).
+	wxString PlayRecording;
+
+	// Benchmark mode (--bench / --benchreps); see gui/Benchmark.h.
+	uint BenchFrames;
+	uint BenchReps;
+
+	// GS dump batch benchmark (--gsbench / --gsbench-csv); see gui/GSDumpBench.h.
+	wxString GsBenchDir;
+	wxString GsBenchCsv;
+
 	StartupOptions()
 	{
 		ForceWizard = false;
@@ -349,6 +366,8 @@ public:
 		SysAutoRunElf = false;
 		SysAutoRunIrx = false;
 		CdvdSource = CDVD_SourceType::NoDisc;
+		BenchFrames = 0;
+		BenchReps = 5;
 	}
 };
 
@@ -505,6 +524,12 @@ public:
 	std::unique_ptr<SysCpuProviderPack> m_CpuProviders;
 	std::unique_ptr<SysMainMemory> m_VmReserve;
 
+	// In-flight background allocation of the VM reserve and recompiler caches, kicked
+	// off by AllocateCoreStuffs and joined by CompleteCoreAllocations before anything
+	// can start emulation.  Any exception the task caught is stashed for the join.
+	std::unique_ptr<Threading::TaskGroup> m_task_CoreAlloc;
+	ScopedExcept m_except_CoreAlloc;
+
 protected:
 	wxWindowID m_id_MainFrame;
 	wxWindowID m_id_GsFrame;
@@ -637,6 +662,7 @@ protected:
 	bool AppRpc_TryInvokeAsync(FnPtr_Pcsx2App method);
 
 	void AllocateCoreStuffs();
+	void CompleteCoreAllocations();
 	void InitDefaultGlobalAccelerators();
 	void BuildCommandHash();
 	bool TryOpenConfigCwd();
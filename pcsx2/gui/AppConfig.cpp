@@ -85,6 +85,12 @@ namespace PathDefs
 			return retval;
 		}
 
+		const wxDirName& Cache()
+		{
+			static const wxDirName retval(L"cache");
+			return retval;
+		}
+
 		const wxDirName& Langs()
 		{
 			static const wxDirName retval( L"Langs" );
@@ -199,7 +205,14 @@ namespace PathDefs
 	{
 		return GetDocuments() + Base::CheatsWS();
 	}
-	
+
+	// Not user-configurable (no FolderId); holds app-generated per-game caches
+	// such as the recompiler's persistent block cache.
+	wxDirName GetCache()
+	{
+		return GetDocuments() + Base::Cache();
+	}
+
 	wxDirName GetDocs()
 	{
 		return AppRoot() + Base::Docs();
@@ -21,6 +21,7 @@
 #include "CDVD/CDVDaccess.h"
 #include "common/General.h"
 #include "common/Path.h"
+#include "common/RwMutex.h"
 
 #include <wx/colour.h>
 #include <wx/gdicmn.h>
@@ -415,3 +416,10 @@ extern void AppConfig_OnChangedSettingsFolder( bool overwrite =  false );
 extern wxConfigBase* GetAppConfig();
 
 extern std::unique_ptr<AppConfig> g_Conf;
+
+// Seqlock-published copy of g_Conf->GSWindow, for the GS thread's per-frame reads
+// (aspect/zoom/offset in ComputeDrawRectangle).  g_Conf itself is main-thread-only;
+// any code that modifies the GSWindow options must call AppPublishGSWindowConfig()
+// afterward to make the change visible to the renderer.
+extern Threading::SeqLockedObject<AppConfig::GSWindowOptions> g_GSWindowConf;
+extern void AppPublishGSWindowConfig();
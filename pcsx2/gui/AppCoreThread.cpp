@@ -16,6 +16,7 @@
 #include "PrecompiledHeader.h"
 #include "App.h"
 #include "AppSaveStates.h"
+#include "Benchmark.h"
 #include "AppGameDatabase.h"
 
 #include <wx/stdpaths.h>
@@ -342,9 +343,26 @@ static int loadGameSettings(Pcsx2Config& dest, const GameDatabaseSchema::GameEnt
 #define _UNKNOWN_GAME_KEY (L"_UNKNOWN_GAME_KEY")
 static wxString curGameKey = _UNKNOWN_GAME_KEY;
 
+// Cached result of the last full _ApplySettings resolution.  Boot re-applies
+// settings several times while the game is being identified (bios, CRC
+// detection, ELF load); when neither the source config nor the detected game
+// changed since the last pass, the GameDB lookup and patch reloads below
+// would just redo identical work, so the cached fixup is reused instead.
+static Pcsx2Config resolvedSrc;
+static Pcsx2Config resolvedFixup;
+static wxString resolvedGameKey;
+static bool resolvedIngame = false;
+static u32 resolvedElfCRC = 0;
+// the master toggles live in g_Conf rather than in the Pcsx2Config source,
+// so they have to be part of the cache key separately
+static bool resolvedSpeedHacks = false;
+static bool resolvedGameFixes = false;
+static bool resolvedValid = false;
+
 void PatchesVerboseReset()
 {
 	curGameKey = _UNKNOWN_GAME_KEY;
+	resolvedValid = false;
 }
 
 // PatchesCon points to either Console or ConsoleWriter_Null, such that if we're in Devel mode
@@ -425,6 +443,20 @@ static void _ApplySettings(const Pcsx2Config& src, Pcsx2Config& fixup)
 		GameInfo::gameSerial = L" [" + DiscSerial + L"]";
 
 	const wxString newGameKey(ingame ? SysGetDiscID() : SysGetBiosDiscID());
+
+	// Nothing that feeds the resolution changed since the last pass: the
+	// loaded patches, sio serial and console title are all still correct,
+	// so hand back the cached fixup without redoing the GameDB/patch work.
+	if (resolvedValid && ingame == resolvedIngame && ElfCRC == resolvedElfCRC
+		&& newGameKey == resolvedGameKey && src == resolvedSrc
+		&& g_Conf->EnableSpeedHacks == resolvedSpeedHacks
+		&& g_Conf->EnableGameFixes == resolvedGameFixes)
+	{
+		fixup = resolvedFixup;
+		gsUpdateFrequency(fixup);
+		return;
+	}
+
 	const bool verbose(newGameKey != curGameKey && ingame);
 	//Console.WriteLn(L"------> patches verbose: %d   prev: '%s'   new: '%s'", (int)verbose, WX_STR(curGameKey), WX_STR(newGameKey));
 	SetupPatchesCon(verbose);
@@ -510,6 +542,15 @@ static void _ApplySettings(const Pcsx2Config& src, Pcsx2Config& fixup)
 	if (ingame)
 		Console.SetTitle(consoleTitle);
 
+	resolvedSrc = src;
+	resolvedFixup = fixup;
+	resolvedGameKey = newGameKey;
+	resolvedIngame = ingame;
+	resolvedElfCRC = ElfCRC;
+	resolvedSpeedHacks = g_Conf->EnableSpeedHacks;
+	resolvedGameFixes = g_Conf->EnableGameFixes;
+	resolvedValid = true;
+
 	gsUpdateFrequency(fixup);
 }
 
@@ -613,6 +654,7 @@ void AppCoreThread::OnCleanupInThread()
 void AppCoreThread::VsyncInThread()
 {
 	wxGetApp().LogicalVsync();
+	Benchmark::OnVsync();
 	_parent::VsyncInThread();
 }
 
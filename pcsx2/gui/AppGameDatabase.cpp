@@ -62,11 +62,16 @@ AppGameDatabase& AppGameDatabase::LoadFromFile(const wxString& _file)
 
 	const u64 qpc_Start = GetCPUTicks();
 
-	std::ifstream fileStream = getFileAsStream(file);
-	if (!this->initDatabase(fileStream))
+	// Prefer mapping the file over streaming it in: concurrent instances then share
+	// a single page-cache copy of the database text between them.
+	if (!this->initDatabase(file))
 	{
-		Console.Error(L"[GameDB] Database could not be loaded successfully");
-		return *this;
+		std::ifstream fileStream = getFileAsStream(file);
+		if (!this->initDatabase(fileStream))
+		{
+			Console.Error(L"[GameDB] Database could not be loaded successfully");
+			return *this;
+		}
 	}
 
 	const u64 qpc_end = GetCPUTicks();
@@ -23,6 +23,7 @@
 #include "common/IniInterface.h"
 #include "DebugTools/Debug.h"
 #include "Dialogs/ModalPopups.h"
+#include "GSDumpBench.h"
 
 #include "Debugger/DisassemblyDialog.h"
 
@@ -133,63 +134,94 @@ void Pcsx2App::AllocateCoreStuffs()
 	SysLogMachineCaps();
 	AppApplySettings();
 
-	GetVmReserve().ReserveAll();
-
-	if (!m_CpuProviders)
+	if (!m_CpuProviders && !m_task_CoreAlloc)
 	{
-		// FIXME : Some or all of SysCpuProviderPack should be run from the SysExecutor thread,
-		// so that the thread is safely blocked from being able to start emulation.
+		// Reserving the VM address space and the recompiler caches is kernel-bound work
+		// with no GUI dependencies, so it runs on the task pool while the main thread
+		// builds the frames.  CompleteCoreAllocations() joins it (and reports failures)
+		// before anything can start emulation.
+		m_task_CoreAlloc = std::make_unique<Threading::TaskGroup>();
+		m_task_CoreAlloc->Run([this]() {
+			try
+			{
+				GetVmReserve().ReserveAll();
+				m_CpuProviders = std::make_unique<SysCpuProviderPack>();
+			}
+			catch (BaseException& ex)
+			{
+				m_except_CoreAlloc = ScopedExcept(ex.Clone());
+			}
+			catch (std::runtime_error& ex)
+			{
+				m_except_CoreAlloc = ScopedExcept(new Exception::RuntimeError(ex, L"CoreAlloc"));
+			}
+		});
+	}
+}
 
-		m_CpuProviders = std::make_unique<SysCpuProviderPack>();
+// Joins the background allocation started by AllocateCoreStuffs, rethrowing anything
+// it failed with and walking the user through any recompilers that didn't come up.
+void Pcsx2App::CompleteCoreAllocations()
+{
+	if (!m_task_CoreAlloc)
+		return;
 
-		if (m_CpuProviders->HadSomeFailures(g_Conf->EmuOptions.Cpu.Recompiler))
-		{
-			// HadSomeFailures only returns 'true' if an *enabled* cpu type fails to init.  If
-			// the user already has all interps configured, for example, then no point in
-			// popping up this dialog.
+	m_task_CoreAlloc->Wait();
+	m_task_CoreAlloc = nullptr;
 
-			wxDialogWithHelpers exconf(NULL, _("PCSX2 Recompiler Error(s)"));
+	if (m_except_CoreAlloc)
+	{
+		ScopedExcept ex(std::move(m_except_CoreAlloc));
+		ex->Rethrow();
+	}
 
-			wxTextCtrl* scrollableTextArea = new wxTextCtrl(
-				&exconf, wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize,
-				wxTE_READONLY | wxTE_MULTILINE | wxTE_WORDWRAP);
+	if (m_CpuProviders->HadSomeFailures(g_Conf->EmuOptions.Cpu.Recompiler))
+	{
+		// HadSomeFailures only returns 'true' if an *enabled* cpu type fails to init.  If
+		// the user already has all interps configured, for example, then no point in
+		// popping up this dialog.
 
-			exconf += 12;
-			exconf += exconf.Heading(pxE(L"Warning: Some of the configured PS2 recompilers failed to initialize and have been disabled:"));
+		wxDialogWithHelpers exconf(NULL, _("PCSX2 Recompiler Error(s)"));
 
-			exconf += 6;
-			exconf += scrollableTextArea | pxExpand.Border(wxALL, 16);
+		wxTextCtrl* scrollableTextArea = new wxTextCtrl(
+			&exconf, wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize,
+			wxTE_READONLY | wxTE_MULTILINE | wxTE_WORDWRAP);
 
-			Pcsx2Config::RecompilerOptions& recOps = g_Conf->EmuOptions.Cpu.Recompiler;
+		exconf += 12;
+		exconf += exconf.Heading(pxE(L"Warning: Some of the configured PS2 recompilers failed to initialize and have been disabled:"));
 
-			if (BaseException* ex = m_CpuProviders->GetException_EE())
-			{
-				scrollableTextArea->AppendText(L"* R5900 (EE)\n\t" + ex->FormatDisplayMessage() + L"\n\n");
-				recOps.EnableEE = false;
-			}
+		exconf += 6;
+		exconf += scrollableTextArea | pxExpand.Border(wxALL, 16);
 
-			if (BaseException* ex = m_CpuProviders->GetException_IOP())
-			{
-				scrollableTextArea->AppendText(L"* R3000A (IOP)\n\t" + ex->FormatDisplayMessage() + L"\n\n");
-				recOps.EnableIOP = false;
-			}
+		Pcsx2Config::RecompilerOptions& recOps = g_Conf->EmuOptions.Cpu.Recompiler;
 
-			if (BaseException* ex = m_CpuProviders->GetException_MicroVU0())
-			{
-				scrollableTextArea->AppendText(L"* microVU0\n\t" + ex->FormatDisplayMessage() + L"\n\n");
-				recOps.EnableVU0 = false;
-			}
+		if (BaseException* ex = m_CpuProviders->GetException_EE())
+		{
+			scrollableTextArea->AppendText(L"* R5900 (EE)\n\t" + ex->FormatDisplayMessage() + L"\n\n");
+			recOps.EnableEE = false;
+		}
 
-			if (BaseException* ex = m_CpuProviders->GetException_MicroVU1())
-			{
-				scrollableTextArea->AppendText(L"* microVU1\n\t" + ex->FormatDisplayMessage() + L"\n\n");
-				recOps.EnableVU1 = false;
-			}
+		if (BaseException* ex = m_CpuProviders->GetException_IOP())
+		{
+			scrollableTextArea->AppendText(L"* R3000A (IOP)\n\t" + ex->FormatDisplayMessage() + L"\n\n");
+			recOps.EnableIOP = false;
+		}
 
-			exconf += exconf.Heading(pxE(L"Note: Recompilers are not necessary for PCSX2 to run, however they typically improve emulation speed substantially. You may have to manually re-enable the recompilers listed above, if you resolve the errors."));
+		if (BaseException* ex = m_CpuProviders->GetException_MicroVU0())
+		{
+			scrollableTextArea->AppendText(L"* microVU0\n\t" + ex->FormatDisplayMessage() + L"\n\n");
+			recOps.EnableVU0 = false;
+		}
 
-			pxIssueConfirmation(exconf, MsgButtons().OK());
+		if (BaseException* ex = m_CpuProviders->GetException_MicroVU1())
+		{
+			scrollableTextArea->AppendText(L"* microVU1\n\t" + ex->FormatDisplayMessage() + L"\n\n");
+			recOps.EnableVU1 = false;
 		}
+
+		exconf += exconf.Heading(pxE(L"Note: Recompilers are not necessary for PCSX2 to run, however they typically improve emulation speed substantially. You may have to manually re-enable the recompilers listed above, if you resolve the errors."));
+
+		pxIssueConfirmation(exconf, MsgButtons().OK());
 	}
 }
 
@@ -226,6 +258,13 @@ void Pcsx2App::OnInitCmdLine(wxCmdLineParser& parser)
 	parser.AddSwitch(wxEmptyString, L"fullboot", _("disables fast booting"));
 	parser.AddOption(wxEmptyString, L"gameargs", _("passes the specified space-delimited string of launch arguments to the game"), wxCMD_LINE_VAL_STRING);
 
+	parser.AddOption(wxEmptyString, L"state", _("loads the specified savestate once the game has booted"), wxCMD_LINE_VAL_STRING);
+	parser.AddOption(wxEmptyString, L"play", _("replays the specified input recording after boot"), wxCMD_LINE_VAL_STRING);
+	parser.AddOption(wxEmptyString, L"bench", _("benchmark mode: runs the given number of frames per repetition, prints timings and exits"), wxCMD_LINE_VAL_NUMBER);
+	parser.AddOption(wxEmptyString, L"benchreps", _("number of benchmark repetitions (default 5)"), wxCMD_LINE_VAL_NUMBER);
+	parser.AddOption(wxEmptyString, L"gsbench", _("replays a directory of GS dumps across renderer configurations, writes timings to a CSV file and exits"), wxCMD_LINE_VAL_STRING);
+	parser.AddOption(wxEmptyString, L"gsbench-csv", _("output file for the --gsbench results (default logs/gsbench.csv)"), wxCMD_LINE_VAL_STRING);
+
 	parser.AddOption(wxEmptyString, L"cfgpath", _("changes the configuration file path"), wxCMD_LINE_VAL_STRING);
 	parser.AddOption(wxEmptyString, L"cfg", _("specifies the PCSX2 configuration file to use"), wxCMD_LINE_VAL_STRING);
 	parser.AddSwitch(wxEmptyString, L"forcewiz", AddAppName(_("forces %s to start the First-time Wizard")));
@@ -325,6 +364,26 @@ bool Pcsx2App::OnCmdLineParsed(wxCmdLineParser& parser)
 	if (parser.Found(L"gameargs", &game_args) && !game_args.IsEmpty())
 		Startup.GameLaunchArgs = game_args;
 
+	wxString startup_file;
+	if (parser.Found(L"state", &startup_file) && !startup_file.IsEmpty())
+		Startup.StateFile = startup_file;
+
+#ifndef DISABLE_RECORDING
+	if (parser.Found(L"play", &startup_file) && !startup_file.IsEmpty())
+		Startup.PlayRecording = startup_file;
+#endif
+
+	long bench_value;
+	if (parser.Found(L"bench", &bench_value) && bench_value > 0)
+		Startup.BenchFrames = (uint)bench_value;
+	if (parser.Found(L"benchreps", &bench_value) && bench_value > 0)
+		Startup.BenchReps = (uint)bench_value;
+
+	if (parser.Found(L"gsbench", &startup_file) && !startup_file.IsEmpty())
+		Startup.GsBenchDir = startup_file;
+	if (parser.Found(L"gsbench-csv", &startup_file) && !startup_file.IsEmpty())
+		Startup.GsBenchCsv = startup_file;
+
 	if (parser.Found(L"usecd"))
 	{
 		Startup.CdvdSource = CDVD_SourceType::Disc;
@@ -454,6 +513,8 @@ bool Pcsx2App::OnInit()
 		if (m_UseGUI)
 			OpenMainFrame();
 
+		// The frames are built; now collect the core allocations that ran alongside.
+		CompleteCoreAllocations();
 
 		(new GameDatabaseLoaderThread())->Start();
 
@@ -500,6 +561,26 @@ bool Pcsx2App::OnInit()
 			// FIXME: ElfFile is an irx it will crash
 			sApp.SysExecute(Startup.CdvdSource, Startup.ElfFile);
 		}
+
+#ifndef DISABLE_RECORDING
+		// A recording that boots the game itself (not savestate-anchored) can be
+		// replayed without any other autorun option; Play() issues the SysExecute.
+		// Savestate-anchored recordings are instead handled after the autorun boot
+		// (see SysExecEvent_Execute), since they need an open core.
+		if (!Startup.PlayRecording.IsEmpty() && !Startup.SysAutoRun && !Startup.SysAutoRunElf && !Startup.SysAutoRunIrx)
+		{
+			g_Conf->EmuOptions.EnableRecordingTools = true;
+			const wxString recording(Startup.PlayRecording);
+			Startup.PlayRecording.clear();
+			if (!g_InputRecording.Play(NULL, recording))
+				Console.Error(L"Could not replay input recording: " + recording);
+		}
+#endif
+
+		// GS dump batch benchmark; replays dumps directly against the GS
+		// without booting the VM, so it runs instead of any autorun option.
+		if (!Startup.GsBenchDir.IsEmpty())
+			GSDumpBench::Start(Startup.GsBenchDir, Startup.GsBenchCsv);
 	}
 	// ----------------------------------------------------------------------------
 	catch (Exception::StartupAborted& ex) // user-aborted, no popups needed.
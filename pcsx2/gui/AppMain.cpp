@@ -21,6 +21,7 @@
 #include "AppSaveStates.h"
 #include "AppGameDatabase.h"
 #include "AppAccelerators.h"
+#include "Benchmark.h"
 #ifdef _WIN32
 #include "PAD/Windows/PAD.h"
 #else
@@ -71,6 +72,14 @@ wxIMPLEMENT_APP(Pcsx2App);
 
 std::unique_ptr<AppConfig> g_Conf;
 
+Threading::SeqLockedObject<AppConfig::GSWindowOptions> g_GSWindowConf;
+
+void AppPublishGSWindowConfig()
+{
+	if( g_Conf )
+		g_GSWindowConf.Write( g_Conf->GSWindow );
+}
+
 uptr pDsp[2];
 
 // Returns a string message telling the user to consult guides for obtaining a legal BIOS.
@@ -458,6 +467,18 @@ void Pcsx2App::LogicalVsync()
 
 	FpsManager.DoFrame();
 
+	// Rewind history captures one state per second of emulated time (the rewind
+	// hotkey steps back through them).
+	if( EmuConfig.EnableRewind )
+	{
+		static uint rewind_countdown = 0;
+		if( ++rewind_countdown >= 60 )
+		{
+			rewind_countdown = 0;
+			StateCopy_CaptureRewind();
+		}
+	}
+
 	if (g_Conf->GSWindow.FMVAspectRatioSwitch != FMV_AspectRatio_Switch_Off) {
 		if (EnableFMV) {
 			DevCon.Warning("FMV on");
@@ -738,6 +759,8 @@ void AppApplySettings( const AppConfig* oldconf )
 	#ifdef __WXMSW__
 	NTFS_CompressFile( g_Conf->Folders.MemoryCards.ToString(), g_Conf->McdCompressNTFS );
 	#endif
+
+	AppPublishGSWindowConfig();
 	sApp.DispatchEvent( AppStatus_SettingsApplied );
 
 	paused_core.AllowResume();
@@ -1014,6 +1037,34 @@ protected:
 			CoreThread.SetElfOverride( m_elf_override );
 
 		CoreThread.Resume();
+
+		// Fast boot: skip the emulated BIOS bringup when a boot template was
+		// captured for this BIOS on an earlier boot.
+		StateCopy_TryBootTemplate();
+
+		// Startup actions that need a booted core (--state / --play / --bench).
+		// Each is consumed on first use so in-session reboots don't re-apply it;
+		// the posted load events queue up behind this one on the SysExecutor.
+		StartupOptions& startup(wxGetApp().Startup);
+		if (!startup.StateFile.IsEmpty())
+		{
+			StateCopy_LoadFromFile(startup.StateFile);
+			startup.StateFile.clear();
+		}
+#ifndef DISABLE_RECORDING
+		if (!startup.PlayRecording.IsEmpty())
+		{
+			const wxString recording(startup.PlayRecording);
+			startup.PlayRecording.clear();
+			if (!g_InputRecording.Play(NULL, recording))
+				Console.Error(L"Could not replay input recording: " + recording);
+		}
+#endif
+		if (startup.BenchFrames > 0)
+		{
+			Benchmark::Start(startup.BenchFrames, startup.BenchReps);
+			startup.BenchFrames = 0;
+		}
 	}
 };
 
@@ -23,3 +23,13 @@ extern void StateCopy_SaveToFile(const wxString& file);
 extern void StateCopy_LoadFromFile(const wxString& file);
 extern void StateCopy_SaveToSlot(uint num);
 extern void StateCopy_LoadFromSlot(uint slot, bool isFromBackup = false);
+
+// Rewind ring: CaptureRewind appends the current machine state to the in-memory rewind
+// history (called periodically from the vsync handler when rewind is enabled); Rewind
+// steps the machine back to the previous point in that history.
+extern void StateCopy_CaptureRewind();
+extern void StateCopy_Rewind();
+
+// Per-BIOS fast boot snapshots; see SysState.cpp for details.
+extern void StateCopy_CaptureBootTemplate();
+extern void StateCopy_TryBootTemplate();
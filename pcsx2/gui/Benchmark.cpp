@@ -0,0 +1,116 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "App.h"
+#include "Benchmark.h"
+#include "FrameProfiler.h"
+
+#include <cmath>
+#include <vector>
+
+namespace Benchmark
+{
+	struct RepResult
+	{
+		double wall_ms;
+		FrameProfiler::Stats stats;
+	};
+
+	static bool s_active = false;
+	static uint s_frames_per_rep = 0;
+	static uint s_reps = 0;
+	static uint s_frame = 0;
+	static int s_rep = -1; // -1 while the warmup repetition runs
+	static u64 s_rep_start = 0;
+	static std::vector<RepResult> s_results;
+
+	void Start(uint frames, uint reps)
+	{
+		s_frames_per_rep = std::max(frames, 1u);
+		s_reps = std::max(reps, 1u);
+		s_frame = 0;
+		s_rep = -1;
+		s_results.clear();
+		s_rep_start = GetCPUTicks();
+		s_active = true;
+
+		Console.WriteLn(Color_StrongBlue, "Benchmark: %u repetitions of %u frames (plus one warmup repetition).",
+			s_reps, s_frames_per_rep);
+	}
+
+	bool IsActive()
+	{
+		return s_active;
+	}
+
+	static void Finish()
+	{
+		s_active = false;
+
+		Console.WriteLn(Color_StrongBlue, "Benchmark results (%u frames per repetition):", s_frames_per_rep);
+		Console.WriteLn("  rep      fps    ee(ms)   vu1(ms) gswait(ms) present(ms)");
+
+		double sum = 0, sumsq = 0, minfps = 0, maxfps = 0;
+		for (uint i = 0; i < s_results.size(); i++)
+		{
+			const RepResult& r = s_results[i];
+			const double fps = s_frames_per_rep * 1000.0 / r.wall_ms;
+			Console.WriteLn("  %3u  %7.2f  %8.2f  %8.2f  %9.2f  %10.2f", i + 1, fps,
+				r.stats.ee_run_ms, r.stats.vu1_wait_ms, r.stats.gs_wait_ms, r.stats.present_ms);
+
+			sum += fps;
+			sumsq += fps * fps;
+			minfps = (i == 0) ? fps : std::min(minfps, fps);
+			maxfps = std::max(maxfps, fps);
+		}
+
+		const double n = (double)s_results.size();
+		const double mean = sum / n;
+		const double stddev = (n > 1) ? std::sqrt(std::max(0.0, (sumsq - sum * sum / n) / (n - 1))) : 0.0;
+		Console.WriteLn(Color_StrongBlue, "Benchmark: %.2f fps +/- %.2f (min %.2f, max %.2f)",
+			mean, stddev, minfps, maxfps);
+
+		wxGetApp().PostMenuAction(MenuId_Exit);
+	}
+
+	void OnVsync()
+	{
+		if (!s_active)
+			return;
+
+		if (++s_frame < s_frames_per_rep)
+			return;
+		s_frame = 0;
+
+		const u64 now = GetCPUTicks();
+		if (s_rep >= 0)
+		{
+			RepResult r;
+			r.wall_ms = (now - s_rep_start) * 1000.0 / GetTickFrequency();
+			r.stats = FrameProfiler::Read();
+			s_results.push_back(r);
+		}
+		else
+		{
+			// Throw away the phase counters accumulated during warmup.
+			FrameProfiler::Read();
+		}
+		s_rep_start = now;
+
+		if (++s_rep >= (int)s_reps)
+			Finish();
+	}
+} // namespace Benchmark
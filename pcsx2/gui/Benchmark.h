@@ -0,0 +1,33 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Pcsx2Types.h"
+
+// Benchmark mode (--bench): after boot (and any --state / --play startup
+// action) the emulator runs a fixed number of frames per repetition, records
+// wall time plus the FrameProfiler phase breakdown for each repetition, prints
+// a summary with mean/stddev and exits.  One extra repetition is run first as
+// warmup and discarded, so state-load and recompilation costs don't pollute
+// the numbers.
+namespace Benchmark
+{
+	extern void Start(uint frames, uint reps);
+	extern bool IsActive();
+
+	// Called once per emulated frame from the EE thread's vsync handler.
+	extern void OnVsync();
+} // namespace Benchmark
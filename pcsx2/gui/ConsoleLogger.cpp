@@ -25,6 +25,7 @@
 #include "Dialogs/LogOptionsDialog.h"
 #include "DebugTools/Debug.h"
 
+#include <wx/clipbrd.h>
 #include <wx/textfile.h>
 
 wxDECLARE_EVENT(pxEvt_SetTitleText, wxCommandEvent);
@@ -366,16 +367,175 @@ void ConLog_LoadSaveSettings( IniInterface& ini )
 	ConLogInitialized = true;
 }
 
+// --------------------------------------------------------------------------------------
+//  ConsoleLogFrame::LogView  (implementations)
+// --------------------------------------------------------------------------------------
+ConsoleLogFrame::LogView::LogView( wxWindow* parent, ColorArray& colors )
+	: wxVListBox( parent, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxLB_MULTIPLE | wxBORDER_NONE )
+	, m_colors( colors )
+{
+	m_cur_color		= DefaultConsoleColor;
+	m_line_open		= false;
+	m_row_height	= 1;
+
+	OnFontChanged();
+
+	Bind(wxEVT_KEY_DOWN, &ConsoleLogFrame::LogView::OnKeyDown, this);
+}
+
+// Splits the incoming text into rows of the ring.  Bookkeeping only -- the scroll
+// model and the screen aren't touched until CommitAppends(), so a flush containing
+// several sections pays for the repaint exactly once.
+void ConsoleLogFrame::LogView::Append( ConsoleColors color, const wxChar* text )
+{
+	if( color != Color_Current )
+		m_cur_color = color;
+
+	const wxChar* pos = text;
+	while( *pos != 0 )
+	{
+		const wxChar* eol = pos;
+		while( (*eol != 0) && (*eol != L'\n') ) ++eol;
+
+		if( !m_line_open )
+		{
+			if( m_lines.size() >= MaxLines )
+				m_lines.pop_front();
+			m_lines.push_back( Line() );
+			m_line_open = true;
+		}
+
+		if( eol != pos )
+		{
+			Line& line( m_lines.back() );
+			if( !line.empty() && (line.back().color == m_cur_color) )
+				line.back().text.append( pos, eol - pos );
+			else
+				line.push_back( LineSpan( m_cur_color, pos, eol - pos ) );
+		}
+
+		if( *eol == L'\n' )
+		{
+			m_line_open = false;
+			++eol;
+		}
+		pos = eol;
+	}
+}
+
+void ConsoleLogFrame::LogView::CommitAppends()
+{
+	// Stick to the tail unless the user has scrolled back to read something.
+	const bool follow = (GetItemCount() == 0) || (GetVisibleEnd() >= GetItemCount());
+
+	SetItemCount( m_lines.size() );
+
+	// ScrollToRow clamps against the last fully-visible position, so passing the
+	// line count scrolls such that the newest line sits at the bottom of the view.
+	if( follow && !m_lines.empty() )
+		ScrollToRow( m_lines.size() );
+
+	// On a virtual control this invalidates the client area only; the paint handler
+	// then draws just the visible rows.
+	RefreshAll();
+}
+
+void ConsoleLogFrame::LogView::ClearAll()
+{
+	m_lines.clear();
+	m_line_open = false;
+	m_cur_color = DefaultConsoleColor;
+	SetItemCount( 0 );
+	RefreshAll();
+}
+
+// Row sizing needs the font up front; the colors themselves are resolved at paint
+// time, so no restyling pass over existing content is ever needed.
+void ConsoleLogFrame::LogView::OnFontChanged()
+{
+	const wxFont& font( m_colors[DefaultConsoleColor].GetFont() );
+	SetFont( font );
+
+	wxClientDC dc( this );
+	dc.SetFont( font );
+	m_row_height = dc.GetCharHeight() + 1;
+
+	RefreshAll();
+}
+
+wxString ConsoleLogFrame::LogView::GetLineText( int line ) const
+{
+	wxString result;
+	for( const LineSpan& span : m_lines[line] )
+		result += span.text;
+	return result;
+}
+
+void ConsoleLogFrame::LogView::OnDrawItem( wxDC& dc, const wxRect& rect, size_t n ) const
+{
+	if( n >= m_lines.size() ) return;
+
+	wxCoord x = rect.x + 2;
+	for( const LineSpan& span : m_lines[n] )
+	{
+		const wxTextAttr& attr( m_colors[span.color] );
+		dc.SetFont( attr.GetFont() );
+		dc.SetTextForeground( attr.GetTextColour() );
+		dc.DrawText( span.text, x, rect.y );
+		x += dc.GetTextExtent( span.text ).x;
+	}
+}
+
+wxCoord ConsoleLogFrame::LogView::OnMeasureItem( size_t WXUNUSED(n) ) const
+{
+	return m_row_height;
+}
+
+// wxVListBox has no native text selection, so provide row-based copy; losing the
+// ability to grab output for bug reports would be a poor trade for fast rendering.
+void ConsoleLogFrame::LogView::OnKeyDown( wxKeyEvent& evt )
+{
+	if( evt.GetModifiers() == wxMOD_CONTROL )
+	{
+		if( evt.GetKeyCode() == 'C' )
+		{
+			CopySelectionToClipboard();
+			return;
+		}
+		if( evt.GetKeyCode() == 'A' )
+		{
+			SelectAll();
+			return;
+		}
+	}
+	evt.Skip();
+}
+
+void ConsoleLogFrame::LogView::CopySelectionToClipboard() const
+{
+	wxString text;
+	unsigned long cookie;
+	for( int sel = GetFirstSelected( cookie ); sel != wxNOT_FOUND; sel = GetNextSelected( cookie ) )
+		text += GetLineText( sel ) + wxTextFile::GetEOL();
+
+	if( text.IsEmpty() ) return;
+
+	if( wxTheClipboard->Open() )
+	{
+		wxTheClipboard->SetData( new wxTextDataObject( text ) );
+		wxTheClipboard->Close();
+	}
+}
+
 // --------------------------------------------------------------------------------------
 //  ConsoleLogFrame  (implementations)
 // --------------------------------------------------------------------------------------
 ConsoleLogFrame::ConsoleLogFrame( MainEmuFrame *parent, const wxString& title, AppConfig::ConsoleLogOptions& options )
 	: wxFrame(parent, wxID_ANY, title)
 	, m_conf( options )
-	, m_TextCtrl( *new wxTextCtrl(this, wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize,
-		wxTE_MULTILINE | wxTE_READONLY | wxTE_RICH2 | wxTE_NOHIDESEL) )
-	, m_timer_FlushUnlocker( this )
 	, m_ColorTable( options.FontSize )
+	, m_TextView( *new LogView(this, m_ColorTable) )
+	, m_timer_FlushUnlocker( this )
 
 	, m_QueueColorSection( L"ConsoleLog::QueueColorSection" )
 	, m_QueueBuffer( L"ConsoleLog::QueueBuffer" )
@@ -391,28 +551,19 @@ ConsoleLogFrame::ConsoleLogFrame( MainEmuFrame *parent, const wxString& title, A
 	SetMenuBar( pMenuBar );
 	SetIcons( wxGetApp().GetIconBundle() );
 
+	// Text colors come out of m_ColorTable at paint time, so the view itself only
+	// needs to know the backdrop for the selected scheme.
 	if (m_conf.Theme.CmpNoCase(L"Dark") == 0)
 	{
 		m_ColorTable.SetColorScheme_Dark();
-		m_TextCtrl.SetBackgroundColour(darkThemeBgColor);
-		m_TextCtrl.SetDefaultStyle(wxTextAttr(wxNullColour, darkThemeBgColor));
+		m_TextView.SetBackgroundColour(darkThemeBgColor);
 	}
 	else
 	{
 		m_ColorTable.SetColorScheme_Light();
-		m_TextCtrl.SetBackgroundColour(lightThemeBgColor);
-		m_TextCtrl.SetDefaultStyle(wxTextAttr(wxNullColour, lightThemeBgColor));
+		m_TextView.SetBackgroundColour(lightThemeBgColor);
 	}
 
-	// TODO - SetDefaultStyle _should_ be returning a wxTextAttr with both foreground and background color info
-	// but I don't want to mess with it too much in fear of breaking existing functionality.
-	// instead, i just set the background color individually above
-	m_TextCtrl.SetDefaultStyle(m_ColorTable[DefaultConsoleColor]);
-
-	// SetDefaultStyle only sets the style of text in the control.  We need to
-	// also set the font of the control, so that sizing logic knows what font we use:
-	m_TextCtrl.SetFont( m_ColorTable[DefaultConsoleColor].GetFont() );
-
 	wxMenu& menuLog		(*new wxMenu());
 	wxMenu& menuAppear	(*new wxMenu());
 	wxMenu& menuSources	(*new wxMenu());
@@ -532,6 +683,12 @@ ConsoleLogFrame::~ConsoleLogFrame()
 {
 	ScopedLogLock locker;
 	wxGetApp().OnProgramLogClosed( GetId() );
+
+	// The lock above stops any further writers; whatever they managed to push
+	// before that is ours to free now.
+	QueuedLine* line;
+	while( m_WriteRing.pop( line ) )
+		delete line;
 }
 
 void ConsoleLogFrame::OnEnableAllLogging(wxCommandEvent& evt)
@@ -617,40 +774,48 @@ bool ConsoleLogFrame::Write( ConsoleColors color, const wxString& text )
 {
 	pthread_testcancel();
 
-	ScopedLock lock( m_mtx_Queue );
+	QueuedLine* line = new QueuedLine( color, text );
+	bool stalled = false;
 
-	if( m_QueueColorSection.GetLength() == 0 )
-	{
-		pxAssertMsg( m_CurQueuePos == 0, "Queue's character position didn't get reset in sync with it's ColorSection table." );
-	}
+	// Lock-free handoff: the only time a writer waits here is when the ring fills up,
+	// meaning the GUI hasn't managed a flush in a couple thousand messages.  Too many
+	// color changes cause huge slowdowns when decorating the rich textview, so a full
+	// ring intentionally throttles spammy writers instead of growing without bound
+	// and killing gui responsiveness (this replaces the old "piling up" size check).
 
-	if( (m_QueueColorSection.GetLength() == 0) || ((color != Color_Current) && (m_QueueColorSection.GetLast().color != color)) )
+	while( !m_WriteRing.push( line ) )
 	{
-		++m_CurQueuePos;		// Don't overwrite the NULL;
-		m_QueueColorSection.Add( ColorSection(color, m_CurQueuePos) );
-	}
+		if( wxThread::IsMain() )
+		{
+			// Can't wait on ourselves; just pull the backlog into the staging buffer.
+			DrainWriteRing();
+			continue;
+		}
 
-	int endpos = m_CurQueuePos + text.Length();
-	m_QueueBuffer.MakeRoomFor( endpos + 1 );		// and the null!!
-	memcpy( &m_QueueBuffer[m_CurQueuePos], text.wc_str(), sizeof(wxChar) * text.Length() );
-	m_CurQueuePos = endpos;
+		stalled = true;
+		++m_WaitingThreadsForFlush;
 
-	// this NULL may be overwritten if the next message sent doesn't perform a color change.
-	m_QueueBuffer[m_CurQueuePos] = 0;
+		// Note: if the queue flushes, we retry immediately; and we return TRUE below, so
+		// that our thread sleeps until the main thread has had a chance to repaint the
+		// console window contents.
+		// [TODO] : It'd be a lot better if the console window repaint released the lock
+		//  once its task were complete, but thats been problematic, so for now this hack is
+		//  what we get.
+		if( !m_sem_QueueFlushed.Wait( wxTimeSpan( 0,0,0,250 ) ) )
+		{
+			// If we're here it means QueueFlush wait timed out, so remove us from the waiting
+			// threads count. This way no thread permanently deadlocks against the console
+			// logger.  They just run quite slow, but should remain responsive to user input.
+			if( m_WaitingThreadsForFlush != 0 ) --m_WaitingThreadsForFlush;
+		}
+	}
 
 	// Idle events don't always pass (wx blocks them when moving windows or using menus, for
-	// example).  So let's hackfix it so that an alternate message is posted if the queue is
-	// "piling up."
+	// example).  So let's hackfix it so that an alternate message is posted if no flush is
+	// already in flight.
 
-	if( !m_pendingFlushMsg )
+	if( !m_pendingFlushMsg.exchange( true ) )
 	{
-		m_pendingFlushMsg = true;
-
-		// wxWidgets may have aggressive locks on event processing, so best to release
-		// our own mutex lest wx get hung for an extended period of time and cause all
-		// of our own stuff to get sluggish.
-		lock.Release();
-
 		wxCommandEvent evt( pxEvt_FlushQueue );
 		evt.SetInt( 0 );
 		if( wxThread::IsMain() )
@@ -660,36 +825,9 @@ bool ConsoleLogFrame::Write( ConsoleColors color, const wxString& text )
 		}
 		else
 			GetEventHandler()->AddPendingEvent( evt );
-
-		lock.Acquire();
-	}
-
-	if( !wxThread::IsMain() )
-	{
-		// Too many color changes causes huge slowdowns when decorating the rich textview, so
-		// include a secondary check to avoid having a colorful log spam killing gui responsiveness.
-
-		if( m_CurQueuePos > 0x100000 || m_QueueColorSection.GetLength() > 256 )
-		{
-			++m_WaitingThreadsForFlush;
-			lock.Release();
-
-			// Note: if the queue flushes, we need to return TRUE, so that our thread sleeps
-			// until the main thread has had a chance to repaint the console window contents.
-			// [TODO] : It'd be a lot better if the console window repaint released the lock
-			//  once its task were complete, but thats been problematic, so for now this hack is
-			//  what we get.
-			if( m_sem_QueueFlushed.Wait( wxTimeSpan( 0,0,0,250 ) ) ) return true;
-
-			// If we're here it means QueueFlush wait timed out, so remove us from the waiting
-			// threads count. This way no thread permanently deadlocks against the console
-			// logger.  They just run quite slow, but should remain responsive to user input.
-			lock.Acquire();
-			if( m_WaitingThreadsForFlush != 0 ) --m_WaitingThreadsForFlush;
-		}
 	}
 
-	return false;
+	return stalled;
 }
 
 bool ConsoleLogFrame::Newline()
@@ -805,10 +943,10 @@ void ConsoleLogFrame::OnSave(wxCommandEvent& WXUNUSED(event))
 
 	// retrieve text and save it
 	// -------------------------
-	int nLines = m_TextCtrl.GetNumberOfLines();
+	int nLines = m_TextView.GetLineCount();
 	for ( int nLine = 0; nLine < nLines; nLine++ )
 	{
-		if( !file.Write(m_TextCtrl.GetLineText(nLine) + wxTextFile::GetEOL()) )
+		if( !file.Write(m_TextView.GetLineText(nLine) + wxTextFile::GetEOL()) )
 		{
 			wxLogError( L"Can't save log contents to file." );
 			return;
@@ -818,7 +956,7 @@ void ConsoleLogFrame::OnSave(wxCommandEvent& WXUNUSED(event))
 
 void ConsoleLogFrame::OnClear(wxCommandEvent& WXUNUSED(event))
 {
-	m_TextCtrl.Clear();
+	m_TextView.ClearAll();
 }
 
 void ConsoleLogFrame::OnLogSettings(wxCommandEvent& WXUNUSED(event))
@@ -877,20 +1015,20 @@ void ConsoleLogFrame::OnToggleTheme(wxCommandEvent& evt)
 		case MenuId_ColorScheme_Dark:
 			newTheme = L"Dark";
 			m_ColorTable.SetColorScheme_Dark();
-			m_TextCtrl.SetBackgroundColour(darkThemeBgColor);
-			m_TextCtrl.SetDefaultStyle(wxTextAttr(wxNullColour, darkThemeBgColor));
-			m_TextCtrl.Clear();
+			m_TextView.SetBackgroundColour(darkThemeBgColor);
 			break;
 		case MenuId_ColorScheme_Light:
 		default:
 			newTheme = L"Default";
 			m_ColorTable.SetColorScheme_Light();
-			m_TextCtrl.SetBackgroundColour(lightThemeBgColor);
-			m_TextCtrl.SetDefaultStyle(wxTextAttr(wxNullColour, lightThemeBgColor));
-			m_TextCtrl.Clear();
+			m_TextView.SetBackgroundColour(lightThemeBgColor);
 			break;
 	}
 
+	// Colors are resolved at paint time, so unlike the old text control the existing
+	// contents survive a theme switch; a repaint is all it takes.
+	m_TextView.Refresh();
+
 	if (m_conf.Theme.CmpNoCase(newTheme) == 0)
 		return;
 	m_conf.Theme = newTheme;
@@ -914,11 +1052,7 @@ void ConsoleLogFrame::OnFontSize( wxCommandEvent& evt )
 
 	m_conf.FontSize = ptsize;
 	m_ColorTable.SetFont( ptsize );
-	m_TextCtrl.SetDefaultStyle( m_ColorTable[Color_White] );
-
-	// TODO: Process the attributes of each character and upgrade the font size,
-	// while still retaining color and bold settings...  (might be slow but then
-	// it hardly matters being a once-in-a-bluemoon action).
+	m_TextView.OnFontChanged();
 }
 
 void ConsoleLogFrame::OnAutoDock(wxCommandEvent& evt)
@@ -947,7 +1081,7 @@ void ConsoleLogFrame::DoFlushEvent( bool isPending )
 	RecursionGuard recguard( recursion_counter );
 	if( recguard.IsReentrant() ) return;
 
-	ScopedLock locker( m_mtx_Queue );
+	DrainWriteRing();
 
 	if( m_CurQueuePos != 0 )
 	{
@@ -991,59 +1125,51 @@ void ConsoleLogFrame::OnFlushEvent( wxCommandEvent& )
 	m_timer_FlushUnlocker.Start( 100, true );
 }
 
-void ConsoleLogFrame::DoFlushQueue()
+// Moves everything the writer threads have pushed into the staging buffer that
+// DoFlushQueue feeds to the textview.  Main thread only -- it's the sole consumer
+// of the ring and the only toucher of the m_Queue* vars.
+void ConsoleLogFrame::DrainWriteRing()
 {
-	int len = m_QueueColorSection.GetLength();
-	pxAssert( len != 0 );
-
-	// Note, freezing/thawing actually seems to cause more overhead than it solves.
-	// It might be useful if we're posting like dozens of messages, but in our case
-	// we only post 1-4 typically, so better to leave things enabled.
-	//m_TextCtrl.Freeze();
-
-	// Manual InsertionPoint tracking avoids a lot of overhead in SetInsertionPointEnd()
-	wxTextPos insertPoint = m_TextCtrl.GetLastPosition();
-
-	// cap at 512k for now...
-	// fixme - 512k runs well on win32 but appears to be very sluggish on linux (but that could
-	// be a result of my using Xming + CoLinux).  Might need platform dependent defaults here. --air
-
-	static const int BufferSize = 0x80000;
-	if( (insertPoint + m_CurQueuePos) > BufferSize )
+	QueuedLine* line;
+	while( m_WriteRing.pop( line ) )
 	{
-		int toKeep = BufferSize - m_CurQueuePos;
-		if( toKeep <= 10 )
+		if( m_QueueColorSection.GetLength() == 0 )
 		{
-			m_TextCtrl.Clear();
-			insertPoint = 0;
+			pxAssertMsg( m_CurQueuePos == 0, "Queue's character position didn't get reset in sync with it's ColorSection table." );
 		}
-		else
+
+		if( (m_QueueColorSection.GetLength() == 0) || ((line->color != Color_Current) && (m_QueueColorSection.GetLast().color != line->color)) )
 		{
-			int toRemove = BufferSize - toKeep;
-			if( toRemove < BufferSize / 4 ) toRemove = BufferSize;
-			m_TextCtrl.Remove( 0, toRemove );
-			insertPoint -= toRemove;
+			++m_CurQueuePos;		// Don't overwrite the NULL;
+			m_QueueColorSection.Add( ColorSection(line->color, m_CurQueuePos) );
 		}
-	}
 
-	m_TextCtrl.SetInsertionPoint( insertPoint );
+		int endpos = m_CurQueuePos + line->len;
+		m_QueueBuffer.MakeRoomFor( endpos + 1 );		// and the null!!
+		memcpy( &m_QueueBuffer[m_CurQueuePos], line->text, sizeof(wxChar) * line->len );
+		m_CurQueuePos = endpos;
 
-	// fixme : Writing a lot of colored logs to the console can be quite slow when "spamming"
-	// is happening, due to the overhead of SetDefaultStyle and WriteText calls.  I'm not sure
-	// if there's a better way to go about this?  Using Freeze/Thaw helps a little bit, but it's
-	// still magnitudes slower than dumping a straight run. --air
+		// this NULL may be overwritten if the next message drained doesn't perform a color change.
+		m_QueueBuffer[m_CurQueuePos] = 0;
 
-	if( len > 64 ) m_TextCtrl.Freeze();
+		delete line;
+	}
+}
 
-	for( int i=0; i<len; ++i )
-	{
-		if( m_QueueColorSection[i].color != Color_Current )
-			m_TextCtrl.SetDefaultStyle( m_ColorTable[m_QueueColorSection[i].color] );
+void ConsoleLogFrame::DoFlushQueue()
+{
+	int len = m_QueueColorSection.GetLength();
+	pxAssert( len != 0 );
 
-		m_TextCtrl.WriteText( &m_QueueBuffer[m_QueueColorSection[i].startpoint] );
-	}
+	// Sections land in the view's bounded line ring; only the rows actually on screen
+	// ever get laid out or painted, so the cost here is O(new text) no matter how long
+	// the session has been running.  The ring handles its own trimming -- no more
+	// shuffling the whole buffer down to honor a character cap.
+
+	for( int i=0; i<len; ++i )
+		m_TextView.Append( m_QueueColorSection[i].color, &m_QueueBuffer[m_QueueColorSection[i].startpoint] );
 
-	if( len > 64 ) m_TextCtrl.Thaw();
+	m_TextView.CommitAppends();
 
 	m_QueueColorSection.Clear();
 	m_CurQueuePos		= 0;
@@ -1264,15 +1390,20 @@ void Pcsx2App::DisableWindowLogging() const
 	Console_SetActiveHandler( (emuLog!=NULL) ? (IConsoleWriter&)ConsoleWriter_File : (IConsoleWriter&)ConsoleWriter_Stdout );
 }
 
-void OSDlog(ConsoleColors color, bool console, const std::string& str)
+void OSDlog(ConsoleColors color, bool console, const char* str)
 {
-	GSosdLog(str.c_str(), wxGetApp().GetProgramLog()->GetRGBA(color));
+	GSosdLog(str, wxGetApp().GetProgramLog()->GetRGBA(color));
 
 	if (console)
-		Console.WriteLn(color, str.c_str());
+		Console.WriteLn(color, str);
+}
+
+void OSDlog(ConsoleColors color, bool console, const std::string& str)
+{
+	OSDlog(color, console, str.c_str());
 }
 
-void OSDmonitor(ConsoleColors color, const std::string key, const std::string value) {
-	GSosdMonitor(wxString(key).utf8_str(), wxString(value).utf8_str(), wxGetApp().GetProgramLog()->GetRGBA(color));
+void OSDmonitor(ConsoleColors color, const char* key, const char* value) {
+	GSosdMonitor(key, value, wxGetApp().GetProgramLog()->GetRGBA(color));
 }
 
@@ -16,9 +16,13 @@
 #pragma once
 
 #include "App.h"
+#include "common/mt_queue.h"
+#include <wx/vlbox.h>
 #include <array>
+#include <deque>
 #include <map>
 #include <memory>
+#include <vector>
 
 static const bool EnableThreadedLoggingTest = false; //true;
 
@@ -130,16 +134,105 @@ protected:
 		ColorSection( ConsoleColors _color, int msgptr ) : color(_color), startpoint(msgptr) { }
 	};
 
+	// A single message in flight from a writing thread to the main thread.  The text
+	// is deep-copied into entry-owned storage -- wxString buffers can't be handed
+	// across threads safely.
+	class QueuedLine
+	{
+		DeclareNoncopyableObject(QueuedLine);
+
+	public:
+		ConsoleColors	color;
+		int				len;
+		wxChar*			text;
+
+		QueuedLine( ConsoleColors _color, const wxString& src )
+			: color( _color )
+			, len( src.Length() )
+		{
+			text = new wxChar[len + 1];
+			memcpy( text, src.wc_str(), sizeof(wxChar) * (len + 1) );
+		}
+
+		~QueuedLine()
+		{
+			delete[] text;
+		}
+	};
+
+	// ------------------------------------------------------------------------
+	//  LogView
+	// ------------------------------------------------------------------------
+	// Virtualized replacement for the wxTextCtrl the log used to write into.  Lines
+	// live in a bounded ring and only the rows actually on screen ever get laid out
+	// or painted, so appends and repaints stay O(1) with respect to session length.
+	// The old control re-styled and re-measured its whole buffer on every append,
+	// and shuffled the entire thing down each time it hit its character cap.
+	class LogView : public wxVListBox
+	{
+		DeclareNoncopyableObject(LogView);
+
+	protected:
+		// Hard bound on retained lines; the oldest are dropped as new ones arrive.
+		// Roughly the same history as the old 512k character cap at typical console
+		// line lengths, and a fixed memory ceiling either way.
+		static const uint MaxLines = 8192;
+
+		// A run of same-colored text within a line.  Most lines hold exactly one;
+		// more appear when a message changes color mid-line.
+		struct LineSpan
+		{
+			ConsoleColors	color;
+			wxString		text;
+
+			LineSpan( ConsoleColors _color, const wxChar* src, size_t len )
+				: color( _color ), text( src, len ) { }
+		};
+
+		typedef std::vector<LineSpan> Line;
+
+		ColorArray&			m_colors;
+		std::deque<Line>	m_lines;
+
+		// Color applied to spans queued with Color_Current.
+		ConsoleColors		m_cur_color;
+
+		// True if m_lines.back() hasn't seen its newline yet, in which case the next
+		// append continues that row instead of starting a fresh one.
+		bool				m_line_open;
+
+		// Cached result for OnMeasureItem; recomputed when the font changes.
+		wxCoord				m_row_height;
+
+	public:
+		LogView( wxWindow* parent, ColorArray& colors );
+		virtual ~LogView() = default;
+
+		void Append( ConsoleColors color, const wxChar* text );
+		void CommitAppends();
+		void ClearAll();
+		void OnFontChanged();
+
+		int GetLineCount() const { return m_lines.size(); }
+		wxString GetLineText( int line ) const;
+
+	protected:
+		void OnDrawItem( wxDC& dc, const wxRect& rect, size_t n ) const;
+		wxCoord OnMeasureItem( size_t n ) const;
+		void OnKeyDown( wxKeyEvent& evt );
+		void CopySelectionToClipboard() const;
+	};
+
 private:
 	wxColor lightThemeBgColor = wxColor(230, 235, 242);
 	wxColor darkThemeBgColor = wxColor(38, 41, 48);
 
 protected:
 	ConLogConfig&	m_conf;
-	wxTextCtrl&		m_TextCtrl;
+	ColorArray		m_ColorTable;
+	LogView&		m_TextView;
 	wxTimer			m_timer_FlushLimiter;
 	wxTimer			m_timer_FlushUnlocker;
-	ColorArray		m_ColorTable;
 
 	int				m_flushevent_counter;
 	bool			m_FlushRefreshLocked;
@@ -163,9 +256,11 @@ protected:
 	// Used by threads waiting on the queue to flush.
 	Semaphore				m_sem_QueueFlushed;
 
-	// Lock object for accessing or modifying the following three vars:
-	//  m_QueueBuffer, m_QueueColorSelection, m_CurQueuePos
-	Mutex					m_mtx_Queue;
+	// Messages in flight to the main thread.  Writers push here without taking any
+	// lock; the main thread drains it into the three queue vars below, which are
+	// therefore main-thread-only now and need no mutex.  A full ring is the new
+	// "queue is piling up" signal, and the only case where a writer waits.
+	MtMpmcQueue<QueuedLine*, 2048>	m_WriteRing;
 
 	// Describes a series of colored text sections in the m_QueueBuffer.
 	SafeList<ColorSection>	m_QueueColorSection;
@@ -221,6 +316,7 @@ protected:
 	void OnFlushUnlockerTimer( wxTimerEvent& evt );
 	void OnFlushEvent( wxCommandEvent& event );
 
+	void DrainWriteRing();
 	void DoFlushQueue();
 	void DoFlushEvent( bool isPending );
 
@@ -231,18 +327,20 @@ protected:
 	void OnLoggingChanged();
 };
 
+void OSDlog(ConsoleColors color, bool console, const char* str);
 void OSDlog(ConsoleColors color, bool console, const std::string& str);
 
 template<typename ... Args>
 void OSDlog(ConsoleColors color, bool console, const std::string& format, Args ... args) {
 	if (!console) return;
 
-	size_t size = snprintf( nullptr, 0, format.c_str(), args ... ) + 1; // Extra space for '\0'
-	std::vector<char> buf(size);
-	snprintf( buf.data(), size, format.c_str(), args ... );
+	// Fixed stack buffer: these run during gameplay and must not touch the
+	// heap. Overlong messages get truncated, which is fine for the OSD.
+	char buf[512];
+	snprintf(buf, sizeof(buf), format.c_str(), args ...);
 
-	OSDlog(color, console, buf.data());
+	OSDlog(color, console, buf);
 }
 
-void OSDmonitor(ConsoleColors color, const std::string key, const std::string value);
+void OSDmonitor(ConsoleColors color, const char* key, const char* value);
 
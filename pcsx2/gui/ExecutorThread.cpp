@@ -157,7 +157,7 @@ void SysExecEvent::PostResult() const
 //  pxEvtQueue Implementations
 // --------------------------------------------------------------------------------------
 pxEvtQueue::pxEvtQueue() :
-	m_OwnerThreadId(), m_Quitting(false), m_qpc_Start(0)
+	m_wakeup_pending(false), m_OwnerThreadId(), m_Quitting(false), m_qpc_Start(0)
 {
 }
 
@@ -245,7 +245,47 @@ void pxEvtQueue::ProcessIdleEvents()
 
 void pxEvtQueue::ProcessPendingEvents()
 {
-	ProcessEvents( m_pendingEvents );
+	// Pops in small batches from the lock-free queue; producers can keep posting
+	// at full speed while events execute.
+	SysExecEvent* batch[16];
+	size_t count;
+
+	while( (count = m_pendingEvents.pop_n( batch, countof(batch) )) != 0 )
+	{
+		for( size_t i=0; i<count; ++i )
+		{
+			std::unique_ptr<SysExecEvent> deleteMe(batch[i]);
+
+			if( !m_Quitting || deleteMe->IsCriticalEvent() )
+			{
+				m_qpc_Start = GetCPUTicks();
+
+				pxEvtLog.Write( this, deleteMe.get(), wxsFormat(L"Executing... [%s]",
+					deleteMe->AllowCancelOnExit() ? L"Cancelable" : L"Noncancelable").wc_str()
+				);
+
+				if( deleteMe->AllowCancelOnExit() )
+					deleteMe->_DoInvokeEvent();
+				else
+				{
+					ScopedThreadCancelDisable thr_cancel_scope;
+					deleteMe->_DoInvokeEvent();
+				}
+
+				u64 qpc_end = GetCPUTicks();
+				pxEvtLog.Write( this, deleteMe.get(), wxsFormat(L"Event completed in %ums",
+					(u32)(((qpc_end-m_qpc_Start)*1000) / GetTickFrequency())).wc_str()
+				);
+
+				m_qpc_Start = 0;		// lets the main thread know the message completed.
+			}
+			else
+			{
+				pxEvtLog.Write( this, deleteMe.get(), L"Skipping Event: %s" );
+				deleteMe->PostResult();
+			}
+		}
+	}
 }
 
 // This method is provided for wxWidgets API conformance.  I like to use PostEvent instead
@@ -272,12 +312,19 @@ void pxEvtQueue::PostEvent( SysExecEvent* evt )
 		return;
 	}
 
-	ScopedLock synclock( m_mtx_pending );
-	
-	pxEvtLog.Write( this, evt, pxsFmt(L"Posting event! (pending=%d, idle=%d)", m_pendingEvents.size(), m_idleEvents.size()) );
+	pxEvtLog.Write( this, evt, pxsFmt(L"Posting event! (pending=%d)", (int)m_pendingEvents.size_approx()) );
 
-	m_pendingEvents.push_back( sevt.release() );
-	if( m_pendingEvents.size() == 1)
+	while( !m_pendingEvents.push( sevt.get() ) )
+	{
+		// Queue full, which means the executor is well behind.  Rare; back off
+		// briefly rather than growing an unbounded list.
+		Threading::Sleep( 1 );
+	}
+	sevt.release();
+
+	// Collapse redundant wakeups: only the first post since the executor last
+	// went back to draining needs to hit the semaphore.
+	if( !m_wakeup_pending.exchange( true ) )
 		m_wakeup.Post();
 }
 
@@ -298,12 +345,16 @@ void pxEvtQueue::PostIdleEvent( SysExecEvent* evt )
 
 	ScopedLock synclock( m_mtx_pending );
 
-	pxEvtLog.Write( this, evt, pxsFmt(L"Posting event! (pending=%d, idle=%d) [idle]", m_pendingEvents.size(), m_idleEvents.size()) );
+	pxEvtLog.Write( this, evt, pxsFmt(L"Posting event! (pending=%d, idle=%d) [idle]", (int)m_pendingEvents.size_approx(), m_idleEvents.size()) );
 
-	if( m_pendingEvents.empty() )
+	if( m_pendingEvents.empty_approx() )
 	{
-		m_pendingEvents.push_back( evt );
-		m_wakeup.Post();
+		// An idle queue executes the event immediately.  The emptiness check is
+		// approximate, but either failure mode just shifts *when* the event runs.
+		while( !m_pendingEvents.push( evt ) )
+			Threading::Sleep( 1 );
+		if( !m_wakeup_pending.exchange( true ) )
+			m_wakeup.Post();
 	}
 	else
 		m_idleEvents.push_back( evt );
@@ -384,6 +435,10 @@ void pxEvtQueue::Idle()
 	ProcessIdleEvents();
 	_DoIdle();
 	m_wakeup.WaitWithoutYield();
+
+	// Re-arm before draining; a post landing after the drain will then produce
+	// a fresh wakeup instead of being lost.
+	m_wakeup_pending.store( false );
 }
 
 void pxEvtQueue::SetActiveThread()
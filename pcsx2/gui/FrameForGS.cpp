@@ -18,7 +18,9 @@
 #include "GSFrame.h"
 #include "AppAccelerators.h"
 #include "AppSaveStates.h"
+#include "Benchmark.h"
 #include "Counters.h"
+#include "FrameProfiler.h"
 #include "GS.h"
 #include "MainFrame.h"
 #include "MSWstuff.h"
@@ -40,8 +42,6 @@
 #include <wx/utils.h>
 #include <wx/graphics.h>
 #include <memory>
-#include <sstream>
-#include <iomanip>
 
 //#define GSWindowScaleDebug
 
@@ -90,9 +90,12 @@ void GSPanel::InitDefaultAccelerators()
 	m_Accels->Map( AAC( WXK_ESCAPE ),			"Sys_SuspendResume" );
 	m_Accels->Map( AAC( WXK_F8 ),				"Sys_TakeSnapshot" ); // also shift and ctrl-shift will be added automatically
 	m_Accels->Map( AAC( WXK_F9 ),				"Sys_RenderswitchToggle");
+	m_Accels->Map( AAC( WXK_F9 ).Shift(),		"Sys_MemReport" );
 
 	m_Accels->Map( AAC( WXK_F10 ),				"Sys_LoggingToggle" );
+	m_Accels->Map( AAC( WXK_F10 ).Shift(),		"Sys_ProfilerToggle" );
 	m_Accels->Map( AAC( WXK_F11 ),				"Sys_FreezeGS" );
+	m_Accels->Map( AAC( WXK_F11 ).Shift(),		"Sys_TraceDump" );
 	m_Accels->Map( AAC( WXK_F12 ),				"Sys_RecordingToggle" );
 
 	m_Accels->Map( FULLSCREEN_TOGGLE_ACCELERATOR_GSPANEL,		"FullscreenToggle" );
@@ -666,17 +669,46 @@ void GSFrame::OnUpdateTitle( wxTimerEvent& evt )
 			pxNonReleaseCode(cpuUsage.Write(L" | UI: %3d%%", m_CpuUsage.GetGuiPct()));
 		}
 
+		// fixed buffers, the monitor refreshes during gameplay and the old
+		// std::to_string/ostringstream path churned the heap
+		char pct[32];
+
 		if (THREAD_VU1)
-			OSDmonitor(Color_StrongGreen, "VU:", std::to_string(m_CpuUsage.GetVUPct()).c_str());
+		{
+			snprintf(pct, sizeof(pct), "%d", m_CpuUsage.GetVUPct());
+			OSDmonitor(Color_StrongGreen, "VU:", pct);
+		}
 
-		OSDmonitor(Color_StrongGreen, "EE:", std::to_string(m_CpuUsage.GetEEcorePct()).c_str());
-		OSDmonitor(Color_StrongGreen, "GS:", std::to_string(m_CpuUsage.GetGsPct()).c_str());
-		pxNonReleaseCode(OSDmonitor(Color_StrongGreen, "UI:", std::to_string(m_CpuUsage.GetGuiPct()).c_str()));
+		snprintf(pct, sizeof(pct), "%d", m_CpuUsage.GetEEcorePct());
+		OSDmonitor(Color_StrongGreen, "EE:", pct);
+		snprintf(pct, sizeof(pct), "%d", m_CpuUsage.GetGsPct());
+		OSDmonitor(Color_StrongGreen, "GS:", pct);
+		pxNonReleaseCode((snprintf(pct, sizeof(pct), "%d", m_CpuUsage.GetGuiPct()),
+			OSDmonitor(Color_StrongGreen, "UI:", pct)));
 	}
 
-	std::ostringstream out;
-	out << std::fixed << std::setprecision(2) << fps;
-	OSDmonitor(Color_StrongGreen, "FPS:", out.str());
+	char fpsStr[32];
+	snprintf(fpsStr, sizeof(fpsStr), "%.2f", fps);
+	OSDmonitor(Color_StrongGreen, "FPS:", fpsStr);
+
+	// Per-frame phase breakdown since the last title update: where each frame
+	// of wall time went, and how many frames sit queued ahead of the GS.
+	// In benchmark mode the phase counters belong to the benchmark's
+	// per-repetition windows, so don't consume them here.
+	const FrameProfiler::Stats fstats =
+		Benchmark::IsActive() ? FrameProfiler::Stats{} : FrameProfiler::Read();
+	if (fstats.frames > 0)
+	{
+		char phases[96];
+		snprintf(phases, sizeof(phases), "%.1fee %.1fvu %.1fgs %.1fslp %.1fprs",
+			fstats.ee_run_ms, fstats.vu1_wait_ms, fstats.gs_wait_ms,
+			fstats.limit_ms, fstats.present_ms);
+		OSDmonitor(Color_StrongGreen, "Frame(ms):", phases);
+
+		char queue[32];
+		snprintf(queue, sizeof(queue), "%.1f", fstats.gs_queue);
+		OSDmonitor(Color_StrongGreen, "GSqueue:", queue);
+	}
 
 #ifdef __linux__
 	// Important Linux note: When the title is set in fullscreen the window is redrawn. Unfortunately
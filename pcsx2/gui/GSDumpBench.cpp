@@ -0,0 +1,352 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "App.h"
+#include "GSDumpBench.h"
+#include "Dialogs/ModalPopups.h" // GSDump::isRunning
+
+#include "GS.h"
+#include "PathDefs.h"
+#include "SaveState.h"
+
+#include <wx/dir.h>
+#include <wx/ffile.h>
+#include <wx/filename.h>
+
+#include <memory>
+#include <vector>
+
+// Local mirror of the on-disk gs dump stream; the same constants are parsed by
+// the GS debugger (gui/Dialogs/GSDumpDialog.cpp) and by GSReplay.
+namespace
+{
+	enum GSType : u8
+	{
+		Transfer = 0,
+		VSync = 1,
+		ReadFIFO2 = 2,
+		Registers = 3
+	};
+
+	enum GSTransferPath : u8
+	{
+		Path1Old = 0,
+		Path2 = 1,
+		Path3 = 2,
+		Path1New = 3,
+		Dummy = 4
+	};
+
+	struct GSData
+	{
+		GSType id;
+		std::unique_ptr<char[]> data;
+		int length;
+		GSTransferPath path;
+	};
+
+	// One cell of the configuration matrix.  renderer_override uses the same
+	// encoding as the GS debugger: the GSRendererType is passed to GSopen2 in
+	// the top byte of the flags word.
+	struct BenchConfig
+	{
+		const wxChar* renderer;
+		s8 renderer_override;
+		int blend;
+		int upscale;
+	};
+
+	// Timed replay loops per configuration; one extra untimed loop warms the
+	// shader caches and the texture cache first.
+	static const int BenchLoops = 8;
+} // namespace
+
+// --------------------------------------------------------------------------------------
+//  GSDumpBenchThread
+// --------------------------------------------------------------------------------------
+class GSDumpBenchThread : public pxThread
+{
+	typedef pxThread _parent;
+
+public:
+	GSDumpBenchThread(const wxString& dumpdir, const wxString& csvpath)
+		: pxThread(L"GSDumpBench")
+		, m_dumpdir(dumpdir)
+		, m_csvpath(csvpath)
+	{
+	}
+
+	virtual ~GSDumpBenchThread()
+	{
+		try
+		{
+			pxThread::Cancel();
+		}
+		DESTRUCTOR_CATCHALL
+	}
+
+protected:
+	wxString m_dumpdir;
+	wxString m_csvpath;
+
+	void ExecuteTaskInThread();
+	bool LoadDump(const wxString& path, u32& crc, std::unique_ptr<char[]>& state, u32& state_size, char* regs, std::vector<GSData>& packets);
+	void ProcessPacket(const GSData& packet, char* regs);
+};
+
+bool GSDumpBenchThread::LoadDump(const wxString& path, u32& crc, std::unique_ptr<char[]>& state, u32& state_size, char* regs, std::vector<GSData>& packets)
+{
+	wxFFile file(path, L"rb");
+	if (!file.IsOpened())
+		return false;
+
+	const wxFileOffset length = file.Length();
+
+	file.Read(&crc, 4);
+	file.Read(&state_size, 4);
+
+	state = std::unique_ptr<char[]>(new char[state_size]);
+	file.Read(state.get(), state_size);
+	file.Read(regs, 8192);
+
+	packets.clear();
+	while (file.Tell() < length)
+	{
+		GSType id;
+		GSTransferPath id_transfer = Dummy;
+		file.Read(&id, 1);
+		s32 size = 0;
+		switch (id)
+		{
+			case Transfer:
+				file.Read(&id_transfer, 1);
+				file.Read(&size, 4);
+				break;
+			case VSync:
+				size = 1;
+				break;
+			case ReadFIFO2:
+				size = 4;
+				break;
+			case Registers:
+				size = 8192;
+				break;
+		}
+		std::unique_ptr<char[]> data(new char[size]);
+		file.Read(data.get(), size);
+		packets.push_back({id, std::move(data), size, id_transfer});
+	}
+
+	return !packets.empty();
+}
+
+void GSDumpBenchThread::ProcessPacket(const GSData& packet, char* regs)
+{
+	switch (packet.id)
+	{
+		case Transfer:
+		{
+			switch (packet.path)
+			{
+				case Path1Old:
+				{
+					std::unique_ptr<char[]> data(new char[16384]);
+					int addr = 16384 - packet.length;
+					memcpy(data.get(), packet.data.get() + addr, packet.length);
+					GSgifTransfer1((u8*)data.get(), addr);
+					break;
+				}
+				case Path1New:
+					GSgifTransfer((u8*)packet.data.get(), packet.length / 16);
+					break;
+				case Path2:
+					GSgifTransfer2((u8*)packet.data.get(), packet.length / 16);
+					break;
+				case Path3:
+					GSgifTransfer3((u8*)packet.data.get(), packet.length / 16);
+					break;
+				default:
+					break;
+			}
+			break;
+		}
+		case VSync:
+			GSvsync((*((int*)(regs + 4096)) & 0x2000) > 0 ? (u8)1 : (u8)0);
+			break;
+		case ReadFIFO2:
+		{
+			std::unique_ptr<char[]> arr(new char[*((int*)packet.data.get())]);
+			GSreadFIFO2((u8*)arr.get(), *((int*)packet.data.get()));
+			break;
+		}
+		case Registers:
+			memcpy(regs, packet.data.get(), 8192);
+			break;
+	}
+}
+
+void GSDumpBenchThread::ExecuteTaskInThread()
+{
+	wxArrayString dumps;
+	wxDir::GetAllFiles(m_dumpdir, &dumps, L"*.gs", wxDIR_FILES);
+	dumps.Sort();
+
+	if (dumps.empty())
+	{
+		Console.Error(L"(GSDumpBench) No .gs dumps found in %ls", WX_STR(m_dumpdir));
+		wxGetApp().PostMenuAction(MenuId_Exit);
+		return;
+	}
+
+	// The configuration matrix.  The software renderer ignores blending
+	// accuracy and upscaling, so it gets a single cell.
+	std::vector<BenchConfig> configs;
+	for (int blend = 1; blend <= 2; blend++)
+	{
+		for (int upscale = 1; upscale <= 2; upscale++)
+		{
+			configs.push_back({L"ogl-hw", 12, blend, upscale});
+#ifdef _WIN32
+			configs.push_back({L"d3d11-hw", 3, blend, upscale});
+#endif
+		}
+	}
+	configs.push_back({L"sw", 13, 1, 1});
+
+	wxString csvpath(m_csvpath);
+	if (csvpath.IsEmpty())
+	{
+		PathDefs::GetLogs().Mkdir();
+		csvpath = Path::Combine(PathDefs::GetLogs().ToString(), L"gsbench.csv");
+	}
+
+	wxFFile csv(csvpath, L"w");
+	if (!csv.IsOpened())
+	{
+		Console.Error(L"(GSDumpBench) Could not open %ls for writing", WX_STR(csvpath));
+		wxGetApp().PostMenuAction(MenuId_Exit);
+		return;
+	}
+	csv.Write(L"dump,renderer,blend,upscale,loops,frames,total_ms,avg_ms,min_ms,max_ms,prims_per_frame,draws_per_frame,syncs_per_frame\n");
+
+	GSDump::isRunning = true;
+	GSinit();
+	sApp.OpenGsPanel();
+
+	Console.WriteLn(Color_StrongGreen, L"(GSDumpBench) %d dump(s) x %d configuration(s), %d loops each",
+		(int)dumps.size(), (int)configs.size(), BenchLoops);
+
+	for (const wxString& dump : dumps)
+	{
+		u32 crc = 0, state_size = 0;
+		std::unique_ptr<char[]> state_data;
+		char regs[8192];
+		std::vector<GSData> packets;
+
+		if (!LoadDump(dump, crc, state_data, state_size, regs, packets))
+		{
+			Console.Error(L"(GSDumpBench) Could not read %ls, skipping", WX_STR(dump));
+			continue;
+		}
+
+		const wxString name(wxFileName(dump).GetFullName());
+		freezeData fd = {(int)state_size, (u8*)state_data.get()};
+
+		for (const BenchConfig& config : configs)
+		{
+			theApp.SetConfig("accurate_blending_unit", config.blend);
+			theApp.SetConfig("upscale_multiplier", config.upscale);
+
+			GSsetBaseMem((u8*)regs);
+			if (GSopen2((void**)pDsp, (config.renderer_override << 24)) != 0)
+			{
+				Console.Error(L"(GSDumpBench) GSopen2 failed for renderer %ls, skipping", config.renderer);
+				continue;
+			}
+
+			GSsetGameCRC((int)crc, 0);
+			GSfreeze(FreezeAction::Load, &fd);
+			GSvsync(1);
+			GSreset();
+			GSsetBaseMem((u8*)regs);
+			GSfreeze(FreezeAction::Load, &fd);
+
+			u32 frames = 0;
+			u64 total_ticks = 0, min_ticks = 0, max_ticks = 0;
+
+			// Loop 0 is the warmup: shader compilation and texture cache
+			// population would otherwise dominate the first pass.
+			for (int loop = 0; loop <= BenchLoops; loop++)
+			{
+				u64 frame_start = GetCPUTicks();
+				for (const GSData& packet : packets)
+				{
+					ProcessPacket(packet, regs);
+					if (packet.id == VSync && loop > 0)
+					{
+						const u64 now = GetCPUTicks();
+						const u64 ticks = now - frame_start;
+						total_ticks += ticks;
+						if (frames == 0 || ticks < min_ticks)
+							min_ticks = ticks;
+						if (ticks > max_ticks)
+							max_ticks = ticks;
+						frames++;
+						frame_start = now;
+					}
+				}
+			}
+
+			double prims = 0.0, draws = 0.0, syncs = 0.0;
+			GSgetPerfStats(&prims, &draws, &syncs);
+
+			GSclose();
+
+			const double to_ms = 1000.0 / GetTickFrequency();
+			const double total_ms = total_ticks * to_ms;
+			const double avg_ms = frames ? total_ms / frames : 0.0;
+
+			csv.Write(wxString::Format(L"%ls,%ls,%d,%d,%d,%u,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f,%.1f\n",
+				WX_STR(name), config.renderer, config.blend, config.upscale, BenchLoops, frames,
+				total_ms, avg_ms, min_ticks * to_ms, max_ticks * to_ms, prims, draws, syncs));
+
+			Console.WriteLn(L"(GSDumpBench) %ls [%ls blend=%d upscale=%d]: %.3f ms/frame over %u frames",
+				WX_STR(name), config.renderer, config.blend, config.upscale, avg_ms, frames);
+		}
+	}
+
+	csv.Close();
+	GSshutdown();
+	sApp.CloseGsPanel();
+	GSDump::isRunning = false;
+
+	Console.WriteLn(Color_StrongGreen, L"(GSDumpBench) Results written to %ls", WX_STR(csvpath));
+	wxGetApp().PostMenuAction(MenuId_Exit);
+}
+
+// --------------------------------------------------------------------------------------
+//  GSDumpBench (public interface)
+// --------------------------------------------------------------------------------------
+namespace GSDumpBench
+{
+	static std::unique_ptr<GSDumpBenchThread> s_thread;
+
+	void Start(const wxString& dumpdir, const wxString& csvpath)
+	{
+		s_thread = std::make_unique<GSDumpBenchThread>(dumpdir, csvpath);
+		s_thread->Start();
+	}
+} // namespace GSDumpBench
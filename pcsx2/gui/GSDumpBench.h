@@ -0,0 +1,31 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <wx/string.h>
+
+// GS dump batch benchmark (--gsbench).  Replays every .gs dump found in a
+// directory across a matrix of renderer configurations (hardware/software
+// renderer, blending accuracy, upscale factor) without booting the VM, and
+// writes per-dump frame timings plus GS internal counters to a CSV file.
+// Intended for automated GS regression tracking; the process exits when the
+// matrix completes.
+namespace GSDumpBench
+{
+	// Spawns the replay thread.  csvpath may be empty, in which case the
+	// results go to logs/gsbench.csv.
+	void Start(const wxString& dumpdir, const wxString& csvpath);
+}
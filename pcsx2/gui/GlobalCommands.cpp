@@ -31,6 +31,11 @@
 #include "GS.h"
 #include "Dump.h"
 #include "DebugTools/Debug.h"
+#include "DebugTools/GuestProfiler.h"
+#include "DebugTools/Tracepoint.h"
+#include "FrameProfiler.h"
+#include "common/MemoryAccount.h"
+#include "Memory.h"
 #include "R3000A.h"
 #include "SPU2/spu2.h"
 #include "gui/Dialogs/ModalPopups.h"
@@ -200,12 +205,14 @@ namespace Implementations
 
 		// Disable FMV mode if we were previously in it, so the user can override the AR.
 		GSSetFMVSwitch(false);
+		AppPublishGSWindowConfig();
 	}
 
 	void SetOffset(float x, float y)
 	{
 		g_Conf->GSWindow.OffsetX = x;
 		g_Conf->GSWindow.OffsetY = y;
+		AppPublishGSWindowConfig();
 		OSDlog(Color_StrongBlue, true, "(GSwindow) Offset: x=%f, y=%f", x, y);
 	}
 
@@ -239,6 +246,7 @@ namespace Implementations
 		if (zoom <= 0)
 			return;
 		g_Conf->GSWindow.StretchY = zoom;
+		AppPublishGSWindowConfig();
 		OSDlog(Color_StrongBlue, true, "(GSwindow) Vertical stretch: %f", zoom);
 	}
 
@@ -260,6 +268,7 @@ namespace Implementations
 		if (zoom < 0)
 			return;
 		g_Conf->GSWindow.Zoom = zoom;
+		AppPublishGSWindowConfig();
 
 		if (zoom == 0)
 			OSDlog(Color_StrongBlue, true, "(GSwindow) Zoom: 0 (auto, no black bars)");
@@ -391,6 +400,9 @@ namespace Implementations
 			GetMTGS().Freeze(FreezeAction::Size, sstate);
 			fP.data = new u8[fP.size];
 			GetMTGS().Freeze(FreezeAction::Save, sstate);
+			// HW<->SW toggles can keep the window, GL context and device
+			// across the close/reopen pair; only the renderer object changes
+			GSSetWarmSwitch(true);
 			GetMTGS().Suspend(true);
 			renderswitch = !renderswitch;
 			GetMTGS().Freeze(FreezeAction::Load, sstate);
@@ -413,6 +425,38 @@ namespace Implementations
 #endif
 	}
 
+	void Sys_ProfilerToggle()
+	{
+		GuestProfiler::Toggle();
+		OSDlog(ConsoleColors::Color_Black, true,
+			GuestProfiler::IsRunning() ? "Guest profiler started" : "Guest profiler stopped");
+	}
+
+	void Sys_TraceDump()
+	{
+		Tracepoint::Dump();
+		OSDlog(ConsoleColors::Color_Black, true, "Tracepoints dumped");
+	}
+
+	void Sys_AccountingToggle()
+	{
+		FrameProfiler::ToggleAccounting();
+		OSDlog(ConsoleColors::Color_Black, true,
+			FrameProfiler::IsAccounting() ? "Cycle accounting started" : "Cycle accounting stopped");
+	}
+
+	void Sys_MemReport()
+	{
+		MemAccount::Report();
+		OSDlog(ConsoleColors::Color_Black, true, "Memory report written to console");
+	}
+
+	void Sys_SmcHeatmapDump()
+	{
+		mmap_DumpSmcHeatmap();
+		OSDlog(ConsoleColors::Color_Black, true, "SMC heatmap dumped");
+	}
+
 	void Sys_FreezeGS()
 	{
 		// fixme : fix up gsstate mess and make it mtgs compatible -- air
@@ -544,6 +588,11 @@ namespace Implementations
 		States_DefrostCurrentSlot();
 	}
 
+	void States_Rewind()
+	{
+		StateCopy_Rewind();
+	}
+
 	void States_SaveSlot0()
 	{
 		States_SaveSlot(0);
@@ -696,6 +745,14 @@ static const GlobalCommandDescriptor CommandDeclarations[] =
 			false,
 		},
 
+		{
+			"States_Rewind",
+			Implementations::States_Rewind,
+			pxL("Rewind"),
+			pxL("Steps the virtual machine back through the rewind history (requires rewind to be enabled)."),
+			false,
+		},
+
 		{
 			"Frameskip_Toggle",
 			Implementations::Frameskip_Toggle,
@@ -802,6 +859,46 @@ static const GlobalCommandDescriptor CommandDeclarations[] =
 			false,
 		},
 
+		{
+			"Sys_ProfilerToggle",
+			Implementations::Sys_ProfilerToggle,
+			NULL,
+			NULL,
+			false,
+		},
+
+		{
+			"Sys_TraceDump",
+			Implementations::Sys_TraceDump,
+			NULL,
+			NULL,
+			false,
+		},
+
+		{
+			"Sys_AccountingToggle",
+			Implementations::Sys_AccountingToggle,
+			NULL,
+			NULL,
+			false,
+		},
+
+		{
+			"Sys_MemReport",
+			Implementations::Sys_MemReport,
+			NULL,
+			NULL,
+			false,
+		},
+
+		{
+			"Sys_SmcHeatmapDump",
+			Implementations::Sys_SmcHeatmapDump,
+			NULL,
+			NULL,
+			false,
+		},
+
 		{
 			"Sys_FreezeGS",
 			Implementations::Sys_FreezeGS,
@@ -1028,8 +1125,13 @@ void Pcsx2App::InitDefaultGlobalAccelerators()
 	// GlobalAccels->Map(AAC(WXK_F8).Shift(), "Sys_TakeSnapshot");
 	// GlobalAccels->Map(AAC(WXK_F8).Shift().Cmd(), "Sys_TakeSnapshot");
 	GlobalAccels->Map(AAC(WXK_F9), "Sys_RenderswitchToggle");
+	GlobalAccels->Map(AAC(WXK_F9).Shift(), "Sys_MemReport");
 
 	// GlobalAccels->Map(AAC(WXK_F10),	"Sys_LoggingToggle");
+	GlobalAccels->Map(AAC(WXK_F10).Shift(), "Sys_ProfilerToggle");
+	GlobalAccels->Map(AAC(WXK_F10).Cmd(), "Sys_AccountingToggle");
+	GlobalAccels->Map(AAC(WXK_F11).Shift(), "Sys_TraceDump");
+	GlobalAccels->Map(AAC(WXK_F11).Cmd(), "Sys_SmcHeatmapDump");
 	// GlobalAccels->Map(AAC(WXK_F11),	"Sys_FreezeGS");
 	GlobalAccels->Map(AAC(WXK_F12), "Sys_RecordingToggle");
 }
@@ -40,6 +40,8 @@ static const int MCD_SIZE = 1024 * 8 * 16; // Legacy PSX card default size
 
 static const int MC2_MBSIZE = 1024 * 528 * 2; // Size of a single megabyte of card data
 
+static const int MC2_SECTOR_SIZE = 528; // Size of a single sector of card data, including ECC
+
 bool FileMcd_Open = false;
 
 // ECC code ported from mymc
@@ -152,6 +154,12 @@ static bool ConvertRAWtoNoECC(wxString file_in, wxString file_out)
 
 // --------------------------------------------------------------------------------------
 //  FileMemoryCard
+// a sector's worth of card data pending in the write journal
+struct McdJournalSector
+{
+	u8 raw[MC2_SECTOR_SIZE];
+};
+
 // --------------------------------------------------------------------------------------
 // Provides thread-safe direct file IO mapping.
 //
@@ -165,6 +173,14 @@ protected:
 	bool m_ispsx[8];
 	u32 m_chkaddr;
 
+	// sectors written by the game but not yet to the file, keyed by sector number
+	// keeping the file I/O out of the SIO interrupt path avoids stalling emulation
+	// while games save, the same way FolderMemoryCard defers its flushes
+	std::map<u32, McdJournalSector> m_journal[8];
+	// if > 0, the amount of frames until the slot's journal is flushed to the file
+	// reset to FolderMemoryCard::FramesAfterWriteUntilFlush on each write
+	int m_framesUntilFlush[8];
+
 public:
 	FileMemoryCard();
 	virtual ~FileMemoryCard() = default;
@@ -182,10 +198,14 @@ public:
 	s32 Save(uint slot, const u8* src, u32 adr, int size);
 	s32 EraseBlock(uint slot, u32 adr);
 	u64 GetCRC(uint slot);
+	void NextFrame(uint slot);
 
 protected:
 	bool Seek(wxFFile& f, u32 adr);
 	bool Create(const wxString& mcdFile, uint sizeInMB);
+	bool ReadJournaled(uint slot, u8* dest, u32 adr, int size);
+	bool WriteJournaled(uint slot, const u8* src, u32 adr, int size);
+	bool FlushJournal(uint slot);
 
 	wxString GetDisabledMessage(uint slot) const
 	{
@@ -266,6 +286,7 @@ FileMemoryCard::FileMemoryCard()
 {
 	memset8<0xff>(m_effeffs);
 	m_chkaddr = 0;
+	memset(m_framesUntilFlush, 0, sizeof(m_framesUntilFlush));
 }
 
 void FileMemoryCard::Open()
@@ -365,6 +386,10 @@ void FileMemoryCard::Close()
 	{
 		if (m_file[slot].IsOpened())
 		{
+			// write out any data the game saved just before shutdown
+			FlushJournal(slot);
+			m_framesUntilFlush[slot] = 0;
+
 			// Store checksum
 			if (!m_ispsx[slot] && !!m_file[slot].Seek(m_chkaddr))
 				m_file[slot].Write(&m_chksum[slot], 8);
@@ -405,6 +430,131 @@ bool FileMemoryCard::Seek(wxFFile& f, u32 adr)
 	return f.Seek(adr + offset);
 }
 
+// Reads data from the card, preferring sectors still sitting in the write journal
+// over the (stale) file contents.
+bool FileMemoryCard::ReadJournaled(uint slot, u8* dest, u32 adr, int size)
+{
+	wxFFile& mcfp(m_file[slot]);
+
+	while (size > 0)
+	{
+		const u32 sector = adr / MC2_SECTOR_SIZE;
+		const u32 offset = adr % MC2_SECTOR_SIZE;
+		const int dataLength = std::min(size, (int)(MC2_SECTOR_SIZE - offset));
+
+		auto it = m_journal[slot].find(sector);
+		if (it != m_journal[slot].end())
+		{
+			memcpy(dest, &it->second.raw[offset], dataLength);
+		}
+		else
+		{
+			if (!Seek(mcfp, adr))
+				return false;
+			if (mcfp.Read(dest, dataLength) == 0)
+				return false;
+		}
+
+		dest += dataLength;
+		adr += dataLength;
+		size -= dataLength;
+	}
+
+	return true;
+}
+
+// Stores data in the slot's write journal instead of the file; the journal is written
+// out a few frames after the game stops writing (see NextFrame), so the actual disk
+// I/O happens outside the SIO interrupt path.
+bool FileMemoryCard::WriteJournaled(uint slot, const u8* src, u32 adr, int size)
+{
+	while (size > 0)
+	{
+		const u32 sector = adr / MC2_SECTOR_SIZE;
+		const u32 offset = adr % MC2_SECTOR_SIZE;
+		const int dataLength = std::min(size, (int)(MC2_SECTOR_SIZE - offset));
+
+		auto it = m_journal[slot].find(sector);
+		if (it == m_journal[slot].end())
+		{
+			McdJournalSector& journaled = m_journal[slot][sector];
+			if (dataLength < MC2_SECTOR_SIZE)
+			{
+				// partial sector write, get the rest of the sector from the file
+				wxFFile& mcfp(m_file[slot]);
+				if (!Seek(mcfp, sector * MC2_SECTOR_SIZE))
+					return false;
+				if (mcfp.Read(&journaled.raw[0], MC2_SECTOR_SIZE) == 0)
+					return false;
+			}
+			memcpy(&journaled.raw[offset], src, dataLength);
+		}
+		else
+		{
+			memcpy(&it->second.raw[offset], src, dataLength);
+		}
+
+		src += dataLength;
+		adr += dataLength;
+		size -= dataLength;
+	}
+
+	m_framesUntilFlush[slot] = FolderMemoryCard::FramesAfterWriteUntilFlush;
+	return true;
+}
+
+// Writes all sectors accumulated in the slot's journal out to the file.  The journal
+// is sorted by sector, so a game save turns into a few large sequential writes instead
+// of hundreds of seek+write pairs.
+bool FileMemoryCard::FlushJournal(uint slot)
+{
+	if (m_journal[slot].empty())
+		return true;
+
+	wxFFile& mcfp(m_file[slot]);
+	if (!mcfp.IsOpened())
+	{
+		m_journal[slot].clear();
+		return false;
+	}
+
+	bool success = true;
+	auto it = m_journal[slot].begin();
+	while (success && it != m_journal[slot].end())
+	{
+		u32 sector = it->first;
+		if (!Seek(mcfp, sector * MC2_SECTOR_SIZE))
+		{
+			success = false;
+			break;
+		}
+
+		// the file position advances on its own, so runs of consecutive sectors
+		// don't need to re-seek
+		do
+		{
+			if (mcfp.Write(&it->second.raw[0], MC2_SECTOR_SIZE) == 0)
+			{
+				success = false;
+				break;
+			}
+			++sector;
+			++it;
+		} while (it != m_journal[slot].end() && it->first == sector);
+	}
+
+	m_journal[slot].clear();
+	return success;
+}
+
+void FileMemoryCard::NextFrame(uint slot)
+{
+	if (m_framesUntilFlush[slot] > 0 && --m_framesUntilFlush[slot] == 0)
+	{
+		FlushJournal(slot);
+	}
+}
+
 // returns FALSE if an error occurred (either permission denied or disk full)
 bool FileMemoryCard::Create(const wxString& mcdFile, uint sizeInMB)
 {
@@ -458,9 +608,7 @@ s32 FileMemoryCard::Read(uint slot, u8* dest, u32 adr, int size)
 		memset(dest, 0, size);
 		return 1;
 	}
-	if (!Seek(mcfp, adr))
-		return 0;
-	return mcfp.Read(dest, size) != 0;
+	return ReadJournaled(slot, dest, adr, size) ? 1 : 0;
 }
 
 s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
@@ -481,10 +629,9 @@ s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
 	}
 	else
 	{
-		if (!Seek(mcfp, adr))
-			return 0;
 		m_currentdata.MakeRoomFor(size);
-		mcfp.Read(m_currentdata.GetPtr(), size);
+		if (!ReadJournaled(slot, m_currentdata.GetPtr(), adr, size))
+			return 0;
 
 
 		for (int i = 0; i < size; i++)
@@ -507,12 +654,7 @@ s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
 		}
 	}
 
-	if (!Seek(mcfp, adr))
-		return 0;
-
-	int status = mcfp.Write(m_currentdata.GetPtr(), size);
-
-	if (status)
+	if (WriteJournaled(slot, m_currentdata.GetPtr(), adr, size))
 	{
 		static auto last = std::chrono::time_point<std::chrono::system_clock>();
 
@@ -540,9 +682,7 @@ s32 FileMemoryCard::EraseBlock(uint slot, u32 adr)
 		return 1;
 	}
 
-	if (!Seek(mcfp, adr))
-		return 0;
-	return mcfp.Write(m_effeffs, sizeof(m_effeffs)) != 0;
+	return WriteJournaled(slot, m_effeffs, adr, sizeof(m_effeffs)) ? 1 : 0;
 }
 
 u64 FileMemoryCard::GetCRC(uint slot)
@@ -555,6 +695,9 @@ u64 FileMemoryCard::GetCRC(uint slot)
 
 	if (m_ispsx[slot])
 	{
+		// the file contents have to be current for this
+		FlushJournal(slot);
+
 		if (!Seek(mcfp, 0))
 			return 0;
 
@@ -741,9 +884,9 @@ void FileMcd_NextFrame(uint port, uint slot)
 	const uint combinedSlot = FileMcd_ConvertToSlot(port, slot);
 	switch (g_Conf->Mcd[combinedSlot].Type)
 	{
-		//case MemoryCardType::MemoryCard_File:
-		//	Mcd::impl.NextFrame( combinedSlot );
-		//	break;
+		case MemoryCardType::MemoryCard_File:
+			Mcd::impl.NextFrame(combinedSlot);
+			break;
 		case MemoryCardType::MemoryCard_Folder:
 			Mcd::implFolder.NextFrame(combinedSlot);
 			break;
@@ -71,6 +71,7 @@ void FolderMemoryCard::InitializeInternalData()
 	memset(&m_fat, 0xFF, sizeof(m_fat));
 	memset(&m_backupBlock1, 0xFF, sizeof(m_backupBlock1));
 	memset(&m_backupBlock2, 0xFF, sizeof(m_backupBlock2));
+	m_freeDataClusterScanStart = 0;
 	m_cache.clear();
 	m_oldDataCache.clear();
 	m_lastAccessedFile.CloseAll();
@@ -303,12 +304,16 @@ u32 FolderMemoryCard::GetFreeDataCluster() const
 {
 	const u32 countDataClusters = GetAmountDataClusters();
 
-	for (unsigned int i = 0; i < countDataClusters; ++i)
+	// during indexing every cluster we hand out is immediately marked as used, so the
+	// scan can resume where the previous one left off instead of re-walking the FAT
+	// from the start for every single cluster of every file
+	for (unsigned int i = m_freeDataClusterScanStart; i < countDataClusters; ++i)
 	{
 		const u32 cluster = m_fat.data[0][0][i];
 
 		if ((cluster & DataClusterInUseMask) == 0)
 		{
+			m_freeDataClusterScanStart = i;
 			return i;
 		}
 	}
@@ -321,7 +326,8 @@ u32 FolderMemoryCard::GetAmountFreeDataClusters() const
 	const u32 countDataClusters = GetAmountDataClusters();
 	u32 countFreeDataClusters = 0;
 
-	for (unsigned int i = 0; i < countDataClusters; ++i)
+	// everything below the scan start position is known to be allocated
+	for (unsigned int i = m_freeDataClusterScanStart; i < countDataClusters; ++i)
 	{
 		const u32 cluster = m_fat.data[0][0][i];
 
@@ -1076,7 +1082,6 @@ void FolderMemoryCard::Flush()
 	}
 
 	const u32 clusterCount = GetSizeInClusters();
-	const u32 pageCount = clusterCount * 2;
 
 	// then write the indirect FAT
 	for (int i = 0; i < IndirectFatClusterCount; ++i)
@@ -1108,9 +1113,11 @@ void FolderMemoryCard::Flush()
 	FlushDeletedFilesAndRemoveUnchangedDataFromCache(oldFileEntryTree);
 
 	// and finally, flush everything that hasn't been flushed yet
-	for (uint i = 0; i < pageCount; ++i)
+	// the cache only ever holds modified pages, so walking it directly touches exactly
+	// the dirty ones instead of probing every page of the card
+	while (!m_cache.empty())
 	{
-		FlushPage(i);
+		FlushPage(m_cache.begin()->first);
 	}
 
 	m_lastAccessedFile.FlushAll();
@@ -334,6 +334,11 @@ protected:
 		u8 raw[BlockSize];
 	} m_backupBlock2;
 
+	// scan start position for GetFreeDataCluster(); while the host directory is being
+	// indexed clusters are only ever allocated, never freed, so every cluster below this
+	// is known to be in use and doesn't have to be re-scanned for each allocation
+	mutable u32 m_freeDataClusterScanStart;
+
 	// stores directory and file metadata
 	std::map<u32, MemoryCardFileEntryCluster> m_fileEntryDict;
 	// quick-access map of related file entry metadata for each memory card FAT cluster that contains file data
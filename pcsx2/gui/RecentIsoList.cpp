@@ -22,6 +22,13 @@
 
 extern wxString GetMsg_IsoImageChanged();
 
+// Runs the existence checks the initial menu population skips; stat'ing every recent
+// entry (possibly on dead network shares) at menu-build time stalls first paint.
+static void RefreshRecentIsoEnables()
+{
+	wxGetApp().GetRecentIsoManager().EnableItems( !g_Conf->AskOnBoot );
+}
+
 // FIXME : This needs to handle removed/missing ISOs somehow, although I'm not sure the
 // best approach.  I think I'd prefer for missing entries to only be removed when they
 // are selected.  This also means we'll need to add some sort of "no current selection"
@@ -43,6 +50,8 @@ RecentIsoManager::RecentIsoManager( wxMenu* menu, int firstIdForMenuItems_or_wxI
 	LoadListFrom(loader);
 
 	Bind(wxEVT_MENU, &RecentIsoManager::OnChangedSelection, this);
+
+	wxGetApp().PostIdleMethod( RefreshRecentIsoEnables );
 }
 
 RecentIsoManager::~RecentIsoManager()
@@ -196,7 +205,9 @@ void RecentIsoManager::InsertIntoMenu( int id )
 	filename.Replace("&", "&&", true);
 
 	curitem.ItemPtr = m_Menu->AppendRadioItem( wxid, filename, curitem.Filename );
-	curitem.ItemPtr->Enable(wxFileExists(curitem.Filename) && !g_Conf->AskOnBoot);
+
+	// Enabled optimistically; the existence check runs at idle (see RefreshRecentIsoEnables).
+	curitem.ItemPtr->Enable( !g_Conf->AskOnBoot );
 }
 
 void RecentIsoManager::EnableItems(bool display)
@@ -15,6 +15,7 @@
 
 #include "PrecompiledHeader.h"
 #include "MemoryTypes.h"
+#include "Memory.h"
 #include "App.h"
 
 #include "System/SysThreads.h"
@@ -23,6 +24,7 @@
 
 #include "ZipTools/ThreadedZipTools.h"
 #include "common/pxStreams.h"
+#include "common/ThreadPool.h"
 #include "SPU2/spu2.h"
 #include "USB/USB.h"
 #ifdef _WIN32
@@ -32,9 +34,15 @@
 #endif
 
 #include "ConsoleLogger.h"
+#include "ps2/BiosTools.h"
 
 #include <wx/wfstream.h>
+#include <wx/mstream.h>
+#include <wx/ffile.h>
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include "Patch.h"
 
@@ -134,6 +142,12 @@ public:
 	virtual void FreezeIn(pxInputStream& reader) const = 0;
 	virtual void FreezeOut(SaveStateBase& writer) const = 0;
 	virtual bool IsRequired() const = 0;
+
+	// Optionally returns a stable external buffer holding this entry's current data, in
+	// which case nothing is serialized into the shared entry list buffer and the archive
+	// references the external memory directly (it must stay valid and unmodified until
+	// compression completes).  Returns NULL to use the regular FreezeOut path.
+	virtual const u8* GetExternalData(uint& size) const { return NULL; }
 };
 
 class MemorySavestateEntry : public BaseSavestateEntry
@@ -172,6 +186,31 @@ void MemorySavestateEntry::FreezeOut(SaveStateBase& writer) const
 	writer.FreezeMem(GetDataPtr(), GetDataSize());
 }
 
+// It's bad mojo to have savestates trying to read and write from the same file at the
+// same time.  To prevent that we use this mutex lock, which is used by both the
+// compression task and the UnzipFromDisk events.  (note that the ZipToDisk event blocks
+// until the compression task has acquired the mutex; preventing the SysExecutor's Idle
+// Event from re-enabing savestates and slots.)
+//
+static Mutex mtx_CompressToDisk;
+
+// Persistent image of EE main memory, maintained incrementally between saves via
+// mmap_SyncRamSnapshot.  The compress thread reads straight out of this buffer (see
+// GetExternalData below), so it may only be touched while mtx_CompressToDisk is held --
+// holding it also guarantees any in-flight compression of the previous save is done.
+static SafeArray<u8> s_eemem_image(L"Savestate EEmem Image");
+
+static const u8* SyncEmotionMemoryImage()
+{
+	ScopedLock lock(mtx_CompressToDisk);
+
+	if (s_eemem_image.GetSizeInBytes() < (int)sizeof(eeMem->Main))
+		s_eemem_image.MakeRoomFor(sizeof(eeMem->Main));
+
+	mmap_SyncRamSnapshot(s_eemem_image.GetPtr());
+	return s_eemem_image.GetPtr();
+}
+
 // --------------------------------------------------------------------------------------
 //  SavestateEntry_* (EmotionMemory, IopMemory, etc)
 // --------------------------------------------------------------------------------------
@@ -195,6 +234,19 @@ public:
 		SysClearExecutionCache();
 		MemorySavestateEntry::FreezeIn(reader);
 	}
+
+	// Main memory is by far the largest part of the state (32MB of ~40), so when the
+	// incremental option is on we keep a persistent copy of it synced via dirty-page
+	// tracking and let the zip thread compress from that, instead of memcpy'ing the
+	// whole thing into the entry list buffer while the core is paused.
+	virtual const u8* GetExternalData(uint& size) const
+	{
+		if (!EmuConfig.IncrementalSavestates)
+			return NULL;
+
+		size = GetDataSize();
+		return SyncEmotionMemoryImage();
+	}
 };
 
 class SavestateEntry_IopMemory : public MemorySavestateEntry
@@ -344,14 +396,6 @@ static const std::unique_ptr<BaseSavestateEntry> SavestateEntries[] = {
 	std::unique_ptr<BaseSavestateEntry>(new SavestateEntry_GS),
 };
 
-// It's bad mojo to have savestates trying to read and write from the same file at the
-// same time.  To prevent that we use this mutex lock, which is used by both the
-// CompressThread and the UnzipFromDisk events.  (note that CompressThread locks the
-// mutex during OnStartInThread, which ensures that the ZipToDisk event blocks; preventing
-// the SysExecutor's Idle Event from re-enabing savestates and slots.)
-//
-static Mutex mtx_CompressToDisk;
-
 static void CheckVersion(pxInputStream& thr)
 {
 	u32 savever;
@@ -419,6 +463,15 @@ protected:
 
 		for (uint i = 0; i < ArraySize(SavestateEntries); ++i)
 		{
+			uint extsize = 0;
+			if (const u8* extdata = SavestateEntries[i]->GetExternalData(extsize))
+			{
+				m_dest_list->Add(ArchiveEntry(SavestateEntries[i]->GetFilename())
+									 .SetExternalData(extdata)
+									 .SetDataSize(extsize));
+				continue;
+			}
+
 			uint startpos = saveme.GetCurrentPos();
 			SavestateEntries[i]->FreezeOut(saveme);
 			m_dest_list->Add(ArchiveEntry(SavestateEntries[i]->GetFilename())
@@ -432,38 +485,6 @@ protected:
 };
 
 
-// --------------------------------------------------------------------------------------
-//  CompressThread_VmState
-// --------------------------------------------------------------------------------------
-class VmStateCompressThread : public BaseCompressThread
-{
-	typedef BaseCompressThread _parent;
-
-protected:
-	ScopedLock m_lock_Compress;
-
-public:
-	VmStateCompressThread()
-	{
-		m_lock_Compress.Assign(mtx_CompressToDisk);
-	}
-
-	virtual ~VmStateCompressThread() = default;
-
-protected:
-	void OnStartInThread()
-	{
-		_parent::OnStartInThread();
-		m_lock_Compress.Acquire();
-	}
-
-	void OnCleanupInThread()
-	{
-		m_lock_Compress.Release();
-		_parent::OnCleanupInThread();
-	}
-};
-
 // --------------------------------------------------------------------------------------
 //  SysExecEvent_ZipToDisk
 // --------------------------------------------------------------------------------------
@@ -514,7 +535,11 @@ protected:
 		pxYield(4);
 
 		// Write the version and screenshot:
-		std::unique_ptr<pxOutputStream> out(new pxOutputStream(tempfile, new wxZipOutputStream(woot)));
+		// Deflate at its fastest setting: savestates are scratch files, and the default
+		// level costs several times the compression time for a few percent of size.  The
+		// compression task holds mtx_CompressToDisk for the duration, so its speed directly
+		// bounds how often states can be saved back-to-back.
+		std::unique_ptr<pxOutputStream> out(new pxOutputStream(tempfile, new wxZipOutputStream(woot, 1)));
 		wxZipOutputStream* gzfp = (wxZipOutputStream*)out->GetWxStreamBase();
 
 		{
@@ -536,13 +561,24 @@ protected:
 			gzfp->CloseEntry();
 		}
 
-		(*new VmStateCompressThread())
-			.SetSource(elist.get())
-			.SetOutStream(out.get())
-			.SetFinishedPath(m_filename)
-			.Start();
-
-		// No errors?  Release cleanup handlers:
+		// The compression task must own mtx_CompressToDisk before this event returns,
+		// so the executor's idle event can't re-enable savestates (or start an unzip)
+		// while the previous save is still being written out.  Hand the acquisition to
+		// the task and block until it reports back.
+		ArchiveEntryList* list = elist.get();
+		pxOutputStream* outstream = out.get();
+		wxString destpath(m_filename);
+
+		Semaphore lock_acquired;
+		Semaphore* started = &lock_acquired;
+		Threading::TaskPool::Get().Enqueue([list, outstream, destpath, started]() {
+			ScopedLock lock(mtx_CompressToDisk);
+			started->Post();
+			CompressArchiveToDisk(list, outstream, destpath);
+		}, true);
+		lock_acquired.WaitWithoutYield();
+
+		// No errors?  The task owns these now; release cleanup handlers:
 		elist.release();
 		out.release();
 	}
@@ -707,6 +743,457 @@ protected:
 	}
 };
 
+// =====================================================================================================
+//  Rewind Ring
+// =====================================================================================================
+// Holds a bounded-memory history of recent machine states.  Every capture interval the
+// full raw state is downloaded (same parts as a disk save) and the *previous* capture is
+// delta-encoded against it: the delta stores just the bytes needed to turn the newer
+// state back into the older one, as skip/copy records over the byte stream.  Since each
+// interval only touches a small fraction of the 40MB state, minutes of history fit in the
+// budget below.  Rewinding pops the newest delta, reconstructs the previous raw state in
+// place, and uploads it into the VM.
+//
+// All ring state below is touched only from the SysExecutor thread (via the two events);
+// other threads just post.
+
+static const uint RewindRingBudget = 256 * _1mb;
+
+struct RewindDelta
+{
+	VmStateBuffer data{L"Rewind Delta"}; // skip/copy records, then the raw old tail (if any)
+	uint reclen; // bytes of skip/copy records within data
+	uint oldlen; // total raw length of the state this delta reconstructs
+	std::vector<uint> oldsizes; // part lengths of that state (internals, then SavestateEntries)
+};
+
+static std::deque<RewindDelta> s_rewind_ring;
+static uint s_rewind_ring_bytes = 0;
+
+// Newest raw capture; the ring's deltas chain backward from it.  Disposed (never
+// allocated) until the first capture lands.
+static VmStateBuffer s_rewind_head(L"Rewind Head");
+static uint s_rewind_head_len = 0;
+static std::vector<uint> s_rewind_head_sizes;
+
+// Recycles the displaced head buffer into the next capture, sparing a 40MB alloc a second.
+static VmStateBuffer s_rewind_spare(L"Rewind Spare");
+
+static std::atomic<bool> s_rewind_busy(false);
+
+static void RewindDestMakeRoom(VmStateBuffer& dest, uint destlen, uint need)
+{
+	// SafeArray reallocs are exact-fit; grow geometrically so encoding isn't O(n^2).
+	if ((int)(destlen + need) > dest.GetSizeInBytes())
+		dest.MakeRoomFor(std::max(destlen + need, destlen + destlen / 2 + 4096));
+}
+
+// Encodes the bytes needed to turn newbuf back into oldbuf: [u32 skip][u32 copylen]
+// [old bytes] records over the common prefix, then (beyond reclen) the raw old tail
+// for any part of oldbuf past the end of newbuf.
+static void RewindEncode(RewindDelta& delta, const u8* oldbuf, uint oldlen, const u8* newbuf, uint newlen)
+{
+	const uint prefix = std::min(oldlen, newlen);
+	VmStateBuffer& dest = delta.data;
+	uint destlen = 0;
+
+	uint pos = 0;
+	uint runstart = 0;
+	while (pos < prefix)
+	{
+		// Skim over the unchanged run a qword at a time.
+		while (pos + 8 <= prefix && *(u64*)(oldbuf + pos) == *(u64*)(newbuf + pos))
+			pos += 8;
+		while (pos < prefix && oldbuf[pos] == newbuf[pos])
+			++pos;
+
+		if (pos == prefix)
+			break;
+
+		const uint skip = pos - runstart;
+
+		// Extend the changed run until a decent (16 byte) unchanged stretch shows up;
+		// shorter gaps aren't worth a record's 8 bytes of overhead.
+		const uint lit = pos;
+		while (pos < prefix)
+		{
+			if (pos + 16 <= prefix && *(u64*)(oldbuf + pos) == *(u64*)(newbuf + pos) && *(u64*)(oldbuf + pos + 8) == *(u64*)(newbuf + pos + 8))
+				break;
+			++pos;
+		}
+		const uint litlen = pos - lit;
+
+		RewindDestMakeRoom(dest, destlen, 8 + litlen);
+		*(u32*)dest.GetPtr(destlen) = skip;
+		*(u32*)dest.GetPtr(destlen + 4) = litlen;
+		memcpy(dest.GetPtr(destlen + 8), oldbuf + lit, litlen);
+		destlen += 8 + litlen;
+
+		runstart = pos;
+	}
+
+	delta.reclen = destlen;
+
+	if (oldlen > prefix)
+	{
+		RewindDestMakeRoom(dest, destlen, oldlen - prefix);
+		memcpy(dest.GetPtr(destlen), oldbuf + prefix, oldlen - prefix);
+	}
+
+	delta.oldlen = oldlen;
+}
+
+// Transforms s_rewind_head (currently the state the delta was encoded against) back into
+// the older state the delta describes.
+static void RewindApply(const RewindDelta& delta)
+{
+	VmStateBuffer& head = s_rewind_head;
+	head.MakeRoomFor(delta.oldlen);
+
+	const u8* rec = delta.data.GetPtr();
+	const uint prefix = std::min(delta.oldlen, s_rewind_head_len);
+
+	uint pos = 0;
+	uint idx = 0;
+	while (idx < delta.reclen)
+	{
+		pos += *(u32*)(rec + idx);
+		const uint copy = *(u32*)(rec + idx + 4);
+		memcpy(head.GetPtr(pos), rec + idx + 8, copy);
+		pos += copy;
+		idx += 8 + copy;
+	}
+
+	if (delta.oldlen > prefix)
+		memcpy(head.GetPtr(prefix), rec + delta.reclen, delta.oldlen - prefix);
+}
+
+// --------------------------------------------------------------------------------------
+//  SysExecEvent_CaptureRewind
+// --------------------------------------------------------------------------------------
+class SysExecEvent_CaptureRewind : public SysExecEvent
+{
+public:
+	wxString GetEventName() const { return L"VM_CaptureRewind"; }
+
+	virtual ~SysExecEvent_CaptureRewind() = default;
+	SysExecEvent_CaptureRewind* Clone() const { return new SysExecEvent_CaptureRewind(*this); }
+
+protected:
+	void InvokeEvent()
+	{
+		// Re-opens the capture gate no matter how we leave (including exceptions).
+		struct BusyGate
+		{
+			~BusyGate() { s_rewind_busy = false; }
+		} gate;
+
+		if (!SysHasValidState())
+			return;
+
+		VmStateBuffer capture(std::move(s_rewind_spare));
+		std::vector<uint> sizes;
+		uint capturelen;
+
+		{
+			ScopedCoreThreadPause paused_core;
+
+			memSavingState saveme(capture);
+			saveme.FreezeBios();
+			saveme.FreezeInternals();
+			sizes.push_back(saveme.GetCurrentPos());
+
+			for (uint i = 0; i < ArraySize(SavestateEntries); ++i)
+			{
+				uint start = saveme.GetCurrentPos();
+				SavestateEntries[i]->FreezeOut(saveme);
+				sizes.push_back(saveme.GetCurrentPos() - start);
+			}
+
+			capturelen = saveme.GetCurrentPos();
+			paused_core.AllowResume();
+		}
+
+		// The delta encode runs after the core resumes; the buffers are ours alone.
+		if (!s_rewind_head.IsDisposed())
+		{
+			RewindDelta delta;
+			delta.oldsizes = s_rewind_head_sizes;
+			RewindEncode(delta, s_rewind_head.GetPtr(), s_rewind_head_len, capture.GetPtr(), capturelen);
+
+			s_rewind_ring_bytes += delta.data.GetSizeInBytes();
+			s_rewind_ring.push_back(std::move(delta));
+
+			while (!s_rewind_ring.empty() && s_rewind_ring_bytes > RewindRingBudget)
+			{
+				s_rewind_ring_bytes -= s_rewind_ring.front().data.GetSizeInBytes();
+				s_rewind_ring.pop_front();
+			}
+
+			s_rewind_spare = std::move(s_rewind_head);
+		}
+
+		s_rewind_head = std::move(capture);
+		s_rewind_head_len = capturelen;
+		s_rewind_head_sizes.swap(sizes);
+	}
+};
+
+// --------------------------------------------------------------------------------------
+//  SysExecEvent_Rewind
+// --------------------------------------------------------------------------------------
+class SysExecEvent_Rewind : public SysExecEvent
+{
+public:
+	wxString GetEventName() const { return L"VM_Rewind"; }
+
+	virtual ~SysExecEvent_Rewind() = default;
+	SysExecEvent_Rewind* Clone() const { return new SysExecEvent_Rewind(*this); }
+
+	bool IsCriticalEvent() const { return true; }
+
+protected:
+	void InvokeEvent()
+	{
+		if (!SysHasValidState() || s_rewind_head.IsDisposed())
+		{
+			Console.WriteLn("(Rewind) No rewind history available.");
+			return;
+		}
+
+		// Jumping to the head already rewinds up to one capture interval; pop a delta on
+		// top of that when the ring has one, so repeated presses keep stepping backward.
+		if (!s_rewind_ring.empty())
+		{
+			RewindDelta delta(std::move(s_rewind_ring.back()));
+			s_rewind_ring.pop_back();
+			s_rewind_ring_bytes -= delta.data.GetSizeInBytes();
+
+			RewindApply(delta);
+			s_rewind_head_len = delta.oldlen;
+			s_rewind_head_sizes = delta.oldsizes;
+		}
+
+		GetCoreThread().Pause({});
+		SysClearExecutionCache();
+
+		const u8* blob = s_rewind_head.GetPtr();
+		uint offset = s_rewind_head_sizes[0];
+
+		for (uint i = 0; i < ArraySize(SavestateEntries); ++i)
+		{
+			const uint partlen = s_rewind_head_sizes[i + 1];
+			if (partlen)
+			{
+				pxInputStream reader(L"Rewind", new wxMemoryInputStream(blob + offset, partlen));
+				SavestateEntries[i]->FreezeIn(reader);
+			}
+			offset += partlen;
+		}
+
+		// Internals last, matching the from-disk load order.
+		VmStateBuffer internals(s_rewind_head_sizes[0], L"Rewind Internals");
+		memcpy(internals.GetPtr(), blob, s_rewind_head_sizes[0]);
+		memLoadingState(internals).FreezeBios().FreezeInternals();
+
+		GetCoreThread().Resume();
+	}
+};
+
+void StateCopy_CaptureRewind()
+{
+	// Drop the tick if the previous capture is still in the executor's queue; history
+	// just gets a slightly longer step, which beats piling up pause requests.
+	if (s_rewind_busy.exchange(true))
+		return;
+
+	GetSysExecutorThread().PostEvent(new SysExecEvent_CaptureRewind());
+}
+
+void StateCopy_Rewind()
+{
+	GetSysExecutorThread().PostEvent(new SysExecEvent_Rewind());
+}
+
+// =====================================================================================================
+//  Boot Template  (per-BIOS fast boot snapshot)
+// =====================================================================================================
+// Fast boot still emulates the whole BIOS bringup (~20 virtual seconds) before EELOAD is
+// reached and the game's ELF name can be injected (see eeloadHook).  The machine state at
+// that point is a function of the BIOS image alone, so it is captured once per BIOS into
+// the cache folder; later fast boots of any game restore the template and resume right at
+// the injection point instead of re-running the bringup.
+
+static const uint BootTemplateParts = 5; // internals + SPU2/PAD/USB/GS
+
+struct BootTemplateHeader
+{
+	u32 savever;
+	u32 bioscheck;
+	u32 partsize[BootTemplateParts];
+};
+
+static wxString GetBootTemplateFilename()
+{
+	return Path::Combine(PathDefs::GetCache().ToString(), pxsFmt(L"biosboot.%08x.raw", BiosChecksum));
+}
+
+// Runs on the EE thread, called from eeloadHook at the injection point.  The EE sits at an
+// instruction boundary there, so its own state can be serialized in place of normal
+// execution; the GS part rides a regular MTGS freeze packet, for which the EE thread is
+// the normal producer (the core-pause wrapper the executor paths use would deadlock here).
+void StateCopy_CaptureBootTemplate()
+{
+	const wxString filename(GetBootTemplateFilename());
+	if (wxFileExists(filename))
+		return;
+
+	try
+	{
+		BootTemplateHeader head = {};
+		head.savever = g_SaveVersion;
+		head.bioscheck = BiosChecksum;
+
+		VmStateBuffer buffer(L"BootTemplate");
+		memSavingState saveme(buffer);
+
+		saveme.FreezeBios();
+		saveme.FreezeMainMemory();
+		saveme.FreezeInternals();
+		head.partsize[0] = saveme.GetCurrentPos();
+
+		const SysState_Component comps[] = {SPU2, PAD, USB};
+		for (uint i = 0; i < ArraySize(comps); ++i)
+		{
+			const uint start = saveme.GetCurrentPos();
+			SysState_ComponentFreezeOut(saveme, comps[i]);
+			head.partsize[1 + i] = saveme.GetCurrentPos() - start;
+		}
+
+		{
+			freezeData fP = {0, NULL};
+			MTGS_FreezeData sstate = {&fP, 0};
+			GetMTGS().Freeze(FreezeAction::Size, sstate);
+			if (sstate.retval == 0 && fP.size > 0)
+			{
+				saveme.PrepBlock(fP.size);
+				fP.data = saveme.GetBlockPtr();
+				GetMTGS().Freeze(FreezeAction::Save, sstate);
+				saveme.CommitBlock(fP.size);
+				head.partsize[4] = fP.size;
+			}
+		}
+
+		PathDefs::GetCache().Mkdir();
+		wxFFile file(filename, L"wb");
+		if (!file.IsOpened())
+			return;
+		if (file.Write(&head, sizeof(head)) != sizeof(head) ||
+			file.Write(buffer.GetPtr(), saveme.GetCurrentPos()) != saveme.GetCurrentPos())
+		{
+			file.Close();
+			wxRemoveFile(filename);
+			return;
+		}
+
+		Console.WriteLn(Color_StrongGreen, "(BootTemplate) Captured post-BIOS boot state (bios crc=0x%08x).", BiosChecksum);
+	}
+	catch (std::runtime_error& ex)
+	{
+		Console.Error("(BootTemplate) Capture failed: %s", ex.what());
+	}
+}
+
+// Validates and uploads a template file.  Caller must have the core thread paused.
+static bool BootTemplateLoad(const wxString& filename)
+{
+	wxFFile file(filename, L"rb");
+	if (!file.IsOpened())
+		return false;
+
+	BootTemplateHeader head;
+	if (file.Read(&head, sizeof(head)) != sizeof(head))
+		return false;
+
+	if (head.savever != g_SaveVersion || head.bioscheck != BiosChecksum)
+	{
+		Console.Warning("(BootTemplate) Cached boot state is stale, ignoring it.");
+		return false;
+	}
+
+	uint total = 0;
+	for (uint i = 0; i < BootTemplateParts; ++i)
+		total += head.partsize[i];
+
+	if (head.partsize[0] == 0 || (uint)file.Length() != sizeof(head) + total)
+		return false;
+
+	VmStateBuffer buffer((int)total, L"BootTemplate");
+	if (file.Read(buffer.GetPtr(), total) != total)
+		return false;
+
+	SysClearExecutionCache();
+
+	// Components first and internals last, mirroring the from-disk load order.
+	const u8* blob = buffer.GetPtr();
+	uint offset = head.partsize[0];
+	const SysState_Component comps[] = {SPU2, PAD, USB, GS};
+	for (uint i = 0; i < ArraySize(comps); ++i)
+	{
+		const uint partlen = head.partsize[1 + i];
+		if (partlen)
+		{
+			pxInputStream reader(L"BootTemplate", new wxMemoryInputStream(blob + offset, partlen));
+			SysState_ComponentFreezeIn(reader, comps[i]);
+		}
+		offset += partlen;
+	}
+
+	VmStateBuffer internals((int)head.partsize[0], L"BootTemplate Internals");
+	memcpy(internals.GetPtr(), blob, head.partsize[0]);
+	memLoadingState(internals).FreezeBios().FreezeMainMemory().FreezeInternals();
+
+	return true;
+}
+
+// Runs on the SysExecutor thread right after a fresh boot was kicked off; if fast boot is
+// enabled and a template exists for the loaded BIOS, the emulated bringup is skipped by
+// uploading the template.  Execution then resumes at the EELOAD hook, which injects the
+// game's ELF name exactly as it would at the end of a full bringup.
+void StateCopy_TryBootTemplate()
+{
+	if (!g_Conf->EmuOptions.UseBOOT2Injection)
+		return;
+
+	// Pausing also guarantees the core finished its reset, so the BIOS is
+	// loaded and its checksum known.
+	GetCoreThread().Pause({});
+
+	bool loaded = false;
+	const wxString filename(GetBootTemplateFilename());
+
+	if (wxFileExists(filename))
+	{
+		try
+		{
+			loaded = BootTemplateLoad(filename);
+		}
+		catch (std::runtime_error& ex)
+		{
+			Console.Error("(BootTemplate) Restore failed: %s", ex.what());
+		}
+		catch (Exception::SaveStateLoadError&)
+		{
+			Console.Error("(BootTemplate) Restore failed: corrupted template, ignoring it.");
+		}
+	}
+
+	if (loaded)
+		Console.WriteLn(Color_StrongGreen, "(BootTemplate) Skipped BIOS bringup using the cached boot state.");
+
+	GetCoreThread().Resume();
+}
+
 // =====================================================================================================
 //  StateCopy Public Interface
 // =====================================================================================================
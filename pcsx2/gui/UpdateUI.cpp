@@ -87,8 +87,9 @@ static void _SaveLoadStuff(bool enabled)
 
 			sMainFrame.EnableMenuItem(slot.load_item_id, !slot.empty);
 			sMainFrame.CheckMenuItem(slot.load_item_id, slot.slot_num == States_GetCurrentSlot());
-			sMainFrame.SetMenuItemLabel(slot.load_item_id, slot.SlotName());
-			sMainFrame.SetMenuItemLabel(slot.save_item_id, slot.SlotName());
+			const wxString name(slot.SlotName());
+			sMainFrame.SetMenuItemLabel(slot.load_item_id, name);
+			sMainFrame.SetMenuItemLabel(slot.save_item_id, name);
 		}
 	}
 	if (crcChanged)
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "common/PersistentThread.h"
+#include "common/mt_queue.h"
 #include "gui/pxEvents.h"
 
 #include <wx/timer.h>
@@ -200,11 +201,15 @@ typedef std::list<SysExecEvent*> pxEvtList;
 class pxEvtQueue
 {
 protected:
-	pxEvtList					m_pendingEvents;
+	// Pending events go through a lock-free queue so producers (GUI thread,
+	// core thread) never stall behind each other or behind event execution.
+	// The idle list is cold and keeps the mutex.
+	MtMpmcQueue<SysExecEvent*, 256>	m_pendingEvents;
 	pxEvtList					m_idleEvents;
 
 	Threading::MutexRecursive	m_mtx_pending;
 	Threading::Semaphore		m_wakeup;
+	std::atomic<bool>			m_wakeup_pending;
 	wxThreadIdType				m_OwnerThreadId;
 	std::atomic<bool>			m_Quitting;
 
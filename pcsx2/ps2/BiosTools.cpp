@@ -175,6 +175,32 @@ void ChecksumIt( u32& result, const u8 (&srcdata)[_size] )
 		result ^= ((u32*)srcdata)[i];
 }
 
+// Loads up to destsize bytes of the given rom file into dest, which must be page
+// aligned (all the eeMem rom regions are).  Where the host supports it the bulk of
+// the file is mapped copy-on-write straight over the region instead of copied, so
+// concurrently running instances share a single page-cache copy of these rather
+// large images.
+static void LoadRomIntoMemory( const wxString& filename, u8* dest, s64 filesize, s64 destsize )
+{
+	const s64 loadsize = std::min( destsize, filesize );
+	const size_t mapsize = (size_t)loadsize & ~(size_t)(__pagesize - 1);
+
+	if( (mapsize == 0) || !HostSys::MmapFilePtr( dest, mapsize, filename ) )
+	{
+		wxFile fp( filename );
+		fp.Read( dest, loadsize );
+		return;
+	}
+
+	if( loadsize > (s64)mapsize )
+	{
+		// the mapping covers whole pages only; read the leftover tail the ordinary way
+		wxFile fp( filename );
+		fp.Seek( mapsize );
+		fp.Read( dest + mapsize, loadsize - mapsize );
+	}
+}
+
 // Attempts to load a BIOS rom sub-component, by trying multiple combinations of base
 // filename and extension.  The bios specified in the user's configuration is used as
 // the base.
@@ -205,8 +231,7 @@ static void LoadExtraRom( const wxChar* ext, u8 (&dest)[_size] )
 			}
 		}
 
-		wxFile fp( Bios1 );
-		fp.Read( dest, std::min<s64>( _size, filesize ) );
+		LoadRomIntoMemory( Bios1, dest, filesize, _size );
 
 		// Checksum for ROM1, ROM2, EROM?  Rama says no, Gigaherz says yes.  I'm not sure either way.  --air
 		//ChecksumIt( BiosChecksum, dest );
@@ -276,8 +301,7 @@ void LoadBIOS()
 		BiosChecksum = 0;
 
 		wxString biosZone;
-		wxFFile fp( Bios , "rb");
-		fp.Read( eeMem->ROM, std::min<s64>( Ps2MemSize::Rom, filesize ) );
+		LoadRomIntoMemory( Bios, eeMem->ROM, filesize, Ps2MemSize::Rom );
 
 		// If file is less than 2mb it doesn't have an OSD (Devel consoles)
 		// So skip HLEing OSDSys Param stuff
@@ -21,6 +21,7 @@
 
 #include "IPU/IPUdma.h"
 #include "ps2/HwInternal.h"
+#include "DebugTools/Tracepoint.h"
 
 bool DMACh::transfer(const char *s, tDMA_TAG* ptag)
 {
@@ -159,8 +160,9 @@ __fi tDMA_TAG* SPRdmaGetAddr(u32 addr, bool write)
 	}
 }
 
-// Note: Dma addresses are guaranteed to be aligned to 16 bytes (128 bits)
-__ri tDMA_TAG *dmaGetAddr(u32 addr, bool write)
+// Out-of-line part of dmaGetAddr (see Dmac.h); the main memory case is
+// handled inline by the caller, everything here is the uncommon stuff.
+__ri tDMA_TAG *_dmaGetAddr(u32 addr, bool write)
 {
 	// if (addr & 0xf) { DMA_LOG("*PCSX2*: DMA address not 128bit aligned: %8.8x", addr); }
 	if (DMA_TAG(addr).SPR) return (tDMA_TAG*)&eeMem->Scratch[addr & 0x3ff0];
@@ -199,6 +201,7 @@ static bool QuickDmaExec( void (*func)(), u32 mem)
 
 	if (reg.chcr.STR && dmacRegs.ctrl.DMAE && !psHu8(DMAC_ENABLER+2))
 	{
+		Tracepoint::Record(TRACE_EE_DMA_START, ChannelNumber(mem), reg.qwc);
 		func();
 		ret = true;
 	}
@@ -286,6 +289,7 @@ static __ri void DmaExec( void (*func)(), u32 mem, u32 value )
 
 	if (reg.chcr.STR && dmacRegs.ctrl.DMAE && !psHu8(DMAC_ENABLER+2))
 	{
+		Tracepoint::Record(TRACE_EE_DMA_START, ChannelNumber(mem), reg.qwc);
 		func();
 	}
 	else if(reg.chcr.STR)
@@ -76,34 +76,63 @@ vtlb_private::VTLBVirtual::VTLBVirtual(VTLBPhysical phys, u32 paddr, u32 vaddr)
 	}
 }
 
-__inline int CheckCache(u32 addr)
+// --------------------------------------------------------------------------------------
+// Cacheable-range summary for the D-cache emulation.
+// --------------------------------------------------------------------------------------
+// CheckCache() runs on every interpreter memory access when cache emulation is
+// enabled; rescanning all 48 TLB entries there (96 range compares) was the main
+// cost of cache-enabled titles.  Instead, keep a compact list of the ranges whose
+// EntryLo cache mode is cacheable (0x3), rebuilt lazily after any TLB change --
+// typically only a handful of entries are mapped cacheable.
+
+struct CacheableRange
+{
+	u32 start, end; // inclusive bounds, same arithmetic as the old per-entry check
+};
+
+static CacheableRange s_cacheRanges[96];
+static int s_cacheRangeCount = -1; // -1: TLB changed, rebuild on next use
+
+void vtlb_InvalidateCacheRanges()
+{
+	s_cacheRangeCount = -1;
+}
+
+static void RebuildCacheableRanges()
 {
-	u32 mask;
+	s_cacheRangeCount = 0;
+	for (int i = 1; i < 48; i++)
+	{
+		if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3)
+		{
+			s_cacheRanges[s_cacheRangeCount].start = tlb[i].PFN1;
+			s_cacheRanges[s_cacheRangeCount].end = tlb[i].PFN1 + tlb[i].PageMask;
+			s_cacheRangeCount++;
+		}
+		if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3)
+		{
+			s_cacheRanges[s_cacheRangeCount].start = tlb[i].PFN0;
+			s_cacheRanges[s_cacheRangeCount].end = tlb[i].PFN0 + tlb[i].PageMask;
+			s_cacheRangeCount++;
+		}
+	}
+}
 
-	if(((cpuRegs.CP0.n.Config >> 16) & 0x1) == 0) 
+__inline int CheckCache(u32 addr)
+{
+	if(((cpuRegs.CP0.n.Config >> 16) & 0x1) == 0)
 	{
 		//DevCon.Warning("Data Cache Disabled! %x", cpuRegs.CP0.n.Config);
 		return false;//
 	}
 
-	for(int i = 1; i < 48; i++)
+	if (s_cacheRangeCount < 0)
+		RebuildCacheableRanges();
+
+	for (int i = 0; i < s_cacheRangeCount; i++)
 	{
-		if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3) {
-			mask  = tlb[i].PageMask;
-			
-			if ((addr >= tlb[i].PFN1) && (addr <= tlb[i].PFN1 + mask)) {
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-				return true;
-			}
-		}
-		if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3) {
-			mask  = tlb[i].PageMask;
-			
-			if ((addr >= tlb[i].PFN0) && (addr <= tlb[i].PFN0 + mask)) {
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-				return true;
-			}
-		}
+		if ((addr >= s_cacheRanges[i].start) && (addr <= s_cacheRanges[i].end))
+			return true;
 	}
 	return false;
 }
@@ -84,6 +84,10 @@ extern void vtlb_VMap(u32 vaddr,u32 paddr,u32 sz);
 extern void vtlb_VMapBuffer(u32 vaddr,void* buffer,u32 sz);
 extern void vtlb_VMapUnmap(u32 vaddr,u32 sz);
 
+// Must be called whenever a TLB entry changes; drops the cached summary of
+// cacheable ranges used by the D-cache emulation's per-access check.
+extern void vtlb_InvalidateCacheRanges();
+
 //Memory functions
 
 template< typename DataType >
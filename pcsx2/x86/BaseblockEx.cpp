@@ -23,6 +23,9 @@ BASEBLOCKEX* BaseBlocks::New(u32 startpc, uptr fnptr)
 	for (linkiter_t i = range.first; i != range.second; ++i)
 		*(u32*)i->second = fnptr - (i->second + 4);
 
+	// Links emitted from here on belong to this block.
+	linkowner = startpc;
+
 	return blocks.insert(startpc, fnptr);
 }
 
@@ -78,5 +81,17 @@ void BaseBlocks::Link(u32 pc, s32* jumpptr)
 		*jumpptr = (s32)(targetblock->fnptr - (sptr)(jumpptr + 1));
 	else
 		*jumpptr = (s32)(recompiler - (sptr)(jumpptr + 1));
-	links.insert(std::pair<u32, uptr>(pc, (uptr)jumpptr));
+	linkiter_t i = links.insert(std::pair<u32, uptr>(pc, (uptr)jumpptr));
+	outlinks.insert(std::pair<u32, linkiter_t>(linkowner, i));
+}
+
+// Drops all link records owned by the block at ownerpc.  Must be called when
+// the block is invalidated, or a later block compiled at one of its targets
+// would patch a jump displacement inside freed (or reallocated) code.
+void BaseBlocks::Unlink(u32 ownerpc)
+{
+	std::pair<outlinkiter_t, outlinkiter_t> range = outlinks.equal_range(ownerpc);
+	for (outlinkiter_t i = range.first; i != range.second; ++i)
+		links.erase(i->second);
+	outlinks.erase(range.first, range.second);
 }
@@ -35,6 +35,7 @@ struct BASEBLOCKEX
 	uptr fnptr;
 	u16 size;    // The size in dwords (equivalent to the number of instructions)
 	u16 x86size; // The size in byte of the translated x86 instructions
+	u16 dead;    // block was invalidated; the entry awaits lazy reclamation
 
 #ifdef PCSX2_DEVBUILD
 	// Could be useful to instrument the block
@@ -47,6 +48,7 @@ class BaseBlockArray
 {
 	s32 _Reserved;
 	s32 _Size;
+	s32 _DeadCount;
 	BASEBLOCKEX* blocks;
 
 	__fi void resize(s32 size)
@@ -78,13 +80,39 @@ public:
 	BaseBlockArray(s32 size)
 		: _Reserved(0)
 		, _Size(0)
+		, _DeadCount(0)
 		, blocks(NULL)
 	{
 		reserve(size);
 	}
 
+	// Reclaims the entries of invalidated blocks in one pass.  Only called from
+	// insert(), which is the one point where no caller can be holding an index
+	// or pointer into the array across the operation (they are re-fetched after
+	// every insert, same as for the reserve() above).
+	void compact()
+	{
+		s32 dst = 0;
+		for (s32 i = 0; i < _Size; i++)
+		{
+			if (blocks[i].dead)
+				continue;
+			if (dst != i)
+				blocks[dst] = blocks[i];
+			dst++;
+		}
+		_Size = dst;
+		_DeadCount = 0;
+	}
+
 	BASEBLOCKEX* insert(u32 startpc, uptr fnptr)
 	{
+		// Reclaim dead entries in bulk once enough pile up; clearing itself only
+		// marks them, so heavy invalidators (overlay loads) don't pay a tail
+		// memmove per cleared block.
+		if (_DeadCount >= 0x400)
+			compact();
+
 		if (_Size + 1 >= _Reserved)
 		{
 			reserve(_Reserved + 0x2000); // some games requires even more!
@@ -127,6 +155,7 @@ public:
 	void clear()
 	{
 		_Size = 0;
+		_DeadCount = 0;
 	}
 
 	__fi u32 size() const
@@ -134,16 +163,19 @@ public:
 		return _Size;
 	}
 
+	// Lazily removes [first, last) by flagging the entries dead, keeping the
+	// array sorted without shifting the tail down on every invalidation.  The
+	// entries are reclaimed in bulk by compact().
 	__fi void erase(s32 first, s32 last)
 	{
-		int range = last - first;
-
-		if (last < _Size)
+		for (s32 i = first; i < last; i++)
 		{
-			memmove(blocks + first, blocks + last, (_Size - last) * sizeof(BASEBLOCKEX));
+			if (!blocks[i].dead)
+			{
+				blocks[i].dead = 1;
+				_DeadCount++;
+			}
 		}
-
-		_Size -= range;
 	}
 };
 
@@ -151,15 +183,27 @@ class BaseBlocks
 {
 protected:
 	typedef std::multimap<u32, uptr>::iterator linkiter_t;
+	typedef std::multimap<u32, linkiter_t>::iterator outlinkiter_t;
 
 	// switch to a hash map later?
 	std::multimap<u32, uptr> links;
+
+	// Outgoing patch list per block: maps the owning block's startpc to its
+	// entries in 'links', so invalidating a block can retire the patch sites
+	// that live inside its (about to be reused) x86 code.
+	std::multimap<u32, linkiter_t> outlinks;
+
+	// startpc of the block currently being compiled; all Link() calls between
+	// one New() and the next belong to it.
+	u32 linkowner;
+
 	uptr recompiler;
 	BaseBlockArray blocks;
 
 public:
 	BaseBlocks()
-		: recompiler(0)
+		: linkowner(0)
+		, recompiler(0)
 		, blocks(0x4000)
 	{
 	}
@@ -177,6 +221,11 @@ public:
 	{
 		int idx = LastIndex(startpc);
 
+		// Skip over entries that were invalidated but not yet reclaimed; the
+		// run of dead entries is bounded by the compaction threshold.
+		while ((idx != -1) && blocks[idx].dead)
+			idx--;
+
 		if ((idx == -1) || (startpc < blocks[idx].startpc) ||
 			((blocks[idx].size) && (startpc >= blocks[idx].startpc + blocks[idx].size * 4)))
 			return -1;
@@ -205,6 +254,11 @@ public:
 		{
 			pxAssert(idx <= last);
 
+			// Entries invalidated on an earlier pass were already processed (and
+			// a newer block may have since claimed the same startpc's links).
+			if (blocks[idx].dead)
+				continue;
+
 			//u32 startpc = blocks[idx].startpc;
 			std::pair<linkiter_t, linkiter_t> range = links.equal_range(blocks[idx].startpc);
 			for (linkiter_t i = range.first; i != range.second; ++i)
@@ -222,16 +276,26 @@ public:
 			}
 		} while (idx++ < last);
 
-		// TODO: remove links from this block?
+		// Retire the outgoing links owned by the removed blocks, since their
+		// patch sites are about to become dead (and later reused) code memory.
+		for (idx = first; idx <= last; idx++)
+		{
+			if (!blocks[idx].dead)
+				Unlink(blocks[idx].startpc);
+		}
+
 		blocks.erase(first, last + 1);
 	}
 
 	void Link(u32 pc, s32* jumpptr);
+	void Unlink(u32 ownerpc);
 
 	__fi void Reset()
 	{
 		blocks.clear();
 		links.clear();
+		outlinks.clear();
+		linkowner = 0;
 	}
 };
 
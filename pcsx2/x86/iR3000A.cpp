@@ -870,10 +870,15 @@ static __fi u32 psxRecClearMem(u32 pc)
 
 	while (BASEBLOCKEX* pexblock = recBlocks[blockidx - 1])
 	{
-		if (pexblock->startpc + pexblock->size * 4 <= lowerextent)
-			break;
+		// dead entries neither bound the clear nor contribute extents; they
+		// just ride along in the removal range below.
+		if (!pexblock->dead)
+		{
+			if (pexblock->startpc + pexblock->size * 4 <= lowerextent)
+				break;
 
-		lowerextent = std::min(lowerextent, pexblock->startpc);
+			lowerextent = std::min(lowerextent, pexblock->startpc);
+		}
 		blockidx--;
 	}
 
@@ -881,12 +886,14 @@ static __fi u32 psxRecClearMem(u32 pc)
 
 	while (BASEBLOCKEX* pexblock = recBlocks[blockidx])
 	{
-		if (pexblock->startpc >= upperextent)
-			break;
-
-		lowerextent = std::min(lowerextent, pexblock->startpc);
-		upperextent = std::max(upperextent, pexblock->startpc + pexblock->size * 4);
+		if (!pexblock->dead)
+		{
+			if (pexblock->startpc >= upperextent)
+				break;
 
+			lowerextent = std::min(lowerextent, pexblock->startpc);
+			upperextent = std::max(upperextent, pexblock->startpc + pexblock->size * 4);
+		}
 		blockidx++;
 	}
 
@@ -895,13 +902,20 @@ static __fi u32 psxRecClearMem(u32 pc)
 		recBlocks.Remove(toRemoveFirst, (blockidx - 1));
 	}
 
-	blockidx = 0;
-	while (BASEBLOCKEX* pexblock = recBlocks[blockidx++])
+	// Sanity check only; scanning the whole block array per clear is too
+	// expensive for release builds.
+	if (IsDevBuild)
 	{
-		if (pc >= pexblock->startpc && pc < pexblock->startpc + pexblock->size * 4)
+		blockidx = 0;
+		while (BASEBLOCKEX* pexblock = recBlocks[blockidx++])
 		{
-			DevCon.Error("[IOP] Impossible block clearing failure");
-			pxFailDev("[IOP] Impossible block clearing failure");
+			if (pexblock->dead)
+				continue;
+			if (pc >= pexblock->startpc && pc < pexblock->startpc + pexblock->size * 4)
+			{
+				DevCon.Error("[IOP] Impossible block clearing failure");
+				pxFailDev("[IOP] Impossible block clearing failure");
+			}
 		}
 	}
 
@@ -1164,6 +1178,13 @@ void psxRecMemcheck(u32 op, u32 bits, bool store)
 	// ecx = access address
 	// edx = access address+size
 
+	// Skip the whole compare chain when the accessed page holds no watchpoint,
+	// the overwhelmingly common case.
+	xMOV(eax, ecx);
+	xSHR(eax, 12);
+	xBT(ptr32[CBreakPoints::GetMemCheckPageMask(BREAKPOINT_IOP)], eax);
+	xForwardJNC32 skipChecks;
+
 	auto checks = CBreakPoints::GetMemChecks();
 	for (size_t i = 0; i < checks.size(); i++)
 	{
@@ -1200,6 +1221,8 @@ void psxRecMemcheck(u32 op, u32 bits, bool store)
 		next1.SetTarget();
 		next2.SetTarget();
 	}
+
+	skipChecks.SetTarget();
 	// get out of here
 	xCMP(ptr8[&iopBreakpoint], 0);
 	xJNE(iopExitRecompiledCode);
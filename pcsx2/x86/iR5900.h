@@ -70,6 +70,10 @@ void SaveBranchState();
 void LoadBranchState();
 
 void recompileNextInstruction(int delayslot);
+
+// Backwards liveness propagation over one instruction, used by the hot-block
+// (second tier) compile pass.  Defined in ir5900tables.cpp.
+void recBackpropBSC(EEINST* prev, EEINST* pinst);
 void SetBranchReg(u32 reg);
 void SetBranchImm(u32 imm);
 
@@ -33,3 +33,369 @@
 #include "iMMI.h"
 #include "iFPU.h"
 #include "iCOP0.h"
+
+////////////////////////////////////////////////
+// Back-Prop Function Tables - Gathering Info //
+////////////////////////////////////////////////
+//
+// Backwards liveness propagation for the hot-block (second tier) compile pass.
+// This mirrors rpsxpropBSC in iR3000Atables.cpp, extended with the EE's wide
+// registers: EEINST_LIVE0 tracks the low 64 bits of a GPR and EEINST_LIVE2 the
+// upper 64 bits, which only full-width ops (LQ/SQ/QMFC2/QMTC2 and the MMI set)
+// touch.  Anything we don't model (COP0 control ops, MMI, traps, syscalls)
+// conservatively resets the whole state to live, which is always safe - it
+// merely costs optimization opportunities.
+
+#define recpropSetRead(reg, mask) \
+	{ \
+		if (!(pinst->regs[reg] & EEINST_USED)) \
+			pinst->regs[reg] |= EEINST_LASTUSE; \
+		prev->regs[reg] |= EEINST_LIVE0 | (mask) | EEINST_USED; \
+		pinst->regs[reg] |= EEINST_USED; \
+		_recFillRegister(*pinst, XMMTYPE_GPRREG, reg, 0); \
+	}
+
+#define recpropSetWrite(reg, mask) \
+	{ \
+		prev->regs[reg] &= ~(EEINST_LIVE0 | (mask)); \
+		if (!(pinst->regs[reg] & EEINST_USED)) \
+			pinst->regs[reg] |= EEINST_LASTUSE; \
+		pinst->regs[reg] |= EEINST_USED; \
+		prev->regs[reg] |= EEINST_USED; \
+		_recFillRegister(*pinst, XMMTYPE_GPRREG, reg, 1); \
+	}
+
+// Unmodeled instruction: forget everything we know (all registers live).
+static void recpropClear(EEINST* prev)
+{
+	_recClearInst(prev);
+	prev->info = 0;
+}
+
+static void recpropSPECIAL(EEINST* prev, EEINST* pinst)
+{
+	switch (_Funct_)
+	{
+		case 0: // sll
+		case 2: // srl
+		case 3: // sra
+		case 56: // dsll
+		case 58: // dsrl
+		case 59: // dsra
+		case 60: // dsll32
+		case 62: // dsrl32
+		case 63: // dsra32
+			recpropSetWrite(_Rd_, 0);
+			recpropSetRead(_Rt_, 0);
+			break;
+
+		case 4: // sllv
+		case 6: // srlv
+		case 7: // srav
+		case 20: // dsllv
+		case 22: // dsrlv
+		case 23: // dsrav
+			recpropSetWrite(_Rd_, 0);
+			recpropSetRead(_Rs_, 0);
+			recpropSetRead(_Rt_, 0);
+			break;
+
+		case 8: // jr
+			recpropSetRead(_Rs_, 0);
+			break;
+		case 9: // jalr
+			recpropSetWrite(_Rd_, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 10: // movz
+		case 11: // movn
+			// conditional moves also read rd (it may keep its old value)
+			recpropSetWrite(_Rd_, 0);
+			recpropSetRead(_Rd_, 0);
+			recpropSetRead(_Rs_, 0);
+			recpropSetRead(_Rt_, 0);
+			break;
+
+		case 15: // sync
+			break;
+
+		case 16: // mfhi
+			recpropSetWrite(_Rd_, 0);
+			recpropSetRead(XMMGPR_HI, 0);
+			break;
+		case 17: // mthi
+			recpropSetWrite(XMMGPR_HI, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+		case 18: // mflo
+			recpropSetWrite(_Rd_, 0);
+			recpropSetRead(XMMGPR_LO, 0);
+			break;
+		case 19: // mtlo
+			recpropSetWrite(XMMGPR_LO, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 24: // mult
+		case 25: // multu
+			recpropSetWrite(XMMGPR_LO, 0);
+			recpropSetWrite(XMMGPR_HI, 0);
+			if (_Rd_)
+				recpropSetWrite(_Rd_, 0);
+			recpropSetRead(_Rs_, 0);
+			recpropSetRead(_Rt_, 0);
+			break;
+		case 26: // div
+		case 27: // divu
+			recpropSetWrite(XMMGPR_LO, 0);
+			recpropSetWrite(XMMGPR_HI, 0);
+			recpropSetRead(_Rs_, 0);
+			recpropSetRead(_Rt_, 0);
+			break;
+
+		case 32: // add
+		case 33: // addu
+		case 34: // sub
+		case 35: // subu
+		case 36: // and
+		case 37: // or
+		case 38: // xor
+		case 39: // nor
+		case 42: // slt
+		case 43: // sltu
+		case 44: // dadd
+		case 45: // daddu
+		case 46: // dsub
+		case 47: // dsubu
+			recpropSetWrite(_Rd_, 0);
+			recpropSetRead(_Rs_, 0);
+			recpropSetRead(_Rt_, 0);
+			break;
+
+		case 40: // mfsa
+			recpropSetWrite(_Rd_, 0);
+			break;
+		case 41: // mtsa
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		default:
+			// syscall, break, traps, and anything else unexpected
+			recpropClear(prev);
+			break;
+	}
+}
+
+static void recpropREGIMM(EEINST* prev, EEINST* pinst)
+{
+	switch (_Rt_)
+	{
+		case 0: // bltz
+		case 1: // bgez
+		case 2: // bltzl
+		case 3: // bgezl
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 16: // bltzal
+		case 17: // bgezal
+		case 18: // bltzall
+		case 19: // bgezall
+			recpropSetWrite(31, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 24: // mtsab
+		case 25: // mtsah
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		default: // traps
+			recpropClear(prev);
+			break;
+	}
+}
+
+static void recpropCOP0(EEINST* prev, EEINST* pinst)
+{
+	switch (_Rs_)
+	{
+		case 0: // mfc0
+			recpropSetWrite(_Rt_, 0);
+			break;
+		case 4: // mtc0
+			recpropSetRead(_Rt_, 0);
+			break;
+		case 8: // bc0
+			break;
+		default: // tlb ops, eret, ei/di
+			recpropClear(prev);
+			break;
+	}
+}
+
+static void recpropCOP1(EEINST* prev, EEINST* pinst)
+{
+	// Only the GPR side is modeled here; fpuregs stay at their conservative
+	// all-live initialization, so FPU codegen behaves exactly as before.
+	switch (_Rs_)
+	{
+		case 0: // mfc1
+		case 2: // cfc1
+			recpropSetWrite(_Rt_, 0);
+			break;
+		case 4: // mtc1
+		case 6: // ctc1
+			recpropSetRead(_Rt_, 0);
+			break;
+		default: // bc1 and fpu arithmetic - no GPRs involved
+			break;
+	}
+}
+
+static void recpropCOP2(EEINST* prev, EEINST* pinst)
+{
+	// GPR side only; the VU0f/VI registers have their own analysis (vuregs).
+	switch (_Rs_)
+	{
+		case 1: // qmfc2
+			recpropSetWrite(_Rt_, EEINST_LIVE2);
+			break;
+		case 2: // cfc2
+			recpropSetWrite(_Rt_, 0);
+			break;
+		case 5: // qmtc2
+			recpropSetRead(_Rt_, EEINST_LIVE2);
+			break;
+		case 6: // ctc2
+			recpropSetRead(_Rt_, 0);
+			break;
+		default: // bc2 and VU0 macro ops - no GPRs involved
+			break;
+	}
+}
+
+void recBackpropBSC(EEINST* prev, EEINST* pinst)
+{
+	switch (cpuRegs.code >> 26)
+	{
+		case 0:
+			recpropSPECIAL(prev, pinst);
+			break;
+		case 1:
+			recpropREGIMM(prev, pinst);
+			break;
+
+		case 2: // j
+			break;
+		case 3: // jal
+			recpropSetWrite(31, 0);
+			break;
+
+		case 4: // beq
+		case 5: // bne
+		case 20: // beql
+		case 21: // bnel
+			recpropSetRead(_Rs_, 0);
+			recpropSetRead(_Rt_, 0);
+			break;
+
+		case 6: // blez
+		case 7: // bgtz
+		case 22: // blezl
+		case 23: // bgtzl
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 8: // addi
+		case 9: // addiu
+		case 10: // slti
+		case 11: // sltiu
+		case 12: // andi
+		case 13: // ori
+		case 14: // xori
+		case 24: // daddi
+		case 25: // daddiu
+			recpropSetWrite(_Rt_, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 15: // lui
+			recpropSetWrite(_Rt_, 0);
+			break;
+
+		case 16:
+			recpropCOP0(prev, pinst);
+			break;
+		case 17:
+			recpropCOP1(prev, pinst);
+			break;
+		case 18:
+			recpropCOP2(prev, pinst);
+			break;
+
+		// loads
+		case 32: // lb
+		case 33: // lh
+		case 35: // lw
+		case 36: // lbu
+		case 37: // lhu
+		case 39: // lwu
+		case 55: // ld
+			recpropSetWrite(_Rt_, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 26: // ldl
+		case 27: // ldr
+		case 34: // lwl
+		case 38: // lwr
+			// merge loads: rt is both source and destination
+			recpropSetWrite(_Rt_, 0);
+			recpropSetRead(_Rt_, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 30: // lq
+			recpropSetWrite(_Rt_, EEINST_LIVE2);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		// stores
+		case 40: // sb
+		case 41: // sh
+		case 42: // swl
+		case 43: // sw
+		case 44: // sdl
+		case 45: // sdr
+		case 46: // swr
+		case 63: // sd
+			recpropSetRead(_Rt_, 0);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 31: // sq
+			recpropSetRead(_Rt_, EEINST_LIVE2);
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 47: // cache
+		case 51: // pref
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		case 49: // lwc1
+		case 57: // swc1
+		case 54: // lqc2
+		case 62: // sqc2
+			// only the base address lives in a GPR
+			recpropSetRead(_Rs_, 0);
+			break;
+
+		default:
+			// MMI and anything unexpected: play it safe
+			recpropClear(prev);
+			break;
+	}
+}
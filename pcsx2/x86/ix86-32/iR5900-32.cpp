@@ -34,6 +34,10 @@
 
 #include "DebugTools/Breakpoints.h"
 #include "Patch.h"
+#include "PathDefs.h"
+
+#include <wx/ffile.h>
+#include <wx/log.h>
 
 #if !PCSX2_SEH
 	#include <csetjmp>
@@ -43,6 +47,8 @@
 #include "common/MemsetFast.inl"
 #include "common/Perf.h"
 
+#include <unordered_set>
+
 
 using namespace x86Emitter;
 using namespace R5900;
@@ -104,6 +110,108 @@ static EEINST* s_psaveInstInfo = NULL;
 
 static u32 s_savenBlockCycles = 0;
 
+// Tiered compilation: blocks first compile through the cheap baseline path and
+// carry a small execution counter; when a counter trips its threshold the block
+// is cleared and recompiled with the (more expensive) hot-block liveness pass
+// enabled.  The counters are kept in a hashed side table rather than in
+// BASEBLOCKEX, since that array is memmove'd on insertion and generated code
+// must never reference it directly.  A collision merely promotes a block early.
+static const u32 HOTBLOCK_THRESHOLD = 0x200;
+static u16 s_blockHeat[0x4000];
+static std::unordered_set<u32> s_hotBlocks;
+static bool s_recompilingHot = false;
+
+static __fi u16* hotblockCounter(u32 hwpc)
+{
+	return &s_blockHeat[(hwpc >> 2) & (ArraySize(s_blockHeat) - 1)];
+}
+
+static void hotblockResetCounters()
+{
+	// Counters count up and promote on 16-bit carry, so "zero" is the
+	// threshold's distance from the wrap point.
+	for (uint i = 0; i < ArraySize(s_blockHeat); i++)
+		s_blockHeat[i] = (u16)(0x10000 - HOTBLOCK_THRESHOLD);
+}
+
+// --------------------------------------------------------------------------------------
+//  Persistent hot-block cache
+// --------------------------------------------------------------------------------------
+// The promoted (hot) block set is saved per game, keyed on the ELF CRC, so a
+// later boot of the same game precompiles its known-hot set right after the ELF
+// becomes resident instead of lazily faulting each block through JITCompile and
+// recompiling it a second time on promotion.
+
+static const u32 HOTBLOCK_CACHE_MAGIC   = 0x43423250; // 'P2BC'
+static const u32 HOTBLOCK_CACHE_VERSION = 1;
+
+static u32 s_hotBlockCacheCRC = 0;           // game the current s_hotBlocks set belongs to
+static bool s_hotBlockPrecompilePending = false;
+static bool s_hotBlockPrecompiling = false;
+
+static wxString hotblockCacheFilename(u32 crc)
+{
+	return Path::Combine(PathDefs::GetCache().ToString(), pxsFmt(L"%08x.eeblocks", crc));
+}
+
+static void eeRecSaveHotBlockCache()
+{
+	if (!s_hotBlockCacheCRC || s_hotBlocks.empty())
+		return;
+
+	PathDefs::GetCache().Mkdir();
+
+	wxFFile f(hotblockCacheFilename(s_hotBlockCacheCRC), L"wb");
+	if (!f.IsOpened())
+		return;
+
+	u32 header[3] = {HOTBLOCK_CACHE_MAGIC, HOTBLOCK_CACHE_VERSION, (u32)s_hotBlocks.size()};
+	f.Write(header, sizeof(header));
+	for (u32 blockpc : s_hotBlocks)
+		f.Write(&blockpc, sizeof(blockpc));
+
+	DevCon.WriteLn("EE block cache: saved %d hot blocks for %08x", (int)s_hotBlocks.size(), s_hotBlockCacheCRC);
+}
+
+static void eeRecLoadHotBlockCache()
+{
+	if (ElfCRC == s_hotBlockCacheCRC)
+		return; // rebooting the same game -- keep the warm set
+
+	// persist whatever the previous game collected before switching sets
+	eeRecSaveHotBlockCache();
+
+	s_hotBlocks.clear();
+	s_hotBlockCacheCRC = ElfCRC;
+
+	wxFFile f;
+	{
+		wxLogNull silence; // missing cache file is the common case
+		if (!f.Open(hotblockCacheFilename(ElfCRC), L"rb"))
+			return;
+	}
+
+	u32 header[3];
+	if (f.Read(header, sizeof(header)) != sizeof(header)
+	 || header[0] != HOTBLOCK_CACHE_MAGIC || header[1] != HOTBLOCK_CACHE_VERSION)
+	{
+		Console.Warning("EE block cache: discarding unusable cache for %08x", ElfCRC);
+		return;
+	}
+
+	for (u32 i = 0; i < header[2]; i++)
+	{
+		u32 blockpc;
+		if (f.Read(&blockpc, sizeof(blockpc)) != sizeof(blockpc))
+			break;
+		if (blockpc && !(blockpc & 3))
+			s_hotBlocks.insert(blockpc);
+	}
+
+	s_hotBlockPrecompilePending = !s_hotBlocks.empty();
+	Console.WriteLn("EE block cache: loaded %d hot blocks for %08x", (int)s_hotBlocks.size(), ElfCRC);
+}
+
 #ifdef PCSX2_DEBUG
 static u32 dumplog = 0;
 #else
@@ -659,6 +767,10 @@ static void recResetRaw()
 	recBlocks.Reset();
 	mmap_ResetBlockTracking();
 
+	// Promotion counters restart, but blocks already known to be hot stay in
+	// s_hotBlocks so they recompile straight into the optimizing tier.
+	hotblockResetCounters();
+
 	x86SetPtr(*recMem);
 
 	recPtr = *recMem;
@@ -671,6 +783,8 @@ static void recResetRaw()
 
 static void recShutdown()
 {
+	eeRecSaveHotBlockCache();
+
 	safe_delete(recMem);
 	safe_aligned_free(recRAMCopy);
 	safe_aligned_free(recLutReserve_RAM);
@@ -845,6 +959,14 @@ void recClear(u32 addr, u32 size)
 
 	while (pexblock = recBlocks[blockidx])
 	{
+		// Already-invalidated entries neither bound the clear nor need their
+		// extents accumulated; they just ride along in the removal range.
+		if (pexblock->dead)
+		{
+			blockidx--;
+			continue;
+		}
+
 		u32 blockstart = pexblock->startpc;
 		u32 blockend = pexblock->startpc + pexblock->size * 4;
 		BASEBLOCK* pblock = PC_GETBLOCK(blockstart);
@@ -881,18 +1003,23 @@ void recClear(u32 addr, u32 size)
 
 	upperextent = std::min(upperextent, ceiling);
 
-	for (int i = 0; pexblock = recBlocks[i]; i++)
+	// Sanity check only: a full scan of the block array on every clear is far
+	// too expensive to leave in release builds, where code-writing games clear
+	// thousands of times per frame.
+	if (IsDevBuild)
 	{
-		if (s_pCurBlock == PC_GETBLOCK(pexblock->startpc))
-			continue;
-		u32 blockend = pexblock->startpc + pexblock->size * 4;
-		if (pexblock->startpc >= addr && pexblock->startpc < addr + size * 4
-		 || pexblock->startpc < addr && blockend > addr)
+		for (int i = 0; pexblock = recBlocks[i]; i++)
 		{
-			if (!IsDevBuild)
-				Console.Error("[EE] Impossible block clearing failure");
-			else
+			if (pexblock->dead)
+				continue;
+			if (s_pCurBlock == PC_GETBLOCK(pexblock->startpc))
+				continue;
+			u32 blockend = pexblock->startpc + pexblock->size * 4;
+			if (pexblock->startpc >= addr && pexblock->startpc < addr + size * 4
+			 || pexblock->startpc < addr && blockend > addr)
+			{
 				pxFailDev("[EE] Impossible block clearing failure");
+			}
 		}
 	}
 
@@ -1131,11 +1258,24 @@ static void iBranchTest(u32 newpc)
 
 	if (EmuConfig.Speedhacks.WaitLoop && s_nBlockFF && newpc == s_branchTo)
 	{
+		// Fast-forward the idle loop in whole iterations, so the cycle counter ends
+		// up exactly where it would have after spinning until the event fired.
+		// (scaleblockcycles() never returns less than 1, so the divisor is safe.)
+		const u32 blockcycles = scaleblockcycles();
+
 		xMOV(eax, ptr32[&g_nextEventCycle]);
-		xADD(ptr32[&cpuRegs.cycle], scaleblockcycles());
-		xCMP(eax, ptr32[&cpuRegs.cycle]);
-		xCMOVS(eax, ptr32[&cpuRegs.cycle]);
-		xMOV(ptr32[&cpuRegs.cycle], eax);
+		xADD(ptr32[&cpuRegs.cycle], blockcycles);
+		xSUB(eax, ptr32[&cpuRegs.cycle]);
+		xForwardJS8 eventPending; // event is already due; nothing to skip
+		// Round the remaining cycles up to a whole number of iterations so the
+		// loop always runs past the event and exits.
+		xADD(eax, blockcycles - 1);
+		xXOR(edx, edx);
+		xMOV(ecx, blockcycles);
+		xUDIV(ecx);
+		xUMUL(ecx);
+		xADD(ptr32[&cpuRegs.cycle], eax);
+		eventPending.SetTarget();
 
 		xJMP((void*)DispatcherEvent);
 	}
@@ -1338,6 +1478,14 @@ void recMemcheck(u32 op, u32 bits, bool store)
 	// ecx = access address
 	// edx = access address+size
 
+	// Skip the whole compare chain when the accessed page holds no watchpoint,
+	// which is the overwhelmingly common case.  This keeps games near full rec
+	// speed while something is being watched.
+	xMOV(eax, ecx);
+	xSHR(eax, 12);
+	xBT(ptr32[CBreakPoints::GetMemCheckPageMask(BREAKPOINT_EE)], eax);
+	xForwardJNC32 skipChecks;
+
 	auto checks = CBreakPoints::GetMemChecks();
 	for (size_t i = 0; i < checks.size(); i++)
 	{
@@ -1374,6 +1522,8 @@ void recMemcheck(u32 op, u32 bits, bool store)
 		next1.SetTarget();
 		next2.SetTarget();
 	}
+
+	skipChecks.SetTarget();
 }
 
 void encodeBreakpoint()
@@ -1415,6 +1565,42 @@ void encodeMemcheck()
 	}
 }
 
+// If the current instruction is a plain register computation -- no memory
+// access, no branch, no HI/LO update and no exception (integer overflow is not
+// implemented by the rec) -- returns the GPR it writes, else 0.  Used to drop
+// instructions whose result is overwritten before ever being read.
+static int recPureGPRWrite()
+{
+	switch (_Opcode_)
+	{
+		case 0: // SPECIAL
+			switch (_Funct_)
+			{
+				case 0x00: case 0x02: case 0x03:            // SLL/SRL/SRA
+				case 0x04: case 0x06: case 0x07:            // SLLV/SRLV/SRAV
+				case 0x0a: case 0x0b:                       // MOVZ/MOVN
+				case 0x10: case 0x12:                       // MFHI/MFLO
+				case 0x14: case 0x16: case 0x17:            // DSLLV/DSRLV/DSRAV
+				case 0x20: case 0x21: case 0x22: case 0x23: // ADD/ADDU/SUB/SUBU
+				case 0x24: case 0x25: case 0x26: case 0x27: // AND/OR/XOR/NOR
+				case 0x2a: case 0x2b:                       // SLT/SLTU
+				case 0x2c: case 0x2d: case 0x2e: case 0x2f: // DADD/DADDU/DSUB/DSUBU
+				case 0x38: case 0x3a: case 0x3b:            // DSLL/DSRL/DSRA
+				case 0x3c: case 0x3e: case 0x3f:            // DSLL32/DSRL32/DSRA32
+					return _Rd_;
+			}
+			return 0;
+
+		case 8: case 9:             // ADDI/ADDIU
+		case 10: case 11:           // SLTI/SLTIU
+		case 12: case 13: case 14:  // ANDI/ORI/XORI
+		case 15:                    // LUI
+		case 24: case 25:           // DADDI/DADDIU
+			return _Rt_;
+	}
+	return 0;
+}
+
 void recompileNextInstruction(int delayslot)
 {
 	u32 i;
@@ -1513,18 +1699,32 @@ void recompileNextInstruction(int delayslot)
 	{
 		//If the COP0 DIE bit is disabled, cycles should be doubled.
 		s_nBlockCycles += opcode.cycles * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
-		try
+
+		// Dead-store elimination (hot blocks only, where real liveness was
+		// computed): a side-effect-free computation whose destination is
+		// overwritten before ever being read doesn't need any code at all.
+		// g_pCurInstInfo holds the live-out state of this instruction, and the
+		// block's last instruction always sees the all-live terminator.
+		const int purereg = (s_recompilingHot && !delayslot) ? recPureGPRWrite() : 0;
+		if (purereg > 0 && !(g_pCurInstInfo->regs[purereg] & (EEINST_LIVE0 | EEINST_LIVE2)))
 		{
-			opcode.recompile();
+			// skipped; cycles were still accounted above
 		}
-		catch (Exception::FailedToAllocateRegister&)
+		else
 		{
-			// Fall back to the interpreter
-			recCall(opcode.interpret);
+			try
+			{
+				opcode.recompile();
+			}
+			catch (Exception::FailedToAllocateRegister&)
+			{
+				// Fall back to the interpreter
+				recCall(opcode.interpret);
 #if 0
-			// TODO: Free register ?
-			//	_freeXMMregs();
+				// TODO: Free register ?
+				//	_freeXMMregs();
 #endif
+			}
 		}
 	}
 
@@ -1667,12 +1867,25 @@ static void __fastcall PreBlockCheck(u32 blockpc)
 static u32 s_recblocks[] = {0};
 #endif
 
+// (Called from recompiled code)
+// Promotes the block at startpc to the optimizing tier: remember it as hot, then
+// clear it so the next dispatch recompiles it with full liveness analysis.
+static void __fastcall dyna_block_promote(u32 startpc)
+{
+	eeRecPerfLog.Write(Color_StrongGray, "Promoting Hot Block @ 0x%08X", startpc);
+	s_hotBlocks.insert(startpc);
+	// rearm the counter in case another block hashes onto it
+	*hotblockCounter(HWADDR(startpc)) = (u16)(0x10000 - HOTBLOCK_THRESHOLD);
+	recClear(startpc, 1);
+}
+
 // Called when a block under manual protection fails it's pre-execution integrity check.
 // (meaning the actual code area has been modified -- ie dynamic modules being loaded or,
 //  less likely, self-modifying code)
 void __fastcall dyna_block_discard(u32 start, u32 sz)
 {
 	eeRecPerfLog.Write(Color_StrongGray, "Clearing Manual Block @ 0x%08X  [size=%d]", start, sz * 4);
+	mmap_RecordBlockDiscard(start);
 	recClear(start, sz);
 }
 
@@ -1821,6 +2034,33 @@ static void __fastcall recRecompile(const u32 startpc)
 
 	pxAssert(startpc);
 
+	// Precompile the known-hot set from the block cache (if one was loaded) now
+	// that the ELF is resident.  We are in dispatcher context here, so these
+	// recursive compiles are as safe as any other first-touch compile.
+	if (s_hotBlockPrecompilePending && !s_hotBlockPrecompiling)
+	{
+		s_hotBlockPrecompilePending = false;
+		s_hotBlockPrecompiling = true;
+
+		int compiled = 0;
+		for (u32 blockpc : s_hotBlocks)
+		{
+			// leave headroom instead of forcing a rec reset from in here
+			if (recPtr >= (recMem->GetPtrEnd() - _1mb))
+				break;
+			if (blockpc == startpc || !recLUT[blockpc >> 16] || HWADDR(blockpc) >= Ps2MemSize::MainRam)
+				continue;
+			if (PC_GETBLOCK(blockpc)->GetFnptr() != (uptr)JITCompile)
+				continue;
+
+			recRecompile(blockpc);
+			compiled++;
+		}
+
+		s_hotBlockPrecompiling = false;
+		Console.WriteLn("EE block cache: precompiled %d hot blocks", compiled);
+	}
+
 	// if recPtr reached the mem limit reset whole mem
 	if (recPtr >= (recMem->GetPtrEnd() - _64kb))
 	{
@@ -1901,6 +2141,10 @@ static void __fastcall recRecompile(const u32 startpc)
 		// Apply patch as soon as possible. Normally it is done in
 		// eeGameStarting but first block is already compiled.
 		doPlace0Patches();
+
+		// The game's code is resident now, so the persistent block cache is
+		// finally usable: pull in the hot set recorded by earlier runs.
+		eeRecLoadHotBlockCache();
 	}
 
 	g_branch = 0;
@@ -1923,6 +2167,18 @@ static void __fastcall recRecompile(const u32 startpc)
 		xFastCall((void*)PreBlockCheck, pc);
 	}
 
+	// Tiered compilation: baseline blocks count their executions and promote
+	// themselves once the counter carries.  Hot blocks skip the counter and
+	// get the full liveness analysis below instead.
+	s_recompilingHot = s_hotBlocks.find(startpc) != s_hotBlocks.end();
+	if (!s_recompilingHot)
+	{
+		xADD(ptr16[hotblockCounter(HWADDR(startpc))], 1);
+		xForwardJNC8 skipPromote;
+		xFastCall((void*)dyna_block_promote, startpc);
+		skipPromote.SetTarget();
+	}
+
 	if (EmuConfig.Gamefixes.GoemonTlbHack)
 	{
 		if (pc == 0x33ad48 || pc == 0x35060c)
@@ -2106,8 +2362,24 @@ StartRecomp:
 					break;
 				}
 			}
-			// common register arithmetic instructions
-			else if (_Opcode_ == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
+			// shifts by immediate
+			else if (_Opcode_ == 0 && (_Funct_ < 4 || (_Funct_ & 070) == 070))
+			{
+				if (loads & 1 << _Rt_)
+				{
+					loads |= 1 << _Rd_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rt_;
+				if (reads & 1 << _Rd_)
+				{
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// common register arithmetic instructions, shifts by register
+			else if (_Opcode_ == 0 && ((_Funct_ & 060) == 040 && (_Funct_ & 076) != 050 || (_Funct_ & 054) == 004))
 			{
 				if (loads & 1 << _Rs_ && loads & 1 << _Rt_)
 				{
@@ -2143,6 +2415,12 @@ StartRecomp:
 			{
 				loads |= 1 << _Rt_;
 			}
+			// mfhi, mflo; hi/lo can't be written inside the loop (mult/div aren't
+			// accepted above), so these read loop-invariant values.
+			else if (_Opcode_ == 0 && (_Funct_ & 075) == 020)
+			{
+				loads |= 1 << _Rd_;
+			}
 			else
 			{
 				s_nBlockFF = false;
@@ -2171,6 +2449,12 @@ StartRecomp:
 		{
 			cpuRegs.code = *(int*)PSM(i - 4);
 			pcur[-1] = pcur[0];
+
+			// Hot tier only: compute real liveness so the register allocator
+			// can reuse dying registers instead of assuming everything live.
+			if (s_recompilingHot)
+				recBackpropBSC(pcur - 1, pcur);
+
 			pcur--;
 		}
 	}
@@ -2265,6 +2549,8 @@ StartRecomp:
 		i = recBlocks.LastIndex(HWADDR(pc) - 4);
 		while (oldBlock = recBlocks[i--])
 		{
+			if (oldBlock->dead)
+				continue;
 			if (oldBlock == s_pCurBlockEx)
 				continue;
 			if (oldBlock->startpc >= HWADDR(pc))
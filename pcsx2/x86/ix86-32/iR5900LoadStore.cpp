@@ -269,6 +269,33 @@ void recSQ()  { recStore(128); EE::Profiler.EmitOp(eeOpcode::SQ); }
 void recLWL()
 {
 #ifdef REC_LOADS
+	if (GPR_IS_CONST1(_Rs_))
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		_deleteEEreg(_Rt_, 1);
+
+		const u32 srcadr = g_cpuConstRegs[_Rs_].UL[0] + _Imm_;
+		const u32 shift = (srcadr & 3) << 3;
+
+		vtlb_DynGenRead32_Const(32, false, srcadr & ~3);
+
+		if (_Rt_)
+		{
+			// the bit offset is known, so the mask/merge folds to constants
+			if (shift != 24)
+			{
+				xSHL(eax, 24 - shift);
+				xMOV(edx, ptr32[&cpuRegs.GPR.r[_Rt_].UL[0]]);
+				xAND(edx, 0xffffff >> shift);
+				xOR(eax, edx);
+			}
+			eeSignExtendTo(_Rt_);
+		}
+
+		EE::Profiler.EmitOp(eeOpcode::LWL);
+		return;
+	}
+
 	iFlushCall(FLUSH_FULLVTLB);
 	_deleteEEreg(_Rt_, 1);
 
@@ -329,6 +356,35 @@ void recLWL()
 void recLWR()
 {
 #ifdef REC_LOADS
+	if (GPR_IS_CONST1(_Rs_))
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		_deleteEEreg(_Rt_, 1);
+
+		const u32 srcadr = g_cpuConstRegs[_Rs_].UL[0] + _Imm_;
+		const u32 shift = (srcadr & 3) << 3;
+
+		vtlb_DynGenRead32_Const(32, false, srcadr & ~3);
+
+		if (_Rt_)
+		{
+			if (shift == 0)
+			{
+				eeSignExtendTo(_Rt_);
+			}
+			else
+			{
+				// merge into the low word only, as the dynamic path does
+				xSHR(eax, shift);
+				xAND(ptr32[&cpuRegs.GPR.r[_Rt_].UL[0]], 0xffffff00 << (24 - shift));
+				xOR(ptr32[&cpuRegs.GPR.r[_Rt_].UL[0]], eax);
+			}
+		}
+
+		EE::Profiler.EmitOp(eeOpcode::LWR);
+		return;
+	}
+
 	iFlushCall(FLUSH_FULLVTLB);
 	_deleteEEreg(_Rt_, 1);
 
@@ -379,6 +435,39 @@ void recLWR()
 void recSWL()
 {
 #ifdef REC_STORES
+	if (GPR_IS_CONST1(_Rs_))
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+
+		const u32 dstadr = g_cpuConstRegs[_Rs_].UL[0] + _Imm_;
+		const u32 shift = (dstadr & 3) << 3;
+
+		if (shift == 24)
+		{
+			// aligned case stores Rt as-is
+			_eeMoveGPRtoR(arg2regd, _Rt_);
+		}
+		else
+		{
+			vtlb_DynGenRead32_Const(32, false, dstadr & ~3);
+
+			xMOV(arg2regd, 0xffffff00 << shift);
+			xAND(arg2regd, eax);
+
+			if (_Rt_)
+			{
+				_eeMoveGPRtoR(eax, _Rt_);
+				xSHR(eax, 24 - shift);
+				xOR(arg2regd, eax);
+			}
+		}
+
+		vtlb_DynGenWrite_Const(32, dstadr & ~3);
+
+		EE::Profiler.EmitOp(eeOpcode::SWL);
+		return;
+	}
+
 	iFlushCall(FLUSH_FULLVTLB);
 
 	_eeMoveGPRtoR(arg1regd, _Rs_);
@@ -436,6 +525,39 @@ void recSWL()
 void recSWR()
 {
 #ifdef REC_STORES
+	if (GPR_IS_CONST1(_Rs_))
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+
+		const u32 dstadr = g_cpuConstRegs[_Rs_].UL[0] + _Imm_;
+		const u32 shift = (dstadr & 3) << 3;
+
+		if (shift == 0)
+		{
+			// aligned case stores Rt as-is
+			_eeMoveGPRtoR(arg2regd, _Rt_);
+		}
+		else
+		{
+			vtlb_DynGenRead32_Const(32, false, dstadr & ~3);
+
+			xMOV(arg2regd, 0xffffff >> (24 - shift));
+			xAND(arg2regd, eax);
+
+			if (_Rt_)
+			{
+				_eeMoveGPRtoR(eax, _Rt_);
+				xSHL(eax, shift);
+				xOR(arg2regd, eax);
+			}
+		}
+
+		vtlb_DynGenWrite_Const(32, dstadr & ~3);
+
+		EE::Profiler.EmitOp(eeOpcode::SWR);
+		return;
+	}
+
 	iFlushCall(FLUSH_FULLVTLB);
 
 	_eeMoveGPRtoR(arg1regd, _Rs_);
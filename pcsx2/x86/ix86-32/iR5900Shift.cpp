@@ -369,23 +369,56 @@ EERECOMPILE_CODEX(eeRecompileCode2, DSRA32);
 * Format:  OP rd, rt, rs                                 *
 *********************************************************/
 
+// Returns the flags-free BMI2 three-operand form of the given group 2 shift,
+// or NULL when the host (or the operation) has no such form.  SHLX and friends
+// mask the count to the operand size just like the CL shifts, so they're a
+// drop-in that skips both the CL staging mov and the flags merge.
+static const xImplBMI_RMV* bmi2ShiftFor(const xImpl_Group2& shift)
+{
+	if (!x86caps.hasBMI2)
+		return NULL;
+	if (&shift == &xSHL)
+		return &xSHLX;
+	if (&shift == &xSHR)
+		return &xSHRX;
+	if (&shift == &xSAR)
+		return &xSARX;
+	return NULL;
+}
+
 static void recShiftV_constt(const xImpl_Group2& shift)
 {
+	const xImplBMI_RMV* bmi = bmi2ShiftFor(shift);
+
 	xMOV(ecx, ptr[&cpuRegs.GPR.r[_Rs_].UL[0]]);
 
 	xMOV(eax, g_cpuConstRegs[_Rt_].UL[0]);
-	shift(eax, cl);
+	if (bmi)
+		(*bmi)(eax, eax, ecx);
+	else
+		shift(eax, cl);
 
 	eeSignExtendTo(_Rd_);
 }
 
 static void recShiftV(const xImpl_Group2& shift)
 {
-	xMOV(eax, ptr[&cpuRegs.GPR.r[_Rt_].UL[0]]);
-	if (_Rs_ != 0)
+	const xImplBMI_RMV* bmi = (_Rs_ != 0) ? bmi2ShiftFor(shift) : NULL;
+
+	if (bmi)
 	{
+		// count can live anywhere and the source can stay in memory
 		xMOV(ecx, ptr[&cpuRegs.GPR.r[_Rs_].UL[0]]);
-		shift(eax, cl);
+		(*bmi)(eax, ptr[&cpuRegs.GPR.r[_Rt_].UL[0]], ecx);
+	}
+	else
+	{
+		xMOV(eax, ptr[&cpuRegs.GPR.r[_Rt_].UL[0]]);
+		if (_Rs_ != 0)
+		{
+			xMOV(ecx, ptr[&cpuRegs.GPR.r[_Rs_].UL[0]]);
+			shift(eax, cl);
+		}
 	}
 	eeSignExtendTo(_Rd_);
 }
@@ -394,21 +427,36 @@ static void recShiftV(const xImpl_Group2& shift)
 
 static void recDShiftV_constt(const xImpl_Group2& shift)
 {
+	const xImplBMI_RMV* bmi = bmi2ShiftFor(shift);
+
 	xMOV(ecx, ptr[&cpuRegs.GPR.r[_Rs_].UL[0]]);
 
 	xMOV64(rax, g_cpuConstRegs[_Rt_].UD[0]);
-	shift(rax, cl);
+	if (bmi)
+		(*bmi)(rax, rax, rcx);
+	else
+		shift(rax, cl);
 
 	xMOV(ptr[&cpuRegs.GPR.r[_Rd_].UD[0]], rax);
 }
 
 static void recDShiftV(const xImpl_Group2& shift)
 {
-	xMOV(rax, ptr[&cpuRegs.GPR.r[_Rt_].UD[0]]);
-	if (_Rs_ != 0)
+	const xImplBMI_RMV* bmi = (_Rs_ != 0) ? bmi2ShiftFor(shift) : NULL;
+
+	if (bmi)
 	{
 		xMOV(ecx, ptr[&cpuRegs.GPR.r[_Rs_].UL[0]]);
-		shift(rax, cl);
+		(*bmi)(rax, ptr[&cpuRegs.GPR.r[_Rt_].UD[0]], rcx);
+	}
+	else
+	{
+		xMOV(rax, ptr[&cpuRegs.GPR.r[_Rt_].UD[0]]);
+		if (_Rs_ != 0)
+		{
+			xMOV(ecx, ptr[&cpuRegs.GPR.r[_Rs_].UL[0]]);
+			shift(rax, cl);
+		}
 	}
 	xMOV(ptr[&cpuRegs.GPR.r[_Rd_].UD[0]], rax);
 }
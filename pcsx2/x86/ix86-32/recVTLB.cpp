@@ -152,10 +152,10 @@ static void iMOV64_Smart(const xIndirectVoid& destRm, const xIndirectVoid& srcRm
 namespace vtlb_private
 {
 	// ------------------------------------------------------------------------
-	// Prepares eax, ecx, and, ebx for Direct or Indirect operations.
-	// Returns the writeback pointer for ebx (return address from indirect handling)
+	// Prepares eax and ecx for Direct or Indirect operations.  On exit the sign flag
+	// distinguishes the two: set means the vmap entry was a handler.
 	//
-	static u32* DynGen_PrepRegs()
+	static void DynGen_PrepRegs()
 	{
 		// Warning dirty ebx (in case someone got the very bad idea to move this code)
 		EE::Profiler.EmitMem();
@@ -163,10 +163,7 @@ namespace vtlb_private
 		xMOV(eax, arg1regd);
 		xSHR(eax, VTLB_PAGE_BITS);
 		xMOV(rax, ptrNative[xComplexAddress(rbx, vtlbdata.vmap, rax * wordsize)]);
-		u32* writeback = xLEA_Writeback(rbx);
 		xADD(arg1reg, rax);
-
-		return writeback;
 	}
 
 	// ------------------------------------------------------------------------
@@ -275,10 +272,12 @@ static u8* GetIndirectDispatcherPtr(int mode, int operandsize, int sign = 0)
 }
 
 // ------------------------------------------------------------------------
-// Generates a JS instruction that targets the appropriate templated instance of
-// the vtlb Indirect Dispatcher.
+// Emits the handler-page branch: a call to the appropriate templated instance of
+// the vtlb Indirect Dispatcher, taken when DynGen_PrepRegs left the sign flag set.
+// The dispatcher returns via ret, so the returned forward jump must be targeted
+// just past the direct-path code that the caller emits next.
 //
-static void DynGen_IndirectDispatch(int mode, int bits, bool sign = false)
+static xForwardJump8 DynGen_IndirectDispatch(int mode, int bits, bool sign = false)
 {
 	int szidx = 0;
 	switch (bits)
@@ -290,15 +289,24 @@ static void DynGen_IndirectDispatch(int mode, int bits, bool sign = false)
 		case 128: szidx = 4; break;
 		jNO_DEFAULT;
 	}
-	xJS(GetIndirectDispatcherPtr(mode, szidx, sign));
+
+	xForwardJNS8 direct;
+	xCALL(GetIndirectDispatcherPtr(mode, szidx, sign));
+	xForwardJump8 done;
+	direct.SetTarget();
+	return done;
 }
 
 // ------------------------------------------------------------------------
 // Generates the various instances of the indirect dispatchers
-// In: arg1reg: vtlb entry, arg2reg: data ptr (if mode >= 64), rbx: function return ptr
+// In: arg1reg: vtlb entry, arg2reg: data ptr (if mode >= 64)
 // Out: eax: result (if mode < 64)
 static void DynGen_IndirectTlbDispatcher(int mode, int bits, bool sign)
 {
+	// We got here via a near call, which leaves the stack one push off the
+	// alignment the recompiled code maintains; restore it for the handler call.
+	xSUB(rsp, 16 - wordsize);
+
 	xMOVZX(eax, al);
 	if (wordsize != 8)
 		xSUB(arg1regd, 0x80000000);
@@ -335,7 +343,8 @@ static void DynGen_IndirectTlbDispatcher(int mode, int bits, bool sign)
 		}
 	}
 
-	xJMP(rbx);
+	xADD(rsp, 16 - wordsize);
+	xRET();
 }
 
 // One-time initialization procedure.  Multiple subsequent calls during the lifespan of the
@@ -372,31 +381,19 @@ void vtlb_dynarec_init()
 	Perf::any.map((uptr)m_IndirectDispatchers, __pagesize, "TLB Dispatcher");
 }
 
-static void vtlb_SetWriteback(u32* writeback)
-{
-	uptr val = (uptr)xGetPtr();
-	if (wordsize == 8)
-	{
-		pxAssertMsg(*((u8*)writeback - 2) == 0x8d, "Expected codegen to be an LEA");
-		val -= ((uptr)writeback + 4);
-	}
-	pxAssertMsg((sptr)val == (s32)val, "Writeback too far away!");
-	*writeback = val;
-}
-
 //////////////////////////////////////////////////////////////////////////////////////////
 //                            Dynarec Load Implementations
 int vtlb_DynGenRead64(u32 bits, int gpr)
 {
 	pxAssume(bits == 64 || bits == 128);
 
-	u32* writeback = DynGen_PrepRegs();
+	DynGen_PrepRegs();
 
 	int reg = gpr == -1 ? _allocTempXMMreg(XMMT_INT, 0) : _allocGPRtoXMMreg(0, gpr, MODE_WRITE); // Handler returns in xmm0
-	DynGen_IndirectDispatch(0, bits);
+	xForwardJump8 indirectDone = DynGen_IndirectDispatch(0, bits);
 	DynGen_DirectRead64(bits);
 
-	vtlb_SetWriteback(writeback); // return target for indirect's call/ret
+	indirectDone.SetTarget();
 	return reg;
 }
 
@@ -408,12 +405,12 @@ void vtlb_DynGenRead32(u32 bits, bool sign)
 {
 	pxAssume(bits <= 32);
 
-	u32* writeback = DynGen_PrepRegs();
+	DynGen_PrepRegs();
 
-	DynGen_IndirectDispatch(0, bits, sign && bits < 32);
+	xForwardJump8 indirectDone = DynGen_IndirectDispatch(0, bits, sign && bits < 32);
 	DynGen_DirectRead(bits, sign);
 
-	vtlb_SetWriteback(writeback);
+	indirectDone.SetTarget();
 }
 
 // ------------------------------------------------------------------------
@@ -461,6 +458,38 @@ int vtlb_DynGenRead64_Const(u32 bits, u32 addr_const, int gpr)
 	return reg;
 }
 
+// Returns true if the hardware register at paddr is a plain psHu32() word whose
+// read handler has no side effects, so a constant-address load can be inlined as
+// a single mov instead of an indirect handler call.  Games busy-wait on most of
+// these (CHCR.STR polls, DMAC/INTC status spins), making the handler call the
+// dominant cost of the wait loop.  Keep this list in sync with hwRead32: anything
+// with special-cased behavior there (SIO_ISR, MCH_RICM, SBUS, etc) must stay on
+// the handler path.
+static bool vtlb_IsPureHwRead32(u32 paddr)
+{
+	// DMA channel registers (CHCR/MADR/QWC/TADR/ASR/SADR, pages 0x8 - 0xD)
+	if (paddr >= D0_CHCR && paddr <= toSPR_SADR)
+	{
+		// the VIF1 fifo-fill gamefix needs its handler
+		if ((paddr == D1_CHCR + 0x10) && CHECK_VIFFIFOHACK)
+			return false;
+		return true;
+	}
+
+	// DMAC control/status page (0x1000Exxx, including DMAC_FAKESTAT)
+	if (paddr >= DMAC_CTRL && paddr < INTC_STAT)
+		return true;
+
+	switch (paddr)
+	{
+		case INTC_MASK:
+		case DMAC_ENABLER:
+			return true;
+	}
+
+	return false;
+}
+
 // ------------------------------------------------------------------------
 // Recompiled input registers:
 //   ecx - source address to read from
@@ -516,6 +545,12 @@ void vtlb_DynGenRead32_Const(u32 bits, bool sign, u32 addr_const)
 		{
 			xMOV(eax, ptr[&psHu32(INTC_STAT)]);
 		}
+		// Same idea for the other side-effect-free hardware registers (DMA channel
+		// and DMAC/INTC status words), which busy-wait loops hammer just as hard.
+		else if ((bits == 32) && vtlb_IsPureHwRead32(paddr))
+		{
+			xMOV(eax, ptr[&psHu32(paddr)]);
+		}
 		else
 		{
 			iFlushCall(FLUSH_FULLVTLB);
@@ -546,12 +581,12 @@ void vtlb_DynGenRead32_Const(u32 bits, bool sign, u32 addr_const)
 
 void vtlb_DynGenWrite(u32 sz)
 {
-	u32* writeback = DynGen_PrepRegs();
+	DynGen_PrepRegs();
 
-	DynGen_IndirectDispatch(1, sz);
+	xForwardJump8 indirectDone = DynGen_IndirectDispatch(1, sz);
 	DynGen_DirectWrite(sz);
 
-	vtlb_SetWriteback(writeback);
+	indirectDone.SetTarget();
 }
 
 
@@ -120,6 +120,9 @@ void mVUreset(microVU& mVU, bool resetReserve)
 	mVU.prog.x86ptr   = z;
 	mVU.prog.x86end   = z + ((mVU.cacheSize - mVUcacheSafeZone) * _1mb);
 
+	if (!mVU.prog.progMap)
+		mVU.prog.progMap = new microProgramMap();
+
 	for (u32 i = 0; i < (mVU.progSize / 2); i++)
 	{
 		if (!mVU.prog.prog[i])
@@ -163,6 +166,7 @@ void mVUclose(microVU& mVU)
 		}
 		safe_delete(mVU.prog.prog[i]);
 	}
+	safe_delete(mVU.prog.progMap);
 }
 
 // Clears Block Data in specified range
@@ -184,15 +188,19 @@ __fi void mVUclear(mV, u32 addr, u32 size)
 // Micro VU - Private Functions
 //------------------------------------------------------------------
 
-// Finds and Ages/Kills Programs if they haven't been used in a while.
+// Advances the frame counter used to age programs; the stale ones are killed
+// from the compile path (mVUcreateProg) so eviction never races execution.
 __ri void mVUvsyncUpdate(mV)
 {
-	//mVU.prog.curFrame++;
+	mVU.prog.curFrame++;
 }
 
 // Deletes a program
 __ri void mVUdeleteProg(microVU& mVU, microProgram*& prog)
 {
+	microProgramMap::iterator it(mVU.prog.progMap->find(prog->hash));
+	if ((it != mVU.prog.progMap->end()) && (it->second == prog))
+		mVU.prog.progMap->erase(it);
 	for (u32 i = 0; i < (mVU.progSize / 2); i++)
 	{
 		safe_delete(prog->block[i]);
@@ -201,15 +209,182 @@ __ri void mVUdeleteProg(microVU& mVU, microProgram*& prog)
 	safe_aligned_free(prog);
 }
 
+// Kills programs that haven't been searched for in a while, so the cache
+// doesn't grow unbounded when a game streams lots of different programs.
+__ri void mVUkillOldProgs(microVU& mVU)
+{
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		microProgramList* list = mVU.prog.prog[i];
+		if (!list)
+			continue;
+		std::deque<microProgram*>::iterator it(list->begin());
+		while (it != list->end())
+		{
+			microProgram* prog = it[0];
+			if ((prog != mVU.prog.cur) && ((mVU.prog.curFrame - prog->frame) > mVUprogAgeMax))
+			{
+				DevCon.WriteLn(mVU.index ? Color_Orange : Color_Magenta, "microVU%d: Killed Old Prog = [%03d] [PC=%04x]",
+					mVU.index, prog->idx, prog->startPC * 8);
+				for (u32 q = 0; q < (mVU.progSize / 2); q++)
+				{
+					if (mVU.prog.quick[q].prog == prog)
+					{
+						mVU.prog.quick[q].block = NULL;
+						mVU.prog.quick[q].prog = NULL;
+					}
+				}
+				mVUdeleteProg(mVU, prog);
+				it = list->erase(it);
+			}
+			else
+				++it;
+		}
+	}
+}
+
+// Returns true if an Inf/NaN value has escaped into the VF registers or the
+// ACC, meaning a program compiled without the extra clamps needed them after
+// all. Integer data parked in a VF register can false-positive here, but that
+// only costs the program its speculation, which is still the old behavior.
+__ri bool mVUcheckClampEscape(microVU& mVU)
+{
+	for (int i = 1; i < 32; i++)
+	{
+		for (int f = 0; f < 4; f++)
+		{
+			if ((mVU.regs().VF[i].UL[f] & 0x7f800000) == 0x7f800000)
+				return true;
+		}
+	}
+	for (int f = 0; f < 4; f++)
+	{
+		if ((mVU.regs().ACC.UL[f] & 0x7f800000) == 0x7f800000)
+			return true;
+	}
+	return false;
+}
+
+// Marks the current program as needing the extra clamps and scraps its blocks,
+// so its next execution recompiles them with clamping. The old rec-code stays
+// allocated, same as any other recompile.
+__ri void mVUflagClampProg(microVU& mVU)
+{
+	microProgram& prog = *mVU.prog.cur;
+	DevCon.WriteLn(mVU.index ? Color_Orange : Color_Magenta, "microVU%d: Inf/NaN escaped Prog = [%03d] [PC=%04x], enabling extra clamping",
+		mVU.index, prog.idx, prog.startPC * 8);
+	prog.needsClamp = 1;
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		safe_delete(prog.block[i]);
+		if (mVU.prog.quick[i].prog == &prog)
+			mVU.prog.quick[i].block = NULL;
+	}
+}
+
+// Returns true if the program contains a status flag reader (FSEQ/FSAND/FSOR).
+// Scanning the whole micro memory snapshot is conservative: unreachable data
+// that happens to decode as a reader just costs the program its optimization.
+// Lower words paired with an I-bit upper are float immediates, so skip those.
+static bool mVUscanSflagReads(microProgram& prog, u32 size)
+{
+	for (u32 i = 0; i < (size / 8); i++)
+	{
+		if (prog.data[i * 2 + 1] & 0x80000000) // I-bit
+			continue;
+		const u32 opcode = prog.data[i * 2] >> 25;
+		if ((opcode == 0x14) || (opcode == 0x16) || (opcode == 0x17)) // FSEQ/FSAND/FSOR
+			return true;
+	}
+	return false;
+}
+
+// Computes which VF/VI registers the program can read or write, so the COP2
+// transfer recs can skip syncing VU0 for accesses that provably can't conflict
+// (see doCOP2DepElim). Over-approximates: register fields are marked in both
+// files when the opcode's operand layout is ambiguous, and unknown opcodes
+// mark everything.
+static void mVUscanRegTouch(microProgram& prog, u32 size)
+{
+	u32 vf = 1; // vf00 is hardwired, treat it as always touched
+	u32 vi = 1;
+	for (u32 i = 0; i < (size / 8); i++)
+	{
+		const u32 upper = prog.data[i * 2 + 1];
+		vf |= (1 << ((upper >> 6) & 0x1f)) | (1 << ((upper >> 11) & 0x1f)) | (1 << ((upper >> 16) & 0x1f));
+		if (upper & 0x80000000) // I-bit: lower word is a float immediate
+			continue;
+		const u32 lower = prog.data[i * 2];
+		const u32 ft = 1 << ((lower >> 16) & 0x1f); // Ft/It field
+		const u32 fs = 1 << ((lower >> 11) & 0x1f); // Fs/Is field
+		const u32 fd = 1 << ((lower >>  6) & 0x1f); // Fd/Id field
+		switch (lower >> 25)
+		{
+			case 0x00: case 0x01: // LQ/SQ (VF reg + VI address reg)
+				vf |= ft | fs;
+				vi |= ft | fs;
+				break;
+			case 0x04: case 0x05: // ILW/ISW
+			case 0x08: case 0x09: // IADDIU/ISUBIU
+				vi |= ft | fs;
+				break;
+			case 0x10: case 0x11: case 0x12: case 0x13: // FC*
+			case 0x14: case 0x15: case 0x16: case 0x17: // FS*
+			case 0x18: case 0x19: case 0x1a: case 0x1b: // FM*
+			case 0x1c:                                  // FCGET
+				vi |= ft;
+				break;
+			case 0x20: case 0x21: case 0x24: case 0x25: // B/BAL/JR/JALR
+			case 0x28: case 0x29: case 0x2a: case 0x2b: // IBEQ/IBNE
+			case 0x2c: case 0x2d: case 0x2e: case 0x2f: // IBLTZ/IBGTZ/IBLEZ/IBGEZ
+				vi |= ft | fs;
+				break;
+			case 0x40: // LowerOP group (integer ALU + the T3 tables)
+				vf |= ft | fs;
+				vi |= ft | fs | fd;
+				break;
+			default: // Unknown: might be garbage, might be a bug; assume the worst
+				vf = 0xffffffff;
+				vi = 0xffffffff;
+				break;
+		}
+	}
+	prog.vfTouch = vf;
+	prog.viTouch = vi;
+}
+
+// Generate Hash for a full micro memory snapshot (same mixing as mVUrangesHash)
+static u64 mVUmemHash(const u32* data, u32 size)
+{
+	union
+	{
+		u64 v64;
+		u32 v32[2];
+	} hash = {0};
+
+	for (u32 i = 0; i < (size / 4); i++)
+	{
+		hash.v32[0] -= data[i];
+		hash.v32[1] ^= data[i];
+	}
+	return hash.v64;
+}
+
 // Creates a new Micro Program
 __ri microProgram* mVUcreateProg(microVU& mVU, int startPC)
 {
+	mVUkillOldProgs(mVU); // Cold path, and on the thread that runs the VU
 	microProgram* prog = (microProgram*)_aligned_malloc(sizeof(microProgram), 64);
 	memset(prog, 0, sizeof(microProgram));
 	prog->idx = mVU.prog.total++;
 	prog->ranges = new std::deque<microRange>();
 	prog->startPC = startPC;
+	prog->hash = mVUmemHash((u32*)mVU.regs().Micro, mVU.microMemSize);
+	prog->frame = mVU.prog.curFrame;
+	(*mVU.prog.progMap)[prog->hash] = prog; // Newest snapshot owns the exact-match slot
 	mVUcacheProg(mVU, *prog); // Cache Micro Program
+	prog->sFlagDead = doDeadFlagElim && !mVUscanSflagReads(*prog, mVU.microMemSize);
+	mVUscanRegTouch(*prog, mVU.microMemSize);
 	double cacheSize = (double)((uptr)mVU.prog.x86end - (uptr)mVU.prog.x86start);
 	double cacheUsed = ((double)((uptr)mVU.prog.x86ptr - (uptr)mVU.prog.x86start)) / (double)_1mb;
 	double cachePerc = ((double)((uptr)mVU.prog.x86ptr - (uptr)mVU.prog.x86start)) / cacheSize * 100;
@@ -311,6 +486,25 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 
 	if (!quick.prog) // If null, we need to search for new program
 	{
+		// Exact-match fast path: if the whole micro memory matches a cached
+		// snapshot, the program map finds it without walking the list.  This
+		// can also revive a program cached from a different startPC, since a
+		// microProgram's block managers cover every entry point.
+		microProgramMap::iterator mapIt(mVU.prog.progMap->find(mVUmemHash((u32*)mVU.regs().Micro, mVU.microMemSize)));
+		if ((mapIt != mVU.prog.progMap->end()) && mVUcmpProg(mVU, *mapIt->second, 1))
+		{
+			quick.block = mapIt->second->block[startPC / 8];
+			quick.prog  = mapIt->second;
+			quick.prog->frame = mVU.prog.curFrame;
+
+			if (quick.block == nullptr)
+			{
+				void* entryPoint = mVUblockFetch(mVU, startPC, pState);
+				return entryPoint;
+			}
+			return mVUentryGet(mVU, quick.block, startPC, pState);
+		}
+
 		std::deque<microProgram*>::iterator it(list->begin());
 		for (; it != list->end(); ++it)
 		{
@@ -320,6 +514,7 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 			{
 				quick.block = it[0]->block[startPC / 8];
 				quick.prog  = it[0];
+				quick.prog->frame = mVU.prog.curFrame;
 				list->erase(it);
 				list->push_front(quick.prog);
 
@@ -348,6 +543,7 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 	// If list.quick, then we've already found and recompiled the program ;)
 	mVU.prog.isSame = -1;
 	mVU.prog.cur = quick.prog;
+	mVU.prog.cur->frame = mVU.prog.curFrame;
 	// Because the VU's can now run in sections and not whole programs at once
 	// we need to set the current block so it gets the right program back
 	quick.block = mVU.prog.cur->block[startPC / 8];
@@ -361,6 +557,63 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 	return mVUentryGet(mVU, quick.block, startPC, pState);
 }
 
+//------------------------------------------------------------------
+// Program Timing Report
+//------------------------------------------------------------------
+
+static void mVUdumpProgTimings(microVU& mVU)
+{
+	std::vector<microProgram*> progs;
+
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		if (!mVU.prog.prog[i])
+			continue;
+		for (microProgram* prog : *mVU.prog.prog[i])
+		{
+			if (prog->execCount)
+				progs.push_back(prog);
+		}
+	}
+
+	if (progs.empty())
+		return;
+
+	u64 total = 0;
+	for (microProgram* prog : progs)
+		total += prog->hostTicks;
+
+	std::sort(progs.begin(), progs.end(), [](microProgram* a, microProgram* b)
+	{
+		return a->hostTicks > b->hostTicks;
+	});
+
+	const double to_ms = 1000.0 / GetTickFrequency();
+	const double to_us = 1000000.0 / GetTickFrequency();
+
+	Console.WriteLn("microVU%d programs by host time (%.0fms total):", mVU.index, total * to_ms);
+	for (size_t i = 0; i < progs.size() && i < 10; i++)
+	{
+		microProgram& prog = *progs[i];
+		Console.WriteLn("  [%3d] pc 0x%04x hash %016llx : %5.1f%%  %8llu runs  %6.1fus/run%s%s",
+			prog.idx, prog.startPC * 8, prog.hash,
+			prog.hostTicks * 100.0 / total, prog.execCount,
+			prog.hostTicks * to_us / prog.execCount,
+			prog.needsClamp ? "  [clamped]" : "",
+			prog.sFlagDead ? "  [sflag-dead]" : "");
+	}
+}
+
+// Per-program execution counts and host timings for both VUs; the counters
+// accumulate from the last recompiler reset.  With MTVU the VU1 counters are
+// updated by the VU thread, so a report taken mid-run can be slightly torn --
+// fine for a profiling summary.
+void mVUdumpProgramTimings()
+{
+	mVUdumpProgTimings(microVU0);
+	mVUdumpProgTimings(microVU1);
+}
+
 //------------------------------------------------------------------
 // recMicroVU0 / recMicroVU1
 //------------------------------------------------------------------
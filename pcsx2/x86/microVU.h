@@ -23,6 +23,7 @@ using namespace x86Emitter;
 #include <deque>
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include "Common.h"
 #include "VU.h"
 #include "MTVU.h"
@@ -127,6 +128,10 @@ public:
 			{
 				if (linkI->block.pState.quick32[0] != pState->quick32[0]) continue;
 				if (linkI->block.pState.quick32[1] != pState->quick32[1]) continue;
+				if (linkI->block.pState.xmmCached32[0] != pState->xmmCached32[0]) continue;
+				if (linkI->block.pState.xmmCached32[1] != pState->xmmCached32[1]) continue;
+				if (linkI->block.pState.xmmCached32[2] != pState->xmmCached32[2]) continue;
+				if (linkI->block.pState.xmmCached32[3] != pState->xmmCached32[3]) continue;
 				if (doConstProp && (linkI->block.pState.vi15  != pState->vi15))  continue;
 				if (doConstProp && (linkI->block.pState.vi15v != pState->vi15v)) continue;
 				return &linkI->block;
@@ -170,11 +175,20 @@ struct microProgram
 	u32                data [mProgSize];     // Holds a copy of the VU microProgram
 	microBlockManager* block[mProgSize / 2]; // Array of Block Managers
 	std::deque<microRange>* ranges;          // The ranges of the microProgram that have already been recompiled
-	u32 startPC; // Start PC of this program
-	int idx;     // Program index
+	u32 startPC;    // Start PC of this program
+	u64 hash;       // Hash of the micro memory snapshot this program was cached from
+	u32 frame;      // Frame this program was last searched for / executed on
+	u32 needsClamp; // Set when an Inf/NaN escaped this program while compiled without the extra clamps
+	u32 sFlagDead;  // Program never reads its status flags, so most updates can be optimized out
+	u32 vfTouch;    // VF registers this program can read or write (COP2 dependency mask)
+	u32 viTouch;    // VI registers this program can read or write (COP2 dependency mask)
+	u64 execCount;  // Times this program has been entered (mVUexecute)
+	u64 hostTicks;  // Host time spent running this program (mVUdumpProgTimings)
+	int idx;        // Program index
 };
 
 typedef std::deque<microProgram*> microProgramList;
+typedef std::unordered_map<u64, microProgram*> microProgramMap;
 
 struct microProgramQuick
 {
@@ -186,6 +200,7 @@ struct microProgManager
 {
 	microIR<mProgSize> IRinfo;             // IR information
 	microProgramList*  prog [mProgSize/2]; // List of microPrograms indexed by startPC values
+	microProgramMap*   progMap;            // Micro memory hash to newest matching microProgram (exact-match fast path)
 	microProgramQuick  quick[mProgSize/2]; // Quick reference to valid microPrograms for current execution
 	microProgram*      cur;                // Pointer to currently running MicroProgram
 	int                total;              // Total Number of valid MicroPrograms
@@ -201,6 +216,7 @@ struct microProgManager
 static const uint mVUdispCacheSize = __pagesize; // Dispatcher Cache Size (in bytes)
 static const uint mVUcacheSafeZone =  3; // Safe-Zone for program recompilation (in megabytes)
 static const uint mVUcacheReserve = 64; // mVU0, mVU1 Reserve Cache Size (in megabytes)
+static const uint mVUprogAgeMax  = 600; // Frames a program can go unsearched before it gets evicted
 
 struct microVU
 {
@@ -247,6 +263,7 @@ struct microVU
 	u32 q;            // Holds current Q instance index
 	u32 totalCycles;  // Total Cycles that mVU is expected to run for
 	u32 cycles;       // Cycles Counter
+	u64 execStart;    // Host tick at mVUexecute entry (per-program timing)
 
 	VURegs& regs() const { return ::vuRegs[index]; }
 
@@ -280,6 +297,8 @@ mVUop(mVUopL);
 // Private Functions
 extern void mVUcacheProg(microVU& mVU, microProgram& prog);
 extern void mVUdeleteProg(microVU& mVU, microProgram*& prog);
+extern bool mVUcheckClampEscape(microVU& mVU);
+extern void mVUflagClampProg(microVU& mVU);
 _mVUt extern void* mVUsearchProg(u32 startPC, uptr pState);
 extern void* __fastcall mVUexecuteVU0(u32 startPC, u32 cycles);
 extern void* __fastcall mVUexecuteVU1(u32 startPC, u32 cycles);
@@ -272,8 +272,16 @@ void mVUendProgram(mV, microFlagCycles* mFC, int isEbit)
 // Recompiles Code for Proper Flags and Q/P regs on Block Linkings
 void mVUsetupBranch(mV, microFlagCycles& mFC)
 {
-	mVU.regAlloc->flushAll(); // Flush Allocated Regs
+	mVU.regAlloc->flushAll(!doBlockRegLink); // Flush Allocated Regs (keep cached copies when linking)
 	mVUsetupFlags(mVU, mFC);  // Shuffle Flag Instances
+	if (doBlockRegLink)
+	{
+		// The flag shuffling above and any program-exit code on the way to the
+		// next block may clobber xmmT1/xmmT2, so those can't stay cached.
+		mVU.regAlloc->clearReg(xmmT1);
+		mVU.regAlloc->clearReg(xmmT2);
+		mVU.regAlloc->exportState(mVUregs.xmmCached);
+	}
 
 	// Shuffle P/Q regs since every block starts at instance #0
 	if (mVU.p || mVU.q)
@@ -294,8 +302,12 @@ void normBranchCompile(microVU& mVU, u32 branchPC)
 
 void normJumpCompile(mV, microFlagCycles& mFC, bool isEvilJump)
 {
+	// Jump targets are reached through the C dispatcher, so the xmm contents
+	// don't survive; the jump's end-state must carry an empty mapping.
+	memset(mVUregs.xmmCached, 0, sizeof(mVUregs.xmmCached));
 	memcpy(&mVUpBlock->pStateEnd, &mVUregs, sizeof(microRegInfo));
 	mVUsetupBranch(mVU, mFC);
+	memset(mVUregs.xmmCached, 0, sizeof(mVUregs.xmmCached)); // Undo mVUsetupBranch's export
 	mVUbackupRegs(mVU);
 
 	if (!mVUpBlock->jumpCache) // Create the jump cache for this block
@@ -539,7 +539,7 @@ __fi void mVUinitFirstPass(microVU& mVU, uptr pState, u8* thisPtr)
 	mVUregs.viBackUp  = 0;
 	mVUregs.flagInfo  = 0;
 	mVUregs.mbitinblock = false;
-	mVUsFlagHack = CHECK_VU_FLAGHACK;
+	mVUsFlagHack = CHECK_VU_FLAGHACK || mVUcurProg.sFlagDead; // Proven-dead status flags get the hack automatically
 	mVUinitConstValues(mVU);
 }
 
@@ -665,6 +665,15 @@ void mVUSaveFlags(microVU& mVU, microFlagCycles& mFC, microFlagCycles& mFCBackup
 	memcpy(&mFCBackup, &mFC, sizeof(microFlagCycles));
 	mVUsetFlags(mVU, mFCBackup); // Sets Up Flag instances
 }
+// Note: Compiling new programs on a helper thread (with the interpreter
+// covering the first pass) was evaluated and rejected. Blocks compile lazily
+// per control-flow path, so a program's first run only pays for the path it
+// actually takes, and with MTVU enabled VU1 compilation already happens on the
+// VU thread, off the EE. A dedicated compile worker can't emit concurrently
+// because the emitter (x86Ptr & friends) is global state shared with the EE
+// recompilers, and handing a half-executed program from the interpreter to the
+// rec would need a pipeline-state translation (flag instances, stalls, xmm
+// cache) that neither side models.
 void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 {
 	microFlagCycles mFC;
@@ -675,6 +684,8 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 	iPC = startPC / 4;
 	mVUsetupRange(mVU, startPC, 1); // Setup Program Bounds/Range
 	mVU.regAlloc->reset();          // Reset regAlloc
+	if (doBlockRegLink) // Seed regAlloc with the mapping the linking block left behind
+		mVU.regAlloc->importState(((microRegInfo*)pState)->xmmCached);
 	mVUinitFirstPass(mVU, pState, thisPtr);
 	mVUbranch = 0;
 	for (int branch = 0; mVUcount < endCount;)
@@ -140,8 +140,12 @@ _mVUt void* __fastcall mVUexecute(u32 startPC, u32 cycles)
 
 	mVU.cycles = cycles;
 	mVU.totalCycles = cycles;
+	mVU.execStart = GetCPUTicks();
 
 	xSetPtr(mVU.prog.x86ptr); // Set x86ptr to where last program left off
+	// Entries from C code can't rely on xmm contents, so drop any register
+	// mapping the last executed block recorded in its pipeline state.
+	memset(mVU.prog.lpState.xmmCached, 0, sizeof(mVU.prog.lpState.xmmCached));
 	return mVUsearchProg<vuIndex>(startPC & vuLimit, (uptr)&mVU.prog.lpState); // Find and set correct program
 }
 
@@ -161,6 +165,23 @@ _mVUt void mVUcleanUp()
 		mVUreset(mVU, false);
 	}
 
+	// Speculative clamp mode: this program ran without the extra clamps, so if
+	// an Inf/NaN escaped into its registers the speculation failed; flag the
+	// program and scrap its blocks to get it recompiled with the clamps.
+	if (doClampSpec && clampE && mVU.prog.cur && !mVU.prog.cur->needsClamp)
+	{
+		if (mVUcheckClampEscape(mVU))
+			mVUflagClampProg(mVU);
+	}
+
+	// Attribute the whole run (dispatch, recompiled code, xgkick) to the
+	// program that was entered; the counters feed mVUdumpProgTimings.
+	if (mVU.prog.cur)
+	{
+		mVU.prog.cur->execCount++;
+		mVU.prog.cur->hostTicks += GetCPUTicks() - mVU.execStart;
+	}
+
 	mVU.cycles = mVU.totalCycles - mVU.cycles;
 	mVU.regs().cycle += mVU.cycles;
 
@@ -58,6 +58,12 @@ union __aligned16 microRegInfo
 		u8 vi15v; // 'vi15' constant is valid
 		u16 vi15; // Constant Prop Info for vi15
 
+		union
+		{
+			u8  xmmCached[16];   // VF reg (1-31, 32 = ACC) held by each host xmm reg on block entry (0 = none)
+			u32 xmmCached32[4];  // The generated code relies on this mapping, so it's part of the compared state
+		};
+
 		struct
 		{
 			u8 VI[16];
@@ -65,12 +71,12 @@ union __aligned16 microRegInfo
 		};
 	};
 
-	u128 full128[176 / sizeof(u128)];
-	u64  full64[176 / sizeof(u64)];
-	u32  full32[176 / sizeof(u32)];
+	u128 full128[192 / sizeof(u128)];
+	u64  full64[192 / sizeof(u64)];
+	u32  full32[192 / sizeof(u32)];
 };
 
-static_assert(sizeof(microRegInfo) == 176, "microRegInfo was not 176 bytes");
+static_assert(sizeof(microRegInfo) == 192, "microRegInfo was not 192 bytes");
 
 struct microProgram;
 struct microJumpCache
@@ -321,6 +327,38 @@ public:
 		}
 	}
 
+	// Records which xmm regs hold a clean, fully-valid copy of a VF reg (or ACC),
+	// so the mapping can be carried into a statically linked block (see microRegInfo).
+	// xmm0/xmm1 (xmmT1/xmmT2) are skipped since the flag shuffling and program-exit
+	// code emitted between blocks uses them as raw temporaries.
+	void exportState(u8* dst) const
+	{
+		for (int i = 0; i < 16; i++)
+			dst[i] = 0;
+		for (int i = 2; i < xmmTotal; i++)
+		{
+			const microMapXMM& mapI = xmmMap[i];
+			if ((mapI.VFreg > 0) && (mapI.VFreg <= 32) && !mapI.xyzw && !mapI.isNeeded)
+				dst[i] = (u8)mapI.VFreg;
+		}
+	}
+
+	// Seeds the allocator with the register mapping a predecessor block left in
+	// the xmm registers (see exportState).
+	void importState(const u8* src)
+	{
+		for (int i = 0; i < xmmTotal; i++)
+		{
+			if (src[i])
+			{
+				xmmMap[i].VFreg    = src[i];
+				xmmMap[i].xyzw     = 0;
+				xmmMap[i].count    = 0;
+				xmmMap[i].isNeeded = false;
+			}
+		}
+	}
+
 	void TDwritebackAll(bool clearState = false)
 	{
 		for (int i = 0; i < xmmTotal; i++)
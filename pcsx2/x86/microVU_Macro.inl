@@ -314,21 +314,17 @@ void recBC2TL() { _setupBranchTest(JZ32,  true);  }
 // Macro VU - COP2 Transfer Instructions
 //------------------------------------------------------------------
 
-void COP2_Interlock(bool mBitSync)
+// Emits the actual VU0 sync: the full interlocked wait when the instruction's
+// I-bit is set, otherwise the kickstart that runs VU0 up to the EE's cycle
+// count. Reloads eax from cpuRegs.cycle (the caller just stored it there).
+static void COP2_EmitSync(bool interlocked, bool mBitSync)
 {
-
-	if (cpuRegs.code & 1)
+	if (interlocked)
 	{
-		_freeX86reg(eax);
-		xMOV(eax, ptr32[&cpuRegs.cycle]);
-		xADD(eax, scaleblockcycles_clear());
-		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
-
-		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-		xForwardJZ32 skipvuidle;
 		_cop2BackupRegs();
 		if (mBitSync)
 		{
+			xMOV(eax, ptr32[&cpuRegs.cycle]);
 			xSUB(eax, ptr32[&VU0.cycle]);
 			xSUB(eax, ptr32[&VU0.nextBlockCycles]);
 			xCMP(eax, 0);
@@ -342,7 +338,62 @@ void COP2_Interlock(bool mBitSync)
 		else
 			xFastCall((void*)_vu0FinishMicro);
 		_cop2RestoreRegs();
-		skipvuidle.SetTarget();
+	}
+	else
+	{
+		xMOV(eax, ptr32[&cpuRegs.cycle]);
+		xSUB(eax, ptr32[&VU0.cycle]);
+		xSUB(eax, ptr32[&VU0.nextBlockCycles]);
+		xCMP(eax, EmuConfig.Gamefixes.VUKickstartHack ? 8 : 0);
+		xForwardJL32 skip;
+		_cop2BackupRegs();
+		xLoadFarAddr(arg1reg, CpuVU0);
+		xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
+		_cop2RestoreRegs();
+		skip.SetTarget();
+	}
+}
+
+// Syncs VU0 before a macro-mode transfer touching the given register, unless
+// the in-flight program's register-touch masks prove the access can't
+// conflict. Pass vfReg/viReg as -1 when the transfer doesn't use that file;
+// control registers (vi16+) always sync, as do interpreter-run programs
+// (prog.cur is null for those).
+static void COP2_SyncVU0(bool interlocked, bool mBitSync, int vfReg, int viReg)
+{
+	xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
+	xForwardJZ32 skipvuidle;
+
+	if (doCOP2DepElim && ((vfReg > 0) || ((viReg > 0) && (viReg < 16))))
+	{
+		const sptr touchOff  = (vfReg > 0) ? offsetof(microProgram, vfTouch) : offsetof(microProgram, viTouch);
+		const u32  touchMask = 1 << ((vfReg > 0) ? vfReg : viReg);
+		xMOV(rax, ptrNative[&microVU0.prog.cur]);
+		xCMP(rax, 0);
+		xForwardJZ8 runSync;
+		xTEST(ptr32[rax + touchOff], touchMask);
+		xForwardJZ32 noConflict;
+		runSync.SetTarget();
+		COP2_EmitSync(interlocked, mBitSync);
+		noConflict.SetTarget();
+	}
+	else
+		COP2_EmitSync(interlocked, mBitSync);
+
+	skipvuidle.SetTarget();
+}
+
+void COP2_Interlock(bool mBitSync, int vfReg = -1, int viReg = -1)
+{
+
+	if (cpuRegs.code & 1)
+	{
+		_freeX86reg(eax);
+		xMOV(eax, ptr32[&cpuRegs.cycle]);
+		xADD(eax, scaleblockcycles_clear());
+		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
+
+		COP2_SyncVU0(true, mBitSync, vfReg, viReg);
 	}
 }
 
@@ -359,7 +410,7 @@ static void recCFC2()
 {
 	printCOP2("CFC2");
 
-	COP2_Interlock(false);
+	COP2_Interlock(false, -1, _Rd_);
 
 	if (!_Rt_)
 		return;
@@ -371,18 +422,7 @@ static void recCFC2()
 		xADD(eax, scaleblockcycles_clear());
 		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
 
-		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-		xForwardJZ32 skipvuidle;
-		xSUB(eax, ptr32[&VU0.cycle]);
-		xSUB(eax, ptr32[&VU0.nextBlockCycles]);
-		xCMP(eax, EmuConfig.Gamefixes.VUKickstartHack ? 8 : 0);
-		xForwardJL32 skip;
-		_cop2BackupRegs();
-		xLoadFarAddr(arg1reg, CpuVU0);
-		xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
-		_cop2RestoreRegs();
-		skip.SetTarget();
-		skipvuidle.SetTarget();
+		COP2_SyncVU0(false, false, -1, _Rd_);
 	}
 
 	_flushEEreg(_Rt_, true);
@@ -421,7 +461,7 @@ static void recCTC2()
 {
 	printCOP2("CTC2");
 
-	COP2_Interlock(1);
+	COP2_Interlock(1, -1, _Rd_);
 
 	if (!_Rd_)
 		return;
@@ -433,18 +473,7 @@ static void recCTC2()
 		xADD(eax, scaleblockcycles_clear());
 		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
 
-		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-		xForwardJZ32 skipvuidle;
-		xSUB(eax, ptr32[&VU0.cycle]);
-		xSUB(eax, ptr32[&VU0.nextBlockCycles]);
-		xCMP(eax, EmuConfig.Gamefixes.VUKickstartHack ? 8 : 0);
-		xForwardJL32 skip;
-		_cop2BackupRegs();
-		xLoadFarAddr(arg1reg, CpuVU0);
-		xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
-		_cop2RestoreRegs();
-		skip.SetTarget();
-		skipvuidle.SetTarget();
+		COP2_SyncVU0(false, false, -1, _Rd_);
 	}
 
 	_flushEEreg(_Rt_);
@@ -523,11 +552,11 @@ static void recQMFC2()
 
 	printCOP2("QMFC2");
 
-	COP2_Interlock(false);
+	COP2_Interlock(false, _Rd_, -1);
 
 	if (!_Rt_)
 		return;
-	
+
 	if (!(cpuRegs.code & 1))
 	{
 		_freeX86reg(eax);
@@ -535,18 +564,7 @@ static void recQMFC2()
 		xADD(eax, scaleblockcycles_clear());
 		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
 
-		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-		xForwardJZ32 skipvuidle;
-		xSUB(eax, ptr32[&VU0.cycle]);
-		xSUB(eax, ptr32[&VU0.nextBlockCycles]);
-		xCMP(eax, EmuConfig.Gamefixes.VUKickstartHack ? 8 : 0);
-		xForwardJL32 skip;
-		_cop2BackupRegs();
-		xLoadFarAddr(arg1reg, CpuVU0);
-		xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
-		_cop2RestoreRegs();
-		skip.SetTarget();
-		skipvuidle.SetTarget();
+		COP2_SyncVU0(false, false, _Rd_, -1);
 	}
 
 	int rtreg = _allocGPRtoXMMreg(-1, _Rt_, MODE_WRITE);
@@ -563,11 +581,11 @@ static void recQMFC2()
 static void recQMTC2()
 {
 	printCOP2("QMTC2");
-	COP2_Interlock(true);
+	COP2_Interlock(true, _Rd_, -1);
 
 	if (!_Rd_)
 		return;
-	
+
 	if (!(cpuRegs.code & 1))
 	{
 		_freeX86reg(eax);
@@ -575,18 +593,7 @@ static void recQMTC2()
 		xADD(eax, scaleblockcycles_clear());
 		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
 
-		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-		xForwardJZ32 skipvuidle;
-		xSUB(eax, ptr32[&VU0.cycle]);
-		xSUB(eax, ptr32[&VU0.nextBlockCycles]);
-		xCMP(eax, EmuConfig.Gamefixes.VUKickstartHack ? 8 : 0);
-		xForwardJL32 skip;
-		_cop2BackupRegs();
-		xLoadFarAddr(arg1reg, CpuVU0);
-		xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
-		_cop2RestoreRegs();
-		skip.SetTarget();
-		skipvuidle.SetTarget();
+		COP2_SyncVU0(false, false, _Rd_, -1);
 	}
 
 	int rtreg = _allocGPRtoXMMreg(-1, _Rt_, MODE_READ);
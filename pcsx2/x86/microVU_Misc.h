@@ -251,6 +251,9 @@ typedef u32(__fastcall* mVUCall)(void*, void*);
 #define aWrap(x, m)  ((x > m) ? 0 : x)
 #define shuffleSS(x) ((x == 1) ? (0x27) : ((x == 2) ? (0xc6) : ((x == 4) ? (0xe1) : (0xe4))))
 #define clampE       CHECK_VU_EXTRA_OVERFLOW
+// Effective clampE for the program being compiled; cop2 macro mode has no
+// program context so it always gets the clamps (see doClampSpec below)
+#define clampEprog   (clampE && (mVU.cop2 || !doClampSpec || mVUcurProg.needsClamp))
 #define varPrint(x)  DevCon.WriteLn(#x " = %d", (int)x)
 #define islowerOP    ((iPC & 1) == 0)
 
@@ -305,6 +308,40 @@ static const bool doRegAlloc = true; // Set to false to flush every 32bit Instru
 // Lower and Upper instructions, so in this case it flushes after the full
 // 64bit instruction (lower and upper)
 
+// Cross-Block Register Caching
+static const bool doBlockRegLink = true; // Set to false to flush all xmm regs on block boundaries
+// Keeps clean VF regs cached in xmm registers across statically linked blocks
+// (branches and constant jumps). The entry mapping becomes part of the block's
+// pipeline-state key, so a block is only reused when its predecessor left the
+// same registers cached. Indirect jumps and entries from the dispatcher always
+// start with an empty mapping since they pass through C code.
+
+// Speculative Clamp Compilation
+static const bool doClampSpec = true; // Set to false to always clamp when extra overflow is enabled
+// When extra overflow clamping is enabled, each microprogram is first compiled
+// without the extra clamps. If an Inf/NaN then escapes into the VF registers
+// or ACC at microprogram exit (see mVUcheckClampEscape), the program is flagged
+// and its blocks are scrapped so it gets recompiled with the clamps. Games that
+// need the extra clamping usually need it for a few programs, not all of them.
+
+// Dead Status Flag Elimination
+static const bool doDeadFlagElim = true; // Set to false to only skip flag updates via the config hack
+// Programs whose micro memory snapshot contains no status flag reader
+// (FSEQ/FSAND/FSOR) get the status flag speedhack applied automatically: the
+// program itself can't observe the skipped updates, and the trailing-block
+// logic in mVUsetFlags still materializes them where a linked block needs an
+// exact match. The residual risk is the same as the config hack's (a later
+// program reading sticky bits the eliminated updates would have set), but
+// scoped to programs that were proven not to read flags themselves.
+
+// COP2 Dependency Elimination
+static const bool doCOP2DepElim = true; // Set to false to always sync VU0 on macro-mode transfers
+// The COP2 transfer recs (CFC2/CTC2/QMFC2/QMTC2) test the in-flight VU0
+// program's register-touch masks (computed when the program is cached) and
+// skip the interlock/kickstart sync when the transferred register provably
+// can't conflict. Control registers (vi16+) and interpreter-run programs
+// always sync.
+
 // No Flag Optimizations
 static const bool noFlagOpts = false; // Set to true to disable all flag setting optimizations
 // Note: The flag optimizations this disables should all be harmless, so
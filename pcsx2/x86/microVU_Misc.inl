@@ -465,7 +465,7 @@ void ADD_SS_TriAceHack(microVU& mVU, const xmm& to, const xmm& from)
 		mVUclamp3(mVU, to, t1, (isPS) ? 0xf : 0x8); \
 		mVUclamp3(mVU, from, t1, (isPS) ? 0xf : 0x8); \
 		opX(to, from); \
-		mVUclamp4(to, t1, (isPS) ? 0xf : 0x8); \
+		mVUclamp4(mVU, to, t1, (isPS) ? 0xf : 0x8); \
 	} while (0)
 
 void SSE_MAXPS(mV, const xmm& to, const xmm& from, const xmm& t1 = xEmptyReg, const xmm& t2 = xEmptyReg)
@@ -578,9 +578,16 @@ void mVUcustomSearch()
 	xPCMP.EQD(xmm7, ptr32[arg2reg + 0x90]);
 	xPAND    (xmm6, xmm7);
 
+	xMOVAPS  (xmm1, ptr32[arg1reg + 0xa0]);
+	xPCMP.EQD(xmm1, ptr32[arg2reg + 0xa0]);
+	xMOVAPS  (xmm3, ptr32[arg1reg + 0xb0]);
+	xPCMP.EQD(xmm3, ptr32[arg2reg + 0xb0]);
+	xPAND    (xmm1, xmm3);
+
 	xPAND (xmm0, xmm2);
 	xPAND (xmm4, xmm6);
 	xPAND (xmm0, xmm4);
+	xPAND (xmm0, xmm1);
 	xMOVMSKPS(eax, xmm0);
 
 	exitPoint.SetTarget();
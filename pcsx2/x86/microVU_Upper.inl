@@ -197,7 +197,7 @@ static void setupFtReg(microVU& mVU, xmm& Ft, xmm& tempFt, int opCase)
 	opCase1
 	{
 		if (_XYZW_SS2)   { Ft = mVU.regAlloc->allocReg(_Ft_, 0, _X_Y_Z_W); tempFt = Ft; }
-		else if (clampE) { Ft = mVU.regAlloc->allocReg(_Ft_, 0, 0xf);      tempFt = Ft; }
+		else if (clampEprog) { Ft = mVU.regAlloc->allocReg(_Ft_, 0, 0xf);      tempFt = Ft; }
 		else             { Ft = mVU.regAlloc->allocReg(_Ft_);              tempFt = xEmptyReg; }
 	}
 	opCase2
@@ -215,7 +215,7 @@ static void setupFtReg(microVU& mVU, xmm& Ft, xmm& tempFt, int opCase)
 	}
 	opCase4
 	{
-		if (!clampE && _XYZW_SS && !mVUinfo.readQ)
+		if (!clampEprog && _XYZW_SS && !mVUinfo.readQ)
 		{
 			Ft = xmmPQ;
 			tempFt = xEmptyReg;
@@ -317,8 +317,13 @@ static void mVU_FMACb(microVU& mVU, int recPass, int opCase, int opType, microOp
 		else
 		{
 			const xmm& tempACC = mVU.regAlloc->allocReg();
-			xMOVAPS(tempACC, ACC);
-			SSE_PS[opType](mVU, tempACC, Fs, tempFt, xEmptyReg);
+			if (x86caps.hasAVX && !clampEprog) // Non-destructive form folds the ACC copy away (plain add/sub when not clamping)
+				((opType == 1) ? xVSUB : xVADD).PS(tempACC, ACC, Fs);
+			else
+			{
+				xMOVAPS(tempACC, ACC);
+				SSE_PS[opType](mVU, tempACC, Fs, tempFt, xEmptyReg);
+			}
 			mVUmergeRegs(ACC, tempACC, _X_Y_Z_W);
 			mVUupdateFlags(mVU, ACC, Fs, tempFt);
 			mVU.regAlloc->clearNeeded(tempACC);
@@ -488,14 +493,24 @@ static void mVU_FTOIx(mP, const float* addr, microOpcode opEnum)
 		const xmm& t2 = mVU.regAlloc->allocReg();
 
 		// Note: For help understanding this algorithm see recVUMI_FTOI_Saturate()
-		xMOVAPS(t1, Fs);
+		if (x86caps.hasAVX)
+			xVPXOR(t1, Fs, ptr128[mVUglob.signbit]);
+		else
+		{
+			xMOVAPS(t1, Fs);
+			xPXOR(t1, ptr128[mVUglob.signbit]);
+		}
 		if (addr)
 			xMUL.PS(Fs, ptr128[addr]);
 		xCVTTPS2DQ(Fs, Fs);
-		xPXOR(t1, ptr128[mVUglob.signbit]);
 		xPSRA.D(t1, 31);
-		xMOVAPS(t2, Fs);
-		xPCMP.EQD(t2, ptr128[mVUglob.signbit]);
+		if (x86caps.hasAVX)
+			xVPCMPEQD(t2, Fs, ptr128[mVUglob.signbit]);
+		else
+		{
+			xMOVAPS(t2, Fs);
+			xPCMP.EQD(t2, ptr128[mVUglob.signbit]);
+		}
 		xAND.PS(t1, t2);
 		xPADD.D(Fs, t1);
 
@@ -551,8 +566,13 @@ mVUop(mVU_CLIP)
 		xSHL(gprT1, 6);
 
 		xAND.PS(Ft, ptr128[mVUglob.absclip]);
-		xMOVAPS(t1, Ft);
-		xPOR(t1, ptr128[mVUglob.signbit]);
+		if (x86caps.hasAVX)
+			xVPOR(t1, Ft, ptr128[mVUglob.signbit]);
+		else
+		{
+			xMOVAPS(t1, Ft);
+			xPOR(t1, ptr128[mVUglob.signbit]);
+		}
 
 		xCMPNLE.PS(t1, Fs); // -w, -z, -y, -x
 		xCMPLT.PS(Ft, Fs);  // +w, +z, +y, +x
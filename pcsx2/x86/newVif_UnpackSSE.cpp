@@ -30,6 +30,12 @@ static const __aligned16 u32 SSEXYZWMask[4][4] =
 	{0x00000000, 0xffffffff, 0xffffffff, 0xffffffff}
 };
 
+// Keeps the low byte of each dword, used by the V4-5 unpack
+static const __aligned16 u32 SSEByteMask[4] =
+{
+	0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff
+};
+
 //static __pagealigned u8 nVifUpkExec[__pagesize*4];
 static RecompiledCodeReserve* nVifUpkExec = NULL;
 
@@ -257,8 +263,7 @@ void VifUnpackSSE_Base::xUPK_V4_5() const
 	xPSRL.D     (workReg, 8);           // A
 	xPSLL.D     (workReg, 7);           // A.0000000
 	mVUmergeRegs(destReg, workReg, 0x1);// A|B|G|R
-	xPSLL.D     (destReg, 24); // can optimize to
-	xPSRL.D     (destReg, 24); // single AND...
+	xAND.PS     (destReg, ptr128[SSEByteMask]); // clear the garbage above each byte
 }
 
 void VifUnpackSSE_Base::xUnpack(int upknum) const
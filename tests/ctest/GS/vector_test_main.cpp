@@ -0,0 +1,151 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "GSVector.h"
+#include <gtest/gtest.h>
+#include <climits>
+#include <random>
+#include <string.h>
+
+// Checks the horizontal reduction and masked store helpers against plain
+// scalar references, over lane values picked to straddle the signed/unsigned
+// boundary.
+
+static std::mt19937 rng(42);
+
+static int randInt()
+{
+	// Mix small values with ones that have the sign bit set
+	return (int)(rng() >> (rng() % 24));
+}
+
+TEST(GSVector4i, HorizontalOps)
+{
+	for (int trial = 0; trial < 1000; trial++)
+	{
+		int v[4] = {randInt(), randInt(), randInt(), randInt()};
+
+		GSVector4i a(v[0], v[1], v[2], v[3]);
+
+		int sum = v[0] + v[1] + v[2] + v[3];
+		int mini = std::min(std::min(v[0], v[1]), std::min(v[2], v[3]));
+		int maxi = std::max(std::max(v[0], v[1]), std::max(v[2], v[3]));
+		uint32 minu = std::min(std::min((uint32)v[0], (uint32)v[1]), std::min((uint32)v[2], (uint32)v[3]));
+		uint32 maxu = std::max(std::max((uint32)v[0], (uint32)v[1]), std::max((uint32)v[2], (uint32)v[3]));
+
+		ASSERT_EQ(a.hadd32().extract32<0>(), v[0] + v[1]);
+		ASSERT_EQ(a.hadd32().extract32<1>(), v[2] + v[3]);
+
+		// All lanes must hold the reduced value
+		for (int i = 0; i < 4; i++)
+		{
+			ASSERT_EQ(a.hsum32().u32[i], (uint32)sum);
+			ASSERT_EQ(a.hmin_i32().i32[i], mini);
+			ASSERT_EQ(a.hmax_i32().i32[i], maxi);
+			ASSERT_EQ(a.hmin_u32().u32[i], minu);
+			ASSERT_EQ(a.hmax_u32().u32[i], maxu);
+		}
+	}
+}
+
+TEST(GSVector4i, MaskStore32)
+{
+	for (int trial = 0; trial < 1000; trial++)
+	{
+		int v[4] = {randInt(), randInt(), randInt(), randInt()};
+		int old[4] = {randInt(), randInt(), randInt(), randInt()};
+		int sel[4] = {(int)(rng() & 1), (int)(rng() & 1), (int)(rng() & 1), (int)(rng() & 1)};
+
+		alignas(16) int mem[4];
+		memcpy(mem, old, sizeof(mem));
+
+		GSVector4i a(v[0], v[1], v[2], v[3]);
+		GSVector4i mask(-sel[0], -sel[1], -sel[2], -sel[3]);
+
+		a.maskstore32(mem, mask);
+
+		for (int i = 0; i < 4; i++)
+			ASSERT_EQ(mem[i], sel[i] ? v[i] : old[i]);
+	}
+}
+
+#if _M_SSE >= 0x501
+
+TEST(GSVector8i, HorizontalOps)
+{
+	for (int trial = 0; trial < 1000; trial++)
+	{
+		int v[8];
+		int sum = 0;
+		int mini = INT_MAX;
+		int maxi = INT_MIN;
+		uint32 minu = UINT_MAX;
+		uint32 maxu = 0;
+
+		for (int i = 0; i < 8; i++)
+		{
+			v[i] = randInt();
+			sum += v[i];
+			mini = std::min(mini, v[i]);
+			maxi = std::max(maxi, v[i]);
+			minu = std::min(minu, (uint32)v[i]);
+			maxu = std::max(maxu, (uint32)v[i]);
+		}
+
+		GSVector8i a(GSVector4i(v[0], v[1], v[2], v[3]), GSVector4i(v[4], v[5], v[6], v[7]));
+
+		// vphaddd stays within each 128-bit half
+		ASSERT_EQ(a.hadd32().extract32<0>(), v[0] + v[1]);
+		ASSERT_EQ(a.hadd32().extract32<4>(), v[4] + v[5]);
+
+		for (int i = 0; i < 8; i++)
+		{
+			ASSERT_EQ(a.hsum32().u32[i], (uint32)sum);
+			ASSERT_EQ(a.hmin_i32().i32[i], mini);
+			ASSERT_EQ(a.hmax_i32().i32[i], maxi);
+			ASSERT_EQ(a.hmin_u32().u32[i], minu);
+			ASSERT_EQ(a.hmax_u32().u32[i], maxu);
+		}
+	}
+}
+
+TEST(GSVector8i, MaskStore32)
+{
+	for (int trial = 0; trial < 1000; trial++)
+	{
+		int v[8], old[8], sel[8];
+
+		alignas(32) int mem[8];
+
+		for (int i = 0; i < 8; i++)
+		{
+			v[i] = randInt();
+			old[i] = randInt();
+			sel[i] = (int)(rng() & 1);
+			mem[i] = old[i];
+		}
+
+		GSVector8i a(GSVector4i(v[0], v[1], v[2], v[3]), GSVector4i(v[4], v[5], v[6], v[7]));
+		GSVector8i mask(GSVector4i(-sel[0], -sel[1], -sel[2], -sel[3]), GSVector4i(-sel[4], -sel[5], -sel[6], -sel[7]));
+
+		a.maskstore32(mem, mask);
+
+		for (int i = 0; i < 8; i++)
+			ASSERT_EQ(mem[i], sel[i] ? v[i] : old[i]);
+	}
+}
+
+#endif
@@ -0,0 +1,76 @@
+#!/usr/bin/perl
+
+use strict;
+use warnings;
+
+use Getopt::Long;
+
+sub help {
+    my $msg = << 'EOS';
+
+    The script run_benchmark.pl drives PCSX2's built-in benchmark mode
+    (--bench) for performance bisection: it replays a fixed workload and
+    prints per-repetition fps with a per-subsystem frame-time breakdown.
+
+    Mandatory Option
+        --exe <STRING>          : the PCSX2 binary that you want to benchmark
+        --iso <STRING>          : the game image to boot
+
+    Optional Option
+        --state <STRING>        : savestate to load once the game has booted
+        --play <STRING>         : input recording to replay after boot
+        --frames=600            : frames per repetition
+        --reps=5                : number of repetitions (one warmup rep is added)
+        --cfg <STRING>          : configuration folder to use (--cfgpath)
+        --timeout=600           : kill the run after this many seconds
+
+    Typical bisect usage: same --iso/--state/--frames on each revision, then
+    compare the final "Benchmark: <fps> +/- <stddev>" lines.
+
+EOS
+    print $msg;
+
+    exit
+}
+
+my ($exe, $iso, $state, $play, $cfg);
+my $frames  = 600;
+my $reps    = 5;
+my $timeout = 600;
+my $status = GetOptions(
+    'exe=s'     => \$exe,
+    'iso=s'     => \$iso,
+    'state=s'   => \$state,
+    'play=s'    => \$play,
+    'cfg=s'     => \$cfg,
+    'frames=i'  => \$frames,
+    'reps=i'    => \$reps,
+    'timeout=i' => \$timeout,
+);
+
+help() unless ($status and defined $exe and defined $iso);
+
+my @cmd = ($exe, $iso, "--nogui", "--console", "--bench=$frames", "--benchreps=$reps");
+push(@cmd, "--state=$state")  if (defined $state);
+push(@cmd, "--play=$play")    if (defined $play);
+push(@cmd, "--cfgpath=$cfg")  if (defined $cfg);
+
+print "EXEC: @cmd\n";
+
+my $pid = fork();
+if ($pid == 0) {
+    exec(@cmd);
+    die "failed to exec $exe";
+}
+
+local $SIG{ALRM} = sub {
+    print "ERROR: timeout after ${timeout}s, killing pid $pid\n";
+    kill 'KILL', $pid;
+    waitpid($pid, 0);
+    exit 1;
+};
+alarm $timeout;
+waitpid($pid, 0);
+alarm 0;
+
+exit($? >> 8);